@@ -0,0 +1,60 @@
+# RAM cost vs cycle savings of the hot function list.
+#
+# Usage: arm-none-eabi-nm -S <elf> | awk -f code_ram_report.awk <list> -
+
+function hex2dec(h,    i, n, c)
+{
+    n = 0
+    h = tolower(h)
+    for (i = 1; i <= length(h); i++)
+    {
+        c = index("0123456789abcdef", substr(h, i, 1)) - 1
+        n = n * 16 + c
+    }
+    return n
+}
+
+# Hot function list
+FNR == NR {
+    sub(/#.*/, "")
+    if (NF > 0)
+    {
+        order[++count] = $1
+        flash[$1] = (NF > 1) ? $2 : "-"
+        ram[$1] = (NF > 2) ? $3 : "-"
+    }
+    next
+}
+
+# nm -S: address size type name
+NF == 4 && $3 ~ /^[tTwW]$/ && ($4 in flash) {
+    bytes[$4] += hex2dec($2)
+    where[$4] = (hex2dec($1) >= hex2dec("1fff8000")) ? "RAM" : "flash"
+    next
+}
+
+NF >= 3 && $NF == "__code_ram_start__" { code_start = hex2dec($1) }
+NF >= 3 && $NF == "__code_ram_end__"   { code_end = hex2dec($1) }
+
+END {
+    printf "%-32s %6s %5s %7s %7s %7s %9s\n", "function", "bytes", "mem", "flash", "ram", "saved", "saved/KB"
+    for (i = 1; i <= count; i++)
+    {
+        f = order[i]
+        saved = "-"
+        per_kb = "-"
+        if ((f in where) && (flash[f] != "-") && (ram[f] != "-"))
+        {
+            saved = flash[f] - ram[f]
+            total_saved += saved
+            if (bytes[f] > 0)
+            {
+                per_kb = sprintf("%.1f", saved * 1024 / bytes[f])
+            }
+        }
+        printf "%-32s %6d %5s %7s %7s %7s %9s\n", f, bytes[f], (f in where) ? where[f] : "gone", flash[f], ram[f], saved, per_kb
+        total_bytes += bytes[f]
+    }
+    printf "listed functions: %d bytes, %d cycles saved (one call each)\n", total_bytes, total_saved
+    printf ".code in RAM (incl. RAMSECTION drivers, veneers): %d bytes\n", code_end - code_start
+}
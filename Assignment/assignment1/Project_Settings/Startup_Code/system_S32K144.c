@@ -92,6 +92,19 @@ void SystemInit(void)
 
   /* Configure timeout */
   IP_WDOG->TOVAL = (uint32_t )0xFFFF;
+#else
+  /* Keep the WDOG running from LPO but stretch the reset timeout (1024 LPO
+   * cycles, about 8 ms) to the maximum, so the C runtime init cannot trip it.
+   * UPDATE stays set: WDOG_Init() installs the application configuration. */
+  IP_WDOG->CNT = (uint32_t ) FEATURE_WDOG_UNLOCK_VALUE;
+  (void)IP_WDOG->CNT;
+
+  IP_WDOG->CS  = (uint32_t ) ( (1UL << WDOG_CS_CMD32EN_SHIFT)                       |
+                            (FEATURE_WDOG_CLK_FROM_LPO << WDOG_CS_CLK_SHIFT)     |
+                            (1U << WDOG_CS_EN_SHIFT)                             |
+                            (1U << WDOG_CS_UPDATE_SHIFT)                         );
+
+  IP_WDOG->TOVAL = (uint32_t )0xFFFF;
 #endif /* (DISABLE_WDOG) */
 
 /**************************************************************************/
@@ -99,7 +112,7 @@ void SystemInit(void)
 /**************************************************************************/
 #if defined(I_CACHE) && (ICACHE_ENABLE == 1)
   /* Invalidate and enable code cache */
-  LMEM->PCCCR = LMEM_PCCCR_INVW0(1) | LMEM_PCCCR_INVW1(1) | LMEM_PCCCR_GO(1) | LMEM_PCCCR_ENCACHE(1);
+  IP_LMEM->PCCCR = LMEM_PCCCR_INVW0(1) | LMEM_PCCCR_INVW1(1) | LMEM_PCCCR_GO(1) | LMEM_PCCCR_ENCACHE(1);
 #endif /* defined(I_CACHE) && (ICACHE_ENABLE == 1) */
 }
 
@@ -0,0 +1,130 @@
+/**
+ * @file Driver_CRC.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief CRC module driver for S32K144 with eDMA feed and software fallback.
+ * @version 0.1
+ * @date 2025-10-24
+ *
+ * The CRC module computes 16- or 32-bit CRCs over any polynomial. The driver
+ * maps a crc_config_t (see crc_sw.h) onto GPOLY/CTRL, streams data with the
+ * widest aligned writes, or lets an eDMA channel push the bulk of a buffer.
+ *
+ * The module holds one running computation, so it is owned between
+ * CRC_Init() and CRC_Release(). CRC_Compute() falls back to the slice-by-N
+ * software tables when somebody else owns it.
+ */
+
+#ifndef DRIVER_CRC_H_
+#define DRIVER_CRC_H_
+
+#include "Driver_Common.h"
+#include "crc_sw.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Bytes moved per eDMA minor loop (eight 32-bit writes to DATA) */
+#define CRC_DMA_MINOR_BYTES     32U
+
+/**
+ * @brief CRC driver status codes.
+ *
+ * CRC_STATUS_SUCCESS  Operation completed successfully.
+ * CRC_STATUS_ERROR    Invalid parameter.
+ * CRC_STATUS_BUSY     Module owned by another computation or eDMA still running.
+ */
+typedef enum
+{
+    CRC_STATUS_SUCCESS = 0,
+    CRC_STATUS_ERROR = -1,
+    CRC_STATUS_BUSY = -2
+} CRC_STATUS_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Take the module and start a new computation.
+ *
+ * Enables the clock, programs polynomial, transposition and seed.
+ *
+ * @param config Algorithm parameters.
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY if already owned.
+ */
+CRC_STATUS_t CRC_Init(const crc_config_t *config);
+
+/**
+ * @brief Feed bytes through the CPU.
+ *
+ * Unaligned head and tail bytes use 8-bit writes, the rest 32-bit writes.
+ *
+ * @param data Input bytes.
+ * @param len Number of bytes.
+ * @return CRC_STATUS_t SUCCESS, ERROR if not owned or BUSY during eDMA.
+ */
+CRC_STATUS_t CRC_Update(const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Feed bytes with an eDMA channel.
+ *
+ * The channel is routed to an always-enabled DMAMUX source and moves
+ * CRC_DMA_MINOR_BYTES per minor loop, so other channels still get arbitrated
+ * between bursts. Head/tail bytes that do not fill a burst are written by the
+ * CPU from CRC_IsDmaDone(). data must stay valid until then.
+ *
+ * @param channel eDMA channel (0..15).
+ * @param data Input bytes.
+ * @param len Number of bytes (up to 0x7FFF bursts).
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY.
+ */
+CRC_STATUS_t CRC_UpdateDma(uint8_t channel, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Poll an eDMA feed and finish the remaining bytes once it completes.
+ *
+ * @return bool true when no eDMA feed is pending.
+ */
+bool CRC_IsDmaDone(void);
+
+/**
+ * @brief Read the CRC of everything fed so far.
+ *
+ * Does not end the computation; more data can still be added.
+ */
+uint32_t CRC_GetResult(void);
+
+/**
+ * @brief Give the module back.
+ */
+void CRC_Release(void);
+
+/**
+ * @brief Check whether the module is owned.
+ */
+bool CRC_IsBusy(void);
+
+/**
+ * @brief One-shot CRC of a buffer on the module, or in software if it is owned.
+ *
+ * @param config Algorithm parameters for the module.
+ * @param fallback Software tables for the same algorithm, or NULL to fail with BUSY.
+ * @param data Input bytes.
+ * @param len Number of bytes.
+ * @param result Computed CRC.
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY.
+ */
+CRC_STATUS_t CRC_Compute(const crc_config_t *config, const crc_sw_table_t *fallback,
+                         const uint8_t *data, uint32_t len, uint32_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_CRC_H_ */
@@ -0,0 +1,145 @@
+/**
+ * @file Driver_EDMA.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Minimal eDMA/DMAMUX channel helper for S32K144.
+ * @version 0.1
+ * @date 2025-10-20
+ *
+ * Provides the small subset of eDMA needed by peripheral drivers: route a
+ * DMAMUX request to a channel, program one TCD and query the channel progress.
+ * Transfers are described by edma_transfer_config_t and committed with one call.
+ */
+
+#ifndef DRIVER_EDMA_H_
+#define DRIVER_EDMA_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Number of eDMA channels available on S32K144 */
+#define EDMA_CHANNEL_NUMS       16U
+
+/**
+ * @brief eDMA driver status codes.
+ *
+ * EDMA_STATUS_SUCCESS  Operation completed successfully.
+ * EDMA_STATUS_ERROR    Invalid parameter (channel, size or count out of range).
+ */
+typedef enum
+{
+    EDMA_STATUS_SUCCESS = 0,
+    EDMA_STATUS_ERROR = -1
+} EDMA_STATUS_t;
+
+/**
+ * @brief Transfer size per read/write (ATTR SSIZE/DSIZE encoding).
+ */
+typedef enum
+{
+    EDMA_SIZE_1_BYTE = 0U,
+    EDMA_SIZE_2_BYTES = 1U,
+    EDMA_SIZE_4_BYTES = 2U,
+    EDMA_SIZE_16_BYTES = 4U,
+    EDMA_SIZE_32_BYTES = 5U
+} EDMA_TRANSFER_SIZE_t;
+
+/**
+ * @brief Description of a single TCD.
+ *
+ * One minor loop moves minor_bytes; the channel runs major_count minor loops.
+ * src_last/dst_last are applied after the major loop (used to build rings).
+ * When loop is set the channel stays enabled after the major loop completes
+ * (DREQ = 0), so a peripheral can stream forever into a circular buffer.
+ */
+typedef struct
+{
+    uint32_t src_addr;
+    uint32_t dst_addr;
+    int16_t src_offset;
+    int16_t dst_offset;
+    EDMA_TRANSFER_SIZE_t src_size;
+    EDMA_TRANSFER_SIZE_t dst_size;
+    uint32_t minor_bytes;
+    uint16_t major_count;
+    int32_t src_last;
+    int32_t dst_last;
+    bool int_major;
+    bool int_half;
+    bool loop;
+} edma_transfer_config_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Route a DMAMUX request source to an eDMA channel.
+ *
+ * Enables the DMAMUX clock through PCC, then writes CHCFG with the source and
+ * ENBL bit in one store. Pass EDMA_REQ_DISABLED (0) to detach the channel.
+ *
+ * @param channel eDMA channel (0..15).
+ * @param source DMAMUX request source (dma_request_source_t value).
+ * @return EDMA_STATUS_t SUCCESS or ERROR on invalid channel.
+ */
+EDMA_STATUS_t EDMA_SetChannelSource(uint8_t channel, uint8_t source);
+
+/**
+ * @brief Program the channel TCD from a transfer description.
+ *
+ * The channel request is disabled while the TCD is rewritten; it is not
+ * re-enabled here (see EDMA_StartChannel).
+ *
+ * @param channel eDMA channel (0..15).
+ * @param config Transfer description, must not be NULL.
+ * @return EDMA_STATUS_t SUCCESS or ERROR on invalid parameter.
+ */
+EDMA_STATUS_t EDMA_ConfigTransfer(uint8_t channel, const edma_transfer_config_t *config);
+
+/**
+ * @brief Enable hardware requests for a channel (SERQ).
+ */
+void EDMA_StartChannel(uint8_t channel);
+
+/**
+ * @brief Disable hardware requests for a channel (CERQ).
+ */
+void EDMA_StopChannel(uint8_t channel);
+
+/**
+ * @brief Issue a software start for a channel (SSRT), e.g. memory-to-memory.
+ */
+void EDMA_TriggerChannel(uint8_t channel);
+
+/**
+ * @brief Check and clear the DONE flag of a channel.
+ *
+ * @return bool true if the major loop completed since the last call.
+ */
+bool EDMA_IsChannelDone(uint8_t channel);
+
+/**
+ * @brief Return the current destination address of a channel.
+ *
+ * Used by ring consumers to derive the producer index without an interrupt.
+ */
+uint32_t EDMA_GetDestAddress(uint8_t channel);
+
+/**
+ * @brief Return the remaining minor loop count (CITER) of a channel.
+ */
+uint16_t EDMA_GetRemainingMajorCount(uint8_t channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_EDMA_H_ */
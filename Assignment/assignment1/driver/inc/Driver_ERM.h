@@ -0,0 +1,147 @@
+/**
+ * @file Driver_ERM.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief SRAM ECC error counters (ERM), EIM error injection and the ECC
+ *        initialisation of the free RAM by eDMA.
+ * @version 0.1
+ * @date 2025-11-10
+ *
+ * With START_FROM_FLASH the startup code initialises the ECC of the RAM the
+ * image uses and of the stack with the CPU, then starts eDMA channel
+ * ERM_SCRUB_DMA_CHANNEL on the free RAM between heap and stack
+ * (__RAM_DMA_START..__RAM_DMA_END in the linker scripts) and returns without
+ * waiting. The transfer runs while .data/.bss are set up and while main()
+ * brings up SOSC and SPLL; nothing may read that RAM before it is done:
+ *
+ *   SCG_SourceInit(SCG_SOSC_CLK);                 scrub still running
+ *   SCG_SPLL_NormalRun_80Mhz();
+ *   ERM_Init(true);                               waits for the scrub
+ *
+ * The transfer is one minor loop on the highest fixed-priority channel, so
+ * other eDMA channels started before ERM_ScrubWait() returns wait for it.
+ * The channel is free for other use afterwards.
+ *
+ * The ERM reports corrected single-bit and non-correctable errors of SRAM_L
+ * (channel 0) and SRAM_U (channel 1). ERM_Init() counts them per region in
+ * the ERM interrupts, or ERM_Poll() does without interrupts. The ERM holds
+ * one event per region, several errors between two services count once.
+ * A non-correctable error also raises a bus fault on the read that hit it.
+ *
+ * ERM_InjectSingleBit() makes the EIM flip one data bit on a single read of
+ * a word, to exercise the counters and the telemetry path in tests.
+ */
+
+#ifndef DRIVER_ERM_H_
+#define DRIVER_ERM_H_
+
+#include "Driver_Common.h"
+#include "../include/S32K144.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* eDMA channel used by the startup code, see startup_S32K144.S */
+#define ERM_SCRUB_DMA_CHANNEL       15U
+
+/**
+ * @brief ERM driver status codes.
+ *
+ * ERM_STATUS_SUCCESS  Operation completed successfully.
+ * ERM_STATUS_TIMEOUT  The ECC initialisation transfer did not finish.
+ * ERM_STATUS_ERROR    eDMA error on the transfer, or an address outside SRAM.
+ */
+typedef enum
+{
+    ERM_STATUS_SUCCESS = 0,
+    ERM_STATUS_TIMEOUT = -1,
+    ERM_STATUS_ERROR = -2
+} ERM_STATUS_t;
+
+/**
+ * @brief ERM/EIM channels.
+ */
+typedef enum
+{
+    ERM_SRAM_L = 0,
+    ERM_SRAM_U = 1
+} ERM_REGION_t;
+
+/**
+ * @brief Error counters of one SRAM region.
+ *
+ * corrected      Single-bit errors corrected since ERM_Init().
+ * uncorrectable  Non-correctable errors since ERM_Init().
+ * last_address   Address of the last error of either kind, 0 if none.
+ */
+typedef struct
+{
+    uint32_t corrected;
+    uint32_t uncorrectable;
+    uint32_t last_address;
+} erm_stats_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Wait for the ECC initialisation of the free RAM started at reset.
+ *
+ * @return ERM_STATUS_t SUCCESS also when nothing was started (RAM build or
+ *         no free RAM), TIMEOUT or ERROR on an eDMA error.
+ */
+ERM_STATUS_t ERM_ScrubWait(void);
+
+/**
+ * @brief Wait for the ECC initialisation, clear the counters and the ERM
+ *        status, and optionally count in the ERM interrupts.
+ *
+ * @param interrupt true: enable the ERM interrupts and their NVIC lines.
+ * @return ERM_STATUS_t the ERM_ScrubWait() status.
+ */
+ERM_STATUS_t ERM_Init(bool interrupt);
+
+/**
+ * @brief Count and clear the pending ERM events; for use without interrupts.
+ */
+void ERM_Poll(void);
+
+/**
+ * @brief Copy the counters of one region.
+ */
+void ERM_GetStats(ERM_REGION_t region, erm_stats_t *stats);
+
+/**
+ * @brief Corrected single-bit errors of both regions since ERM_Init().
+ */
+uint32_t ERM_GetCorrectedTotal(void);
+
+/**
+ * @brief Reset the counters of both regions.
+ */
+void ERM_ClearStats(void);
+
+/**
+ * @brief Read one SRAM word with one data bit flipped by the EIM.
+ *
+ * Interrupts are masked while the EIM channel is enabled, so only that read
+ * is corrupted; no DMA may read the same SRAM meanwhile. The ERM then
+ * reports a corrected error at address.
+ *
+ * @param address Word-aligned SRAM_L or SRAM_U address.
+ * @param bit Data bit to flip (0..31).
+ * @return ERM_STATUS_t ERROR if the address is not an SRAM word or bit > 31.
+ */
+ERM_STATUS_t ERM_InjectSingleBit(uint32_t address, uint8_t bit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_ERM_H_ */
@@ -0,0 +1,100 @@
+/**
+ * @file Driver_EWM.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief External watchdog monitor (EWM) driver for S32K144.
+ * @version 0.1
+ * @date 2025-11-07
+ *
+ * The EWM asserts EWM_OUT_b (and optionally WDOG_EWM_IRQn) instead of
+ * resetting the MCU, so an external circuit can put the outputs in a safe
+ * state while the WDOG still decides about the reset. Its counter runs from
+ * the LPO clock (SIM_LPOCLKS) divided by prescaler + 1 and must be serviced
+ * between compare_low and compare_high ticks after the previous service.
+ *
+ * CTRL, CMPL, CMPH and CLKPRESCALER are write-once after reset: EWM_Init()
+ * can be called once, only the interrupt enable can change afterwards.
+ */
+
+#ifndef DRIVER_EWM_H_
+#define DRIVER_EWM_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Highest allowed CMPH */
+#define EWM_COMPARE_HIGH_MAX        0xFEU
+
+/**
+ * @brief EWM driver status codes.
+ *
+ * EWM_STATUS_SUCCESS  Operation completed successfully.
+ * EWM_STATUS_ERROR    Invalid configuration, no clock, or already initialised.
+ */
+typedef enum
+{
+    EWM_STATUS_SUCCESS = 0,
+    EWM_STATUS_ERROR = -1
+} EWM_STATUS_t;
+
+/**
+ * @brief EWM configuration.
+ *
+ * prescaler     CLKPRESCALER, the counter runs at LPO / (prescaler + 1).
+ * compare_low   Services before this count assert EWM_OUT_b.
+ * compare_high  Counter value at which EWM_OUT_b asserts, above compare_low
+ *               and at most EWM_COMPARE_HIGH_MAX.
+ * in_enable     Assert EWM_OUT_b on the EWM_IN pin as well.
+ * in_active_high EWM_IN asserts when high instead of low.
+ * interrupt     Raise WDOG_EWM_IRQn when EWM_OUT_b asserts.
+ */
+typedef struct
+{
+    uint8_t prescaler;
+    uint8_t compare_low;
+    uint8_t compare_high;
+    bool in_enable;
+    bool in_active_high;
+    bool interrupt;
+} ewm_config_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Clock the EWM and write its one-time configuration, enabled.
+ *
+ * @return EWM_STATUS_t ERROR for a bad configuration or a second call.
+ */
+EWM_STATUS_t EWM_Init(const ewm_config_t *config);
+
+/**
+ * @brief Service the EWM (0xB4, 0x2C to SERV with interrupts masked).
+ *
+ * Safe from ISRs: the interrupt mask is restored, not cleared.
+ */
+void EWM_Refresh(void);
+
+/**
+ * @brief Enable or disable the interrupt; disabling clears a pending one.
+ */
+void EWM_SetInterrupt(bool enable);
+
+/**
+ * @brief Whether EWM_Init() has enabled the EWM.
+ */
+bool EWM_IsEnabled(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_EWM_H_ */
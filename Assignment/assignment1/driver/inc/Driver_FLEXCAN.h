@@ -0,0 +1,461 @@
+/**
+ * @file Driver_FLEXCAN.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief FlexCAN driver interface for S32K144 (FLEXCAN0..2).
+ * @version 0.1
+ * @date 2025-10-20
+ *
+ * Message-buffer mailboxes with individual acceptance masks, the legacy RX FIFO
+ * with a format-A ID filter table, local-priority TX arbitration and an eDMA
+ * drain of the RX FIFO into a ring of raw frames.
+ *
+ * CAN FD (FLEXCAN0 only) uses 8/16/32/64-byte mailboxes with bit rate switch,
+ * timed by the nominal/data solver FLEXCAN_SolveBitTiming().
+ *
+ * Message buffer layout used by this driver:
+ *  - Classic CAN: 8-byte payload, 16 bytes per MB.
+ *    RX FIFO enabled: MB0..5 are the FIFO engine, the ID filter table follows
+ *    and the first free mailbox is FLEXCAN_GetFirstFreeMb().
+ *    RX FIFO disabled: all mailboxes up to max_mb are free.
+ *  - CAN FD: (2 + payload / 4) words per MB, so 32/21/12/7 mailboxes fit the
+ *    512-byte RAM for 8/16/32/64 bytes (see FLEXCAN_GetMaxMbNums()). The legacy
+ *    RX FIFO is not available.
+ */
+
+#ifndef DRIVER_FLEXCAN_H_
+#define DRIVER_FLEXCAN_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Number of FlexCAN instances on S32K144 */
+#define FLEXCAN_INSTANCE_NUMS           3U
+/* Classic CAN payload size */
+#define FLEXCAN_CLASSIC_PAYLOAD_MAX     8U
+/* CAN FD payload size */
+#define FLEXCAN_PAYLOAD_MAX             64U
+/* Maximum number of RX FIFO ID filter elements (RFFN = 15) */
+#define FLEXCAN_RX_FIFO_FILTER_MAX      128U
+/* Mailboxes occupied by the RX FIFO engine before the filter table */
+#define FLEXCAN_RX_FIFO_MB_NUMS         6U
+
+/**
+ * @brief FlexCAN driver status codes.
+ *
+ * FLEXCAN_STATUS_SUCCESS  Operation completed successfully.
+ * FLEXCAN_STATUS_ERROR    Invalid parameter or unsupported configuration.
+ * FLEXCAN_STATUS_BUSY     Mailbox still owned by the protocol engine.
+ * FLEXCAN_STATUS_TIMEOUT  Module did not enter/leave a mode in time.
+ * FLEXCAN_STATUS_NO_DATA  No frame is pending in the mailbox, FIFO or ring.
+ */
+typedef enum
+{
+    FLEXCAN_STATUS_SUCCESS = 0,
+    FLEXCAN_STATUS_ERROR = -1,
+    FLEXCAN_STATUS_BUSY = -2,
+    FLEXCAN_STATUS_TIMEOUT = -3,
+    FLEXCAN_STATUS_NO_DATA = -4
+} FLEXCAN_STATUS_t;
+
+/**
+ * @brief FlexCAN instance selector.
+ */
+typedef enum
+{
+    FLEXCAN_0 = 0U,
+    FLEXCAN_1,
+    FLEXCAN_2
+} FLEXCAN_INSTANCE_t;
+
+/**
+ * @brief Protocol engine clock source (CTRL1[CLKSRC]).
+ *
+ * FLEXCAN_CLK_SOSCDIV2  Oscillator clock (SOSCDIV2_CLK).
+ * FLEXCAN_CLK_SYS       Peripheral clock (SYS_CLK).
+ */
+typedef enum
+{
+    FLEXCAN_CLK_SOSCDIV2 = 0U,
+    FLEXCAN_CLK_SYS = 1U
+} FLEXCAN_CLK_SOURCE_t;
+
+/**
+ * @brief CAN FD mailbox payload size (FDCTRL[MBDSR0]).
+ */
+typedef enum
+{
+    FLEXCAN_FD_PAYLOAD_8 = 0U,
+    FLEXCAN_FD_PAYLOAD_16 = 1U,
+    FLEXCAN_FD_PAYLOAD_32 = 2U,
+    FLEXCAN_FD_PAYLOAD_64 = 3U
+} FLEXCAN_FD_PAYLOAD_t;
+
+/**
+ * @brief Bit-timing phase the solver targets; each has its own register limits.
+ *
+ * FLEXCAN_PHASE_CLASSIC  CTRL1 fields (classic CAN).
+ * FLEXCAN_PHASE_NOMINAL  CBT extended fields (CAN FD arbitration phase).
+ * FLEXCAN_PHASE_DATA     FDCBT fields (CAN FD data phase, after BRS).
+ */
+typedef enum
+{
+    FLEXCAN_PHASE_CLASSIC = 0U,
+    FLEXCAN_PHASE_NOMINAL,
+    FLEXCAN_PHASE_DATA
+} FLEXCAN_BIT_PHASE_t;
+
+/**
+ * @brief Identifier format.
+ */
+typedef enum
+{
+    FLEXCAN_ID_STD = 0U,
+    FLEXCAN_ID_EXT = 1U
+} FLEXCAN_ID_TYPE_t;
+
+/**
+ * @brief Decoded CAN frame.
+ *
+ * dlc is the DLC code (0..15); the payload length is FLEXCAN_DlcToLength(dlc)
+ * for FD frames and min(dlc, 8) for classic frames. brs is only valid with fd.
+ */
+typedef struct
+{
+    uint32_t id;
+    FLEXCAN_ID_TYPE_t id_type;
+    bool remote;
+    bool fd;
+    bool brs;
+    uint8_t dlc;
+    uint16_t timestamp;
+    uint8_t data[FLEXCAN_PAYLOAD_MAX];
+} flexcan_frame_t;
+
+/**
+ * @brief Raw message buffer image (C/S, ID, two data words) as moved by eDMA.
+ */
+typedef struct
+{
+    uint32_t cs;
+    uint32_t id;
+    uint32_t data[2];
+} flexcan_raw_mb_t;
+
+/**
+ * @brief Nominal bit timing, encoded register field values (real value - 1).
+ *
+ * Bit time = (1 + (propseg + 1) + (pseg1 + 1) + (pseg2 + 1)) time quanta,
+ * time quantum = (presdiv + 1) / f_PE.
+ */
+typedef struct
+{
+    uint8_t presdiv;
+    uint8_t propseg;
+    uint8_t pseg1;
+    uint8_t pseg2;
+    uint8_t rjw;
+} flexcan_timing_t;
+
+/**
+ * @brief Bit timing in real (not encoded) time quanta, as produced by the solver.
+ *
+ * Bit time = 1 + propseg + pseg1 + pseg2 quanta of presdiv PE clocks each.
+ * sample_point is the achieved sample point in permille of the bit time.
+ */
+typedef struct
+{
+    uint16_t presdiv;
+    uint8_t propseg;
+    uint8_t pseg1;
+    uint8_t pseg2;
+    uint8_t rjw;
+    uint16_t sample_point;
+} flexcan_bit_timing_t;
+
+/**
+ * @brief Acceptance filter: a frame is accepted when (frame_id & mask) == (id & mask).
+ *
+ * For RX FIFO elements the mask is the individual mask while the element index
+ * is below FLEXCAN_GetFifoIndividualMaskCount(), RXFGMASK otherwise.
+ */
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;
+    FLEXCAN_ID_TYPE_t id_type;
+} flexcan_id_filter_t;
+
+/**
+ * @brief Module configuration applied by FLEXCAN_Init() in freeze mode.
+ *
+ * max_mb           Number of message buffers in use (1..FEATURE_CANn_MAX_MB_NUM).
+ * rx_fifo          Enable the legacy RX FIFO with the given filter table.
+ * rx_fifo_dma      Serve the RX FIFO by eDMA instead of the BUF5I interrupt.
+ * fifo_filters     ID filter table (8, 16, ... 128 elements, rounded up); an
+ *                  empty table accepts every frame.
+ * fifo_global_mask Raw format-A RXFGMASK value for elements not covered by RXIMR.
+ * local_priority   Use the 3-bit PRIO field ahead of the ID in TX arbitration.
+ * loopback         Internal loopback (self-reception enabled).
+ * fd               Enable ISO CAN FD; nominal/data replace timing and rx_fifo
+ *                  must be false.
+ * fd_payload       Mailbox payload size, bounds max_mb (FLEXCAN_GetMaxMbNums()).
+ * brs              Allow bit rate switching to the data phase timing.
+ */
+typedef struct
+{
+    FLEXCAN_CLK_SOURCE_t clk_src;
+    flexcan_timing_t timing;
+    uint8_t max_mb;
+    bool rx_fifo;
+    bool rx_fifo_dma;
+    const flexcan_id_filter_t *fifo_filters;
+    uint8_t fifo_filter_count;
+    uint32_t fifo_global_mask;
+    bool local_priority;
+    bool loopback;
+    bool fd;
+    FLEXCAN_FD_PAYLOAD_t fd_payload;
+    bool brs;
+    flexcan_bit_timing_t nominal;
+    flexcan_bit_timing_t data;
+} flexcan_config_t;
+
+/**
+ * @brief eDMA ring fed from the RX FIFO output.
+ *
+ * The ring is filled by hardware; rd is the only software-owned index, the
+ * write position is derived from the channel destination address.
+ */
+typedef struct
+{
+    flexcan_raw_mb_t *buf;
+    uint16_t len;
+    uint16_t rd;
+    uint8_t channel;
+} flexcan_dma_ring_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize a FlexCAN instance.
+ *
+ * Gates the clock via PCC, selects the PE clock while disabled, soft-resets,
+ * clears the message buffer RAM, then commits MCR/CTRL1/CTRL2, the RX FIFO
+ * filter table and masks in freeze mode before joining the bus.
+ *
+ * @param instance FlexCAN instance.
+ * @param config Configuration descriptor, must not be NULL.
+ * @return FLEXCAN_STATUS_t SUCCESS, TIMEOUT or ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_Init(FLEXCAN_INSTANCE_t instance, const flexcan_config_t *config);
+
+/**
+ * @brief Disable a FlexCAN instance and gate its clock.
+ */
+FLEXCAN_STATUS_t FLEXCAN_Deinit(FLEXCAN_INSTANCE_t instance);
+
+/**
+ * @brief Return the first mailbox not used by the RX FIFO / filter table.
+ */
+uint8_t FLEXCAN_GetFirstFreeMb(FLEXCAN_INSTANCE_t instance);
+
+/**
+ * @brief Return how many RX FIFO filter elements use an individual mask.
+ */
+uint8_t FLEXCAN_GetFifoIndividualMaskCount(FLEXCAN_INSTANCE_t instance);
+
+/**
+ * @brief Return the number of mailboxes that fit the message buffer RAM.
+ *
+ * @param instance FlexCAN instance.
+ * @param fd true for an FD layout with the given payload size, false for classic.
+ * @param payload FD mailbox payload size (ignored for classic).
+ * @return uint8_t Mailbox count, 0 if the instance has no FD support.
+ */
+uint8_t FLEXCAN_GetMaxMbNums(FLEXCAN_INSTANCE_t instance, bool fd, FLEXCAN_FD_PAYLOAD_t payload);
+
+/**
+ * @brief Return the protocol engine clock frequency for a CLKSRC selection.
+ *
+ * Read from the SCG frequency getters, so it reflects the clock tree actually
+ * running (SOSCDIV2_CLK or SYS_CLK).
+ *
+ * @return uint32_t Frequency in Hz, 0 if the source is not running.
+ */
+uint32_t FLEXCAN_GetPeClock(FLEXCAN_CLK_SOURCE_t clk_src);
+
+/**
+ * @brief Enumerate bit timings reaching a bit rate exactly, best sample point first.
+ *
+ * Every prescaler that divides clk_hz into an integer number of quanta within
+ * the phase limits is considered; per prescaler the segment split closest to
+ * the requested sample point is kept. Solutions are ranked by sample-point
+ * error, then by the smaller prescaler (more quanta, finer resynchronisation).
+ * pseg1 mirrors pseg2 where the limits allow it and rjw = min(pseg1, pseg2).
+ *
+ * @param phase Register set the result is meant for.
+ * @param clk_hz Protocol engine clock (see FLEXCAN_GetPeClock()).
+ * @param bitrate Bit rate in bit/s.
+ * @param sample_point Requested sample point in permille (e.g. 800 = 80 %).
+ * @param solutions Output array, ranked best first.
+ * @param max_solutions Capacity of solutions.
+ * @return uint8_t Number of solutions written, 0 if the bit rate is unreachable.
+ */
+uint8_t FLEXCAN_SolveBitTiming(FLEXCAN_BIT_PHASE_t phase, uint32_t clk_hz, uint32_t bitrate, uint16_t sample_point,
+                               flexcan_bit_timing_t *solutions, uint8_t max_solutions);
+
+/**
+ * @brief Solve a nominal/data timing pair for CAN FD with bit rate switch.
+ *
+ * Picks the best nominal solution and, among the best data solutions, prefers
+ * one with the same prescaler so both phases share a time quantum and the
+ * transceiver delay compensation offset stays small.
+ *
+ * Pairing only considers the 8 best solutions of each phase
+ * (FLEXCAN_FD_TIMING_CANDIDATES); a shared prescaler ranked lower is not
+ * found. Without a shared prescaler the best solution of each phase is
+ * returned on its own.
+ *
+ * @return FLEXCAN_STATUS_t SUCCESS, or ERROR if either bit rate is unreachable.
+ */
+FLEXCAN_STATUS_t FLEXCAN_SolveFdTiming(uint32_t clk_hz, uint32_t nominal_bitrate, uint16_t nominal_sp,
+                                       uint32_t data_bitrate, uint16_t data_sp,
+                                       flexcan_bit_timing_t *nominal, flexcan_bit_timing_t *data);
+
+/**
+ * @brief Encode a solver result for the classic CTRL1 fields.
+ *
+ * @return FLEXCAN_STATUS_t SUCCESS, or ERROR if a field exceeds the CTRL1 range.
+ */
+FLEXCAN_STATUS_t FLEXCAN_EncodeClassicTiming(const flexcan_bit_timing_t *bit_timing, flexcan_timing_t *timing);
+
+/**
+ * @brief Convert a DLC code (0..15) to the CAN FD payload length in bytes.
+ */
+uint8_t FLEXCAN_DlcToLength(uint8_t dlc);
+
+/**
+ * @brief Return the smallest DLC code whose payload holds length bytes (<= 64).
+ */
+uint8_t FLEXCAN_LengthToDlc(uint8_t length);
+
+/**
+ * @brief Enable the mailbox interrupts given by mask (IMASK1 bit n = MB n).
+ *
+ * With the RX FIFO enabled bits 5..7 are the FIFO available/warning/overflow
+ * interrupts; leave bit 5 clear when the FIFO is served by eDMA.
+ */
+void FLEXCAN_EnableMbInterrupts(FLEXCAN_INSTANCE_t instance, uint32_t mask);
+
+/**
+ * @brief Disable the mailbox interrupts given by mask.
+ */
+void FLEXCAN_DisableMbInterrupts(FLEXCAN_INSTANCE_t instance, uint32_t mask);
+
+/**
+ * @brief Arm a mailbox for reception with its own acceptance mask.
+ *
+ * The individual mask (RXIMR) is only writable in freeze mode, so the module
+ * is frozen for the duration of the call.
+ *
+ * @param instance FlexCAN instance.
+ * @param mb Mailbox index (>= FLEXCAN_GetFirstFreeMb()).
+ * @param filter Acceptance filter.
+ * @return FLEXCAN_STATUS_t SUCCESS, TIMEOUT or ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_ConfigRxMb(FLEXCAN_INSTANCE_t instance, uint8_t mb, const flexcan_id_filter_t *filter);
+
+/**
+ * @brief Queue a frame in a TX mailbox.
+ *
+ * Arbitration picks the pending mailbox with the highest priority (lowest
+ * PRIO:ID value) regardless of its index, so urgent frames overtake queued
+ * bulk traffic.
+ *
+ * @param instance FlexCAN instance.
+ * @param mb Mailbox index.
+ * FD frames require an FD configuration and a payload that fits the mailbox;
+ * unused bytes of the last data word are sent as padding from frame->data.
+ *
+ * @param frame Frame to send.
+ * @param prio Local priority 0 (highest) .. 7, used when local_priority is set.
+ * @return FLEXCAN_STATUS_t SUCCESS, BUSY if the mailbox is still pending, ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_Send(FLEXCAN_INSTANCE_t instance, uint8_t mb, const flexcan_frame_t *frame, uint8_t prio);
+
+/**
+ * @brief Queue a frame in the first idle mailbox of a TX pool.
+ *
+ * @param instance FlexCAN instance.
+ * @param tx_pool Bitmask of mailboxes reserved for transmission.
+ * @param frame Frame to send.
+ * @param prio Local priority 0 (highest) .. 7.
+ * @param used_mb Optional output, receives the mailbox chosen.
+ * @return FLEXCAN_STATUS_t SUCCESS, BUSY if every pool mailbox is pending, ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_SendFromPool(FLEXCAN_INSTANCE_t instance, uint32_t tx_pool, const flexcan_frame_t *frame,
+                                      uint8_t prio, uint8_t *used_mb);
+
+/**
+ * @brief Read a received frame from a mailbox and re-arm it.
+ *
+ * @return FLEXCAN_STATUS_t SUCCESS, NO_DATA if nothing is pending, ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_ReadRxMb(FLEXCAN_INSTANCE_t instance, uint8_t mb, flexcan_frame_t *frame);
+
+/**
+ * @brief Pop one frame from the RX FIFO output (polling / ISR use).
+ *
+ * @return FLEXCAN_STATUS_t SUCCESS, NO_DATA if the FIFO is empty, ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_ReadRxFifo(FLEXCAN_INSTANCE_t instance, flexcan_frame_t *frame);
+
+/**
+ * @brief Start the eDMA drain of the RX FIFO into a ring of raw frames.
+ *
+ * Requires rx_fifo and rx_fifo_dma in the configuration. The channel runs
+ * continuously, wrapping at the end of the ring; no CPU interrupt is taken.
+ *
+ * @param instance FlexCAN instance.
+ * @param ring Ring descriptor; buf/len/channel must be set by the caller.
+ * @return FLEXCAN_STATUS_t SUCCESS or ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_StartRxFifoDma(FLEXCAN_INSTANCE_t instance, flexcan_dma_ring_t *ring);
+
+/**
+ * @brief Stop the eDMA drain of the RX FIFO.
+ */
+void FLEXCAN_StopRxFifoDma(flexcan_dma_ring_t *ring);
+
+/**
+ * @brief Number of frames waiting in the DMA ring.
+ */
+uint16_t FLEXCAN_RingPending(const flexcan_dma_ring_t *ring);
+
+/**
+ * @brief Pop and decode one frame from the DMA ring.
+ *
+ * @return FLEXCAN_STATUS_t SUCCESS or NO_DATA.
+ */
+FLEXCAN_STATUS_t FLEXCAN_RingRead(flexcan_dma_ring_t *ring, flexcan_frame_t *frame);
+
+/**
+ * @brief Decode a raw message buffer image into a frame.
+ */
+void FLEXCAN_DecodeRawMb(const flexcan_raw_mb_t *raw, flexcan_frame_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_FLEXCAN_H_ */
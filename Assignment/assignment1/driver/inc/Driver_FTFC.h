@@ -0,0 +1,176 @@
+/**
+ * @file Driver_FTFC.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief FTFC flash programming driver for S32K144.
+ * @version 0.1
+ * @date 2025-10-25
+ *
+ * Erases and programs P-Flash (0x00000000, 4 KB sectors) and FlexNVM
+ * (0x10000000, 2 KB sectors). Programming is batched with the Program Section
+ * command: up to FTFC_SECTION_MAX_BYTES are staged in FlexRAM and written by a
+ * single command, instead of one command per 8-byte phrase. When FlexRAM is
+ * used as EEPROM (RAMRDY = 0) the driver falls back to Program Phrase.
+ *
+ * The command launch/wait routine and FTFC_IRQHandler live in .code_ram.
+ * S32K144 has a single P-Flash block, so while a P-Flash command runs the CPU
+ * must not fetch from P-Flash: the blocking API runs with interrupts masked,
+ * and the async API is intended for FlexNVM targets unless the caller waits
+ * in RAM-resident code. FTFC_CMD_IRQn must be enabled in the NVIC for the
+ * async API.
+ */
+
+#ifndef DRIVER_FTFC_H_
+#define DRIVER_FTFC_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define FTFC_PFLASH_BASE            0x00000000U
+#define FTFC_PFLASH_SIZE            0x00080000U
+#define FTFC_PFLASH_SECTOR_SIZE     4096U
+#define FTFC_DFLASH_BASE            0x10000000U
+#define FTFC_DFLASH_SIZE            0x00010000U
+#define FTFC_DFLASH_SECTOR_SIZE     2048U
+#define FTFC_FLEXRAM_BASE           0x14000000U
+
+/* Program Phrase unit and Program Section unit/limit */
+#define FTFC_PHRASE_SIZE            8U
+#define FTFC_SECTION_UNIT           16U
+#define FTFC_SECTION_MAX_BYTES      1024U
+
+/* Program Partition codes: EEE data set size and FlexNVM partition (RM table) */
+#define FTFC_EEE_SIZE_4K            0x02U
+#define FTFC_EEE_SIZE_NONE          0x0FU
+#define FTFC_DEPART_DFLASH_64K      0x00U
+#define FTFC_DEPART_DFLASH_32K      0x03U
+#define FTFC_DEPART_DFLASH_0K       0x08U
+
+/**
+ * @brief FTFC driver status codes.
+ *
+ * FTFC_STATUS_SUCCESS      Command completed successfully.
+ * FTFC_STATUS_ERROR        Invalid parameter (range, alignment).
+ * FTFC_STATUS_BUSY         A command or async job is in progress.
+ * FTFC_STATUS_ACCESS       FSTAT[ACCERR], illegal command or address.
+ * FTFC_STATUS_PROTECTION   FSTAT[FPVIOL], target is write protected.
+ * FTFC_STATUS_VERIFY       FSTAT[MGSTAT0], command failed its internal verify.
+ */
+typedef enum
+{
+    FTFC_STATUS_SUCCESS = 0,
+    FTFC_STATUS_ERROR = -1,
+    FTFC_STATUS_BUSY = -2,
+    FTFC_STATUS_ACCESS = -3,
+    FTFC_STATUS_PROTECTION = -4,
+    FTFC_STATUS_VERIFY = -5
+} FTFC_STATUS_t;
+
+/**
+ * @brief FlexRAM function (Set FlexRAM Function control code).
+ */
+typedef enum
+{
+    FTFC_FLEXRAM_EEE = 0x00U,
+    FTFC_FLEXRAM_RAM = 0xFFU
+} FTFC_FLEXRAM_t;
+
+/**
+ * @brief Completion callback of an async job, called from FTFC_IRQHandler.
+ */
+typedef void (*ftfc_callback_t)(FTFC_STATUS_t status, void *user);
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Erase the sectors covering [address, address + len).
+ *
+ * @param address Sector aligned P-Flash or FlexNVM address.
+ * @param len Multiple of the sector size of that region.
+ * @return FTFC_STATUS_t SUCCESS or the first failing status.
+ */
+FTFC_STATUS_t FTFC_Erase(uint32_t address, uint32_t len);
+
+/**
+ * @brief Program erased flash.
+ *
+ * Whole FTFC_SECTION_UNIT blocks are written with Program Section, at most
+ * FTFC_SECTION_MAX_BYTES per command and never across a 1 KB boundary; a
+ * leading or trailing odd phrase uses Program Phrase.
+ *
+ * @param address Phrase aligned destination.
+ * @param data Source bytes, any alignment, not in the flash being programmed.
+ * @param len Multiple of FTFC_PHRASE_SIZE.
+ * @return FTFC_STATUS_t SUCCESS or the first failing status.
+ */
+FTFC_STATUS_t FTFC_Program(uint32_t address, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Start an erase job; sectors are erased one per interrupt.
+ *
+ * @return FTFC_STATUS_t SUCCESS if started, ERROR or BUSY.
+ */
+FTFC_STATUS_t FTFC_EraseAsync(uint32_t address, uint32_t len, ftfc_callback_t callback, void *user);
+
+/**
+ * @brief Start a program job; one section (or phrase) per interrupt.
+ *
+ * data must stay valid until the callback runs.
+ *
+ * @return FTFC_STATUS_t SUCCESS if started, ERROR or BUSY.
+ */
+FTFC_STATUS_t FTFC_ProgramAsync(uint32_t address, const uint8_t *data, uint32_t len,
+                                ftfc_callback_t callback, void *user);
+
+/**
+ * @brief Partition FlexNVM between D-Flash and EEE backup (one time, until Erase All).
+ *
+ * @param eee_size_code EEE data set size code, e.g. FTFC_EEE_SIZE_4K.
+ * @param depart_code FlexNVM partition code, e.g. FTFC_DEPART_DFLASH_32K.
+ * @return FTFC_STATUS_t SUCCESS, BUSY or ACCESS if already partitioned.
+ */
+FTFC_STATUS_t FTFC_ProgramPartition(uint8_t eee_size_code, uint8_t depart_code);
+
+/**
+ * @brief Switch FlexRAM between emulated EEPROM and plain RAM.
+ *
+ * Program Section needs FlexRAM as RAM; EEE writes need it as EEE.
+ */
+FTFC_STATUS_t FTFC_SetFlexRam(FTFC_FLEXRAM_t mode);
+
+/**
+ * @brief Write to emulated EEPROM and wait for each record to be saved.
+ *
+ * Aligned words are written 32 bits at a time, the rest byte by byte.
+ *
+ * @param offset Byte offset in FlexRAM.
+ * @param data Source bytes.
+ * @param len Number of bytes.
+ * @return FTFC_STATUS_t SUCCESS, ERROR if EEE is not ready or out of range.
+ */
+FTFC_STATUS_t FTFC_EeeWrite(uint32_t offset, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Check whether a command or async job is in progress.
+ */
+bool FTFC_IsBusy(void);
+
+/**
+ * @brief Command complete handler; advances the async job.
+ */
+void FTFC_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_FTFC_H_ */
@@ -0,0 +1,402 @@
+/**
+ * @file Driver_FTM.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief FlexTimer (FTM0..3) PWM, input capture and quadrature decoder interface.
+ * @version 0.1
+ * @date 2025-10-22
+ *
+ * Edge- or center-aligned PWM with optional complementary pairs and deadtime.
+ * Duty cycles are double-buffered: FTM_SetDuty() costs one CnV write into the
+ * channel write buffer, FTM_SyncDuty() issues a software trigger so every
+ * buffered channel loads at the same loading point (counter max for edge
+ * aligned, counter min/max for center aligned). Outputs never see a partial
+ * period or a mix of old and new duty cycles.
+ *
+ * Capture mode runs the counter free over 16 bits and extends timestamps to
+ * 64 bits with an overflow count kept by FTMn_Ovf_Reload_IRQHandler (enable
+ * FTMn_Ovf_Reload_IRQn in the NVIC). Edges can be drained by eDMA into a ring
+ * of raw 16-bit values so high edge rates cost no interrupt per edge.
+ * Quadrature mode (FTM1/FTM2 phase A/B inputs) counts revolutions the same way.
+ */
+
+#ifndef DRIVER_FTM_H_
+#define DRIVER_FTM_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Number of FTM instances on S32K144 */
+#define FTM_INSTANCE_NUMS               4U
+/* Channels per FTM instance */
+#define FTM_CHANNEL_NUMS                8U
+/* Duty cycle full scale (100 %), duty = FTM_DUTY_MAX * percent / 100 */
+#define FTM_DUTY_MAX                    0x8000U
+/* Largest deadtime accepted, in FTM input clock ticks (DTPS = 16, DTVAL = 1023) */
+#define FTM_DEADTIME_MAX_TICKS          (16U * 1023U)
+/* Channels with an input filter (FILTER[CHnFVAL]) */
+#define FTM_FILTER_CHANNEL_NUMS         4U
+
+/**
+ * @brief FTM driver status codes.
+ *
+ * FTM_STATUS_SUCCESS  Operation completed successfully.
+ * FTM_STATUS_ERROR    Invalid parameter or period out of the counter range.
+ * FTM_STATUS_NO_DATA  No capture is pending on the channel or in the ring.
+ */
+typedef enum
+{
+    FTM_STATUS_SUCCESS = 0,
+    FTM_STATUS_ERROR = -1,
+    FTM_STATUS_NO_DATA = -2
+} FTM_STATUS_t;
+
+/**
+ * @brief FTM instance selector.
+ */
+typedef enum
+{
+    FTM_0 = 0U,
+    FTM_1,
+    FTM_2,
+    FTM_3
+} FTM_INSTANCE_t;
+
+/**
+ * @brief Counter clock source (SC[CLKS]).
+ *
+ * FTM_CLK_SYSTEM    FTM input clock (SYS_CLK), frequency read from SCG.
+ * FTM_CLK_FIXED     Fixed frequency clock, clk_hz must be given.
+ * FTM_CLK_EXTERNAL  PCC-selected external clock, clk_hz must be given.
+ */
+typedef enum
+{
+    FTM_CLK_SYSTEM = 1U,
+    FTM_CLK_FIXED = 2U,
+    FTM_CLK_EXTERNAL = 3U
+} FTM_CLK_SOURCE_t;
+
+/**
+ * @brief PWM alignment.
+ *
+ * FTM_ALIGN_EDGE    Up counter 0..MOD, period = MOD + 1 ticks.
+ * FTM_ALIGN_CENTER  Up-down counter (CPWMS), period = 2 * MOD ticks.
+ */
+typedef enum
+{
+    FTM_ALIGN_EDGE = 0U,
+    FTM_ALIGN_CENTER = 1U
+} FTM_ALIGN_t;
+
+/**
+ * @brief Active level of the PWM pulse.
+ *
+ * FTM_POLARITY_HIGH  High-true pulses (ELSB:ELSA = 10).
+ * FTM_POLARITY_LOW   Low-true pulses (ELSB:ELSA = 01), e.g. LEDs driven to GND.
+ */
+typedef enum
+{
+    FTM_POLARITY_HIGH = 0U,
+    FTM_POLARITY_LOW = 1U
+} FTM_POLARITY_t;
+
+/**
+ * @brief Per-channel PWM configuration.
+ *
+ * complementary  Only valid on an even channel: the odd channel of the pair
+ *                outputs the complement, with the module deadtime inserted.
+ */
+typedef struct
+{
+    uint8_t channel;
+    FTM_POLARITY_t polarity;
+    uint16_t duty;
+    bool complementary;
+} ftm_pwm_channel_config_t;
+
+/**
+ * @brief PWM configuration applied by FTM_PwmInit().
+ *
+ * clk_hz          Counter clock frequency before the prescaler; 0 derives it
+ *                 from SCG for FTM_CLK_SYSTEM.
+ * frequency_hz    PWM frequency. The smallest prescaler that fits the period
+ *                 in the 16-bit counter is chosen, for the finest resolution.
+ * deadtime_ticks  Deadtime for complementary pairs, in counter clock ticks.
+ */
+typedef struct
+{
+    FTM_CLK_SOURCE_t clk_src;
+    uint32_t clk_hz;
+    uint32_t frequency_hz;
+    FTM_ALIGN_t align;
+    uint16_t deadtime_ticks;
+    const ftm_pwm_channel_config_t *channels;
+    uint8_t channel_count;
+} ftm_pwm_config_t;
+
+/**
+ * @brief Input capture edge (CnSC[ELSB:ELSA]).
+ */
+typedef enum
+{
+    FTM_EDGE_RISING = 1U,
+    FTM_EDGE_FALLING = 2U,
+    FTM_EDGE_BOTH = 3U
+} FTM_EDGE_t;
+
+/**
+ * @brief Dual-edge measurement of a channel pair (input on the even channel).
+ *
+ * FTM_PULSE_HIGH    Rising to falling edge.
+ * FTM_PULSE_LOW     Falling to rising edge.
+ * FTM_PULSE_PERIOD  Rising to rising edge.
+ */
+typedef enum
+{
+    FTM_PULSE_HIGH = 0U,
+    FTM_PULSE_LOW,
+    FTM_PULSE_PERIOD
+} FTM_PULSE_t;
+
+/**
+ * @brief Quadrature decoder encoding (QDCTRL[QUADMODE]).
+ */
+typedef enum
+{
+    FTM_QUAD_PHASE_AB = 0U,
+    FTM_QUAD_COUNT_DIR = 1U
+} FTM_QUAD_MODE_t;
+
+/**
+ * @brief Per-channel input capture configuration.
+ *
+ * filter  Input filter 0..15 (x4 counter clocks), channels 0..3 only.
+ * dma     Serve the channel by eDMA (see FTM_StartCaptureDma()).
+ */
+typedef struct
+{
+    uint8_t channel;
+    FTM_EDGE_t edge;
+    uint8_t filter;
+    bool dma;
+} ftm_capture_channel_config_t;
+
+/**
+ * @brief Capture configuration applied by FTM_CaptureInit().
+ *
+ * The counter runs 0..0xFFFF at clk / 2^prescaler. overflow_irq enables TOIE so
+ * timestamps extend past 16 bits; without it FTM_ReadCapture() is only valid
+ * within one counter period.
+ */
+typedef struct
+{
+    FTM_CLK_SOURCE_t clk_src;
+    uint8_t prescaler;
+    bool overflow_irq;
+    const ftm_capture_channel_config_t *channels;
+    uint8_t channel_count;
+} ftm_capture_config_t;
+
+/**
+ * @brief Quadrature decoder configuration applied by FTM_QuadInit().
+ *
+ * counts_per_rev  Counter period in quadrature counts (MOD + 1), 2..65536.
+ * filter_a/b      Phase input filter 0..15 (0 = off).
+ */
+typedef struct
+{
+    FTM_QUAD_MODE_t mode;
+    uint32_t counts_per_rev;
+    uint8_t filter_a;
+    uint8_t filter_b;
+    bool invert_a;
+    bool invert_b;
+} ftm_quad_config_t;
+
+/**
+ * @brief eDMA ring of raw capture values from one channel.
+ *
+ * buf/len/dma_channel/instance/channel are set by the caller. last is the
+ * extended timestamp of the previous entry; consecutive edges must be less
+ * than one counter period (65536 ticks) apart for the ring to extend them.
+ */
+typedef struct
+{
+    uint16_t *buf;
+    uint16_t len;
+    uint16_t rd;
+    uint8_t dma_channel;
+    FTM_INSTANCE_t instance;
+    uint8_t channel;
+    uint64_t last;
+} ftm_capture_ring_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an FTM instance as a PWM generator.
+ *
+ * The counter is stopped while MOD, the channel modes, pairs, deadtime and the
+ * initial duty cycles are written directly, then the clock is started with the
+ * channel outputs enabled. Software-triggered synchronisation of CnV is enabled
+ * for every pair.
+ *
+ * @param instance FTM instance.
+ * @param config PWM configuration, must not be NULL.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_PwmInit(FTM_INSTANCE_t instance, const ftm_pwm_config_t *config);
+
+/**
+ * @brief Stop the counter, release the outputs and gate the FTM clock.
+ */
+FTM_STATUS_t FTM_PwmDeinit(FTM_INSTANCE_t instance);
+
+/**
+ * @brief Buffer a new duty cycle for a channel.
+ *
+ * One write to the CnV buffer; the output keeps the previous duty cycle until
+ * FTM_SyncDuty() is called. For a complementary pair use the even channel.
+ *
+ * @param instance FTM instance.
+ * @param channel Channel 0..7.
+ * @param duty 0..FTM_DUTY_MAX.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_SetDuty(FTM_INSTANCE_t instance, uint8_t channel, uint16_t duty);
+
+/**
+ * @brief Load every buffered duty cycle at the next loading point.
+ *
+ * Issues the software synchronisation trigger; all channels switch together.
+ */
+void FTM_SyncDuty(FTM_INSTANCE_t instance);
+
+/**
+ * @brief Buffer several duty cycles and load them together.
+ *
+ * @param instance FTM instance.
+ * @param channels Channel numbers.
+ * @param duties Duty cycles, one per channel.
+ * @param count Number of entries.
+ * @return FTM_STATUS_t SUCCESS, or ERROR without triggering a load.
+ */
+FTM_STATUS_t FTM_SetDutySync(FTM_INSTANCE_t instance, const uint8_t *channels, const uint16_t *duties,
+                             uint8_t count);
+
+/**
+ * @brief Return the PWM period in counter ticks (resolution of the duty cycle).
+ */
+uint32_t FTM_GetPeriodTicks(FTM_INSTANCE_t instance);
+
+/**
+ * @brief Initialize an FTM instance for input capture.
+ *
+ * @param instance FTM instance.
+ * @param config Capture configuration, must not be NULL.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_CaptureInit(FTM_INSTANCE_t instance, const ftm_capture_config_t *config);
+
+/**
+ * @brief Return the current counter time extended to 64 bits.
+ */
+uint64_t FTM_GetTimestamp(FTM_INSTANCE_t instance);
+
+/**
+ * @brief Read and clear a pending capture, extended to 64 bits.
+ *
+ * The capture is dated relative to the current counter value, so it must be
+ * read within one counter period of the edge.
+ *
+ * @return FTM_STATUS_t SUCCESS, NO_DATA if no edge was captured, ERROR.
+ */
+FTM_STATUS_t FTM_ReadCapture(FTM_INSTANCE_t instance, uint8_t channel, uint64_t *timestamp);
+
+/**
+ * @brief Switch a channel pair to dual-edge capture for pulse measurement.
+ *
+ * Call after FTM_CaptureInit(); the input is the even channel of the pair.
+ *
+ * @param instance FTM instance.
+ * @param pair Channel pair 0..3.
+ * @param pulse Edges delimiting the measurement.
+ * @param continuous Re-arm automatically after every measurement.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_ConfigPulseMeasure(FTM_INSTANCE_t instance, uint8_t pair, FTM_PULSE_t pulse, bool continuous);
+
+/**
+ * @brief Read a completed pulse measurement in counter ticks.
+ *
+ * Pulses longer than one counter period wrap; pick the prescaler accordingly.
+ *
+ * @return FTM_STATUS_t SUCCESS, NO_DATA if the second edge has not arrived, ERROR.
+ */
+FTM_STATUS_t FTM_ReadPulseWidth(FTM_INSTANCE_t instance, uint8_t pair, uint32_t *ticks);
+
+/**
+ * @brief Start the eDMA drain of a capture channel into a ring.
+ *
+ * FTM1/FTM2 have one request per channel; FTM0/FTM3 share one request for all
+ * channels, so only one DMA capture channel can be used on those instances.
+ *
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_StartCaptureDma(ftm_capture_ring_t *ring);
+
+/**
+ * @brief Stop the eDMA drain of a capture channel.
+ */
+void FTM_StopCaptureDma(ftm_capture_ring_t *ring);
+
+/**
+ * @brief Number of captures waiting in the ring.
+ */
+uint16_t FTM_CaptureRingPending(const ftm_capture_ring_t *ring);
+
+/**
+ * @brief Pop one capture from the ring, extended to 64 bits.
+ *
+ * @return FTM_STATUS_t SUCCESS or NO_DATA.
+ */
+FTM_STATUS_t FTM_CaptureRingRead(ftm_capture_ring_t *ring, uint64_t *timestamp);
+
+/**
+ * @brief Initialize an FTM instance as quadrature decoder.
+ *
+ * The overflow interrupt counts revolutions in the direction given by TOFDIR.
+ *
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_QuadInit(FTM_INSTANCE_t instance, const ftm_quad_config_t *config);
+
+/**
+ * @brief Return the signed position: revolutions * counts_per_rev + counter.
+ */
+int64_t FTM_QuadGetPosition(FTM_INSTANCE_t instance);
+
+/**
+ * @brief Return true while the counter is counting up (QDCTRL[QUADIR]).
+ */
+bool FTM_QuadIsCountingUp(FTM_INSTANCE_t instance);
+
+/**
+ * @brief Counter overflow service, called from FTMn_Ovf_Reload_IRQHandler.
+ */
+void FTM_OverflowIRQHandler(FTM_INSTANCE_t instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_FTM_H_ */
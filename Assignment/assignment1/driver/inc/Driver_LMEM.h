@@ -0,0 +1,160 @@
+/**
+ * @file Driver_LMEM.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief LMEM code cache driver for S32K144.
+ * @version 0.1
+ * @date 2025-10-29
+ *
+ * The 4 KB, 2-way, 16-byte-line code cache sits on the code bus in front of
+ * P-Flash, FlexNVM and FlexRAM. This driver enables it at run time, sets the
+ * cache mode of each address region, and runs invalidate/push/clear commands
+ * on the whole cache, one way, or the lines covering an address range.
+ * Driver_FTFC invalidates the range it erased or programmed when the command
+ * finishes, so code and constants rewritten in flash are never read from stale
+ * lines.
+ *
+ * The LMEM has no hit/miss counters. LMEM_IsCached() and LMEM_GetValidLines()
+ * read the tag valid bits, and hit rates are measured indirectly with the DWT
+ * cycle counter (cycle_counter.h).
+ */
+
+#ifndef DRIVER_LMEM_H_
+#define DRIVER_LMEM_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define LMEM_LINE_SIZE              16U
+#define LMEM_WAYS                   2U
+#define LMEM_SETS                   128U
+#define LMEM_REGION_COUNT           16U
+
+/* Regions 0..3 are 128 MB each from 0x00000000 */
+#define LMEM_REGION_PFLASH          0U      /* P-Flash */
+#define LMEM_REGION_FLEXNVM         2U      /* FlexNVM and FlexRAM */
+
+/**
+ * @brief LMEM driver status codes.
+ *
+ * LMEM_STATUS_SUCCESS  Operation completed successfully.
+ * LMEM_STATUS_ERROR    Invalid region, way or mode.
+ */
+typedef enum
+{
+    LMEM_STATUS_SUCCESS = 0,
+    LMEM_STATUS_ERROR = -1
+} LMEM_STATUS_t;
+
+/**
+ * @brief Region cache mode (PCCRMR encoding).
+ */
+typedef enum
+{
+    LMEM_MODE_NON_CACHEABLE = 0U,
+    LMEM_MODE_WRITE_THROUGH = 2U,
+    LMEM_MODE_WRITE_BACK = 3U
+} LMEM_MODE_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Invalidate the whole cache and turn it on.
+ */
+void LMEM_Enable(void);
+
+/**
+ * @brief Push and invalidate the whole cache and turn it off.
+ */
+void LMEM_Disable(void);
+
+/**
+ * @brief Check whether the cache is on.
+ */
+bool LMEM_IsEnabled(void);
+
+/**
+ * @brief Set the cache mode of a region.
+ *
+ * A running cache is cleared afterwards so no line survives a mode change.
+ *
+ * @param region Region number (0..LMEM_REGION_COUNT-1).
+ * @param mode Cache mode.
+ * @return LMEM_STATUS_t SUCCESS or ERROR.
+ */
+LMEM_STATUS_t LMEM_SetRegionMode(uint8_t region, LMEM_MODE_t mode);
+
+/**
+ * @brief Read the cache mode of a region (non-cacheable for a bad region).
+ */
+LMEM_MODE_t LMEM_GetRegionMode(uint8_t region);
+
+/**
+ * @brief Invalidate every line of both ways.
+ */
+void LMEM_InvalidateAll(void);
+
+/**
+ * @brief Push modified lines, then invalidate, in both ways.
+ */
+void LMEM_ClearAll(void);
+
+/**
+ * @brief Invalidate every line of one way.
+ *
+ * @param way Way number (0..LMEM_WAYS-1).
+ * @return LMEM_STATUS_t SUCCESS or ERROR.
+ */
+LMEM_STATUS_t LMEM_InvalidateWay(uint8_t way);
+
+/**
+ * @brief Push and invalidate every line of one way.
+ */
+LMEM_STATUS_t LMEM_ClearWay(uint8_t way);
+
+/**
+ * @brief Invalidate the line holding a physical address, if cached.
+ */
+void LMEM_InvalidateLine(uint32_t address);
+
+/**
+ * @brief Push and invalidate the line holding a physical address, if cached.
+ */
+void LMEM_ClearLine(uint32_t address);
+
+/**
+ * @brief Invalidate all lines covering [address, address + len).
+ *
+ * Ranges larger than the cache fall back to LMEM_InvalidateAll().
+ */
+void LMEM_InvalidateRange(uint32_t address, uint32_t len);
+
+/**
+ * @brief Push and invalidate all lines covering [address, address + len).
+ */
+void LMEM_ClearRange(uint32_t address, uint32_t len);
+
+/**
+ * @brief Check whether the line holding a physical address is in the cache.
+ */
+bool LMEM_IsCached(uint32_t address);
+
+/**
+ * @brief Count valid lines in both ways (occupancy, 0..LMEM_WAYS * LMEM_SETS).
+ */
+uint32_t LMEM_GetValidLines(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_LMEM_H_ */
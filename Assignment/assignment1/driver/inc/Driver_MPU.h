@@ -0,0 +1,181 @@
+/**
+ * @file Driver_MPU.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief System MPU (SYSMPU) region manager with per-task region sets.
+ * @version 0.1
+ * @date 2025-11-09
+ *
+ * The SYSMPU checks the flash and SRAM slave ports; an access is allowed if
+ * any valid region descriptor grants it. MPU_Init() leaves the core full
+ * access in supervisor mode (RGD0) and none in user mode, so a task running
+ * unprivileged can only reach what the descriptors grant:
+ *
+ *   RGD0        whole map, supervisor only (debugger and DMA unchanged)
+ *   RGD1..3     shared user regions, e.g. flash code r-x, set by MPU_Init()
+ *   RGD4..7     the running task's region set
+ *
+ * A region set is built once per task and switched in the context switch:
+ *
+ *   static const mpu_region_t s_can_regions[] =
+ *   {
+ *       MPU_REGION(s_can_stack, sizeof(s_can_stack), MPU_ACCESS_R | MPU_ACCESS_W),
+ *       MPU_REGION(&s_can_data, sizeof(s_can_data), MPU_ACCESS_R | MPU_ACCESS_W)
+ *   };
+ *   static const uint32_t s_can_periph[] = { IP_FLEXCAN0_BASE };
+ *
+ *   MPU_BuildTaskSet(&s_can_set, s_can_regions, 2U, s_can_periph, 1U);
+ *   ...
+ *   MPU_SwitchTaskSet(&s_can_set);     in PendSV, before the PSP switch
+ *
+ * The stack guard is the absence of a grant: a task stack region that starts
+ * exactly at the stack base (32-byte aligned) makes the first push below it
+ * a bus fault, before anything next to the stack is overwritten. Data
+ * regions without MPU_ACCESS_X are no-exec.
+ *
+ * Peripherals are not behind the SYSMPU, they sit behind the AIPS bridge.
+ * Peripheral windows are the AIPS off-platform slots (0x40020000 and up) a
+ * set allows in user mode: MPU_Init() makes every slot supervisor-only and
+ * a set clears SP for its own peripherals.
+ *
+ * Everything is encoded when the set is built: the switch is a bulk copy of
+ * 16 descriptor words (LDM/STM) and 12 OPACR words, with no per-region
+ * logic in the context switch (tools/emu_bench: bench_mpu_switch).
+ *
+ * Writable regions must lie inside the linker's RAM regions m_data or
+ * m_data_2 (__m_data_start__ etc.) and clear of the RAM vector table
+ * (__interrupts_ram_start__.._end__, at the start of m_data); the vector
+ * table and .noinit are then never user-writable.
+ */
+
+#ifndef DRIVER_MPU_H_
+#define DRIVER_MPU_H_
+
+#include "Driver_Common.h"
+#include "../include/S32K144.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define MPU_TASK_REGIONS            4U
+#define MPU_TASK_FIRST              (MPU_RGD_COUNT - MPU_TASK_REGIONS)
+#define MPU_SHARED_MAX              (MPU_TASK_FIRST - 1U)
+
+/* Region start and size granularity */
+#define MPU_GRANULE                 32U
+
+/* User-mode access, the RGD WORD2 M0UM encoding */
+#define MPU_ACCESS_R                0x4U
+#define MPU_ACCESS_W                0x2U
+#define MPU_ACCESS_X                0x1U
+
+/* AIPS off-platform peripheral slots: 4 KB each from 0x40020000 */
+#define MPU_PERIPH_FIRST            0x40020000U
+#define MPU_PERIPH_SLOT_SIZE        0x1000U
+#define MPU_PERIPH_SLOTS            (AIPS_OPACR_COUNT * 8U)
+
+/**
+ * @brief Region covering size bytes from start.
+ */
+#define MPU_REGION(start, size, access) \
+    { (uint32_t)(start), (uint32_t)(start) + (uint32_t)(size) - 1U, (uint8_t)(access) }
+
+/**
+ * @brief MPU driver status codes.
+ *
+ * MPU_STATUS_SUCCESS  Operation completed successfully.
+ * MPU_STATUS_ERROR    Bad region (alignment, access, writable outside RAM
+ *                     or over the RAM vector table),
+ *                     too many regions, or a peripheral outside the slots.
+ */
+typedef enum
+{
+    MPU_STATUS_SUCCESS = 0,
+    MPU_STATUS_ERROR = -1
+} MPU_STATUS_t;
+
+/**
+ * @brief One region in user mode.
+ *
+ * start   First byte, MPU_GRANULE aligned.
+ * end     Last byte; end + 1 MPU_GRANULE aligned.
+ * access  MPU_ACCESS_* OR'ed, not 0.
+ */
+typedef struct
+{
+    uint32_t start;
+    uint32_t end;
+    uint8_t access;
+} mpu_region_t;
+
+/**
+ * @brief A task's region set, as written by MPU_SwitchTaskSet().
+ *
+ * rgd     WORD0..WORD3 of RGD4..RGD7; unused descriptors are invalid.
+ * opacr   AIPS OPACRA..OPACRL with SP cleared for the task's peripherals.
+ */
+typedef struct
+{
+    uint32_t rgd[MPU_TASK_REGIONS][4];
+    uint32_t opacr[AIPS_OPACR_COUNT];
+} mpu_task_set_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Set up RGD0, the shared regions and supervisor-only peripherals, and
+ *        enable the MPU with no task set.
+ *
+ * @param shared Regions every task gets, up to MPU_SHARED_MAX.
+ * @param count Number of shared regions.
+ * @return MPU_STATUS_t ERROR for a bad region or too many.
+ */
+MPU_STATUS_t MPU_Init(const mpu_region_t *shared, uint8_t count);
+
+/**
+ * @brief Encode a task's regions and peripheral windows.
+ *
+ * @param set Filled in; keep it for the life of the task.
+ * @param regions Up to MPU_TASK_REGIONS regions, stack first by convention.
+ * @param count Number of regions.
+ * @param periph Base addresses of peripherals the task may access, or NULL.
+ * @param periph_count Number of peripherals.
+ * @return MPU_STATUS_t ERROR for a bad region or peripheral.
+ */
+MPU_STATUS_t MPU_BuildTaskSet(mpu_task_set_t *set, const mpu_region_t *regions, uint8_t count,
+                              const uint32_t *periph, uint8_t periph_count);
+
+/**
+ * @brief Make a region set the active one: RGD4..7 and the AIPS OPACRs.
+ *
+ * Call with interrupts masked or from PendSV, while no user code runs.
+ */
+void MPU_SwitchTaskSet(const mpu_task_set_t *set);
+
+/**
+ * @brief Set with no regions and no peripherals, for privileged threads.
+ */
+void MPU_EmptyTaskSet(mpu_task_set_t *set);
+
+/**
+ * @brief First slave port with an access error since the last call.
+ *
+ * @param port Slave port (FEATURE_MPU_SLAVE_*).
+ * @param address Faulting address (EAR).
+ * @param detail EDR: master, mode, read/write, denying descriptors.
+ * @return bool false if no port has an error; the reported one is cleared.
+ */
+bool MPU_GetError(uint8_t *port, uint32_t *address, uint32_t *detail);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_MPU_H_ */
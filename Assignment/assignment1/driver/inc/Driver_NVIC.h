@@ -0,0 +1,223 @@
+/**
+ * @file Driver_NVIC.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief NVIC and RAM vector table driver for S32K144.
+ * @version 0.1
+ * @date 2025-11-02
+ *
+ * Priorities are split into preemption priority and subpriority by the
+ * AIRCR[PRIGROUP] grouping; 4 priority bits are implemented, 0 is the most
+ * urgent. Several IRQs are enabled, disabled or cleared together through an
+ * nvic_irq_set_t, with one ISER/ICER/ICPR write per 32 IRQs instead of one per
+ * IRQ.
+ *
+ * startup (init_data_bss) copies the vector table to __VECTOR_RAM and points
+ * VTOR there. NVIC_InstallHandler() replaces one entry of that table at run
+ * time with a single word store, so a specialised ISR (e.g. one per clock
+ * profile) can be swapped in instead of a generic handler that branches on
+ * the current mode. The store is atomic against the interrupt itself, which
+ * then runs either the old or the new handler. Linking with
+ * __flash_vector_table__ defined keeps the table in flash and installing
+ * fails.
+ */
+
+#ifndef DRIVER_NVIC_H_
+#define DRIVER_NVIC_H_
+
+#include "Driver_Common.h"
+#include "../include/S32K144.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define NVIC_PRIO_BITS              4U
+#define NVIC_IRQ_COUNT              ((uint32_t)FTM3_Ovf_Reload_IRQn + 1U)
+#define NVIC_WORD_COUNT             ((NVIC_IRQ_COUNT + 31U) / 32U)
+
+/* Exception numbers are IRQ numbers + 16 in the vector table */
+#define NVIC_VECTOR_OFFSET          16
+
+/**
+ * @brief NVIC driver status codes.
+ *
+ * NVIC_STATUS_SUCCESS  Operation completed successfully.
+ * NVIC_STATUS_ERROR    Invalid IRQ or priority, or no RAM vector table.
+ */
+typedef enum
+{
+    NVIC_STATUS_SUCCESS = 0,
+    NVIC_STATUS_ERROR = -1
+} NVIC_STATUS_t;
+
+/**
+ * @brief Interrupt service routine as stored in the vector table.
+ */
+typedef void (*nvic_handler_t)(void);
+
+/**
+ * @brief A set of device IRQs, one bit per IRQ, laid out as ISER/ICER words.
+ *
+ * Built once with NVIC_SetAdd() (e.g. at init) and then enabled, disabled or
+ * cleared with one register write per non-empty word.
+ */
+typedef struct
+{
+    uint32_t word[NVIC_WORD_COUNT];
+} nvic_irq_set_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Empty an IRQ set.
+ */
+static inline void NVIC_SetClear(nvic_irq_set_t *set)
+{
+    uint32_t i;
+
+    for (i = 0U; i < NVIC_WORD_COUNT; i++)
+    {
+        set->word[i] = 0U;
+    }
+}
+
+/**
+ * @brief Add a device IRQ to a set; system exceptions are ignored.
+ */
+static inline void NVIC_SetAdd(nvic_irq_set_t *set, IRQn_Type irq)
+{
+    if (((int32_t)irq >= 0) && ((uint32_t)irq < NVIC_IRQ_COUNT))
+    {
+        set->word[(uint32_t)irq >> 5U] |= 1UL << ((uint32_t)irq & 31U);
+    }
+}
+
+/**
+ * @brief Set how many priority bits are preemption priority.
+ *
+ * The remaining NVIC_PRIO_BITS - preempt_bits bits are subpriority, which
+ * only orders pending interrupts of equal preemption priority. Set this
+ * before any priority: encoded priorities are not converted.
+ *
+ * @param preempt_bits 0..NVIC_PRIO_BITS.
+ * @return NVIC_STATUS_t SUCCESS or ERROR.
+ */
+NVIC_STATUS_t NVIC_SetPriorityGrouping(uint8_t preempt_bits);
+
+/**
+ * @brief Number of preemption priority bits of the current grouping.
+ */
+uint8_t NVIC_GetPriorityGrouping(void);
+
+/**
+ * @brief Set the priority of a device IRQ or a configurable system exception.
+ *
+ * @param irq Device IRQ, or MemoryManagement/BusFault/UsageFault/SVCall/
+ *            DebugMonitor/PendSV/SysTick.
+ * @param preempt Preemption priority, below 2^preempt_bits.
+ * @param sub Subpriority, below 2^(NVIC_PRIO_BITS - preempt_bits).
+ * @return NVIC_STATUS_t SUCCESS or ERROR.
+ */
+NVIC_STATUS_t NVIC_SetPriority(IRQn_Type irq, uint8_t preempt, uint8_t sub);
+
+/**
+ * @brief Read back the priority of an IRQ under the current grouping.
+ *
+ * @return NVIC_STATUS_t ERROR for an IRQ without a configurable priority.
+ */
+NVIC_STATUS_t NVIC_GetPriority(IRQn_Type irq, uint8_t *preempt, uint8_t *sub);
+
+/**
+ * @brief Enable a device IRQ.
+ */
+NVIC_STATUS_t NVIC_EnableIRQ(IRQn_Type irq);
+
+/**
+ * @brief Disable a device IRQ; its handler does not start after this returns.
+ */
+NVIC_STATUS_t NVIC_DisableIRQ(IRQn_Type irq);
+
+/**
+ * @brief Check whether a device IRQ is enabled.
+ */
+bool NVIC_IsEnabled(IRQn_Type irq);
+
+/**
+ * @brief Enable every IRQ of a set, one ISER write per non-empty word.
+ */
+void NVIC_EnableSet(const nvic_irq_set_t *set);
+
+/**
+ * @brief Disable every IRQ of a set, one ICER write per non-empty word.
+ *
+ * None of their handlers starts after this returns.
+ */
+void NVIC_DisableSet(const nvic_irq_set_t *set);
+
+/**
+ * @brief Enable a list of IRQs (builds the set, then NVIC_EnableSet()).
+ */
+void NVIC_EnableIRQs(const IRQn_Type *irqs, uint32_t count);
+
+/**
+ * @brief Disable a list of IRQs (builds the set, then NVIC_DisableSet()).
+ */
+void NVIC_DisableIRQs(const IRQn_Type *irqs, uint32_t count);
+
+/**
+ * @brief Make a device IRQ pending (software trigger).
+ */
+NVIC_STATUS_t NVIC_SetPending(IRQn_Type irq);
+
+/**
+ * @brief Clear the pending state of a device IRQ.
+ *
+ * A level-sensitive source that is still asserted pends again.
+ */
+NVIC_STATUS_t NVIC_ClearPending(IRQn_Type irq);
+
+/**
+ * @brief Check whether a device IRQ is pending.
+ */
+bool NVIC_IsPending(IRQn_Type irq);
+
+/**
+ * @brief Clear the pending state of every IRQ of a set.
+ */
+void NVIC_ClearPendingSet(const nvic_irq_set_t *set);
+
+/**
+ * @brief Check whether the handler of a device IRQ is running or preempted.
+ */
+bool NVIC_IsActive(IRQn_Type irq);
+
+/**
+ * @brief Install a handler in the RAM vector table.
+ *
+ * Device IRQs and system exceptions (irq >= NonMaskableInt_IRQn) can be
+ * replaced, also while enabled: the entry is written with one word store.
+ *
+ * @param irq IRQ or exception.
+ * @param handler New handler.
+ * @param previous If not NULL, receives the replaced handler.
+ * @return NVIC_STATUS_t ERROR for a bad IRQ or a vector table in flash.
+ */
+NVIC_STATUS_t NVIC_InstallHandler(IRQn_Type irq, nvic_handler_t handler, nvic_handler_t *previous);
+
+/**
+ * @brief Handler currently in the active vector table (NULL for a bad IRQ).
+ */
+nvic_handler_t NVIC_GetHandler(IRQn_Type irq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_NVIC_H_ */
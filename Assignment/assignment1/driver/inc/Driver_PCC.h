@@ -98,7 +98,7 @@ typedef enum
     PCC_PCS_FIRCDIV1_CLK,
     PCC_PCS_FIRCDIV2_CLK,
     PCC_PCS_SIRCDIV1_CLK,
-    PCC_PCS_FIRCDIV2_CLK,
+    PCC_PCS_SIRCDIV2_CLK,
     PCC_PCS_SOSCDIV1_CLK,
     PCC_PCS_SOSCDIV2_CLK,
     PCC_PCS_LPO128K_CLK
@@ -0,0 +1,182 @@
+/**
+ * @file Driver_PORT.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief PORT pin control driver for S32K144.
+ * @version 0.1
+ * @date 2025-11-03
+ *
+ * A board describes its pins once, as a table of port_pin_config_t.
+ * PORT_ConfigPins() enables the clocks of the ports it uses and then, per port
+ * and per half (pins 0..15, 16..31), groups the pins with the same PCR value
+ * and writes each group with one global store: GPCLR/GPCHR for PCR[15:0]
+ * (mux, pull, drive strength, passive filter) and GICLR/GICHR for PCR[31:16]
+ * (IRQC). A typical board with a few pin kinds per port needs a handful of
+ * stores instead of a read-modify-write per pin.
+ *
+ * PORT_PlanWrites() produces the same stores as data, so a board table can
+ * be checked on the host.
+ */
+
+#ifndef DRIVER_PORT_H_
+#define DRIVER_PORT_H_
+
+#include "Driver_Common.h"
+#include "s32k144_pins.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define PORT_PINS_PER_PORT          32U
+#define PORT_PINS_PER_GLOBAL        16U
+
+/**
+ * @brief PORT driver status codes.
+ *
+ * PORT_STATUS_SUCCESS  Operation completed successfully.
+ * PORT_STATUS_ERROR    Invalid or duplicated pin, invalid setting, or the
+ *                      port clock could not be enabled.
+ */
+typedef enum
+{
+    PORT_STATUS_SUCCESS = 0,
+    PORT_STATUS_ERROR = -1
+} PORT_STATUS_t;
+
+/**
+ * @brief Pin function (PCR[MUX]); ALTn meanings are in the pin muxing table.
+ */
+typedef enum
+{
+    PORT_MUX_ANALOG = 0U,
+    PORT_MUX_GPIO = 1U,
+    PORT_MUX_ALT2 = 2U,
+    PORT_MUX_ALT3 = 3U,
+    PORT_MUX_ALT4 = 4U,
+    PORT_MUX_ALT5 = 5U,
+    PORT_MUX_ALT6 = 6U,
+    PORT_MUX_ALT7 = 7U
+} PORT_MUX_t;
+
+/**
+ * @brief Internal pull resistor (PCR[PE], PCR[PS]).
+ */
+typedef enum
+{
+    PORT_PULL_NONE = 0U,
+    PORT_PULL_DOWN = 1U,
+    PORT_PULL_UP = 2U
+} PORT_PULL_t;
+
+/**
+ * @brief Output drive strength (PCR[DSE], high only on high-drive pins).
+ */
+typedef enum
+{
+    PORT_DRIVE_LOW = 0U,
+    PORT_DRIVE_HIGH = 1U
+} PORT_DRIVE_t;
+
+/**
+ * @brief Interrupt/DMA request on the pin (PCR[IRQC] encoding).
+ */
+typedef enum
+{
+    PORT_IRQC_DISABLED = 0x0U,
+    PORT_IRQC_DMA_RISING = 0x1U,
+    PORT_IRQC_DMA_FALLING = 0x2U,
+    PORT_IRQC_DMA_EITHER = 0x3U,
+    PORT_IRQC_LOGIC_ZERO = 0x8U,
+    PORT_IRQC_RISING = 0x9U,
+    PORT_IRQC_FALLING = 0xAU,
+    PORT_IRQC_EITHER = 0xBU,
+    PORT_IRQC_LOGIC_ONE = 0xCU
+} PORT_IRQC_t;
+
+/**
+ * @brief One entry of a board pin table.
+ */
+typedef struct
+{
+    PinName_t pin;
+    PORT_MUX_t mux;
+    PORT_PULL_t pull;
+    PORT_DRIVE_t drive;
+    bool passive_filter;
+    PORT_IRQC_t irqc;
+} port_pin_config_t;
+
+/**
+ * @brief Global pin/interrupt control registers, by offset in PORT_Type.
+ */
+typedef enum
+{
+    PORT_GLOBAL_GPCLR = 0x80U,
+    PORT_GLOBAL_GPCHR = 0x84U,
+    PORT_GLOBAL_GICLR = 0x88U,
+    PORT_GLOBAL_GICHR = 0x8CU
+} PORT_GLOBAL_REG_t;
+
+/**
+ * @brief One global store planned by PORT_PlanWrites().
+ */
+typedef struct
+{
+    uint8_t port;               /* PORT_A..PORT_E */
+    PORT_GLOBAL_REG_t reg;
+    uint32_t value;             /* pin enables and data, as written */
+} port_global_write_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief PCR value of a table entry (ISF and LK clear).
+ */
+uint32_t PORT_PinValue(const port_pin_config_t *config);
+
+/**
+ * @brief Check a pin table: valid pins and settings, no pin listed twice.
+ *
+ * @return PORT_STATUS_t SUCCESS or ERROR.
+ */
+PORT_STATUS_t PORT_CheckPins(const port_pin_config_t *pins, uint32_t count);
+
+/**
+ * @brief Apply a pin table with grouped global stores.
+ *
+ * The table is checked first and nothing is written if it is invalid. Pins
+ * not in the table keep their configuration. Locked pins (PCR[LK]) ignore
+ * the global stores.
+ *
+ * @param pins Pin table.
+ * @param count Number of entries.
+ * @return PORT_STATUS_t SUCCESS or ERROR.
+ */
+PORT_STATUS_t PORT_ConfigPins(const port_pin_config_t *pins, uint32_t count);
+
+/**
+ * @brief Plan the stores PORT_ConfigPins() makes for a pin table.
+ *
+ * Writes are in the order PORT_ConfigPins() makes them.
+ *
+ * @param pins Pin table.
+ * @param count Number of entries.
+ * @param writes Receives up to max_writes stores (may be NULL if max_writes is 0).
+ * @param max_writes Size of writes.
+ * @return uint32_t Number of stores needed, 0 for an empty or invalid table.
+ */
+uint32_t PORT_PlanWrites(const port_pin_config_t *pins, uint32_t count,
+                         port_global_write_t *writes, uint32_t max_writes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_PORT_H_ */
@@ -207,12 +207,12 @@ SCG_STATUS_t SCG_SPLL_NormalRun_80Mhz(void);
 SCG_STATUS_t SCG_SPLL_NormalRun_64Mhz(void);
 
 /**
- * @brief Preset: HSRUN mode using SPLL targeting ~112MHz core clock.
+ * @brief Preset: HSRUN mode using SPLL targeting ~112MHz core clock (HCCR, call in HSRUN).
  */
 SCG_STATUS_t SCG_SPLL_HSRun_112Mhz(void);
 
 /**
- * @brief Preset: HSRUN mode using SPLL targeting ~80MHz core clock.
+ * @brief Preset: HSRUN mode using SPLL targeting ~80MHz core clock (HCCR, call in HSRUN).
  */
 SCG_STATUS_t SCG_SPLL_HSRun_80Mhz(void);
 
@@ -225,21 +225,28 @@ SCG_STATUS_t SCG_SIRC_VLPRRun_4Mhz(void);
 /**
  * @brief Retrieve the current bus clock frequency (Hz).
  * 
- * Implementation pending – will derive from active source + divider settings.
+ * Derived from the active system source, DIVCORE and DIVBUS.
  *
- * @return uint32_t Bus frequency in Hz (placeholder until implemented).
+ * @return uint32_t Bus frequency in Hz (0 if the source is unknown).
  */
 uint32_t SCG_GetBusClock(void);
 
 /**
  * @brief Retrieve the current core clock frequency (Hz).
  * 
- * Implementation pending – will compute based on CSR SCS field and core divider.
+ * Computed from the CSR SCS field and the core divider. This is also SYS_CLK.
  *
- * @return uint32_t Core frequency in Hz (placeholder until implemented).
+ * @return uint32_t Core frequency in Hz (0 if the source is unknown).
  */
 uint32_t SCG_GetCoreClock(void);
 
+/**
+ * @brief Retrieve the SOSCDIV2_CLK frequency (Hz) used by asynchronous peripherals.
+ *
+ * @return uint32_t SOSCDIV2 frequency in Hz (0 if disabled or SOSC not valid).
+ */
+uint32_t SCG_GetSoscDiv2Clock(void);
+
 #ifdef __cplusplus
 }
 #endif
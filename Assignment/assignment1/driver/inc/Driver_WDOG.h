@@ -0,0 +1,183 @@
+/**
+ * @file Driver_WDOG.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Watchdog timer (WDOG) driver for S32K144.
+ * @version 0.1
+ * @date 2025-11-07
+ *
+ * SystemInit() leaves the WDOG either disabled (DISABLE_WDOG = 1, debug
+ * builds) or running from LPO with the longest timeout (DISABLE_WDOG = 0),
+ * in both cases with CS[UPDATE] set. WDOG_Init() then installs the
+ * application configuration with the 32-bit unlock sequence:
+ *
+ *   static const wdog_config_t s_wdog =
+ *   {
+ *       WDOG_CLK_LPO, false, 12800U, 6400U, true, false, false, false, false
+ *   };
+ *
+ *   WDOG_Init(&s_wdog);    100 ms timeout, refreshes before 50 ms reset
+ *
+ * CMD32EN is always set, so WDOG_Refresh() is a single 32-bit store of the
+ * refresh key to CNT: no interrupt masking around a 16-bit pair, cheap
+ * enough to be inlined at every refresh point.
+ *
+ * In window mode a refresh while CNT is still below WIN resets the MCU as
+ * well, WDOG_IsWindowOpen() tells whether a refresh is allowed now. With
+ * the interrupt enabled WDOG_EWM_IRQn is raised 128 bus clocks before the
+ * reset, long enough to save a few words (see wdog_service.h).
+ */
+
+#ifndef DRIVER_WDOG_H_
+#define DRIVER_WDOG_H_
+
+#include "Driver_Common.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define WDOG_LPO_HZ                 128000U
+/* Counter clock divider with prescaler set */
+#define WDOG_PRESCALER              256U
+
+/**
+ * @brief WDOG driver status codes.
+ *
+ * WDOG_STATUS_SUCCESS  Operation completed successfully.
+ * WDOG_STATUS_TIMEOUT  The unlock or the reconfiguration was not confirmed.
+ * WDOG_STATUS_ERROR    Invalid configuration, clock not running, or the
+ *                      configuration is locked until the next reset.
+ */
+typedef enum
+{
+    WDOG_STATUS_SUCCESS = 0,
+    WDOG_STATUS_TIMEOUT = -1,
+    WDOG_STATUS_ERROR = -2
+} WDOG_STATUS_t;
+
+/**
+ * @brief Counter clock, CS[CLK] encoding.
+ *
+ * LPO keeps counting in every mode; SOSC stops in VLPS, and in STOP unless
+ * the SCG keeps it enabled there.
+ */
+typedef enum
+{
+    WDOG_CLK_BUS = 0,
+    WDOG_CLK_LPO = 1,
+    WDOG_CLK_SOSC = 2,
+    WDOG_CLK_SIRC = 3
+} WDOG_CLK_t;
+
+/**
+ * @brief WDOG configuration.
+ *
+ * clock        Counter clock.
+ * prescaler    Divide the counter clock by WDOG_PRESCALER.
+ * timeout      TOVAL, counter ticks from refresh to reset, at least 1.
+ * window       WIN, earliest counter value for a refresh; 0 disables window
+ *              mode, otherwise below timeout.
+ * interrupt    Raise WDOG_EWM_IRQn 128 bus clocks before the reset.
+ * debug        Keep counting while the core is halted by the debugger.
+ * wait         Keep counting in WAIT/VLPW.
+ * stop         Keep counting in STOP/VLPS.
+ * lock         Clear CS[UPDATE]: no further WDOG_Init() until reset.
+ */
+typedef struct
+{
+    WDOG_CLK_t clock;
+    bool prescaler;
+    uint16_t timeout;
+    uint16_t window;
+    bool interrupt;
+    bool debug;
+    bool wait;
+    bool stop;
+    bool lock;
+} wdog_config_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Unlock the WDOG and write WIN, TOVAL and CS, enabled.
+ *
+ * Runs with interrupts masked between the unlock and the CS write, which
+ * must follow within 128 bus clocks. The counter restarts from 0.
+ *
+ * @return WDOG_STATUS_t SUCCESS, TIMEOUT if ULK/RCS did not follow, ERROR
+ *         for a bad configuration, a stopped clock or a locked WDOG.
+ */
+WDOG_STATUS_t WDOG_Init(const wdog_config_t *config);
+
+/**
+ * @brief Restart the counter (32-bit refresh key).
+ *
+ * In window mode only call it when WDOG_IsWindowOpen(), an early refresh
+ * resets the MCU.
+ */
+static inline void WDOG_Refresh(void)
+{
+    IP_WDOG->CNT = FEATURE_WDOG_TRIGGER_VALUE;
+}
+
+/**
+ * @brief Whether a refresh is accepted now: no window mode, or CNT >= WIN.
+ */
+static inline bool WDOG_IsWindowOpen(void)
+{
+    return ((IP_WDOG->CS & WDOG_CS_WIN_MASK) == 0U) || (IP_WDOG->CNT >= IP_WDOG->WIN);
+}
+
+/**
+ * @brief Counter value, ticks since the last refresh.
+ */
+static inline uint16_t WDOG_GetCounter(void)
+{
+    return (uint16_t)IP_WDOG->CNT;
+}
+
+/**
+ * @brief Whether the WDOG interrupt flag is set (reset follows).
+ */
+static inline bool WDOG_IsInterruptPending(void)
+{
+    return ((IP_WDOG->CS & WDOG_CS_FLG_MASK) != 0U);
+}
+
+/**
+ * @brief Whether the last reset was caused by the WDOG (RCM_SRS).
+ */
+static inline bool WDOG_CausedReset(void)
+{
+    return ((IP_RCM->SRS & RCM_SRS_WDOG_MASK) != 0U);
+}
+
+/**
+ * @brief Counter ticks for a time, for timeout/window.
+ *
+ * @param ms Time in milliseconds.
+ * @param clock_hz Counter clock before the prescaler (WDOG_LPO_HZ for LPO).
+ * @param prescaler As in wdog_config_t.
+ * @return uint32_t Ticks; above 0xFFFF does not fit TOVAL.
+ */
+static inline uint32_t WDOG_MsToTicks(uint32_t ms, uint32_t clock_hz, bool prescaler)
+{
+    uint64_t ticks = ((uint64_t)clock_hz * ms) / 1000U;
+
+    return (uint32_t)(prescaler ? (ticks / WDOG_PRESCALER) : ticks);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_WDOG_H_ */
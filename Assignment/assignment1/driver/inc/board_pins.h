@@ -0,0 +1,254 @@
+/**
+ * @file board_pins.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Compile-time board pin map: tables, masks and conflict checks.
+ * @version 0.1
+ * @date 2025-11-04
+ *
+ * A board lists every pin it uses once, as an X-macro, and then includes this
+ * header:
+ *
+ *   #define BOARD_PINS(X, a) \
+ *       X(a, LED_RED, D, 15, GPIO,   PTD15,    NONE, LOW, false, DISABLED, OUT_HIGH) \
+ *       X(a, POT,     A,  6, ANALOG, ADC0_SE2, NONE, LOW, false, DISABLED, NONE)
+ *   #include "board_pins.h"
+ *
+ * Fields after the pass-through argument a:
+ *   name     board function, gives BOARD_<name>_PIN/_PORT/_MASK/_GPIO
+ *   port     port letter A..E
+ *   pin      pin number in the port
+ *   mux      PORT_MUX_t suffix (ANALOG, GPIO, ALT2..ALT7)
+ *   signal   the peripheral signal routed to the pin (LPUART1_TX, ADC0_SE2),
+ *            or the pin itself (PTD15) for GPIO
+ *   pull     PORT_PULL_t suffix (NONE, DOWN, UP)
+ *   drive    PORT_DRIVE_t suffix (LOW, HIGH)
+ *   filter   passive input filter, true/false
+ *   irqc     PORT_IRQC_t suffix (DISABLED, RISING, FALLING, ...)
+ *   dir      GPIO direction and reset level: NONE, IN, OUT_LOW, OUT_HIGH
+ *
+ * Everything below is resolved by the compiler:
+ *   BOARD_PORT_TABLE        port_pin_config_t initializer for PORT_ConfigPins()
+ *                           and PORT_PlanWrites()
+ *   BOARD_PIN_COUNT         number of entries
+ *   BOARD_PORTS_USED        ports to clock gate, bit n = PORT n (PCC_PORTA + 4n)
+ *   BOARD_USED_MASK(p)      pins of port p (PORT_A..PORT_E) in the map
+ *   BOARD_GPIO_OUT_MASK(p)  GPIO outputs of port p (PDDR)
+ *   BOARD_GPIO_HIGH_MASK(p) outputs of port p starting high (PSOR)
+ *   BOARD_PORT_INIT(p)      statements writing the PCRs of port p: one
+ *                           GPCLR/GPCHR store per distinct PCR[15:0] value
+ *                           and one GICLR/GICHR store per distinct IRQC in
+ *                           each half, data and pin masks as constants. Only
+ *                           the stores survive the compiler, even at -O0;
+ *                           guard it with #if on BOARD_PORTS_USED.
+ *
+ * A build fails when the map is inconsistent:
+ *   - two functions on one pin:      redeclaration of BOARD_CLAIM_PIN_<PTxn>
+ *   - one signal on two pins:        redeclaration of BOARD_CLAIM_SIGNAL_<signal>
+ *   - a function listed twice:       redeclaration of BOARD_<name>_PIN
+ *   - a pin the part does not have:  PTxn undeclared
+ *   - a GPIO direction on a pin not muxed to GPIO, or an IRQC on a pin
+ *     without an input path:         negative size of board_check_<name>_*
+ *   - a signal the pin does not carry on that mux setting:
+ *                                    negative size of board_check_<name>_signal
+ *   - a signal not in the location list below:
+ *                                    BOARD_SIGNAL_<signal> undeclared
+ *
+ * Signal locations come from the IO signal description table of the
+ * reference manual: every PTxn as GPIO, and the peripheral signals the
+ * boards use so far. Add a signal here, with all its pin/ALT options, before
+ * using it in a map.
+ */
+
+#ifndef BOARD_PINS_H_
+#define BOARD_PINS_H_
+
+#include "Driver_PORT.h"
+
+#ifndef BOARD_PINS
+#error "Define BOARD_PINS(X, a) before including board_pins.h"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define BOARD_DIR_NONE              0
+#define BOARD_DIR_IN                1
+#define BOARD_DIR_OUT_LOW           2
+#define BOARD_DIR_OUT_HIGH          3
+
+#define BOARD_GPIO_STEP             (IP_PTB_BASE - IP_PTA_BASE)
+#define BOARD_PORT_STEP             (IP_PORTB_BASE - IP_PORTA_BASE)
+
+/*
+ * Signal locations: a pin and mux setting packed into 15 bits (+1, so 0 is
+ * "no option"), up to four options per signal.
+ */
+#define BOARD_SIGNAL_AT(pin, mux)   (((((unsigned long long)(pin)) << 3) | PORT_MUX_##mux) + 1ULL)
+#define BOARD_SIGNAL_2(p1, m1, p2, m2) \
+    (BOARD_SIGNAL_AT(p1, m1) | (BOARD_SIGNAL_AT(p2, m2) << 15))
+#define BOARD_SIGNAL_3(p1, m1, p2, m2, p3, m3) \
+    (BOARD_SIGNAL_2(p1, m1, p2, m2) | (BOARD_SIGNAL_AT(p3, m3) << 30))
+#define BOARD_SIGNAL_HAS(sig, loc) \
+    ((((sig) & 0x7FFFULL) == (loc)) || ((((sig) >> 15) & 0x7FFFULL) == (loc)) || \
+     ((((sig) >> 30) & 0x7FFFULL) == (loc)) || ((((sig) >> 45) & 0x7FFFULL) == (loc)))
+
+/* ADC inputs (analog, ALT0) */
+#define BOARD_SIGNAL_ADC0_SE2       BOARD_SIGNAL_AT(PTA6, ANALOG)
+
+/* FTM0 channels */
+#define BOARD_SIGNAL_FTM0_CH0       BOARD_SIGNAL_2(PTD15, ALT2, PTC0, ALT2)
+#define BOARD_SIGNAL_FTM0_CH1       BOARD_SIGNAL_2(PTD16, ALT2, PTC1, ALT2)
+#define BOARD_SIGNAL_FTM0_CH2       BOARD_SIGNAL_2(PTD0, ALT2, PTC2, ALT2)
+#define BOARD_SIGNAL_FTM0_CH3       BOARD_SIGNAL_AT(PTC3, ALT2)
+
+/* LPUART0/1 */
+#define BOARD_SIGNAL_LPUART0_RX     BOARD_SIGNAL_3(PTB0, ALT2, PTA2, ALT6, PTC2, ALT4)
+#define BOARD_SIGNAL_LPUART0_TX     BOARD_SIGNAL_3(PTB1, ALT2, PTA3, ALT6, PTC3, ALT4)
+#define BOARD_SIGNAL_LPUART1_RX     BOARD_SIGNAL_2(PTC6, ALT2, PTC8, ALT2)
+#define BOARD_SIGNAL_LPUART1_TX     BOARD_SIGNAL_2(PTC7, ALT2, PTC9, ALT2)
+
+/* FlexCAN0 */
+#define BOARD_SIGNAL_CAN0_RX        BOARD_SIGNAL_2(PTE4, ALT5, PTC2, ALT3)
+#define BOARD_SIGNAL_CAN0_TX        BOARD_SIGNAL_2(PTE5, ALT5, PTC3, ALT3)
+
+/* Every pin is its own GPIO signal (ALT1) */
+#define BOARD_X_GPIO_SIGNAL(port, pin) \
+    BOARD_SIGNAL_PT##port##pin = (int)BOARD_SIGNAL_AT(PT##port##pin, GPIO),
+#define BOARD_GPIO_SIGNALS_0_16(port) \
+    BOARD_X_GPIO_SIGNAL(port, 0) BOARD_X_GPIO_SIGNAL(port, 1) BOARD_X_GPIO_SIGNAL(port, 2) \
+    BOARD_X_GPIO_SIGNAL(port, 3) BOARD_X_GPIO_SIGNAL(port, 4) BOARD_X_GPIO_SIGNAL(port, 5) \
+    BOARD_X_GPIO_SIGNAL(port, 6) BOARD_X_GPIO_SIGNAL(port, 7) BOARD_X_GPIO_SIGNAL(port, 8) \
+    BOARD_X_GPIO_SIGNAL(port, 9) BOARD_X_GPIO_SIGNAL(port, 10) BOARD_X_GPIO_SIGNAL(port, 11) \
+    BOARD_X_GPIO_SIGNAL(port, 12) BOARD_X_GPIO_SIGNAL(port, 13) BOARD_X_GPIO_SIGNAL(port, 14) \
+    BOARD_X_GPIO_SIGNAL(port, 15) BOARD_X_GPIO_SIGNAL(port, 16)
+
+/* PCR value of an entry, as PORT_PinValue() computes it */
+#define BOARD_PCR(mux, pull, drive, filter, irqc) \
+    (PORT_PCR_MUX(PORT_MUX_##mux) | PORT_PCR_IRQC(PORT_IRQC_##irqc) | \
+     ((PORT_PULL_##pull != PORT_PULL_NONE) ? PORT_PCR_PE_MASK : 0U) | \
+     ((PORT_PULL_##pull == PORT_PULL_UP) ? PORT_PCR_PS_MASK : 0U) | \
+     ((PORT_DRIVE_##drive == PORT_DRIVE_HIGH) ? PORT_PCR_DSE_MASK : 0U) | \
+     ((filter) ? PORT_PCR_PFE_MASK : 0U))
+
+/*
+ * The 128 PCR[15:0] values a map can produce, by index: bit 0 PS, 1 PE,
+ * 2 PFE, 3 DSE, 6..4 MUX. BOARD_PORT_INIT() tries each index per half and
+ * keeps the stores whose pin mask is not 0.
+ */
+#define BOARD_PCR_LOW(v) \
+    (PORT_PCR_MUX((v) >> 4) | ((((v) & 8U) != 0U) ? PORT_PCR_DSE_MASK : 0U) | \
+     ((((v) & 4U) != 0U) ? PORT_PCR_PFE_MASK : 0U) | ((((v) & 2U) != 0U) ? PORT_PCR_PE_MASK : 0U) | \
+     ((((v) & 1U) != 0U) ? PORT_PCR_PS_MASK : 0U))
+
+/* Fields of the (port, half, value) argument of the group expansions */
+#define BOARD_ARG_PORT(p, h, v)     p
+#define BOARD_ARG_HALF(p, h, v)     h
+#define BOARD_ARG_VALUE(p, h, v)    v
+
+#define BOARD_REP2(M, p, h, v)      M(p, h, v) M(p, h, (v) + 1U)
+#define BOARD_REP4(M, p, h, v)      BOARD_REP2(M, p, h, v) BOARD_REP2(M, p, h, (v) + 2U)
+#define BOARD_REP8(M, p, h, v)      BOARD_REP4(M, p, h, v) BOARD_REP4(M, p, h, (v) + 4U)
+#define BOARD_REP16(M, p, h, v)     BOARD_REP8(M, p, h, v) BOARD_REP8(M, p, h, (v) + 8U)
+#define BOARD_REP32(M, p, h, v)     BOARD_REP16(M, p, h, v) BOARD_REP16(M, p, h, (v) + 16U)
+#define BOARD_REP64(M, p, h, v)     BOARD_REP32(M, p, h, v) BOARD_REP32(M, p, h, (v) + 32U)
+#define BOARD_REP128(M, p, h, v)    BOARD_REP64(M, p, h, v) BOARD_REP64(M, p, h, (v) + 64U)
+
+/* Per-entry expansions */
+#define BOARD_X_CLAIM_PIN(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    BOARD_CLAIM_PIN_PT##port##pin,
+#define BOARD_X_CLAIM_SIGNAL(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    BOARD_CLAIM_SIGNAL_##signal,
+#define BOARD_X_NAMES(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    BOARD_##name##_PIN = PT##port##pin, \
+    BOARD_##name##_PORT = PORT_##port, \
+    BOARD_##name##_MASK = (1 << (pin)),
+#define BOARD_X_INDEX(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    BOARD_INDEX_##name,
+#define BOARD_X_CHECKS(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    typedef char board_check_##name##_gpio_mux[((BOARD_DIR_##dir == BOARD_DIR_NONE) || \
+                                                (PORT_MUX_##mux == PORT_MUX_GPIO)) ? 1 : -1]; \
+    typedef char board_check_##name##_irq_input[((PORT_IRQC_##irqc == PORT_IRQC_DISABLED) || \
+                                                 (PORT_MUX_##mux != PORT_MUX_ANALOG)) ? 1 : -1]; \
+    typedef char board_check_##name##_signal[BOARD_SIGNAL_HAS(BOARD_SIGNAL_##signal, \
+                                                              BOARD_SIGNAL_AT(PT##port##pin, mux)) ? 1 : -1];
+#define BOARD_X_PORT_ENTRY(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    { PT##port##pin, PORT_MUX_##mux, PORT_PULL_##pull, PORT_DRIVE_##drive, (filter), PORT_IRQC_##irqc },
+#define BOARD_X_PORT_BIT(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    | (1UL << PORT_##port)
+#define BOARD_X_USED_BIT(p, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    | ((PORT_##port == (p)) ? (1UL << (pin)) : 0UL)
+#define BOARD_X_OUT_BIT(p, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    | (((PORT_##port == (p)) && (BOARD_DIR_##dir >= BOARD_DIR_OUT_LOW)) ? (1UL << (pin)) : 0UL)
+#define BOARD_X_HIGH_BIT(p, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    | (((PORT_##port == (p)) && (BOARD_DIR_##dir == BOARD_DIR_OUT_HIGH)) ? (1UL << (pin)) : 0UL)
+/* a = (port, half, value): pin of the half whose PCR[15:0] / IRQC is value */
+#define BOARD_X_PCR_BIT(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    | (((PORT_##port == BOARD_ARG_PORT a) && (((pin) / 16) == BOARD_ARG_HALF a) && \
+        ((BOARD_PCR(mux, pull, drive, filter, irqc) & 0xFFFFUL) == BOARD_PCR_LOW(BOARD_ARG_VALUE a))) ? \
+       (1UL << ((pin) % 16)) : 0UL)
+#define BOARD_X_IRQ_BIT(a, name, port, pin, mux, signal, pull, drive, filter, irqc, dir) \
+    | (((PORT_##port == BOARD_ARG_PORT a) && (((pin) / 16) == BOARD_ARG_HALF a) && \
+        ((unsigned long)PORT_IRQC_##irqc == (BOARD_ARG_VALUE a))) ? (1UL << ((pin) % 16)) : 0UL)
+
+/* One global store per group, kept only if the group has pins */
+#define BOARD_PCR_GROUP(p, h, v) \
+    if ((0UL BOARD_PINS(BOARD_X_PCR_BIT, (p, h, v))) != 0UL) \
+    { \
+        (&BOARD_PORT(p)->GPCLR)[h] = PORT_GPCLR_GPWE(0UL BOARD_PINS(BOARD_X_PCR_BIT, (p, h, v))) | \
+                                     PORT_GPCLR_GPWD(BOARD_PCR_LOW(v)); \
+    }
+#define BOARD_IRQ_GROUP(p, h, v) \
+    if ((0UL BOARD_PINS(BOARD_X_IRQ_BIT, (p, h, v))) != 0UL) \
+    { \
+        (&BOARD_PORT(p)->GICLR)[h] = PORT_GICLR_GIWE(0UL BOARD_PINS(BOARD_X_IRQ_BIT, (p, h, v))) | \
+                                     PORT_GICLR_GIWD(v); \
+    }
+
+enum
+{
+    BOARD_GPIO_SIGNALS_0_16(A) BOARD_X_GPIO_SIGNAL(A, 17)
+    BOARD_GPIO_SIGNALS_0_16(B) BOARD_X_GPIO_SIGNAL(B, 17)
+    BOARD_GPIO_SIGNALS_0_16(C) BOARD_X_GPIO_SIGNAL(C, 17)
+    BOARD_GPIO_SIGNALS_0_16(D) BOARD_X_GPIO_SIGNAL(D, 17)
+    BOARD_GPIO_SIGNALS_0_16(E)
+    BOARD_GPIO_SIGNALS_END_
+};
+
+/* Conflicts: every pin and every signal may be claimed once */
+enum { BOARD_PINS(BOARD_X_CLAIM_PIN, 0) BOARD_CLAIM_PIN_COUNT_ };
+enum { BOARD_PINS(BOARD_X_CLAIM_SIGNAL, 0) BOARD_CLAIM_SIGNAL_COUNT_ };
+BOARD_PINS(BOARD_X_CHECKS, 0)
+
+enum { BOARD_PINS(BOARD_X_NAMES, 0) BOARD_NAMES_END_ };
+enum { BOARD_PINS(BOARD_X_INDEX, 0) BOARD_PIN_COUNT };
+
+#define BOARD_PORT_TABLE            { BOARD_PINS(BOARD_X_PORT_ENTRY, 0) }
+#define BOARD_PORTS_USED            (0UL BOARD_PINS(BOARD_X_PORT_BIT, 0))
+#define BOARD_USED_MASK(p)          (0UL BOARD_PINS(BOARD_X_USED_BIT, p))
+#define BOARD_GPIO_OUT_MASK(p)      (0UL BOARD_PINS(BOARD_X_OUT_BIT, p))
+#define BOARD_GPIO_HIGH_MASK(p)     (0UL BOARD_PINS(BOARD_X_HIGH_BIT, p))
+
+/* GPIO block of a board function, e.g. BOARD_GPIO(LED_RED)->PCOR = BOARD_LED_RED_MASK */
+#define BOARD_GPIO(name)            ((GPIO_Type *)(IP_PTA_BASE + ((uint32_t)BOARD_##name##_PORT * BOARD_GPIO_STEP)))
+
+/* PORT block of a port index */
+#define BOARD_PORT(p)               ((PORT_Type *)(IP_PORTA_BASE + ((uint32_t)(p) * BOARD_PORT_STEP)))
+
+/* PCRs of the map's pins on port p, as grouped global stores */
+#define BOARD_PORT_INIT(p) \
+    BOARD_REP128(BOARD_PCR_GROUP, p, 0, 0U) \
+    BOARD_REP128(BOARD_PCR_GROUP, p, 1, 0U) \
+    BOARD_REP16(BOARD_IRQ_GROUP, p, 0, 0U) \
+    BOARD_REP16(BOARD_IRQ_GROUP, p, 1, 0U)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOARD_PINS_H_ */
@@ -0,0 +1,125 @@
+/**
+ * @file crc_sw.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Table-driven software CRC (slice-by-4/8), parameterised like the CRC module.
+ * @version 0.1
+ * @date 2025-10-24
+ *
+ * Register free, so it builds for the host as well as the target. Used on its
+ * own or by Driver_CRC when the CRC module is owned by someone else.
+ *
+ * The algorithm is described Rocksoft-style: width, polynomial (normal form),
+ * initial value, input/output reflection and final XOR. Slice-by-N reads N
+ * bytes per step through N lookup tables of 256 entries each.
+ */
+
+#ifndef CRC_SW_H_
+#define CRC_SW_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Lookup table words needed for a slice count */
+#define CRC_SW_TABLE_WORDS(slices)      ((uint32_t)(slices) * 256U)
+
+/**
+ * @brief CRC width (CTRL[TCRC]).
+ */
+typedef enum
+{
+    CRC_WIDTH_16 = 0U,
+    CRC_WIDTH_32 = 1U
+} CRC_WIDTH_t;
+
+/**
+ * @brief CRC algorithm parameters.
+ *
+ * polynomial   Normal (MSB-first) form, e.g. 0x04C11DB7 for CRC-32.
+ * seed         Initial register value, not reflected.
+ * reflect_in   Process each input byte LSB first.
+ * reflect_out  Bit-reverse the register before the final XOR.
+ * xor_out      Final XOR value.
+ */
+typedef struct
+{
+    CRC_WIDTH_t width;
+    uint32_t polynomial;
+    uint32_t seed;
+    bool reflect_in;
+    bool reflect_out;
+    uint32_t xor_out;
+} crc_config_t;
+
+/* CRC-32 (IEEE 802.3, zlib), check("123456789") = 0xCBF43926 */
+#define CRC_CONFIG_CRC32            { CRC_WIDTH_32, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU }
+/* CRC-16/CCITT-FALSE, check("123456789") = 0x29B1 */
+#define CRC_CONFIG_CCITT_FALSE      { CRC_WIDTH_16, 0x1021U, 0xFFFFU, false, false, 0x0000U }
+/* CRC-16/KERMIT (reflected CCITT), check("123456789") = 0x2189 */
+#define CRC_CONFIG_CCITT_KERMIT     { CRC_WIDTH_16, 0x1021U, 0x0000U, true, true, 0x0000U }
+
+/**
+ * @brief Lookup tables for one algorithm.
+ *
+ * table must point to CRC_SW_TABLE_WORDS(slices) words owned by the caller
+ * (4 KiB for slice-by-4, 8 KiB for slice-by-8), filled by CRC_SwInitTable().
+ */
+typedef struct
+{
+    crc_config_t config;
+    uint8_t slices;
+    uint32_t (*table)[256];
+} crc_sw_table_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Build the lookup tables for an algorithm.
+ *
+ * @param sw Table descriptor; config, slices (4 or 8) and table must be set.
+ * @return bool false on an invalid slice count or missing table.
+ */
+bool CRC_SwInitTable(crc_sw_table_t *sw);
+
+/**
+ * @brief Return the initial register value for a new computation.
+ */
+uint32_t CRC_SwStart(const crc_sw_table_t *sw);
+
+/**
+ * @brief Feed bytes into a running register.
+ *
+ * @param sw Initialised tables.
+ * @param reg Register value from CRC_SwStart() or a previous update.
+ * @param data Input bytes, any alignment.
+ * @param len Number of bytes.
+ * @return uint32_t Updated register value.
+ */
+uint32_t CRC_SwUpdate(const crc_sw_table_t *sw, uint32_t reg, const uint8_t *data, size_t len);
+
+/**
+ * @brief Apply output reflection and the final XOR to a register value.
+ */
+uint32_t CRC_SwFinish(const crc_sw_table_t *sw, uint32_t reg);
+
+/**
+ * @brief One-shot software CRC of a buffer.
+ */
+uint32_t CRC_SwCompute(const crc_sw_table_t *sw, const uint8_t *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC_SW_H_ */
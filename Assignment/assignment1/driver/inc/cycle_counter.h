@@ -0,0 +1,66 @@
+/**
+ * @file cycle_counter.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief DWT cycle counter for hot path measurements.
+ * @version 0.1
+ * @date 2025-10-28
+ *
+ * Used to fill the cycle columns of Project_Settings/Hot_Paths/
+ * code_ram_functions.txt: measure a function in the normal build and again
+ * in the CODE_RAM_HOT build.
+ *
+ *   uint32_t start = CYCLE_Get();
+ *   hot_function();
+ *   cycles = CYCLE_Get() - start;
+ *
+ * The counter wraps after 2^32 cycles; unsigned subtraction handles one wrap.
+ */
+
+#ifndef CYCLE_COUNTER_H_
+#define CYCLE_COUNTER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Armv7-M debug registers, not part of S32K144.h */
+#define CYCLE_DEMCR                 (*(volatile uint32_t *)0xE000EDFCU)
+#define CYCLE_DEMCR_TRCENA_MASK     0x01000000U
+#define CYCLE_DWT_CTRL              (*(volatile uint32_t *)0xE0001000U)
+#define CYCLE_DWT_CTRL_CYCCNTENA    0x00000001U
+#define CYCLE_DWT_CYCCNT            (*(volatile uint32_t *)0xE0001004U)
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Enable and clear the DWT cycle counter.
+ */
+static inline void CYCLE_Init(void)
+{
+    CYCLE_DEMCR |= CYCLE_DEMCR_TRCENA_MASK;
+    CYCLE_DWT_CYCCNT = 0U;
+    CYCLE_DWT_CTRL |= CYCLE_DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Current core cycle count.
+ */
+static inline uint32_t CYCLE_Get(void)
+{
+    return CYCLE_DWT_CYCCNT;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLE_COUNTER_H_ */
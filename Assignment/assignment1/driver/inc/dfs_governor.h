@@ -0,0 +1,234 @@
+/**
+ * @file dfs_governor.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Dynamic frequency scaling governor over the SCG clock presets.
+ * @version 0.1
+ * @date 2025-11-06
+ *
+ * The board lists its clock levels, slowest first, each one an SCG preset
+ * and, for the SPLL levels, the SPLLCFG the preset's dividers assume
+ * (8 MHz SOSC: SPLL_CLK = 4 MHz * (MULT + 16)):
+ *
+ *   static const dfs_level_t s_levels[] =
+ *   {
+ *       { "FIRC48",  SCG_FIRC_SlowRun_48Mhz,   SCG_RUN_MODE,   0U },
+ *       { "SPLL80",  SCG_SPLL_NormalRun_80Mhz, SCG_RUN_MODE,   SCG_SPLLCFG_MULT(24U) },
+ *       { "SPLL112", SCG_SPLL_HSRun_112Mhz,    SCG_HSRUN_MODE, SCG_SPLLCFG_MULT(12U) }
+ *   };
+ *
+ * SPLL80 divides a 160 MHz SPLL by 2, SPLL112 runs a 112 MHz SPLL undivided.
+ * Without its own SPLLCFG the HSRUN preset would run the core at 160 MHz.
+ *
+ * At the end of every measurement window the application reports how long
+ * the CPU was idle in it (e.g. time spent in PWR_Idle(), in timer ticks):
+ *
+ *   DFS_Sample(idle_ticks, window_ticks);
+ *
+ * The load (busy share, per mille) is compared with two thresholds. After
+ * up_windows windows in a row above up_permille the governor steps one level
+ * up, after down_windows windows in a row below down_permille one level
+ * down; the band between the thresholds and the window counts are the
+ * hysteresis. Stepping up fast and down slowly keeps bursts responsive
+ * without switching clocks on every window.
+ *
+ * Every switch is announced to the registered notifiers twice: DFS_EVENT_PRE
+ * with the old clocks (stop transfers, drain FIFOs) and DFS_EVENT_POST with
+ * the clocks now running (recompute baud rates and prescalers). A level that
+ * fails to apply is backed out and POST reports the level actually in use.
+ *
+ * HSRUN levels switch the SMC to HSRUN first and then apply their preset
+ * (HCCR); RUN levels leave HSRUN first. A level whose SPLLCFG differs from
+ * the running one reprograms the SPLL before that, in RUN from FIRC (the
+ * SPLL cannot be stopped while it clocks the system). After the preset the
+ * core clock must be within the limit of the mode (DFS_RUN_MAX_HZ,
+ * DFS_HSRUN_MAX_HZ); a level above it fails and is backed out, so a wrong
+ * table shows up as a failed DFS_Init() or switch. Flash program/erase is
+ * not allowed in HSRUN, so keep the governor below HSRUN (DFS_SetMaxLevel())
+ * around FTFC operations.
+ *
+ * The governor only touches registers through the SCG presets, SPLLCSR/
+ * SPLLCFG and the SMC, so it runs on the host against host_sim; tools/dfs_trace replays load
+ * traces through it.
+ */
+
+#ifndef DFS_GOVERNOR_H_
+#define DFS_GOVERNOR_H_
+
+#include "Driver_Common.h"
+#include "Driver_SCG.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define DFS_PERMILLE                1000U
+
+/* Core clock limits of the run modes */
+#define DFS_RUN_MAX_HZ              80000000U
+#define DFS_HSRUN_MAX_HZ            112000000U
+
+/**
+ * @brief Governor status codes.
+ *
+ * DFS_STATUS_SUCCESS  Operation completed successfully.
+ * DFS_STATUS_TIMEOUT  The SMC or SCG did not reach the requested state.
+ * DFS_STATUS_ERROR    Invalid argument, the governor is not initialised, or
+ *                     the level runs the core above the limit of its mode.
+ */
+typedef enum
+{
+    DFS_STATUS_SUCCESS = 0,
+    DFS_STATUS_TIMEOUT = -1,
+    DFS_STATUS_ERROR = -2
+} DFS_STATUS_t;
+
+/**
+ * @brief Notification phase of a switch.
+ */
+typedef enum
+{
+    DFS_EVENT_PRE = 0,
+    DFS_EVENT_POST
+} DFS_EVENT_t;
+
+/**
+ * @brief One clock level.
+ *
+ * name     Label for traces.
+ * apply    SCG preset that sets the system clock of the level.
+ * mode     SCG_RUN_MODE or SCG_HSRUN_MODE, the SMC run mode it needs.
+ * spllcfg  SPLLCFG the preset needs, 0 to leave the SPLL as it is. Every
+ *          level on the SPLL should set it.
+ */
+typedef struct
+{
+    const char *name;
+    SCG_STATUS_t (*apply)(void);
+    SCG_CLOCK_MODE_t mode;
+    uint32_t spllcfg;
+} dfs_level_t;
+
+/**
+ * @brief Governor thresholds, load in per mille.
+ */
+typedef struct
+{
+    uint16_t up_permille;       /* step up above this load */
+    uint16_t down_permille;     /* step down below this load, < up_permille */
+    uint8_t up_windows;         /* windows in a row above, at least 1 */
+    uint8_t down_windows;       /* windows in a row below, at least 1 */
+} dfs_config_t;
+
+/**
+ * @brief A switch as seen by a notifier.
+ *
+ * PRE: from/to are the levels, core/bus the clocks still running.
+ * POST: to is the level now in use (from on failure), core/bus its clocks.
+ */
+typedef struct
+{
+    DFS_EVENT_t event;
+    uint8_t from;
+    uint8_t to;
+    uint32_t core_hz;
+    uint32_t bus_hz;
+} dfs_change_t;
+
+/**
+ * @brief Clock change callback of a driver, registered once.
+ *
+ * notify  Called with interrupts as the caller of the switch left them.
+ * ctx     Passed back to notify.
+ */
+typedef struct dfs_notifier
+{
+    void (*notify)(const dfs_change_t *change, void *ctx);
+    void *ctx;
+    struct dfs_notifier *next;
+} dfs_notifier_t;
+
+/**
+ * @brief Switch and window counts.
+ */
+typedef struct
+{
+    uint32_t windows;
+    uint32_t ups;
+    uint32_t downs;
+    uint32_t failures;
+} dfs_stats_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Set the levels and thresholds and apply the starting level.
+ *
+ * Allows HSRUN in SMC_PMPROT if a level needs it (PMPROT is write-once,
+ * see PWR_Init()). Notifiers registered earlier stay registered.
+ *
+ * @param levels Level table, slowest first, kept by reference.
+ * @param count 1..255 levels.
+ * @param config Thresholds, copied.
+ * @param start Level to apply now.
+ * @return DFS_STATUS_t SUCCESS, ERROR for bad arguments or a starting level
+ *         above the limit of its mode, TIMEOUT if it could not be applied.
+ *         After a failed start level the slowest level is applied and the
+ *         governor stays uninitialised.
+ */
+DFS_STATUS_t DFS_Init(const dfs_level_t *levels, uint8_t count, const dfs_config_t *config, uint8_t start);
+
+/**
+ * @brief Add a clock change notifier.
+ *
+ * @return DFS_STATUS_t ERROR for NULL or a notifier already registered.
+ */
+DFS_STATUS_t DFS_RegisterNotifier(dfs_notifier_t *notifier);
+
+/**
+ * @brief Account one measurement window and step the level if due.
+ *
+ * @param idle Idle time in the window (clamped to window).
+ * @param window Window length, same unit; 0 is ignored.
+ * @return uint8_t Level in use after the call.
+ */
+uint8_t DFS_Sample(uint32_t idle, uint32_t window);
+
+/**
+ * @brief Switch to a level now, with notifications; resets the hysteresis.
+ *
+ * A level above the DFS_SetMaxLevel() cap is reduced to the cap.
+ */
+DFS_STATUS_t DFS_SetLevel(uint8_t level);
+
+/**
+ * @brief Cap the levels the governor may use, stepping down if needed.
+ */
+DFS_STATUS_t DFS_SetMaxLevel(uint8_t level);
+
+/**
+ * @brief Level in use.
+ */
+uint8_t DFS_GetLevel(void);
+
+/**
+ * @brief Load of the last window, per mille.
+ */
+uint16_t DFS_GetLoad(void);
+
+/**
+ * @brief Window and switch counts since DFS_Init().
+ */
+void DFS_GetStats(dfs_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DFS_GOVERNOR_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @file fault_capture.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief HardFault/MemManage/BusFault/UsageFault capture to .noinit RAM.
+ * @version 0.1
+ * @date 2025-11-08
+ *
+ * The four fault handlers replace the startup's default loop. Each one
+ * saves r4-r11, the exception frame the core stacked (r0-r3, r12, lr, pc,
+ * xPSR), EXC_RETURN and the stack pointer, CFSR/HFSR/MMFAR/BFAR, the DWT
+ * cycle counter and the last FAULT_ISR_RING ISR entries to a record in
+ * .noinit, then resets the MCU (or stops at a breakpoint if a debugger is
+ * attached). The capture is straight-line loads and stores, about 100
+ * instructions: done in a few microseconds, long before any watchdog
+ * timeout.
+ *
+ * .noinit is only cleared on power-on and LVD resets, so the record is read
+ * after the reset, e.g. sent over CAN or UART as raw bytes:
+ *
+ *   fault_record_t record;
+ *
+ *   if (FAULT_GetRecord(&record))
+ *   {
+ *       send(&record, sizeof(record));
+ *       FAULT_ClearRecord();
+ *   }
+ *
+ * tools/fault_decode/fault_decode.py decodes those bytes (or a debugger dump
+ * of .noinit) and symbolises pc, lr and the ISR ring against the ELF.
+ *
+ * ISR entries are recorded by the handlers themselves, with one call at the
+ * top of each ISR worth tracing:
+ *
+ *   void FTM0_Ovf_Reload_IRQHandler(void)
+ *   {
+ *       FAULT_TraceIsr();
+ *       ...
+ *   }
+ *
+ * Memory faults, bus faults and usage faults only get their own handler
+ * once FAULT_Init() has enabled them; before that they escalate to
+ * HardFault, which is captured as well (HFSR FORCED). The handlers override
+ * the startup's weak ones when the module is linked, i.e. when the
+ * application calls FAULT_Init().
+ */
+
+#ifndef FAULT_CAPTURE_H_
+#define FAULT_CAPTURE_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define FAULT_ISR_RING              8U      /* power of two */
+#define FAULT_RECORD_MAGIC          0x544C4146U     /* "FALT" */
+
+/* fault_record_t.flags */
+#define FAULT_FLAG_FRAME_VALID      0x01U   /* frame[] was read from the stack */
+#define FAULT_FLAG_PSP              0x02U   /* the frame was on the process stack */
+#define FAULT_FLAG_FPU_FRAME        0x04U   /* the frame includes FPU registers */
+
+/**
+ * @brief One traced ISR entry.
+ *
+ * exception  IPSR: IRQ number + 16.
+ * cycles     DWT cycle counter at entry.
+ */
+typedef struct
+{
+    uint32_t exception;
+    uint32_t cycles;
+} fault_isr_entry_t;
+
+/**
+ * @brief Fault record as kept in .noinit and sent off the target.
+ *
+ * The layout is fixed (all 32-bit words, little endian) and is what
+ * tools/fault_decode/fault_decode.py reads; r4_r11 has to stay first.
+ *
+ * r4_r11      Callee-saved registers at the fault.
+ * magic       FAULT_RECORD_MAGIC once a record was written.
+ * count       Faults since power-on.
+ * exception   IPSR of the fault: 3 HardFault, 4 MemManage, 5 BusFault,
+ *             6 UsageFault.
+ * flags       FAULT_FLAG_*.
+ * exc_return  LR on handler entry.
+ * sp          Stack pointer the frame was pushed to.
+ * frame       r0, r1, r2, r3, r12, lr, pc, xPSR of the faulting context.
+ * cfsr..bfar  SCB fault status and address registers.
+ * cycles      DWT cycle counter at the fault.
+ * isr_count   ISR entries traced since power-on (wraps).
+ * isr         Last ISR entries, oldest first.
+ */
+typedef struct
+{
+    uint32_t r4_r11[8];
+    uint32_t magic;
+    uint32_t count;
+    uint32_t exception;
+    uint32_t flags;
+    uint32_t exc_return;
+    uint32_t sp;
+    uint32_t frame[8];
+    uint32_t cfsr;
+    uint32_t hfsr;
+    uint32_t mmfar;
+    uint32_t bfar;
+    uint32_t cycles;
+    uint32_t isr_count;
+    fault_isr_entry_t isr[FAULT_ISR_RING];
+} fault_record_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Enable the MemManage, BusFault and UsageFault handlers and start the
+ *        DWT cycle counter if it is not running.
+ */
+void FAULT_Init(void);
+
+/**
+ * @brief Append the running exception to the ISR ring; call first in an ISR.
+ */
+void FAULT_TraceIsr(void);
+
+/**
+ * @brief Fault record left by the previous run.
+ *
+ * @return bool false if no fault was recorded since power-on or the last
+ *         FAULT_ClearRecord().
+ */
+bool FAULT_GetRecord(fault_record_t *record);
+
+/**
+ * @brief Mark the record as read; the fault count is kept.
+ */
+void FAULT_ClearRecord(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAULT_CAPTURE_H_ */
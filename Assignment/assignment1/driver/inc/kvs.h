@@ -0,0 +1,186 @@
+/**
+ * @file kvs.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Key-value store on an append-only, wear-levelled record log.
+ * @version 0.1
+ * @date 2025-10-26
+ *
+ * Records are appended to the newest ("head") sector and never rewritten;
+ * the oldest ("tail") sector is compacted by copying its still-live records
+ * to the head and erasing it. A RAM index maps each key to its latest record,
+ * so reads are O(1). Writes are staged in a RAM buffer and programmed by
+ * KVS_Commit() in one batch.
+ *
+ * Storage is reached only through kvs_flash_t, so the same code runs on
+ * FlexNVM D-Flash, on emulated EEPROM (see kvs_ftfc.c) and on a simulated
+ * flash array on the host.
+ *
+ * On-flash layout, 8-byte phrase aligned, little endian:
+ *   sector header  magic (u32) | seq (u32) | gc tag (u32) | crc32 (u32)
+ *   record         key (u16) | len (u16) | crc32 (u32) | data, 0xFF padded
+ * A record is valid when its CRC (over key, len and data) matches; len 0 is
+ * a delete. Anything else after the last valid record closes the sector.
+ */
+
+#ifndef KVS_H_
+#define KVS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define KVS_SECTOR_MAX          32U
+#define KVS_PHRASE_SIZE         8U
+#define KVS_RECORD_HEADER_SIZE  8U
+
+/* Flash bytes taken by a record with len data bytes */
+#define KVS_RECORD_SIZE(len)    (KVS_RECORD_HEADER_SIZE + ((((uint32_t)(len)) + 7U) & ~7U))
+
+/**
+ * @brief KVS status codes.
+ *
+ * KVS_STATUS_SUCCESS    Operation completed successfully.
+ * KVS_STATUS_ERROR      Invalid parameter or flash operation failed.
+ * KVS_STATUS_NOT_FOUND  Key has no value (never written or deleted).
+ * KVS_STATUS_FULL       Live data no longer fits after compaction.
+ */
+typedef enum
+{
+    KVS_STATUS_SUCCESS = 0,
+    KVS_STATUS_ERROR = -1,
+    KVS_STATUS_NOT_FOUND = -2,
+    KVS_STATUS_FULL = -3
+} KVS_STATUS_t;
+
+/**
+ * @brief Storage backend.
+ *
+ * base          Address of sector 0, sectors are contiguous.
+ * sector_size   Erase unit in bytes (multiple of KVS_PHRASE_SIZE).
+ * sector_count  Number of sectors (2..KVS_SECTOR_MAX).
+ * read/program/erase  Return 0 on success. program only targets erased,
+ *               phrase aligned space; erase takes a sector address.
+ */
+typedef struct
+{
+    uint32_t base;
+    uint32_t sector_size;
+    uint16_t sector_count;
+    int32_t (*read)(void *ctx, uint32_t address, uint8_t *buf, uint32_t len);
+    int32_t (*program)(void *ctx, uint32_t address, const uint8_t *data, uint32_t len);
+    int32_t (*erase)(void *ctx, uint32_t address);
+    void *ctx;
+} kvs_flash_t;
+
+/**
+ * @brief Store instance. Fields are private to kvs.c.
+ */
+typedef struct
+{
+    const kvs_flash_t *flash;
+    uint32_t *index;
+    uint16_t key_count;
+    uint8_t *buffer;
+    uint16_t buffer_len;
+    uint16_t pending;
+    uint32_t seq[KVS_SECTOR_MAX];
+    uint32_t max_seq;
+    uint16_t head;
+    uint32_t head_used;
+    uint16_t free_count;
+    uint16_t gc_threshold;
+    bool gc_active;
+    bool gc_running;
+    uint16_t gc_sector;
+    uint32_t gc_offset;
+} kvs_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Mount a store, rebuilding the index from flash.
+ *
+ * Unreadable or half-erased sectors are erased; an unformatted area is
+ * formatted. An interrupted compaction is finished before returning.
+ *
+ * @param kvs Instance to initialise.
+ * @param flash Storage backend.
+ * @param index key_count words of RAM for the index.
+ * @param key_count Number of keys (0..key_count-1), below 0xFFFE.
+ * @param buffer Commit buffer, multiple of KVS_PHRASE_SIZE.
+ * @param buffer_len Commit buffer size; bounds the largest value.
+ * @return KVS_STATUS_t SUCCESS or ERROR.
+ */
+KVS_STATUS_t KVS_Mount(kvs_t *kvs, const kvs_flash_t *flash, uint32_t *index, uint16_t key_count,
+                       uint8_t *buffer, uint16_t buffer_len);
+
+/**
+ * @brief Erase all sectors and start an empty log.
+ */
+KVS_STATUS_t KVS_Format(kvs_t *kvs);
+
+/**
+ * @brief Read the latest value of a key, committed or not.
+ *
+ * @param kvs Mounted store.
+ * @param key Key.
+ * @param buf Destination.
+ * @param size Destination size; longer values are truncated.
+ * @param len Stored value length, may be NULL.
+ * @return KVS_STATUS_t SUCCESS, NOT_FOUND or ERROR.
+ */
+KVS_STATUS_t KVS_Get(kvs_t *kvs, uint16_t key, uint8_t *buf, uint16_t size, uint16_t *len);
+
+/**
+ * @brief Stage a new value; it is persistent after KVS_Commit().
+ *
+ * A full buffer or head sector commits on its own.
+ *
+ * @param kvs Mounted store.
+ * @param key Key.
+ * @param data Value bytes.
+ * @param len Value length, 1..buffer_len - KVS_RECORD_HEADER_SIZE.
+ * @return KVS_STATUS_t SUCCESS, ERROR or FULL.
+ */
+KVS_STATUS_t KVS_Set(kvs_t *kvs, uint16_t key, const uint8_t *data, uint16_t len);
+
+/**
+ * @brief Stage a delete.
+ */
+KVS_STATUS_t KVS_Delete(kvs_t *kvs, uint16_t key);
+
+/**
+ * @brief Program all staged records in one write.
+ *
+ * Each record is individually power-fail safe: after a reset every record
+ * is either fully present or absent.
+ */
+KVS_STATUS_t KVS_Commit(kvs_t *kvs);
+
+/**
+ * @brief Do a bounded slice of background compaction.
+ *
+ * Starts compacting the tail sector when fewer than gc_threshold sectors are
+ * free (2 after mount), then moves one record per call and erases the sector
+ * on the last call. Call from the idle loop.
+ *
+ * @return bool true while compaction work remains.
+ */
+bool KVS_CompactStep(kvs_t *kvs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KVS_H_ */
@@ -0,0 +1,54 @@
+/**
+ * @file kvs_ftfc.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief kvs_flash_t backends on the S32K144 FTFC.
+ * @version 0.1
+ * @date 2025-10-26
+ *
+ * Two ways to back the key-value store:
+ *  - D-Flash: the log lives directly in FlexNVM sectors, erased and programmed
+ *    with the FTFC driver. Wear levelling is the log's own sector rotation.
+ *  - EEE: FlexNVM is partitioned (FTFC_ProgramPartition) and FlexRAM runs as
+ *    emulated EEPROM; the log lives in FlexRAM and the hardware backs every
+ *    write up with its own wear levelling. Sectors are virtual, an erase
+ *    rewrites the range with 0xFF.
+ */
+
+#ifndef KVS_FTFC_H_
+#define KVS_FTFC_H_
+
+#include "Driver_Common.h"
+#include "kvs.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Describe a D-Flash area as a kvs_flash_t.
+ *
+ * @param flash Backend to fill.
+ * @param base First sector, FTFC_DFLASH_SECTOR_SIZE aligned, in FlexNVM.
+ * @param sector_count Number of 2 KB sectors.
+ */
+void KVS_FtfcDflash(kvs_flash_t *flash, uint32_t base, uint16_t sector_count);
+
+/**
+ * @brief Describe emulated EEPROM (FlexRAM in EEE mode) as a kvs_flash_t.
+ *
+ * @param flash Backend to fill.
+ * @param sector_size Virtual sector size, multiple of 8.
+ * @param sector_count sector_size * sector_count must fit in the EEE size.
+ */
+void KVS_FtfcEee(kvs_flash_t *flash, uint32_t sector_size, uint16_t sector_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KVS_FTFC_H_ */
@@ -0,0 +1,153 @@
+/**
+ * @file mem_pool.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Fixed-block memory pools with compile-time size classes.
+ * @version 0.1
+ * @date 2025-11-11
+ *
+ * The size classes are an X-macro, in ascending block size. The default
+ * below is replaced by defining POOL_CLASSES in a header named by
+ * POOL_CONFIG_FILE (-DPOOL_CONFIG_FILE='"app_pools.h"'), the same for every
+ * file that includes this one:
+ *
+ *   #define POOL_CLASSES(X, a) \
+ *       X(a,  32, 16, SRAM_U) \
+ *       X(a, 128,  8, SRAM_U) \
+ *       X(a, 512,  2, SRAM_L)
+ *
+ * Fields after the pass-through argument a:
+ *   size     block size in bytes, a multiple of POOL_ALIGN
+ *   count    number of blocks, not 0 (both checked by the compiler)
+ *   region   SRAM_L or SRAM_U: the block storage goes to the .pool_sram_l
+ *            (m_data) or .pool_sram_u (m_data_2) section of the linker
+ *            scripts, e.g. SRAM_L for buffers DMA works on while the core
+ *            runs out of SRAM_U
+ *
+ * POOL_Alloc() takes a block of the smallest class that fits, or of the next
+ * larger one when that class is empty; POOL_Free() finds the class from the
+ * address. Both are a free-list push or pop with PRIMASK set, O(1) apart
+ * from the scan over the (few) classes, and can be called from ISRs.
+ * POOL_GetStats() reports blocks in use, the high-water mark and how often a
+ * class was found empty, to size the classes from a real run.
+ *
+ * Built with -DPOOL_REPLACE_MALLOC, mem_pool.c also defines malloc(), free(),
+ * calloc(), realloc() and their newlib _r variants (used by printf) on top of
+ * the pools, so newlib's allocator is not linked at all; the heap can then be
+ * dropped with -Wl,--defsym=__heap_size__=0. A request larger than the
+ * largest class returns NULL.
+ */
+
+#ifndef MEM_POOL_H_
+#define MEM_POOL_H_
+
+#include "Driver_Common.h"
+
+#ifdef POOL_CONFIG_FILE
+#include POOL_CONFIG_FILE
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#ifndef POOL_CLASSES
+#define POOL_CLASSES(X, a) \
+    X(a,  32, 16, SRAM_U) \
+    X(a,  64,  8, SRAM_U) \
+    X(a, 256,  4, SRAM_L)
+#endif
+
+/* Block alignment and size granularity */
+#define POOL_ALIGN                  8U
+
+#define POOL_X_COUNT(a, size, count, region)    + 1U
+#define POOL_CLASS_COUNT            (0U POOL_CLASSES(POOL_X_COUNT, 0))
+
+/**
+ * @brief Pool status codes.
+ *
+ * POOL_STATUS_SUCCESS  Operation completed successfully.
+ * POOL_STATUS_ERROR    Classes not in ascending size order, a block not
+ *                      from a pool, a detected double free, or a bad index.
+ */
+typedef enum
+{
+    POOL_STATUS_SUCCESS = 0,
+    POOL_STATUS_ERROR = -1
+} POOL_STATUS_t;
+
+/**
+ * @brief Statistics of one size class.
+ *
+ * block_size  Block size in bytes.
+ * blocks      Number of blocks.
+ * used        Blocks allocated now.
+ * high_water  Most blocks allocated at once since POOL_Init().
+ * empty       Requests that found the class empty (served by a larger
+ *             class or failed).
+ */
+typedef struct
+{
+    uint32_t block_size;
+    uint32_t blocks;
+    uint32_t used;
+    uint32_t high_water;
+    uint32_t empty;
+} pool_stats_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Build the free lists and clear the statistics; every block is free
+ *        afterwards. The first POOL_Alloc() calls it if needed.
+ *
+ * @return POOL_STATUS_t ERROR if the class table is invalid.
+ */
+POOL_STATUS_t POOL_Init(void);
+
+/**
+ * @brief Allocate a block of at least size bytes, POOL_ALIGN aligned.
+ *
+ * @return void* NULL if size is 0 or no class that fits has a free block.
+ */
+void *POOL_Alloc(uint32_t size);
+
+/**
+ * @brief Return a block to its class; NULL is ignored.
+ *
+ * A double free is caught, and the lists left intact, when the class has no
+ * block allocated or block is the last one freed to it; other double frees
+ * are not detected.
+ *
+ * @return POOL_STATUS_t ERROR if block is not the start of a pool block or
+ *         a double free was caught.
+ */
+POOL_STATUS_t POOL_Free(void *block);
+
+/**
+ * @brief Block size of the class block belongs to, 0 if it is not a pool block.
+ */
+uint32_t POOL_BlockSize(const void *block);
+
+/**
+ * @brief Statistics of class index (0 .. POOL_CLASS_COUNT - 1, table order).
+ */
+POOL_STATUS_t POOL_GetStats(uint8_t index, pool_stats_t *stats);
+
+/**
+ * @brief Restart the high-water marks and empty counts from the current use.
+ */
+void POOL_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEM_POOL_H_ */
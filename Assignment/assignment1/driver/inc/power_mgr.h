@@ -0,0 +1,180 @@
+/**
+ * @file power_mgr.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Low-power mode manager (SMC WAIT/VLPW/STOP/VLPS) for S32K144.
+ * @version 0.1
+ * @date 2025-11-05
+ *
+ * Peripherals register a constraint once and switch it on while they are
+ * active:
+ *
+ *   static pwr_constraint_t s_uart_pwr = { "LPUART1", PWR_MODE_VLPS, 8000000U };
+ *
+ *   PWR_RegisterConstraint(&s_uart_pwr);
+ *   PWR_SetConstraintActive(&s_uart_pwr, true);    transfer started
+ *   PWR_SetConstraintActive(&s_uart_pwr, false);   transfer done
+ *
+ * The main loop calls PWR_Idle() when it has nothing to do. It enters the
+ * deepest mode every active constraint allows, from lightest to deepest:
+ *
+ *   WAIT  core clock gated, RUN clocks keep running
+ *   VLPW  core clock gated in VLPR: SIRC only, 4 MHz core and bus
+ *   STOP  STOP1, core and bus clocks gated, SCG keeps the RUN sources
+ *   VLPS  core and bus clocks gated, only SIRC/LPO may run
+ *
+ * A constraint with a bus clock need keeps the bus clock running (WAIT or
+ * VLPW), and VLPW only if the VLPR bus clock is enough.
+ *
+ * For VLPW and VLPS the system clock is moved to SIRC through the SCG
+ * profile API and SOSC, FIRC and SPLL are disabled, as VLP entry requires.
+ * On wake the sources are enabled again and the RCCR profile that was active
+ * before the call is restored, before interrupts are taken: the wake-up ISR
+ * runs at the normal clock. The software exit path (from WFI returning to the
+ * restored profile) is timed with the DWT cycle counter and kept per mode;
+ * the hardware wake-up before the first instruction is not included.
+ */
+
+#ifndef POWER_MGR_H_
+#define POWER_MGR_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* VLPR clocks set up by the manager: SIRC 8 MHz, core /2, bus /1, slow /4 */
+#define PWR_VLP_CORE_HZ             4000000U
+#define PWR_VLP_BUS_HZ              4000000U
+
+/**
+ * @brief Power manager status codes.
+ *
+ * PWR_STATUS_SUCCESS  Operation completed successfully.
+ * PWR_STATUS_TIMEOUT  The SMC or SCG did not reach the requested state.
+ * PWR_STATUS_ERROR    Invalid argument, constraint already registered, or a
+ *                     core clock above the VLP limit.
+ */
+typedef enum
+{
+    PWR_STATUS_SUCCESS = 0,
+    PWR_STATUS_TIMEOUT = -1,
+    PWR_STATUS_ERROR = -2
+} PWR_STATUS_t;
+
+/**
+ * @brief Idle modes, lightest first.
+ *
+ * PWR_MODE_RUN  No sleep, PWR_Idle() returns at once.
+ */
+typedef enum
+{
+    PWR_MODE_RUN = 0,
+    PWR_MODE_WAIT,
+    PWR_MODE_VLPW,
+    PWR_MODE_STOP,
+    PWR_MODE_VLPS,
+    PWR_MODE_COUNT
+} PWR_MODE_t;
+
+/**
+ * @brief A peripheral's limit on idle modes, owned by the caller.
+ *
+ * name         Label for debugging.
+ * deepest      Deepest mode the peripheral works in.
+ * min_bus_hz   Bus clock the peripheral needs while active, 0 if none.
+ * The remaining fields belong to the manager.
+ */
+typedef struct pwr_constraint
+{
+    const char *name;
+    PWR_MODE_t deepest;
+    uint32_t min_bus_hz;
+    volatile bool active;
+    struct pwr_constraint *next;
+} pwr_constraint_t;
+
+/**
+ * @brief Wake-up statistics of one mode.
+ *
+ * entries      PWR_Idle() calls that entered the mode.
+ * aborts       VLPS entries aborted by a pending interrupt.
+ * failures     Entries that could not switch clocks or modes.
+ * last_ns      Exit path time of the last entry.
+ * max_ns       Longest exit path time.
+ */
+typedef struct
+{
+    uint32_t entries;
+    uint32_t aborts;
+    uint32_t failures;
+    uint32_t last_ns;
+    uint32_t max_ns;
+} pwr_mode_stats_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Allow the VLP modes, enable VLP biasing and start the cycle counter.
+ *
+ * PMPROT is write-once after reset and is written with AVLP and AHSRUN, as
+ * DFS_Init() does; if it was written without AVLP before, the manager never
+ * goes deeper than STOP.
+ *
+ * @return PWR_STATUS_t SUCCESS, or ERROR if VLP modes stay disallowed.
+ */
+PWR_STATUS_t PWR_Init(void);
+
+/**
+ * @brief Add a constraint (inactive) to the manager.
+ *
+ * @param constraint Caller-owned, stays registered for good.
+ * @return PWR_STATUS_t SUCCESS, or ERROR for NULL, a bad mode or a duplicate.
+ */
+PWR_STATUS_t PWR_RegisterConstraint(pwr_constraint_t *constraint);
+
+/**
+ * @brief Switch a registered constraint on or off; safe from ISRs.
+ */
+void PWR_SetConstraintActive(pwr_constraint_t *constraint, bool active);
+
+/**
+ * @brief Deepest mode all active constraints allow.
+ */
+PWR_MODE_t PWR_GetAllowedMode(void);
+
+/**
+ * @brief Idle hook: sleep in the deepest allowed mode until an interrupt.
+ *
+ * Called with interrupts enabled. The pending interrupt's handler runs after
+ * the clock profile is restored, before this returns. Only RUN can enter a
+ * low-power mode; from HSRUN or VLPR the call waits in WAIT.
+ *
+ * @return PWR_MODE_t Mode that was entered.
+ */
+PWR_MODE_t PWR_Idle(void);
+
+/**
+ * @brief Wake-up statistics of a mode.
+ *
+ * @return PWR_STATUS_t ERROR for a bad mode or NULL.
+ */
+PWR_STATUS_t PWR_GetStats(PWR_MODE_t mode, pwr_mode_stats_t *stats);
+
+/**
+ * @brief Clear the statistics of every mode.
+ */
+void PWR_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_MGR_H_ */
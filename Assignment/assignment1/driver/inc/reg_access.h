@@ -0,0 +1,133 @@
+/**
+ * @file reg_access.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Checked bitfield accessors for S32K144 registers.
+ * @version 0.1
+ * @date 2025-10-30
+ *
+ * Field writes name the register type once and list (FIELD, value) pairs;
+ * all pairs go out in a single store:
+ *
+ *   REG_WRITE(IP_SCG->RCCR, SCG_RCCR, (SCS, 6U), (DIVCORE, 0U), (DIVBUS, 1U));
+ *   REG_MODIFY(IP_PORTC->PCR[12], PORT_PCR, (MUX, 1U), (PE, 1U));
+ *   REG_W1C(IP_LPUART1->STAT, LPUART_STAT, OR, FE);
+ *   n = REG_READ(IP_ADC0->R[0], ADC_R, D);
+ *
+ * The expansion only uses the _MASK/_SHIFT/value macros of S32K144.h, so it
+ * folds to the same code as a hand-written mask expression at any -O level.
+ *
+ * Access classes come from S32K144_fields.h (tools/gen_reg_fields.py). A
+ * field that may not be used the way a macro uses it expands to one of the
+ * REG_ERROR_* identifiers below, which are never declared, so the compiler
+ * stops with their name:
+ * - REG_WRITE/REG_MODIFY on a RO or W1C field,
+ * - REG_W1C on a field that is not W1C,
+ * - REG_READ on a WO field.
+ * REG_MODIFY also keeps the W1C flags of the register at 0 so the
+ * read-modify-write does not clear a pending flag.
+ */
+
+#ifndef REG_ACCESS_H_
+#define REG_ACCESS_H_
+
+#include "../include/S32K144.h"
+#include "../include/S32K144_fields.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Per access class: 0U where allowed, an undeclared identifier otherwise */
+#define REG_CHECK_WRITE_RW          0U
+#define REG_CHECK_WRITE_WO          0U
+#define REG_CHECK_WRITE_RO          REG_ERROR_write_to_read_only_field
+#define REG_CHECK_WRITE_W1C         REG_ERROR_write_to_w1c_field_use_REG_W1C
+
+#define REG_CHECK_READ_RW           0U
+#define REG_CHECK_READ_RO           0U
+#define REG_CHECK_READ_W1C          0U
+#define REG_CHECK_READ_WO           REG_ERROR_read_of_write_only_field
+
+#define REG_CHECK_CLEAR_W1C         0U
+#define REG_CHECK_CLEAR_RW          REG_ERROR_field_is_not_w1c
+#define REG_CHECK_CLEAR_RO          REG_ERROR_field_is_not_w1c
+#define REG_CHECK_CLEAR_WO          REG_ERROR_field_is_not_w1c
+
+#define REG_CAT(a, b)               REG_CAT_(a, b)
+#define REG_CAT_(a, b)              a##b
+#define REG_APPLY(m, args)          m args
+
+#define REG_CHECK(kind, R, F)       REG_CAT(REG_CHECK_##kind##_, R##_##F##_ACCESS)
+
+/* Up to 8 fields per access */
+#define REG_NARGS(...)              REG_NARGS_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define REG_NARGS_(_1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+
+#define REG_FOR_EACH(m, R, ...)     REG_CAT(REG_FOR_EACH_, REG_NARGS(__VA_ARGS__))(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_1(m, R, x)      m(R, x)
+#define REG_FOR_EACH_2(m, R, x, ...) m(R, x) REG_FOR_EACH_1(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_3(m, R, x, ...) m(R, x) REG_FOR_EACH_2(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_4(m, R, x, ...) m(R, x) REG_FOR_EACH_3(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_5(m, R, x, ...) m(R, x) REG_FOR_EACH_4(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_6(m, R, x, ...) m(R, x) REG_FOR_EACH_5(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_7(m, R, x, ...) m(R, x) REG_FOR_EACH_6(m, R, __VA_ARGS__)
+#define REG_FOR_EACH_8(m, R, x, ...) m(R, x) REG_FOR_EACH_7(m, R, __VA_ARGS__)
+
+/* (F, v) pair -> | R_F(v), | R_F_MASK */
+#define REG_PAIR_VALUE(R, pair)     REG_APPLY(REG_PAIR_VALUE_, (R, REG_APPLY(REG_UNPACK, pair)))
+#define REG_PAIR_VALUE_(R, F, v)    | R##_##F(v) | REG_CHECK(WRITE, R, F)
+#define REG_PAIR_MASK(R, pair)      REG_APPLY(REG_PAIR_MASK_, (R, REG_APPLY(REG_UNPACK, pair)))
+#define REG_PAIR_MASK_(R, F, v)     | R##_##F##_MASK
+#define REG_UNPACK(F, v)            F, v
+
+/* F -> | R_F_MASK, W1C fields only */
+#define REG_FLAG_MASK(R, F)         | R##_##F##_MASK | REG_CHECK(CLEAR, R, F)
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Write a register from field values; unnamed fields become 0.
+ *
+ * @param reg Register lvalue, e.g. IP_SCG->RCCR.
+ * @param R Register type prefix in S32K144.h, e.g. SCG_RCCR.
+ * @param ... (FIELD, value) pairs, 1 to 8.
+ */
+#define REG_WRITE(reg, R, ...) \
+    ((reg) = (0U REG_FOR_EACH(REG_PAIR_VALUE, R, __VA_ARGS__)))
+
+/**
+ * @brief Read-modify-write the named fields, keep the others.
+ *
+ * W1C flags are written as 0. One load and one store of the register.
+ *
+ * @param reg Register lvalue.
+ * @param R Register type prefix in S32K144.h.
+ * @param ... (FIELD, value) pairs, 1 to 8.
+ */
+#define REG_MODIFY(reg, R, ...) \
+    ((reg) = (((reg) & ~(R##_W1C_MASK REG_FOR_EACH(REG_PAIR_MASK, R, __VA_ARGS__))) | \
+              (0U REG_FOR_EACH(REG_PAIR_VALUE, R, __VA_ARGS__))))
+
+/**
+ * @brief Clear W1C flags without clearing other pending flags.
+ *
+ * @param reg Register lvalue.
+ * @param R Register type prefix in S32K144.h.
+ * @param ... W1C field names, 1 to 8.
+ */
+#define REG_W1C(reg, R, ...) \
+    ((reg) = (R##_W1C_BASE(reg) REG_FOR_EACH(REG_FLAG_MASK, R, __VA_ARGS__)))
+
+/**
+ * @brief Read one field, shifted down to bit 0.
+ *
+ * @param reg Register lvalue.
+ * @param R Register type prefix in S32K144.h.
+ * @param F Field name.
+ */
+#define REG_READ(reg, R, F) \
+    ((((reg) & R##_##F##_MASK) >> R##_##F##_SHIFT) | REG_CHECK(READ, R, F))
+
+#endif /* REG_ACCESS_H_ */
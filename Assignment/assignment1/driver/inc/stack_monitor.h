@@ -0,0 +1,118 @@
+/**
+ * @file stack_monitor.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Stack painting and high-water monitoring, scanned in idle time.
+ * @version 0.1
+ * @date 2025-11-12
+ *
+ * STK_Init() fills the unused part of the main stack (__StackLimit up to the
+ * current SP) with STK_PAINT_PATTERN; STK_Register() fills a further stack,
+ * e.g. a task stack, before it is used. STK_Poll() then looks for the lowest
+ * word that no longer holds the pattern, a few words per call, so the idle
+ * loop can run it without adding latency:
+ *
+ *   STK_Init();                                   early in main()
+ *
+ *   STK_Poll(32U);                                in the idle loop
+ *   PWR_Idle();
+ *
+ * The scan of a region goes up from its base and stops at the first word
+ * that was overwritten; that word is the new high-water mark and the next
+ * round starts again at the base. The marks only ever rise, so a round costs
+ * at most the free words below the mark. A value equal to the pattern
+ * written by the application itself hides that word, as with any painting.
+ *
+ * The build-time worst case per entry point comes from
+ * tools/stack_usage/stack_usage.py (make stack_usage); the high-water mark
+ * is what a real run reached, to be checked against it.
+ */
+
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define STK_PAINT_PATTERN           0xDEADBEEFU
+
+/* Main stack plus registered stacks */
+#define STK_MAX_REGIONS             4U
+
+/* Region index of the main stack */
+#define STK_MAIN                    0U
+
+/**
+ * @brief Stack monitor status codes.
+ *
+ * STK_STATUS_SUCCESS  Operation completed successfully.
+ * STK_STATUS_ERROR    No free region, a region not word aligned or empty,
+ *                     or a bad index.
+ */
+typedef enum
+{
+    STK_STATUS_SUCCESS = 0,
+    STK_STATUS_ERROR = -1
+} STK_STATUS_t;
+
+/**
+ * @brief Usage of one stack, as far as the scan has got.
+ *
+ * size      Stack size in bytes.
+ * used_max  High-water mark: bytes from the top down to the lowest
+ *           overwritten word. Equal to size when the bottom word is gone,
+ *           the stack has probably overflowed.
+ * free_min  size - used_max.
+ */
+typedef struct
+{
+    uint32_t size;
+    uint32_t used_max;
+    uint32_t free_min;
+} stk_usage_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Paint the main stack below the current SP and register it as
+ *        region STK_MAIN. Interrupts are masked while painting.
+ */
+void STK_Init(void);
+
+/**
+ * @brief Paint a stack that is not in use yet and monitor it.
+ *
+ * @param base Lowest address, word aligned.
+ * @param size Size in bytes, a multiple of 4.
+ * @param index Region index for STK_GetUsage(), may be NULL.
+ * @return STK_STATUS_t ERROR if all regions are taken or base/size are bad.
+ */
+STK_STATUS_t STK_Register(void *base, uint32_t size, uint8_t *index);
+
+/**
+ * @brief Scan up to words stack words for the high-water marks.
+ *
+ * @param words Work limit of this call, at least 1.
+ * @return bool true when a round over every region finished in this call.
+ */
+bool STK_Poll(uint32_t words);
+
+/**
+ * @brief Usage of region index (STK_MAIN or a STK_Register() index).
+ */
+STK_STATUS_t STK_GetUsage(uint8_t index, stk_usage_t *usage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACK_MONITOR_H_ */
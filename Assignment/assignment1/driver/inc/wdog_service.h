@@ -0,0 +1,155 @@
+/**
+ * @file wdog_service.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Task liveness aggregation over the WDOG/EWM, with a pre-reset record.
+ * @version 0.1
+ * @date 2025-11-07
+ *
+ * Every monitored task owns one bit of a check-in word and calls
+ * WDS_CheckIn() once per pass of its loop. The WDOG (and the EWM, if used)
+ * is refreshed only once every expected bit is set, then the word starts
+ * over; one stuck task is enough to let the watchdog fire.
+ *
+ *   WDOG_Init(&s_wdog);                           interrupt enabled
+ *   WDS_Init((1UL << TASK_CAN) | (1UL << TASK_CTRL), false);
+ *
+ *   WDS_CheckIn(TASK_CAN);                        in the CAN task loop
+ *   WDS_CheckIn(TASK_CTRL);                       in the control task loop
+ *   WDS_Poll();                                   in the idle loop or a tick
+ *
+ * A check-in is a single store to the bit-band alias of the word, atomic
+ * against every other task and ISR without masking interrupts or an
+ * LDREX/STREX loop. The word therefore has to live in SRAM_U (.bss is placed
+ * there by the linker scripts), WDS_Init() checks it.
+ *
+ * In window mode a set completed before the window opens is kept until a
+ * later WDS_CheckIn() or WDS_Poll() finds the window open, so something has
+ * to poll. Check-ins racing with a refresh count for the period that ends.
+ *
+ * WDS_Init() takes over WDOG_EWM_IRQn at the highest priority. When the WDOG
+ * interrupt fires (128 bus clocks before the reset) or the EWM asserts its
+ * output, the check-in word, the expected mask and the DWT cycle counter are
+ * saved to a record in .noinit, which survives every reset except power-on
+ * and LVD. After the reset WDS_GetResetRecord() shows which tasks had not
+ * checked in.
+ */
+
+#ifndef WDOG_SERVICE_H_
+#define WDOG_SERVICE_H_
+
+#include "Driver_Common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define WDS_MAX_TASKS               32U
+
+/**
+ * @brief Watchdog service status codes.
+ *
+ * WDS_STATUS_SUCCESS  Operation completed successfully.
+ * WDS_STATUS_ERROR    Empty task mask, or the check-in word is not in SRAM_U.
+ */
+typedef enum
+{
+    WDS_STATUS_SUCCESS = 0,
+    WDS_STATUS_ERROR = -1
+} WDS_STATUS_t;
+
+/**
+ * @brief What raised the pre-reset interrupt.
+ */
+typedef enum
+{
+    WDS_SOURCE_NONE = 0,
+    WDS_SOURCE_WDOG,
+    WDS_SOURCE_EWM
+} WDS_SOURCE_t;
+
+/**
+ * @brief Record saved by the pre-reset interrupt.
+ *
+ * source    WDOG (a reset followed) or EWM (EWM_OUT_b asserted).
+ * checkin   Check-in word at the interrupt: missing bits are stuck tasks.
+ * expected  Expected mask at the interrupt.
+ * cycles    DWT cycle counter at the interrupt.
+ * count     Interrupts recorded since power-on.
+ */
+typedef struct
+{
+    WDS_SOURCE_t source;
+    uint32_t checkin;
+    uint32_t expected;
+    uint32_t cycles;
+    uint32_t count;
+} wds_record_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Start aggregating check-ins and enable the pre-reset interrupt.
+ *
+ * Call after WDOG_Init() (and EWM_Init()). Starts the DWT cycle counter if
+ * it is not running yet.
+ *
+ * @param expected One bit per monitored task.
+ * @param ewm Service the EWM together with the WDOG.
+ * @return WDS_STATUS_t ERROR for an empty mask or a word outside SRAM_U.
+ */
+WDS_STATUS_t WDS_Init(uint32_t expected, bool ewm);
+
+/**
+ * @brief Report a task alive; refreshes the watchdog if it was the last one.
+ *
+ * @param task Bit number of the task, below WDS_MAX_TASKS.
+ */
+void WDS_CheckIn(uint8_t task);
+
+/**
+ * @brief Refresh if every expected task has checked in and the window is open.
+ *
+ * @return bool Whether the watchdog was refreshed.
+ */
+bool WDS_Poll(void);
+
+/**
+ * @brief Change the monitored tasks, e.g. around a task being suspended.
+ */
+void WDS_SetExpected(uint32_t expected);
+
+/**
+ * @brief Check-in word of the running period.
+ */
+uint32_t WDS_GetCheckins(void);
+
+/**
+ * @brief Refreshes done since WDS_Init().
+ */
+uint32_t WDS_GetRefreshCount(void);
+
+/**
+ * @brief Last pre-reset record not cleared yet.
+ *
+ * @return bool false if nothing was recorded since power-on or the last
+ *         WDS_ClearResetRecord().
+ */
+bool WDS_GetResetRecord(wds_record_t *record);
+
+/**
+ * @brief Mark the record as read; the count is kept.
+ */
+void WDS_ClearResetRecord(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WDOG_SERVICE_H_ */
@@ -0,0 +1,344 @@
+/**
+ * @file Driver_CRC.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief CRC module driver implementation.
+ * @version 0.1
+ * @date 2025-10-24
+ *
+ * Data is written as little-endian words, so write transposition is chosen to
+ * put the first byte in memory first on the wire: bytes only for normal
+ * algorithms, bits and bytes for reflected ones. Output reflection uses TOTR;
+ * the final XOR is applied in software so any xor_out value works.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_CRC.h"
+#include "../driver/inc/Driver_EDMA.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* CTRL[TOT]/CTRL[TOTR] encodings */
+#define CRC_TRANSPOSE_NONE              0U
+#define CRC_TRANSPOSE_BITS_BYTES        2U
+#define CRC_TRANSPOSE_BYTES             3U
+
+#define CRC_DMA_MAJOR_MAX               0x7FFFU
+
+typedef struct
+{
+    bool owned;
+    bool dma_active;
+    uint8_t dma_channel;
+    const uint8_t *dma_rest;
+    uint32_t dma_rest_len;
+    crc_config_t config;
+} crc_state_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void crc_write(const uint8_t *data, uint32_t len);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static crc_state_t s_crc_state;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void crc_write(const uint8_t *data, uint32_t len)
+{
+    while ((len > 0U) && ((((uint32_t)data) & 3U) != 0U))
+    {
+        IP_CRC->DATAu.DATA_8.LL = *data;
+        data++;
+        len--;
+    }
+
+    while (len >= 4U)
+    {
+        IP_CRC->DATAu.DATA = *(const uint32_t *)data;
+        data += 4U;
+        len -= 4U;
+    }
+
+    while (len > 0U)
+    {
+        IP_CRC->DATAu.DATA_8.LL = *data;
+        data++;
+        len--;
+    }
+}
+
+/**
+ * @brief Take the module and start a new computation.
+ *
+ * The seed is loaded with transposition off so it is taken as written, then
+ * CTRL is set to its final value for the data.
+ *
+ * @param config Algorithm parameters.
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY if already owned.
+ */
+CRC_STATUS_t CRC_Init(const crc_config_t *config)
+{
+    uint32_t ctrl;
+
+    if (config == NULL)
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    if (s_crc_state.owned)
+    {
+        return CRC_STATUS_BUSY;
+    }
+
+    if (PCC_EnableClock(PCC_CRC) != PCC_STATUS_SUCCESS)
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    s_crc_state.owned = true;
+    s_crc_state.dma_active = false;
+    s_crc_state.config = *config;
+
+    ctrl = CRC_CTRL_TCRC((config->width == CRC_WIDTH_32) ? 1U : 0U);
+
+    IP_CRC->CTRL = ctrl | CRC_CTRL_WAS(1U);
+    IP_CRC->GPOLY = (config->width == CRC_WIDTH_32) ? config->polynomial : (config->polynomial & 0xFFFFU);
+    IP_CRC->DATAu.DATA = (config->width == CRC_WIDTH_32) ? config->seed : (config->seed & 0xFFFFU);
+
+    ctrl |= CRC_CTRL_TOT(config->reflect_in ? CRC_TRANSPOSE_BITS_BYTES : CRC_TRANSPOSE_BYTES);
+    ctrl |= CRC_CTRL_TOTR(config->reflect_out ? CRC_TRANSPOSE_BITS_BYTES : CRC_TRANSPOSE_NONE);
+    IP_CRC->CTRL = ctrl;
+
+    return CRC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Feed bytes through the CPU.
+ *
+ * @param data Input bytes.
+ * @param len Number of bytes.
+ * @return CRC_STATUS_t SUCCESS, ERROR if not owned or BUSY during eDMA.
+ */
+CRC_STATUS_t CRC_Update(const uint8_t *data, uint32_t len)
+{
+    if ((!s_crc_state.owned) || ((data == NULL) && (len > 0U)))
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    if (s_crc_state.dma_active)
+    {
+        return CRC_STATUS_BUSY;
+    }
+
+    crc_write(data, len);
+
+    return CRC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Feed bytes with an eDMA channel.
+ *
+ * Unaligned head bytes go through the CPU first; the aligned bulk is split
+ * into CRC_DMA_MINOR_BYTES bursts and whatever is left over is remembered for
+ * CRC_IsDmaDone(). Buffers too short for one burst are written directly.
+ *
+ * @param channel eDMA channel (0..15).
+ * @param data Input bytes.
+ * @param len Number of bytes.
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY.
+ */
+CRC_STATUS_t CRC_UpdateDma(uint8_t channel, const uint8_t *data, uint32_t len)
+{
+    edma_transfer_config_t xfer = {0};
+    uint32_t head;
+    uint32_t bursts;
+
+    if ((!s_crc_state.owned) || (channel >= EDMA_CHANNEL_NUMS) || ((data == NULL) && (len > 0U)))
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    if (s_crc_state.dma_active)
+    {
+        return CRC_STATUS_BUSY;
+    }
+
+    head = (4U - (((uint32_t)data) & 3U)) & 3U;
+    head = (head > len) ? len : head;
+    bursts = (len - head) / CRC_DMA_MINOR_BYTES;
+
+    if (bursts > CRC_DMA_MAJOR_MAX)
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    if (bursts == 0U)
+    {
+        crc_write(data, len);
+        return CRC_STATUS_SUCCESS;
+    }
+
+    crc_write(data, head);
+    data += head;
+    len -= head;
+
+    xfer.src_addr = (uint32_t)data;
+    xfer.dst_addr = (uint32_t)&IP_CRC->DATAu.DATA;
+    xfer.src_offset = 4;
+    xfer.dst_offset = 0;
+    xfer.src_size = EDMA_SIZE_4_BYTES;
+    xfer.dst_size = EDMA_SIZE_4_BYTES;
+    xfer.minor_bytes = CRC_DMA_MINOR_BYTES;
+    xfer.major_count = (uint16_t)bursts;
+
+    if (EDMA_ConfigTransfer(channel, &xfer) != EDMA_STATUS_SUCCESS)
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    s_crc_state.dma_active = true;
+    s_crc_state.dma_channel = channel;
+    s_crc_state.dma_rest = data + (bursts * CRC_DMA_MINOR_BYTES);
+    s_crc_state.dma_rest_len = len - (bursts * CRC_DMA_MINOR_BYTES);
+
+    /* Always-enabled source keeps requesting; DREQ clears ERQ after the last burst */
+    (void)EDMA_SetChannelSource(channel, (uint8_t)EDMA_REQ_DMAMUX_ALWAYS_ENABLED0);
+    EDMA_StartChannel(channel);
+
+    return CRC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Poll an eDMA feed and finish the remaining bytes once it completes.
+ *
+ * @return bool true when no eDMA feed is pending.
+ */
+bool CRC_IsDmaDone(void)
+{
+    if (!s_crc_state.dma_active)
+    {
+        return true;
+    }
+
+    if (!EDMA_IsChannelDone(s_crc_state.dma_channel))
+    {
+        return false;
+    }
+
+    (void)EDMA_SetChannelSource(s_crc_state.dma_channel, 0U);
+    s_crc_state.dma_active = false;
+    crc_write(s_crc_state.dma_rest, s_crc_state.dma_rest_len);
+
+    return true;
+}
+
+/**
+ * @brief Read the CRC of everything fed so far.
+ *
+ * With bit transposition on read, a 16-bit result lands in the upper half.
+ *
+ * @return uint32_t CRC value, 0 if the module is not owned.
+ */
+uint32_t CRC_GetResult(void)
+{
+    uint32_t value;
+
+    if (!s_crc_state.owned)
+    {
+        return 0U;
+    }
+
+    value = IP_CRC->DATAu.DATA;
+
+    if (s_crc_state.config.width == CRC_WIDTH_16)
+    {
+        value = s_crc_state.config.reflect_out ? (value >> 16U) : (value & 0xFFFFU);
+        return (value ^ s_crc_state.config.xor_out) & 0xFFFFU;
+    }
+
+    return value ^ s_crc_state.config.xor_out;
+}
+
+/**
+ * @brief Give the module back, stopping a pending eDMA feed.
+ */
+void CRC_Release(void)
+{
+    if (s_crc_state.dma_active)
+    {
+        EDMA_StopChannel(s_crc_state.dma_channel);
+        (void)EDMA_SetChannelSource(s_crc_state.dma_channel, 0U);
+        s_crc_state.dma_active = false;
+    }
+
+    s_crc_state.owned = false;
+}
+
+/**
+ * @brief Check whether the module is owned.
+ */
+bool CRC_IsBusy(void)
+{
+    return s_crc_state.owned;
+}
+
+/**
+ * @brief One-shot CRC of a buffer on the module, or in software if it is owned.
+ *
+ * @param config Algorithm parameters for the module.
+ * @param fallback Software tables for the same algorithm, or NULL to fail with BUSY.
+ * @param data Input bytes.
+ * @param len Number of bytes.
+ * @param result Computed CRC.
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY.
+ */
+CRC_STATUS_t CRC_Compute(const crc_config_t *config, const crc_sw_table_t *fallback,
+                         const uint8_t *data, uint32_t len, uint32_t *result)
+{
+    CRC_STATUS_t status;
+
+    if ((result == NULL) || ((data == NULL) && (len > 0U)))
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    status = CRC_Init(config);
+
+    if (status == CRC_STATUS_BUSY)
+    {
+        if (fallback == NULL)
+        {
+            return CRC_STATUS_BUSY;
+        }
+
+        *result = CRC_SwCompute(fallback, data, len);
+        return CRC_STATUS_SUCCESS;
+    }
+
+    if (status != CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    crc_write(data, len);
+    *result = CRC_GetResult();
+    CRC_Release();
+
+    return CRC_STATUS_SUCCESS;
+}
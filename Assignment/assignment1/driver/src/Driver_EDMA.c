@@ -0,0 +1,183 @@
+/**
+ * @file Driver_EDMA.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Minimal eDMA/DMAMUX channel helper implementation.
+ * @version 0.1
+ * @date 2025-10-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_EDMA.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define EDMA_CHANNEL_IS_VALID(ch)       ((ch) < EDMA_CHANNEL_NUMS)
+#define EDMA_MAJOR_COUNT_MAX            (0x7FFFU)
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/**
+ * @brief Route a DMAMUX request source to an eDMA channel.
+ *
+ * CHCFG must be written with ENBL = 0 before the source changes, so the channel
+ * is first detached and then enabled with the new source.
+ *
+ * @param channel eDMA channel (0..15).
+ * @param source DMAMUX request source.
+ * @return EDMA_STATUS_t SUCCESS or ERROR on invalid channel.
+ */
+EDMA_STATUS_t EDMA_SetChannelSource(uint8_t channel, uint8_t source)
+{
+    if (!EDMA_CHANNEL_IS_VALID(channel))
+    {
+        return EDMA_STATUS_ERROR;
+    }
+
+    /* DMAMUX is gated through PCC, eDMA itself is clocked by default */
+    (void)PCC_EnableClock(PCC_DMAMUX);
+
+    /* Detach before changing the source */
+    IP_DMAMUX->CHCFG[channel] = 0U;
+
+    if (source != 0U)
+    {
+        IP_DMAMUX->CHCFG[channel] = DMAMUX_CHCFG_SOURCE(source) | DMAMUX_CHCFG_ENBL(1U);
+    }
+
+    return EDMA_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Program one TCD from a transfer description.
+ *
+ * @param channel eDMA channel (0..15).
+ * @param config Transfer description.
+ * @return EDMA_STATUS_t SUCCESS or ERROR on invalid parameter.
+ */
+EDMA_STATUS_t EDMA_ConfigTransfer(uint8_t channel, const edma_transfer_config_t *config)
+{
+    if ((!EDMA_CHANNEL_IS_VALID(channel)) || (config == NULL))
+    {
+        return EDMA_STATUS_ERROR;
+    }
+
+    if ((config->major_count == 0U) || (config->major_count > EDMA_MAJOR_COUNT_MAX))
+    {
+        return EDMA_STATUS_ERROR;
+    }
+
+    /* Stop requests while the TCD is rewritten */
+    IP_DMA->CERQ = channel;
+
+    IP_DMA->TCD[channel].CSR = 0U;
+    IP_DMA->TCD[channel].SADDR = config->src_addr;
+    IP_DMA->TCD[channel].SOFF = (uint16_t)config->src_offset;
+    IP_DMA->TCD[channel].ATTR = DMA_TCD_ATTR_SSIZE(config->src_size) | DMA_TCD_ATTR_DSIZE(config->dst_size);
+    IP_DMA->TCD[channel].NBYTES.MLNO = DMA_TCD_NBYTES_MLNO_NBYTES(config->minor_bytes);
+    IP_DMA->TCD[channel].SLAST = (uint32_t)config->src_last;
+    IP_DMA->TCD[channel].DADDR = config->dst_addr;
+    IP_DMA->TCD[channel].DOFF = (uint16_t)config->dst_offset;
+    IP_DMA->TCD[channel].CITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(config->major_count);
+    IP_DMA->TCD[channel].DLASTSGA = (uint32_t)config->dst_last;
+    IP_DMA->TCD[channel].BITER.ELINKNO = DMA_TCD_BITER_ELINKNO_BITER(config->major_count);
+
+    /* Assemble CSR once */
+    IP_DMA->TCD[channel].CSR = DMA_TCD_CSR_INTMAJOR(config->int_major ? 1U : 0U) |
+                               DMA_TCD_CSR_INTHALF(config->int_half ? 1U : 0U) |
+                               DMA_TCD_CSR_DREQ(config->loop ? 0U : 1U);
+
+    return EDMA_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Enable hardware requests for a channel.
+ */
+void EDMA_StartChannel(uint8_t channel)
+{
+    if (EDMA_CHANNEL_IS_VALID(channel))
+    {
+        IP_DMA->SERQ = channel;
+    }
+}
+
+/**
+ * @brief Disable hardware requests for a channel.
+ */
+void EDMA_StopChannel(uint8_t channel)
+{
+    if (EDMA_CHANNEL_IS_VALID(channel))
+    {
+        IP_DMA->CERQ = channel;
+    }
+}
+
+/**
+ * @brief Software start of a channel.
+ */
+void EDMA_TriggerChannel(uint8_t channel)
+{
+    if (EDMA_CHANNEL_IS_VALID(channel))
+    {
+        IP_DMA->SSRT = channel;
+    }
+}
+
+/**
+ * @brief Check and clear the DONE flag of a channel.
+ *
+ * @return bool true if the major loop completed.
+ */
+bool EDMA_IsChannelDone(uint8_t channel)
+{
+    bool done = false;
+
+    if (EDMA_CHANNEL_IS_VALID(channel))
+    {
+        done = ((IP_DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U);
+        if (done)
+        {
+            IP_DMA->CDNE = channel;
+        }
+    }
+
+    return done;
+}
+
+/**
+ * @brief Return the current destination address of a channel.
+ */
+uint32_t EDMA_GetDestAddress(uint8_t channel)
+{
+    uint32_t addr = 0U;
+
+    if (EDMA_CHANNEL_IS_VALID(channel))
+    {
+        addr = IP_DMA->TCD[channel].DADDR;
+    }
+
+    return addr;
+}
+
+/**
+ * @brief Return the remaining major loop count (CITER) of a channel.
+ */
+uint16_t EDMA_GetRemainingMajorCount(uint8_t channel)
+{
+    uint16_t count = 0U;
+
+    if (EDMA_CHANNEL_IS_VALID(channel))
+    {
+        count = (uint16_t)(IP_DMA->TCD[channel].CITER.ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK);
+    }
+
+    return count;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file Driver_ERM.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief SRAM ECC error counters (ERM) and EIM error injection implementation.
+ * @version 0.1
+ * @date 2025-11-10
+ *
+ * The ERM status flags are W1C and hold one event per region with its
+ * address; erm_service() reads the address before clearing the flag. The
+ * interrupts and ERM_Poll() share it, ERM_Poll() with PRIMASK set.
+ *
+ * The injection is three instructions in one asm block: enable the EIM
+ * channel, load the word, disable the channel. At -O0 anything between them
+ * would be a stack access to SRAM_U, which would be corrupted as well.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_ERM.h"
+#include "../driver/inc/Driver_NVIC.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_fields.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TIMEOUT                     10000
+
+#define ERM_SRAM_L_START            0x1FFF8000U
+#define ERM_SRAM_U_START            0x20000000U
+#define ERM_SRAM_U_END              0x20007000U
+
+/* ERM CR0/SR0 and EIM EICHEN: 4 bits per channel, channel 0 at the top */
+#define ERM_SR0_SBC(ch)             (ERM_SR0_SBC0_MASK >> ((ch) * 4U))
+#define ERM_SR0_NCE(ch)             (ERM_SR0_NCE0_MASK >> ((ch) * 4U))
+#define ERM_CR0_IE(ch)              ((ERM_CR0_ESCIE0_MASK | ERM_CR0_ENCIE0_MASK) >> ((ch) * 4U))
+#define ERM_EICHEN(ch)              (EIM_EICHEN_EICH0EN_MASK >> (ch))
+
+/* Linker script: free RAM initialised by eDMA at reset */
+extern uint32_t __RAM_DMA_START[];
+extern uint32_t __RAM_DMA_END[];
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void erm_service(void);
+void ERM_single_fault_IRQHandler(void);
+void ERM_double_fault_IRQHandler(void);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static volatile erm_stats_t s_erm_stats[ERM_EARn_COUNT];
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void erm_service(void)
+{
+    uint32_t sr = IP_ERM->SR0;
+    uint32_t clear = 0U;
+    uint32_t ch;
+
+    for (ch = 0U; ch < ERM_EARn_COUNT; ch++)
+    {
+        if ((sr & (ERM_SR0_SBC(ch) | ERM_SR0_NCE(ch))) == 0U)
+        {
+            continue;
+        }
+
+        s_erm_stats[ch].last_address = IP_ERM->EARn[ch].EAR;
+        if ((sr & ERM_SR0_SBC(ch)) != 0U)
+        {
+            s_erm_stats[ch].corrected++;
+        }
+        if ((sr & ERM_SR0_NCE(ch)) != 0U)
+        {
+            s_erm_stats[ch].uncorrectable++;
+        }
+        clear |= sr & (ERM_SR0_SBC(ch) | ERM_SR0_NCE(ch));
+    }
+
+    if (clear != 0U)
+    {
+        IP_ERM->SR0 = ERM_SR0_W1C_BASE(sr) | clear;
+    }
+}
+
+void ERM_single_fault_IRQHandler(void)
+{
+    erm_service();
+}
+
+void ERM_double_fault_IRQHandler(void)
+{
+    erm_service();
+}
+
+ERM_STATUS_t ERM_ScrubWait(void)
+{
+    uint32_t timeOut = 0U;
+
+    if ((uint32_t)__RAM_DMA_START >= (uint32_t)__RAM_DMA_END)
+    {
+        return ERM_STATUS_SUCCESS;
+    }
+
+    while ((IP_DMA->TCD[ERM_SCRUB_DMA_CHANNEL].CSR & DMA_TCD_CSR_DONE_MASK) == 0U)
+    {
+        if ((IP_DMA->ERR & (1UL << ERM_SCRUB_DMA_CHANNEL)) != 0U)
+        {
+            return ERM_STATUS_ERROR;
+        }
+        if (++timeOut >= TIMEOUT)
+        {
+            return ERM_STATUS_TIMEOUT;
+        }
+    }
+
+    return ERM_STATUS_SUCCESS;
+}
+
+ERM_STATUS_t ERM_Init(bool interrupt)
+{
+    ERM_STATUS_t status = ERM_ScrubWait();
+    uint32_t ch;
+
+    IP_SIM->PLATCGC |= SIM_PLATCGC_CGCERM_MASK | SIM_PLATCGC_CGCEIM_MASK;
+
+    IP_ERM->CR0 = 0U;
+    IP_ERM->SR0 = ERM_SR0_W1C_MASK;
+    ERM_ClearStats();
+
+    if (interrupt)
+    {
+        for (ch = 0U; ch < ERM_EARn_COUNT; ch++)
+        {
+            IP_ERM->CR0 |= ERM_CR0_IE(ch);
+        }
+        (void)NVIC_EnableIRQ(ERM_single_fault_IRQn);
+        (void)NVIC_EnableIRQ(ERM_double_fault_IRQn);
+    }
+
+    return status;
+}
+
+void ERM_Poll(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    erm_service();
+
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+void ERM_GetStats(ERM_REGION_t region, erm_stats_t *stats)
+{
+    uint32_t primask;
+
+    if (((uint32_t)region >= ERM_EARn_COUNT) || (stats == NULL))
+    {
+        return;
+    }
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    stats->corrected = s_erm_stats[region].corrected;
+    stats->uncorrectable = s_erm_stats[region].uncorrectable;
+    stats->last_address = s_erm_stats[region].last_address;
+
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+uint32_t ERM_GetCorrectedTotal(void)
+{
+    return s_erm_stats[ERM_SRAM_L].corrected + s_erm_stats[ERM_SRAM_U].corrected;
+}
+
+void ERM_ClearStats(void)
+{
+    uint32_t primask;
+    uint32_t ch;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    for (ch = 0U; ch < ERM_EARn_COUNT; ch++)
+    {
+        s_erm_stats[ch].corrected = 0U;
+        s_erm_stats[ch].uncorrectable = 0U;
+        s_erm_stats[ch].last_address = 0U;
+    }
+
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+ERM_STATUS_t ERM_InjectSingleBit(uint32_t address, uint8_t bit)
+{
+    volatile uint32_t *eichen = &IP_EIM->EICHEN;
+    uint32_t ch;
+    uint32_t enable;
+    uint32_t value;
+    uint32_t primask;
+
+    if ((bit > 31U) || ((address & 3U) != 0U) || (address < ERM_SRAM_L_START) || (address >= ERM_SRAM_U_END))
+    {
+        return ERM_STATUS_ERROR;
+    }
+
+    ch = (address < ERM_SRAM_U_START) ? (uint32_t)ERM_SRAM_L : (uint32_t)ERM_SRAM_U;
+    enable = ERM_EICHEN(ch);
+
+    IP_SIM->PLATCGC |= SIM_PLATCGC_CGCEIM_MASK;
+    IP_EIM->EICHDn[ch].WORD0 = 0U;
+    IP_EIM->EICHDn[ch].WORD1 = 1UL << bit;
+    IP_EIM->EIMCR = EIM_EIMCR_GEIEN_MASK;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    __asm volatile ("str %[en], [%[reg]]\n\t"
+                    "ldr %[val], [%[addr]]\n\t"
+                    "str %[off], [%[reg]]\n\t"
+                    "dsb"
+                    : [val] "=&r" (value)
+                    : [en] "r" (enable), [off] "r" (0U), [reg] "r" (eichen), [addr] "r" (address)
+                    : "memory");
+
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+
+    IP_EIM->EIMCR = 0U;
+    (void)value;
+
+    return ERM_STATUS_SUCCESS;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file Driver_EWM.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief External watchdog monitor (EWM) driver implementation.
+ * @version 0.1
+ * @date 2025-11-07
+ *
+ * The two service bytes must reach SERV within 15 bus clocks of each other,
+ * so they are written with PRIMASK set; the previous PRIMASK is put back so
+ * a call from an ISR or a masked section does not unmask interrupts.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_EWM.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define EWM_SERVICE_FIRST           0xB4U
+#define EWM_SERVICE_SECOND          0x2CU
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+EWM_STATUS_t EWM_Init(const ewm_config_t *config)
+{
+    if ((config == NULL) || (config->compare_low >= config->compare_high) ||
+        (config->compare_high > EWM_COMPARE_HIGH_MAX))
+    {
+        return EWM_STATUS_ERROR;
+    }
+
+    if (PCC_EnableClock(PCC_EWM) != PCC_STATUS_SUCCESS)
+    {
+        return EWM_STATUS_ERROR;
+    }
+
+    if ((IP_EWM->CTRL & EWM_CTRL_EWMEN_MASK) != 0U)
+    {
+        return EWM_STATUS_ERROR;
+    }
+
+    IP_EWM->CLKPRESCALER = EWM_CLKPRESCALER_CLK_DIV(config->prescaler);
+    IP_EWM->CMPL = EWM_CMPL_COMPAREL(config->compare_low);
+    IP_EWM->CMPH = EWM_CMPH_COMPAREH(config->compare_high);
+    /* CTRL last: it starts the counter */
+    IP_EWM->CTRL = (uint8_t)(EWM_CTRL_EWMEN_MASK | EWM_CTRL_INEN(config->in_enable ? 1U : 0U) |
+                             EWM_CTRL_ASSIN(config->in_active_high ? 1U : 0U) |
+                             EWM_CTRL_INTEN(config->interrupt ? 1U : 0U));
+
+    return EWM_STATUS_SUCCESS;
+}
+
+void EWM_Refresh(void)
+{
+    uint32_t primask = 0U;
+
+#if !defined(__x86_64__)
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+#endif
+
+    IP_EWM->SERV = EWM_SERVICE_FIRST;
+    IP_EWM->SERV = EWM_SERVICE_SECOND;
+
+#if !defined(__x86_64__)
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+
+void EWM_SetInterrupt(bool enable)
+{
+    if (enable)
+    {
+        IP_EWM->CTRL |= EWM_CTRL_INTEN_MASK;
+    }
+    else
+    {
+        IP_EWM->CTRL &= (uint8_t)~EWM_CTRL_INTEN_MASK;
+    }
+}
+
+bool EWM_IsEnabled(void)
+{
+    return ((IP_EWM->CTRL & EWM_CTRL_EWMEN_MASK) != 0U);
+}
@@ -0,0 +1,1261 @@
+/**
+ * @file Driver_FLEXCAN.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief FlexCAN driver implementation (mailboxes, RX FIFO filtering, eDMA ring,
+ *        CAN FD and bit-timing solver).
+ * @version 0.1
+ * @date 2025-10-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_FLEXCAN.h"
+#include "../driver/inc/Driver_EDMA.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TIMEOUT                         10000U
+
+/* Words per message buffer with 8-byte payload (classic layout, RX FIFO) */
+#define FLEXCAN_MB_WORDS                4U
+/* C/S and ID words ahead of the payload */
+#define FLEXCAN_MB_HEADER_WORDS         2U
+/* Candidates per phase examined when pairing FD nominal/data timings */
+#define FLEXCAN_FD_TIMING_CANDIDATES    8U
+
+/* Message buffer C/S word */
+#define FLEXCAN_CS_EDL_MASK             (0x80000000U)
+#define FLEXCAN_CS_BRS_MASK             (0x40000000U)
+#define FLEXCAN_CS_ESI_MASK             (0x20000000U)
+#define FLEXCAN_CS_CODE_MASK            (0x0F000000U)
+#define FLEXCAN_CS_CODE_SHIFT           (24U)
+#define FLEXCAN_CS_CODE(x)              (((uint32_t)(x) << FLEXCAN_CS_CODE_SHIFT) & FLEXCAN_CS_CODE_MASK)
+#define FLEXCAN_CS_SRR_MASK             (0x00400000U)
+#define FLEXCAN_CS_IDE_MASK             (0x00200000U)
+#define FLEXCAN_CS_RTR_MASK             (0x00100000U)
+#define FLEXCAN_CS_DLC_MASK             (0x000F0000U)
+#define FLEXCAN_CS_DLC_SHIFT            (16U)
+#define FLEXCAN_CS_TIMESTAMP_MASK       (0x0000FFFFU)
+
+/* Message buffer ID word */
+#define FLEXCAN_ID_PRIO_SHIFT           (29U)
+#define FLEXCAN_ID_STD_MASK             (0x1FFC0000U)
+#define FLEXCAN_ID_STD_SHIFT            (18U)
+#define FLEXCAN_ID_EXT_MASK             (0x1FFFFFFFU)
+
+/* RXIMR/RXMGMASK with CTRL2[EACEN]: compare the RTR and IDE bits */
+#define FLEXCAN_RXIMR_RTR_MASK          (0x80000000U)
+#define FLEXCAN_RXIMR_IDE_MASK          (0x40000000U)
+
+/* RX FIFO ID filter table element, format A */
+#define FLEXCAN_FIFO_RTR_MASK           (0x80000000U)
+#define FLEXCAN_FIFO_IDE_MASK           (0x40000000U)
+#define FLEXCAN_FIFO_STD_SHIFT          (19U)
+#define FLEXCAN_FIFO_EXT_SHIFT          (1U)
+
+/* Message buffer codes */
+#define FLEXCAN_RX_INACTIVE             (0x0U)
+#define FLEXCAN_RX_EMPTY                (0x4U)
+#define FLEXCAN_TX_INACTIVE             (0x8U)
+#define FLEXCAN_TX_DATA                 (0xCU)
+
+/* Reset value of the TX arbitration start delay */
+#define FLEXCAN_TASD_DEFAULT            (0x16U)
+
+#define FLEXCAN_INSTANCE_IS_VALID(n)    ((uint32_t)(n) < FLEXCAN_INSTANCE_NUMS)
+
+/**
+ * @brief Per-instance layout captured at init time.
+ */
+typedef struct
+{
+    uint8_t max_mb;
+    uint8_t first_free_mb;
+    uint8_t fifo_indiv_masks;
+    uint8_t mb_words;
+    bool rx_fifo;
+    bool rx_fifo_dma;
+    bool fd;
+} flexcan_state_t;
+
+/**
+ * @brief Register range of one bit-timing phase, in real (not encoded) units.
+ */
+typedef struct
+{
+    uint16_t presdiv_max;
+    uint8_t propseg_min;
+    uint8_t propseg_max;
+    uint8_t pseg1_max;
+    uint8_t pseg2_max;
+    uint8_t rjw_max;
+    uint8_t tq_min;
+    uint8_t tq_max;
+} flexcan_phase_limits_t;
+
+/*******************************************************************************
+ * 									Prototypes
+ ******************************************************************************/
+static FLEXCAN_STATUS_t flexcan_wait_mcr(FLEXCAN_Type *base, uint32_t mask, bool set);
+static FLEXCAN_STATUS_t flexcan_enter_freeze(FLEXCAN_Type *base);
+static FLEXCAN_STATUS_t flexcan_exit_freeze(FLEXCAN_Type *base);
+static uint32_t flexcan_fifo_filter_element(const flexcan_id_filter_t *filter);
+static uint32_t flexcan_fifo_filter_mask(const flexcan_id_filter_t *filter);
+static uint32_t flexcan_pack_word(const uint8_t *data);
+static void flexcan_unpack_word(uint32_t word, uint8_t *data);
+static void flexcan_unpack_mb(uint32_t cs, uint32_t id, const volatile uint32_t *data, uint8_t max_words,
+                              flexcan_frame_t *frame);
+static bool flexcan_timing_is_valid(FLEXCAN_BIT_PHASE_t phase, const flexcan_bit_timing_t *timing);
+
+/*******************************************************************************
+ * 									Variables
+ ******************************************************************************/
+
+static FLEXCAN_Type *const s_flexcan_base_ptr[FLEXCAN_INSTANCE_NUMS] = IP_FLEXCAN_BASE_PTRS;
+static const PCC_PERIPHERALS_t s_flexcan_pcc[FLEXCAN_INSTANCE_NUMS] = { PCC_FLEXCAN0, PCC_FLEXCAN1, PCC_FLEXCAN2 };
+static const uint8_t s_flexcan_max_mb[FLEXCAN_INSTANCE_NUMS] = FEATURE_CAN_MAX_MB_NUM_ARRAY;
+static const uint8_t s_flexcan_dma_req[FLEXCAN_INSTANCE_NUMS] = FEATURE_CAN_EDMA_REQUESTS;
+static const bool s_flexcan_has_fd[FLEXCAN_INSTANCE_NUMS] = { FEATURE_CAN0_HAS_FD, FEATURE_CAN1_HAS_FD, FEATURE_CAN2_HAS_FD };
+static const uint8_t s_flexcan_dlc_len[16] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+
+/* Pseg1 >= 1 and pseg2 >= 2 quanta in every phase */
+static const flexcan_phase_limits_t s_flexcan_phase_limits[3] =
+{
+    /* CTRL1 */
+    { 256U, 1U, 8U, 8U, 8U, 4U, 8U, 25U },
+    /* CBT (BTF = 1) */
+    { 1024U, 1U, 64U, 32U, 32U, 32U, 8U, 129U },
+    /* FDCBT */
+    { 1024U, 0U, 31U, 8U, 8U, 8U, 5U, 48U }
+};
+static flexcan_state_t s_flexcan_state[FLEXCAN_INSTANCE_NUMS];
+
+/*******************************************************************************
+ * 										Code
+ ******************************************************************************/
+
+/**
+ * @brief Poll an MCR bit until it reaches the requested level.
+ *
+ * @param base FlexCAN register block.
+ * @param mask MCR bit to poll.
+ * @param set true to wait for 1, false to wait for 0.
+ * @return FLEXCAN_STATUS_t SUCCESS or TIMEOUT.
+ */
+static FLEXCAN_STATUS_t flexcan_wait_mcr(FLEXCAN_Type *base, uint32_t mask, bool set)
+{
+    uint32_t timeOut = 0U;
+    uint32_t expected = set ? mask : 0U;
+
+    while (((base->MCR & mask) != expected) && (timeOut < TIMEOUT))
+    {
+        ++timeOut;
+    }
+
+    return (timeOut < TIMEOUT) ? FLEXCAN_STATUS_SUCCESS : FLEXCAN_STATUS_TIMEOUT;
+}
+
+/**
+ * @brief Request freeze mode (FRZ + HALT) and wait for FRZACK.
+ */
+static FLEXCAN_STATUS_t flexcan_enter_freeze(FLEXCAN_Type *base)
+{
+    base->MCR |= FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK;
+
+    return flexcan_wait_mcr(base, FLEXCAN_MCR_FRZACK_MASK, true);
+}
+
+/**
+ * @brief Leave freeze mode and wait until the module is synchronised to the bus.
+ */
+static FLEXCAN_STATUS_t flexcan_exit_freeze(FLEXCAN_Type *base)
+{
+    base->MCR &= ~(FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK);
+
+    return flexcan_wait_mcr(base, FLEXCAN_MCR_FRZACK_MASK, false);
+}
+
+/**
+ * @brief Encode an acceptance filter as a format-A RX FIFO table element.
+ */
+static uint32_t flexcan_fifo_filter_element(const flexcan_id_filter_t *filter)
+{
+    uint32_t element;
+
+    if (filter->id_type == FLEXCAN_ID_EXT)
+    {
+        element = FLEXCAN_FIFO_IDE_MASK | ((filter->id & FLEXCAN_ID_EXT_MASK) << FLEXCAN_FIFO_EXT_SHIFT);
+    }
+    else
+    {
+        element = (filter->id & 0x7FFU) << FLEXCAN_FIFO_STD_SHIFT;
+    }
+
+    return element;
+}
+
+/**
+ * @brief Encode the mask of an acceptance filter for a format-A element.
+ *
+ * RTR and IDE are always compared so standard and extended frames never alias.
+ */
+static uint32_t flexcan_fifo_filter_mask(const flexcan_id_filter_t *filter)
+{
+    uint32_t mask = FLEXCAN_FIFO_RTR_MASK | FLEXCAN_FIFO_IDE_MASK;
+
+    if (filter->id_type == FLEXCAN_ID_EXT)
+    {
+        mask |= (filter->mask & FLEXCAN_ID_EXT_MASK) << FLEXCAN_FIFO_EXT_SHIFT;
+    }
+    else
+    {
+        mask |= (filter->mask & 0x7FFU) << FLEXCAN_FIFO_STD_SHIFT;
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Pack four payload bytes into a message buffer data word (byte 0 is MSB).
+ */
+static uint32_t flexcan_pack_word(const uint8_t *data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+/**
+ * @brief Unpack a message buffer data word into four payload bytes.
+ */
+static void flexcan_unpack_word(uint32_t word, uint8_t *data)
+{
+    data[0] = (uint8_t)(word >> 24);
+    data[1] = (uint8_t)(word >> 16);
+    data[2] = (uint8_t)(word >> 8);
+    data[3] = (uint8_t)word;
+}
+
+/**
+ * @brief Decode a message buffer into a frame.
+ *
+ * Only the data words covered by the DLC are read, bounded by the mailbox size.
+ *
+ * @param cs C/S word.
+ * @param id ID word.
+ * @param data First data word.
+ * @param max_words Data words available in the mailbox.
+ * @param frame Output frame.
+ */
+static void flexcan_unpack_mb(uint32_t cs, uint32_t id, const volatile uint32_t *data, uint8_t max_words,
+                              flexcan_frame_t *frame)
+{
+    uint32_t length;
+    uint32_t words;
+    uint32_t i;
+
+    frame->id_type = ((cs & FLEXCAN_CS_IDE_MASK) != 0U) ? FLEXCAN_ID_EXT : FLEXCAN_ID_STD;
+    frame->remote = ((cs & FLEXCAN_CS_RTR_MASK) != 0U);
+    frame->fd = ((cs & FLEXCAN_CS_EDL_MASK) != 0U);
+    frame->brs = ((cs & FLEXCAN_CS_BRS_MASK) != 0U);
+    frame->dlc = (uint8_t)((cs & FLEXCAN_CS_DLC_MASK) >> FLEXCAN_CS_DLC_SHIFT);
+    frame->timestamp = (uint16_t)(cs & FLEXCAN_CS_TIMESTAMP_MASK);
+
+    if (frame->id_type == FLEXCAN_ID_EXT)
+    {
+        frame->id = id & FLEXCAN_ID_EXT_MASK;
+    }
+    else
+    {
+        frame->id = (id & FLEXCAN_ID_STD_MASK) >> FLEXCAN_ID_STD_SHIFT;
+    }
+
+    if (frame->remote)
+    {
+        length = 0U;
+    }
+    else if (frame->fd)
+    {
+        length = s_flexcan_dlc_len[frame->dlc];
+    }
+    else
+    {
+        length = (frame->dlc < FLEXCAN_CLASSIC_PAYLOAD_MAX) ? frame->dlc : FLEXCAN_CLASSIC_PAYLOAD_MAX;
+    }
+
+    words = (length + 3U) / 4U;
+    if (words > max_words)
+    {
+        words = max_words;
+    }
+
+    for (i = 0U; i < words; i++)
+    {
+        flexcan_unpack_word(data[i], &frame->data[4U * i]);
+    }
+}
+
+/**
+ * @brief Check a real-valued bit timing against the register range of a phase.
+ */
+static bool flexcan_timing_is_valid(FLEXCAN_BIT_PHASE_t phase, const flexcan_bit_timing_t *timing)
+{
+    const flexcan_phase_limits_t *limits = &s_flexcan_phase_limits[phase];
+
+    return (timing->presdiv >= 1U) && (timing->presdiv <= limits->presdiv_max) &&
+           (timing->propseg >= limits->propseg_min) && (timing->propseg <= limits->propseg_max) &&
+           (timing->pseg1 >= 1U) && (timing->pseg1 <= limits->pseg1_max) &&
+           (timing->pseg2 >= 2U) && (timing->pseg2 <= limits->pseg2_max) &&
+           (timing->rjw >= 1U) && (timing->rjw <= limits->rjw_max);
+}
+
+/**
+ * @brief Initialize a FlexCAN instance.
+ *
+ * Register values are assembled locally and committed with one store each while
+ * the module is frozen, so the protocol engine never sees a partial setup.
+ *
+ * @param instance FlexCAN instance.
+ * @param config Configuration descriptor.
+ * @return FLEXCAN_STATUS_t SUCCESS, TIMEOUT or ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_Init(FLEXCAN_INSTANCE_t instance, const flexcan_config_t *config)
+{
+    FLEXCAN_STATUS_t result = FLEXCAN_STATUS_SUCCESS;
+    FLEXCAN_Type *base;
+    flexcan_state_t *state;
+    uint32_t regValue;
+    uint32_t rffn = 0U;
+    uint32_t elements = 0U;
+    uint32_t i;
+
+    if ((!FLEXCAN_INSTANCE_IS_VALID(instance)) || (config == NULL))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+    state = &s_flexcan_state[instance];
+
+    if ((config->max_mb == 0U) || (config->max_mb > s_flexcan_max_mb[instance]))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    if ((config->rx_fifo_dma && !config->rx_fifo) ||
+        ((config->fifo_filter_count != 0U) && (config->fifo_filters == NULL)))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    if (config->fd)
+    {
+        /* The legacy RX FIFO only exists for the classic 8-byte layout */
+        if ((!s_flexcan_has_fd[instance]) || config->rx_fifo ||
+            (config->fd_payload > FLEXCAN_FD_PAYLOAD_64) ||
+            (config->max_mb > FLEXCAN_GetMaxMbNums(instance, true, config->fd_payload)) ||
+            (!flexcan_timing_is_valid(FLEXCAN_PHASE_NOMINAL, &config->nominal)) ||
+            (!flexcan_timing_is_valid(FLEXCAN_PHASE_DATA, &config->data)))
+        {
+            return FLEXCAN_STATUS_ERROR;
+        }
+
+        state->mb_words = (uint8_t)(FLEXCAN_MB_HEADER_WORDS + (2U << (uint32_t)config->fd_payload));
+    }
+    else
+    {
+        state->mb_words = FLEXCAN_MB_WORDS;
+    }
+
+    if (config->rx_fifo)
+    {
+        /* Filter table grows in steps of 8 elements (2 mailboxes) */
+        if (config->fifo_filter_count > 0U)
+        {
+            rffn = ((uint32_t)config->fifo_filter_count - 1U) / 8U;
+        }
+        elements = 8U * (rffn + 1U);
+
+        state->first_free_mb = (uint8_t)(FLEXCAN_RX_FIFO_MB_NUMS + (2U * (rffn + 1U)));
+        state->fifo_indiv_masks = (uint8_t)((state->first_free_mb < s_flexcan_max_mb[instance]) ?
+                                            state->first_free_mb : s_flexcan_max_mb[instance]);
+
+        if (state->first_free_mb > config->max_mb)
+        {
+            return FLEXCAN_STATUS_ERROR;
+        }
+    }
+    else
+    {
+        state->first_free_mb = 0U;
+        state->fifo_indiv_masks = 0U;
+    }
+
+    if (PCC_EnableClock(s_flexcan_pcc[instance]) != PCC_STATUS_SUCCESS)
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    /* The PE clock can only be selected while the module is disabled */
+    base->MCR |= FLEXCAN_MCR_MDIS_MASK;
+    result = flexcan_wait_mcr(base, FLEXCAN_MCR_LPMACK_MASK, true);
+    if (result != FLEXCAN_STATUS_SUCCESS)
+    {
+        return result;
+    }
+    base->CTRL1 = FLEXCAN_CTRL1_CLKSRC(config->clk_src);
+
+    base->MCR &= ~FLEXCAN_MCR_MDIS_MASK;
+    result = flexcan_wait_mcr(base, FLEXCAN_MCR_LPMACK_MASK, false);
+    if (result != FLEXCAN_STATUS_SUCCESS)
+    {
+        return result;
+    }
+
+    /* Soft reset, then freeze for configuration */
+    base->MCR |= FLEXCAN_MCR_SOFTRST_MASK;
+    result = flexcan_wait_mcr(base, FLEXCAN_MCR_SOFTRST_MASK, false);
+    if (result != FLEXCAN_STATUS_SUCCESS)
+    {
+        return result;
+    }
+
+    result = flexcan_enter_freeze(base);
+    if (result != FLEXCAN_STATUS_SUCCESS)
+    {
+        return result;
+    }
+
+    /* Message buffer RAM and individual masks are not reset by hardware;
+     * only the mailboxes the instance implements are cleared */
+    for (i = 0U; i < ((uint32_t)s_flexcan_max_mb[instance] * FLEXCAN_MB_WORDS); i++)
+    {
+        base->RAMn[i] = 0U;
+    }
+    for (i = 0U; i < s_flexcan_max_mb[instance]; i++)
+    {
+        base->RXIMR[i] = 0U;
+    }
+
+    /* MCR: individual masks, abort, FIFO/DMA, local priority, mailbox count */
+    regValue = FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK |
+               FLEXCAN_MCR_IRMQ(1U) |
+               FLEXCAN_MCR_AEN(1U) |
+               FLEXCAN_MCR_SRXDIS(config->loopback ? 0U : 1U) |
+               FLEXCAN_MCR_RFEN(config->rx_fifo ? 1U : 0U) |
+               FLEXCAN_MCR_DMA(config->rx_fifo_dma ? 1U : 0U) |
+               FLEXCAN_MCR_LPRIOEN(config->local_priority ? 1U : 0U) |
+               FLEXCAN_MCR_FDEN(config->fd ? 1U : 0U) |
+               FLEXCAN_MCR_IDAM(0U) |
+               FLEXCAN_MCR_MAXMB((uint32_t)config->max_mb - 1U);
+    base->MCR = regValue;
+
+    /* CTRL1: bit timing; LBUF = 0 so the highest priority mailbox wins arbitration */
+    regValue = FLEXCAN_CTRL1_CLKSRC(config->clk_src) |
+               FLEXCAN_CTRL1_LPB(config->loopback ? 1U : 0U) |
+               FLEXCAN_CTRL1_LBUF(0U);
+    if (!config->fd)
+    {
+        regValue |= FLEXCAN_CTRL1_PRESDIV(config->timing.presdiv) |
+                    FLEXCAN_CTRL1_RJW(config->timing.rjw) |
+                    FLEXCAN_CTRL1_PSEG1(config->timing.pseg1) |
+                    FLEXCAN_CTRL1_PSEG2(config->timing.pseg2) |
+                    FLEXCAN_CTRL1_PROPSEG(config->timing.propseg);
+    }
+    base->CTRL1 = regValue;
+
+    /* CTRL2: filter table size, store remote frames, compare IDE/RTR with masks */
+    base->CTRL2 = FLEXCAN_CTRL2_TASD(FLEXCAN_TASD_DEFAULT) |
+                  FLEXCAN_CTRL2_RFFN(rffn) |
+                  FLEXCAN_CTRL2_RRS(1U) |
+                  FLEXCAN_CTRL2_EACEN(1U) |
+                  FLEXCAN_CTRL2_ISOCANFDEN(config->fd ? 1U : 0U) |
+                  FLEXCAN_CTRL2_MRP(0U);
+
+    if (config->fd)
+    {
+        /* Transceiver delay compensation: secondary sample point at the data
+         * phase sample point, in PE clocks; not usable in loopback */
+        uint32_t tdcOffset = (1U + (uint32_t)config->data.propseg + config->data.pseg1) * config->data.presdiv;
+        bool tdc = config->brs && (!config->loopback) &&
+                   (tdcOffset <= (FLEXCAN_FDCTRL_TDCOFF_MASK >> FLEXCAN_FDCTRL_TDCOFF_SHIFT));
+
+        /* CBT: extended nominal timing replaces the CTRL1 fields */
+        base->CBT = FLEXCAN_CBT_BTF(1U) |
+                    FLEXCAN_CBT_EPRESDIV((uint32_t)config->nominal.presdiv - 1U) |
+                    FLEXCAN_CBT_ERJW((uint32_t)config->nominal.rjw - 1U) |
+                    FLEXCAN_CBT_EPROPSEG((uint32_t)config->nominal.propseg - 1U) |
+                    FLEXCAN_CBT_EPSEG1((uint32_t)config->nominal.pseg1 - 1U) |
+                    FLEXCAN_CBT_EPSEG2((uint32_t)config->nominal.pseg2 - 1U);
+
+        /* FDCBT: data phase timing, FPROPSEG is not offset by one */
+        base->FDCBT = FLEXCAN_FDCBT_FPRESDIV((uint32_t)config->data.presdiv - 1U) |
+                      FLEXCAN_FDCBT_FRJW((uint32_t)config->data.rjw - 1U) |
+                      FLEXCAN_FDCBT_FPROPSEG(config->data.propseg) |
+                      FLEXCAN_FDCBT_FPSEG1((uint32_t)config->data.pseg1 - 1U) |
+                      FLEXCAN_FDCBT_FPSEG2((uint32_t)config->data.pseg2 - 1U);
+
+        base->FDCTRL = FLEXCAN_FDCTRL_FDRATE(config->brs ? 1U : 0U) |
+                       FLEXCAN_FDCTRL_MBDSR0(config->fd_payload) |
+                       FLEXCAN_FDCTRL_TDCEN(tdc ? 1U : 0U) |
+                       FLEXCAN_FDCTRL_TDCOFF(tdc ? tdcOffset : 0U);
+    }
+
+    if (config->rx_fifo)
+    {
+        volatile uint32_t *table = &base->RAMn[FLEXCAN_RX_FIFO_MB_NUMS * FLEXCAN_MB_WORDS];
+        flexcan_id_filter_t acceptAll = { 0U, 0U, FLEXCAN_ID_STD };
+
+        for (i = 0U; i < elements; i++)
+        {
+            /* Unused elements repeat the last filter so they accept nothing new */
+            const flexcan_id_filter_t *filter;
+
+            if (config->fifo_filter_count == 0U)
+            {
+                filter = &acceptAll;
+            }
+            else if (i < config->fifo_filter_count)
+            {
+                filter = &config->fifo_filters[i];
+            }
+            else
+            {
+                filter = &config->fifo_filters[config->fifo_filter_count - 1U];
+            }
+
+            table[i] = flexcan_fifo_filter_element(filter);
+
+            if (i < state->fifo_indiv_masks)
+            {
+                /* An empty table must also accept extended frames: mask nothing */
+                base->RXIMR[i] = (filter == &acceptAll) ? 0U : flexcan_fifo_filter_mask(filter);
+            }
+        }
+
+        base->RXFGMASK = config->fifo_global_mask;
+    }
+
+    base->IMASK1 = 0U;
+    base->IFLAG1 = 0xFFFFFFFFU;
+
+    state->max_mb = config->max_mb;
+    state->rx_fifo = config->rx_fifo;
+    state->rx_fifo_dma = config->rx_fifo_dma;
+    state->fd = config->fd;
+
+    return flexcan_exit_freeze(base);
+}
+
+/**
+ * @brief Disable a FlexCAN instance and gate its clock.
+ */
+FLEXCAN_STATUS_t FLEXCAN_Deinit(FLEXCAN_INSTANCE_t instance)
+{
+    FLEXCAN_STATUS_t result;
+    FLEXCAN_Type *base;
+
+    if (!FLEXCAN_INSTANCE_IS_VALID(instance))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+
+    base->MCR |= FLEXCAN_MCR_MDIS_MASK;
+    result = flexcan_wait_mcr(base, FLEXCAN_MCR_LPMACK_MASK, true);
+
+    (void)PCC_DisableClock(s_flexcan_pcc[instance]);
+    s_flexcan_state[instance].max_mb = 0U;
+
+    return result;
+}
+
+/**
+ * @brief Return the first mailbox not used by the RX FIFO / filter table.
+ */
+uint8_t FLEXCAN_GetFirstFreeMb(FLEXCAN_INSTANCE_t instance)
+{
+    return FLEXCAN_INSTANCE_IS_VALID(instance) ? s_flexcan_state[instance].first_free_mb : 0U;
+}
+
+/**
+ * @brief Return how many RX FIFO filter elements use an individual mask.
+ */
+uint8_t FLEXCAN_GetFifoIndividualMaskCount(FLEXCAN_INSTANCE_t instance)
+{
+    return FLEXCAN_INSTANCE_IS_VALID(instance) ? s_flexcan_state[instance].fifo_indiv_masks : 0U;
+}
+
+/**
+ * @brief Return the number of mailboxes that fit the message buffer RAM.
+ *
+ * The RAM holds FEATURE_CANn_MAX_MB_NUM classic mailboxes; an FD mailbox takes
+ * 2 header words plus payload / 4 data words.
+ */
+uint8_t FLEXCAN_GetMaxMbNums(FLEXCAN_INSTANCE_t instance, bool fd, FLEXCAN_FD_PAYLOAD_t payload)
+{
+    uint32_t ramWords;
+
+    if (!FLEXCAN_INSTANCE_IS_VALID(instance))
+    {
+        return 0U;
+    }
+
+    if (!fd)
+    {
+        return s_flexcan_max_mb[instance];
+    }
+
+    if ((!s_flexcan_has_fd[instance]) || (payload > FLEXCAN_FD_PAYLOAD_64))
+    {
+        return 0U;
+    }
+
+    ramWords = (uint32_t)s_flexcan_max_mb[instance] * FLEXCAN_MB_WORDS;
+
+    return (uint8_t)(ramWords / (FLEXCAN_MB_HEADER_WORDS + (2U << (uint32_t)payload)));
+}
+
+/**
+ * @brief Return the protocol engine clock frequency for a CLKSRC selection.
+ */
+uint32_t FLEXCAN_GetPeClock(FLEXCAN_CLK_SOURCE_t clk_src)
+{
+    return (clk_src == FLEXCAN_CLK_SYS) ? SCG_GetCoreClock() : SCG_GetSoscDiv2Clock();
+}
+
+/**
+ * @brief Enumerate bit timings reaching a bit rate exactly, best sample point first.
+ *
+ * The prescaler loop stops as soon as a bit holds fewer quanta than the phase
+ * allows, so the cost is bounded by clk_hz / (bitrate * tq_min) iterations.
+ *
+ * @return uint8_t Number of solutions written.
+ */
+uint8_t FLEXCAN_SolveBitTiming(FLEXCAN_BIT_PHASE_t phase, uint32_t clk_hz, uint32_t bitrate, uint16_t sample_point,
+                               flexcan_bit_timing_t *solutions, uint8_t max_solutions)
+{
+    const flexcan_phase_limits_t *limits;
+    flexcan_bit_timing_t best;
+    uint32_t bestErr;
+    uint32_t presdiv;
+    uint32_t tq;
+    uint32_t tseg1;
+    uint32_t tseg2;
+    uint32_t sp;
+    uint32_t err;
+    uint8_t count = 0U;
+    uint8_t pos;
+    uint8_t i;
+
+    if ((phase > FLEXCAN_PHASE_DATA) || (solutions == NULL) || (max_solutions == 0U) ||
+        (bitrate == 0U) || (sample_point >= 1000U))
+    {
+        return 0U;
+    }
+
+    limits = &s_flexcan_phase_limits[phase];
+
+    for (presdiv = 1U; presdiv <= limits->presdiv_max; presdiv++)
+    {
+        if ((clk_hz / presdiv) < (bitrate * limits->tq_min))
+        {
+            break;
+        }
+
+        /* Only exact bit rates: clk_hz = bitrate * presdiv * tq */
+        if (((clk_hz % presdiv) != 0U) || (((clk_hz / presdiv) % bitrate) != 0U))
+        {
+            continue;
+        }
+
+        tq = (clk_hz / presdiv) / bitrate;
+        if (tq > limits->tq_max)
+        {
+            continue;
+        }
+
+        /* Best phase segment 2 for this prescaler; sync segment is one quantum */
+        bestErr = 0xFFFFFFFFU;
+        for (tseg2 = 2U; tseg2 <= limits->pseg2_max; tseg2++)
+        {
+            if ((tseg2 + 2U + limits->propseg_min) > tq)
+            {
+                break;
+            }
+
+            tseg1 = tq - 1U - tseg2;
+            if (tseg1 > ((uint32_t)limits->propseg_max + limits->pseg1_max))
+            {
+                continue;
+            }
+
+            sp = (((tq - tseg2) * 1000U) + (tq / 2U)) / tq;
+            err = (sp > sample_point) ? (sp - sample_point) : (sample_point - sp);
+            if (err < bestErr)
+            {
+                bestErr = err;
+                best.presdiv = (uint16_t)presdiv;
+                best.pseg2 = (uint8_t)tseg2;
+                best.sample_point = (uint16_t)sp;
+            }
+        }
+
+        if (bestErr == 0xFFFFFFFFU)
+        {
+            continue;
+        }
+
+        /* Split tseg1: pseg1 mirrors pseg2, propagation segment takes the rest */
+        tseg1 = tq - 1U - best.pseg2;
+        best.pseg1 = (best.pseg2 < limits->pseg1_max) ? best.pseg2 : limits->pseg1_max;
+        if (tseg1 < ((uint32_t)best.pseg1 + limits->propseg_min))
+        {
+            best.pseg1 = (uint8_t)(tseg1 - limits->propseg_min);
+        }
+        else if ((tseg1 - best.pseg1) > limits->propseg_max)
+        {
+            best.pseg1 = (uint8_t)(tseg1 - limits->propseg_max);
+        }
+        best.propseg = (uint8_t)(tseg1 - best.pseg1);
+        best.rjw = (best.pseg1 < best.pseg2) ? best.pseg1 : best.pseg2;
+        if (best.rjw > limits->rjw_max)
+        {
+            best.rjw = limits->rjw_max;
+        }
+
+        /* Insert after every entry with an equal or smaller error: ties keep
+         * the smaller prescaler first since prescalers are visited in order */
+        for (pos = 0U; pos < count; pos++)
+        {
+            sp = solutions[pos].sample_point;
+            err = (sp > sample_point) ? (sp - sample_point) : (sample_point - sp);
+            if (err > bestErr)
+            {
+                break;
+            }
+        }
+
+        if (pos >= max_solutions)
+        {
+            continue;
+        }
+
+        if (count < max_solutions)
+        {
+            count++;
+        }
+        for (i = (uint8_t)(count - 1U); i > pos; i--)
+        {
+            solutions[i] = solutions[i - 1U];
+        }
+        solutions[pos] = best;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Solve a nominal/data timing pair for CAN FD with bit rate switch.
+ *
+ * The pair with a shared prescaler and the lowest summed sample-point error
+ * wins; without a shared prescaler the best solution of each phase is used.
+ */
+FLEXCAN_STATUS_t FLEXCAN_SolveFdTiming(uint32_t clk_hz, uint32_t nominal_bitrate, uint16_t nominal_sp,
+                                       uint32_t data_bitrate, uint16_t data_sp,
+                                       flexcan_bit_timing_t *nominal, flexcan_bit_timing_t *data)
+{
+    flexcan_bit_timing_t nomCand[FLEXCAN_FD_TIMING_CANDIDATES];
+    flexcan_bit_timing_t dataCand[FLEXCAN_FD_TIMING_CANDIDATES];
+    uint8_t nomCount;
+    uint8_t dataCount;
+    uint8_t bestNom = 0U;
+    uint8_t bestData = 0U;
+    uint32_t bestErr = 0xFFFFFFFFU;
+    uint32_t err;
+    uint8_t n;
+    uint8_t d;
+
+    if ((nominal == NULL) || (data == NULL))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    nomCount = FLEXCAN_SolveBitTiming(FLEXCAN_PHASE_NOMINAL, clk_hz, nominal_bitrate, nominal_sp,
+                                      nomCand, FLEXCAN_FD_TIMING_CANDIDATES);
+    dataCount = FLEXCAN_SolveBitTiming(FLEXCAN_PHASE_DATA, clk_hz, data_bitrate, data_sp,
+                                       dataCand, FLEXCAN_FD_TIMING_CANDIDATES);
+    if ((nomCount == 0U) || (dataCount == 0U))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    for (n = 0U; n < nomCount; n++)
+    {
+        for (d = 0U; d < dataCount; d++)
+        {
+            if (nomCand[n].presdiv != dataCand[d].presdiv)
+            {
+                continue;
+            }
+
+            err = (uint32_t)((nomCand[n].sample_point > nominal_sp) ? (nomCand[n].sample_point - nominal_sp) :
+                                                                      (nominal_sp - nomCand[n].sample_point)) +
+                  (uint32_t)((dataCand[d].sample_point > data_sp) ? (dataCand[d].sample_point - data_sp) :
+                                                                    (data_sp - dataCand[d].sample_point));
+            if (err < bestErr)
+            {
+                bestErr = err;
+                bestNom = n;
+                bestData = d;
+            }
+        }
+    }
+
+    *nominal = nomCand[bestNom];
+    *data = dataCand[bestData];
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Encode a solver result for the classic CTRL1 fields.
+ */
+FLEXCAN_STATUS_t FLEXCAN_EncodeClassicTiming(const flexcan_bit_timing_t *bit_timing, flexcan_timing_t *timing)
+{
+    if ((bit_timing == NULL) || (timing == NULL) ||
+        (!flexcan_timing_is_valid(FLEXCAN_PHASE_CLASSIC, bit_timing)))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    timing->presdiv = (uint8_t)(bit_timing->presdiv - 1U);
+    timing->propseg = (uint8_t)(bit_timing->propseg - 1U);
+    timing->pseg1 = (uint8_t)(bit_timing->pseg1 - 1U);
+    timing->pseg2 = (uint8_t)(bit_timing->pseg2 - 1U);
+    timing->rjw = (uint8_t)(bit_timing->rjw - 1U);
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Convert a DLC code to the CAN FD payload length in bytes.
+ */
+uint8_t FLEXCAN_DlcToLength(uint8_t dlc)
+{
+    return s_flexcan_dlc_len[dlc & 0x0FU];
+}
+
+/**
+ * @brief Return the smallest DLC code whose payload holds length bytes.
+ */
+uint8_t FLEXCAN_LengthToDlc(uint8_t length)
+{
+    uint8_t dlc = 0U;
+
+    while ((dlc < 15U) && (s_flexcan_dlc_len[dlc] < length))
+    {
+        dlc++;
+    }
+
+    return dlc;
+}
+
+/**
+ * @brief Enable mailbox interrupts.
+ */
+void FLEXCAN_EnableMbInterrupts(FLEXCAN_INSTANCE_t instance, uint32_t mask)
+{
+    if (FLEXCAN_INSTANCE_IS_VALID(instance))
+    {
+        s_flexcan_base_ptr[instance]->IMASK1 |= mask;
+    }
+}
+
+/**
+ * @brief Disable mailbox interrupts.
+ */
+void FLEXCAN_DisableMbInterrupts(FLEXCAN_INSTANCE_t instance, uint32_t mask)
+{
+    if (FLEXCAN_INSTANCE_IS_VALID(instance))
+    {
+        s_flexcan_base_ptr[instance]->IMASK1 &= ~mask;
+    }
+}
+
+/**
+ * @brief Arm a mailbox for reception with its own acceptance mask.
+ *
+ * @param instance FlexCAN instance.
+ * @param mb Mailbox index.
+ * @param filter Acceptance filter.
+ * @return FLEXCAN_STATUS_t SUCCESS, TIMEOUT or ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_ConfigRxMb(FLEXCAN_INSTANCE_t instance, uint8_t mb, const flexcan_id_filter_t *filter)
+{
+    FLEXCAN_STATUS_t result;
+    FLEXCAN_Type *base;
+    volatile uint32_t *mbw;
+    uint32_t cs = FLEXCAN_CS_CODE(FLEXCAN_RX_EMPTY);
+    uint32_t id;
+    uint32_t mask;
+
+    if ((!FLEXCAN_INSTANCE_IS_VALID(instance)) || (filter == NULL))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    if ((mb < s_flexcan_state[instance].first_free_mb) || (mb >= s_flexcan_state[instance].max_mb))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+    mbw = &base->RAMn[(uint32_t)mb * s_flexcan_state[instance].mb_words];
+
+    if (filter->id_type == FLEXCAN_ID_EXT)
+    {
+        cs |= FLEXCAN_CS_IDE_MASK;
+        id = filter->id & FLEXCAN_ID_EXT_MASK;
+        mask = filter->mask & FLEXCAN_ID_EXT_MASK;
+    }
+    else
+    {
+        id = (filter->id << FLEXCAN_ID_STD_SHIFT) & FLEXCAN_ID_STD_MASK;
+        mask = (filter->mask << FLEXCAN_ID_STD_SHIFT) & FLEXCAN_ID_STD_MASK;
+    }
+
+    result = flexcan_enter_freeze(base);
+    if (result != FLEXCAN_STATUS_SUCCESS)
+    {
+        return result;
+    }
+
+    mbw[0] = FLEXCAN_CS_CODE(FLEXCAN_RX_INACTIVE);
+    /* With EACEN, RXIMR bits 31/30 compare RTR/IDE; the ID field is 28:0 */
+    base->RXIMR[mb] = mask | FLEXCAN_RXIMR_IDE_MASK | FLEXCAN_RXIMR_RTR_MASK;
+    mbw[1] = id;
+    mbw[0] = cs;
+
+    return flexcan_exit_freeze(base);
+}
+
+/**
+ * @brief Queue a frame in a TX mailbox.
+ *
+ * The mailbox is deactivated, loaded and activated with a final C/S store.
+ * Only the data words covered by the DLC are written.
+ *
+ * @param instance FlexCAN instance.
+ * @param mb Mailbox index.
+ * @param frame Frame to send.
+ * @param prio Local priority 0..7.
+ * @return FLEXCAN_STATUS_t SUCCESS, BUSY or ERROR.
+ */
+FLEXCAN_STATUS_t FLEXCAN_Send(FLEXCAN_INSTANCE_t instance, uint8_t mb, const flexcan_frame_t *frame, uint8_t prio)
+{
+    const flexcan_state_t *state;
+    FLEXCAN_Type *base;
+    volatile uint32_t *mbw;
+    uint32_t cs;
+    uint32_t id;
+    uint32_t words;
+    uint32_t i;
+
+    if ((!FLEXCAN_INSTANCE_IS_VALID(instance)) || (frame == NULL) || (prio > 7U))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    state = &s_flexcan_state[instance];
+
+    if ((mb < state->first_free_mb) || (mb >= state->max_mb))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    if (frame->fd)
+    {
+        /* FD frames carry no remote request and must fit the mailbox payload */
+        if ((!state->fd) || frame->remote || (frame->dlc > 15U))
+        {
+            return FLEXCAN_STATUS_ERROR;
+        }
+        words = ((uint32_t)s_flexcan_dlc_len[frame->dlc] + 3U) / 4U;
+        if (words > ((uint32_t)state->mb_words - FLEXCAN_MB_HEADER_WORDS))
+        {
+            return FLEXCAN_STATUS_ERROR;
+        }
+    }
+    else
+    {
+        if (frame->dlc > FLEXCAN_CLASSIC_PAYLOAD_MAX)
+        {
+            return FLEXCAN_STATUS_ERROR;
+        }
+        words = ((uint32_t)frame->dlc + 3U) / 4U;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+    mbw = &base->RAMn[(uint32_t)mb * state->mb_words];
+
+    if (((mbw[0] & FLEXCAN_CS_CODE_MASK) >> FLEXCAN_CS_CODE_SHIFT) == FLEXCAN_TX_DATA)
+    {
+        return FLEXCAN_STATUS_BUSY;
+    }
+
+    cs = FLEXCAN_CS_CODE(FLEXCAN_TX_DATA) | ((uint32_t)frame->dlc << FLEXCAN_CS_DLC_SHIFT);
+    if (frame->id_type == FLEXCAN_ID_EXT)
+    {
+        cs |= FLEXCAN_CS_IDE_MASK | FLEXCAN_CS_SRR_MASK;
+        id = frame->id & FLEXCAN_ID_EXT_MASK;
+    }
+    else
+    {
+        id = (frame->id << FLEXCAN_ID_STD_SHIFT) & FLEXCAN_ID_STD_MASK;
+    }
+    if (frame->remote)
+    {
+        cs |= FLEXCAN_CS_RTR_MASK;
+    }
+    if (frame->fd)
+    {
+        cs |= FLEXCAN_CS_EDL_MASK | (frame->brs ? FLEXCAN_CS_BRS_MASK : 0U);
+    }
+    id |= (uint32_t)prio << FLEXCAN_ID_PRIO_SHIFT;
+
+    /* Clear a stale completion flag, then load the mailbox */
+    base->IFLAG1 = (1UL << mb);
+    mbw[0] = FLEXCAN_CS_CODE(FLEXCAN_TX_INACTIVE);
+    mbw[1] = id;
+    for (i = 0U; i < words; i++)
+    {
+        mbw[FLEXCAN_MB_HEADER_WORDS + i] = flexcan_pack_word(&frame->data[4U * i]);
+    }
+    mbw[0] = cs;
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Queue a frame in the first idle mailbox of a TX pool.
+ */
+FLEXCAN_STATUS_t FLEXCAN_SendFromPool(FLEXCAN_INSTANCE_t instance, uint32_t tx_pool, const flexcan_frame_t *frame,
+                                      uint8_t prio, uint8_t *used_mb)
+{
+    FLEXCAN_STATUS_t result = FLEXCAN_STATUS_ERROR;
+    uint8_t mb;
+
+    if (!FLEXCAN_INSTANCE_IS_VALID(instance))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    for (mb = s_flexcan_state[instance].first_free_mb; mb < s_flexcan_state[instance].max_mb; mb++)
+    {
+        if ((tx_pool & (1UL << mb)) == 0U)
+        {
+            continue;
+        }
+
+        result = FLEXCAN_Send(instance, mb, frame, prio);
+        if (result != FLEXCAN_STATUS_BUSY)
+        {
+            break;
+        }
+    }
+
+    if ((result == FLEXCAN_STATUS_SUCCESS) && (used_mb != NULL))
+    {
+        *used_mb = mb;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Read a received frame from a mailbox.
+ *
+ * Reading C/S locks the mailbox against updates, reading TIMER releases it.
+ */
+FLEXCAN_STATUS_t FLEXCAN_ReadRxMb(FLEXCAN_INSTANCE_t instance, uint8_t mb, flexcan_frame_t *frame)
+{
+    FLEXCAN_Type *base;
+    volatile const uint32_t *mbw;
+    uint32_t cs;
+
+    if ((!FLEXCAN_INSTANCE_IS_VALID(instance)) || (frame == NULL) ||
+        (mb >= s_flexcan_state[instance].max_mb))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+
+    if ((base->IFLAG1 & (1UL << mb)) == 0U)
+    {
+        return FLEXCAN_STATUS_NO_DATA;
+    }
+
+    mbw = &base->RAMn[(uint32_t)mb * s_flexcan_state[instance].mb_words];
+    cs = mbw[0];
+    flexcan_unpack_mb(cs, mbw[1], &mbw[FLEXCAN_MB_HEADER_WORDS],
+                      (uint8_t)(s_flexcan_state[instance].mb_words - FLEXCAN_MB_HEADER_WORDS), frame);
+
+    (void)base->TIMER;
+    base->IFLAG1 = (1UL << mb);
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Pop one frame from the RX FIFO output.
+ */
+FLEXCAN_STATUS_t FLEXCAN_ReadRxFifo(FLEXCAN_INSTANCE_t instance, flexcan_frame_t *frame)
+{
+    FLEXCAN_Type *base;
+    uint32_t cs;
+
+    if ((!FLEXCAN_INSTANCE_IS_VALID(instance)) || (frame == NULL) ||
+        (!s_flexcan_state[instance].rx_fifo) || s_flexcan_state[instance].rx_fifo_dma)
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+
+    if ((base->IFLAG1 & FLEXCAN_IFLAG1_BUF5I_MASK) == 0U)
+    {
+        return FLEXCAN_STATUS_NO_DATA;
+    }
+
+    cs = base->RAMn[0];
+    flexcan_unpack_mb(cs, base->RAMn[1], &base->RAMn[FLEXCAN_MB_HEADER_WORDS],
+                      (uint8_t)(FLEXCAN_MB_WORDS - FLEXCAN_MB_HEADER_WORDS), frame);
+
+    /* Clearing BUF5I advances the FIFO to the next frame */
+    base->IFLAG1 = FLEXCAN_IFLAG1_BUF5I_MASK;
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start the eDMA drain of the RX FIFO into a ring of raw frames.
+ *
+ * Each DMA request moves one 16-byte FIFO output image; the destination wraps
+ * to the start of the ring after len frames and the channel stays enabled.
+ */
+FLEXCAN_STATUS_t FLEXCAN_StartRxFifoDma(FLEXCAN_INSTANCE_t instance, flexcan_dma_ring_t *ring)
+{
+    edma_transfer_config_t xfer;
+    FLEXCAN_Type *base;
+
+    if ((!FLEXCAN_INSTANCE_IS_VALID(instance)) || (ring == NULL) || (ring->buf == NULL) ||
+        (ring->len == 0U) || (!s_flexcan_state[instance].rx_fifo_dma))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    base = s_flexcan_base_ptr[instance];
+
+    xfer.src_addr = (uint32_t)&base->RAMn[0];
+    xfer.dst_addr = (uint32_t)ring->buf;
+    xfer.src_offset = 4;
+    xfer.dst_offset = 4;
+    xfer.src_size = EDMA_SIZE_4_BYTES;
+    xfer.dst_size = EDMA_SIZE_4_BYTES;
+    xfer.minor_bytes = sizeof(flexcan_raw_mb_t);
+    xfer.major_count = ring->len;
+    xfer.src_last = -(int32_t)sizeof(flexcan_raw_mb_t);
+    xfer.dst_last = -(int32_t)((uint32_t)ring->len * sizeof(flexcan_raw_mb_t));
+    xfer.int_major = false;
+    xfer.int_half = false;
+    xfer.loop = true;
+
+    ring->rd = 0U;
+
+    if ((EDMA_ConfigTransfer(ring->channel, &xfer) != EDMA_STATUS_SUCCESS) ||
+        (EDMA_SetChannelSource(ring->channel, s_flexcan_dma_req[instance]) != EDMA_STATUS_SUCCESS))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    EDMA_StartChannel(ring->channel);
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop the eDMA drain of the RX FIFO.
+ */
+void FLEXCAN_StopRxFifoDma(flexcan_dma_ring_t *ring)
+{
+    if (ring != NULL)
+    {
+        EDMA_StopChannel(ring->channel);
+        (void)EDMA_SetChannelSource(ring->channel, 0U);
+    }
+}
+
+/**
+ * @brief Number of frames waiting in the DMA ring.
+ *
+ * The producer index comes from the channel DADDR, so no interrupt is needed.
+ * A ring smaller than the worst-case backlog overwrites unread frames.
+ */
+uint16_t FLEXCAN_RingPending(const flexcan_dma_ring_t *ring)
+{
+    uint32_t wr;
+
+    if ((ring == NULL) || (ring->len == 0U))
+    {
+        return 0U;
+    }
+
+    wr = (EDMA_GetDestAddress(ring->channel) - (uint32_t)ring->buf) / sizeof(flexcan_raw_mb_t);
+    if (wr >= ring->len)
+    {
+        wr = 0U;
+    }
+
+    return (uint16_t)((wr + ring->len - ring->rd) % ring->len);
+}
+
+/**
+ * @brief Pop and decode one frame from the DMA ring.
+ */
+FLEXCAN_STATUS_t FLEXCAN_RingRead(flexcan_dma_ring_t *ring, flexcan_frame_t *frame)
+{
+    if ((ring == NULL) || (frame == NULL))
+    {
+        return FLEXCAN_STATUS_ERROR;
+    }
+
+    if (FLEXCAN_RingPending(ring) == 0U)
+    {
+        return FLEXCAN_STATUS_NO_DATA;
+    }
+
+    FLEXCAN_DecodeRawMb(&ring->buf[ring->rd], frame);
+    ring->rd = (uint16_t)((ring->rd + 1U) % ring->len);
+
+    return FLEXCAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Decode a raw message buffer image into a frame.
+ */
+void FLEXCAN_DecodeRawMb(const flexcan_raw_mb_t *raw, flexcan_frame_t *frame)
+{
+    if ((raw != NULL) && (frame != NULL))
+    {
+        flexcan_unpack_mb(raw->cs, raw->id, raw->data, (uint8_t)(FLEXCAN_MB_WORDS - FLEXCAN_MB_HEADER_WORDS), frame);
+    }
+}
@@ -0,0 +1,565 @@
+/**
+ * @file Driver_FTFC.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief FTFC flash programming driver implementation.
+ * @version 0.1
+ * @date 2025-10-25
+ *
+ * Blocking and async operations share one job description. ftfc_stage() loads
+ * FCCOB (and FlexRAM for Program Section) for the next command of the job and
+ * advances it; the blocking path launches from RAM with interrupts masked, the
+ * async path launches with CCIE set and lets FTFC_IRQHandler stage the next one.
+ * When a job ends, successful or not, the LMEM lines covering its range are
+ * invalidated so later fetches see the new flash contents.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_FTFC.h"
+#include "../driver/inc/Driver_LMEM.h"
+#include "../include/S32K144.h"
+#include "../include/s32_core_cm4.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* FCCOB registers are laid out big-endian per 32-bit group (FCCOB0 at offset 7) */
+#define FTFC_FCCOB(n)                   (IP_FTFC->FCCOB[((n) & ~3U) + 3U - ((n) & 3U)])
+
+#define FTFC_CMD_PROGRAM_PHRASE         0x07U
+#define FTFC_CMD_ERASE_SECTOR           0x09U
+#define FTFC_CMD_PROGRAM_SECTION        0x0BU
+#define FTFC_CMD_PROGRAM_PARTITION      0x80U
+#define FTFC_CMD_SET_FLEXRAM            0x81U
+
+#define FTFC_FLEXRAM_SIZE               4096U
+
+/* FlexNVM is addressed with bit 23 set in FCCOB */
+#define FTFC_DFLASH_CMD_OFFSET          0x00800000U
+
+#define FTFC_FSTAT_ERRORS               (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_RDCOLERR_MASK)
+
+#define FTFC_IS_PFLASH(a)               ((a) < (FTFC_PFLASH_BASE + FTFC_PFLASH_SIZE))
+#define FTFC_IS_DFLASH(a)               (((a) >= FTFC_DFLASH_BASE) && ((a) < (FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE)))
+
+#if !defined(__x86_64__)
+#define FTFC_IRQ_DISABLE()              DISABLE_INTERRUPTS()
+#define FTFC_IRQ_ENABLE()               ENABLE_INTERRUPTS()
+#else
+#define FTFC_IRQ_DISABLE()
+#define FTFC_IRQ_ENABLE()
+#endif
+
+#if defined(__GNUC__)
+#define FTFC_NOINLINE                   __attribute__((noinline))
+#else
+#define FTFC_NOINLINE
+#endif
+
+typedef enum
+{
+    FTFC_OP_ERASE = 0U,
+    FTFC_OP_PROGRAM = 1U
+} FTFC_OP_t;
+
+typedef struct
+{
+    volatile bool busy;
+    FTFC_OP_t op;
+    uint32_t start;
+    uint32_t length;
+    uint32_t address;
+    const uint8_t *data;
+    uint32_t remaining;
+    ftfc_callback_t callback;
+    void *user;
+} ftfc_job_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static FTFC_STATUS_t ftfc_check_range(uint32_t address, uint32_t len, uint32_t align);
+static FTFC_STATUS_t ftfc_start(FTFC_OP_t op, uint32_t address, const uint8_t *data, uint32_t len);
+static FTFC_STATUS_t ftfc_run(void);
+static FTFC_STATUS_t ftfc_execute(void);
+static FTFC_STATUS_t ftfc_wait_eee(void);
+static void ftfc_finish(void);
+
+START_FUNCTION_DECLARATION_RAMSECTION
+FTFC_NOINLINE static void ftfc_launch_and_wait(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+START_FUNCTION_DECLARATION_RAMSECTION
+FTFC_NOINLINE static FTFC_STATUS_t ftfc_result(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+START_FUNCTION_DECLARATION_RAMSECTION
+FTFC_NOINLINE static void ftfc_stage(ftfc_job_t *job)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+START_FUNCTION_DECLARATION_RAMSECTION
+void FTFC_IRQHandler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static ftfc_job_t s_ftfc_job;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static FTFC_STATUS_t ftfc_check_range(uint32_t address, uint32_t len, uint32_t align)
+{
+    uint32_t last;
+
+    if ((len == 0U) || ((address % align) != 0U) || ((len % align) != 0U))
+    {
+        return FTFC_STATUS_ERROR;
+    }
+
+    last = address + len - 1U;
+
+    if ((last < address) ||
+        !((FTFC_IS_PFLASH(address) && FTFC_IS_PFLASH(last)) || (FTFC_IS_DFLASH(address) && FTFC_IS_DFLASH(last))))
+    {
+        return FTFC_STATUS_ERROR;
+    }
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Clear CCIF to launch the staged command and wait for completion.
+ *
+ * Runs from RAM because the flash being programmed cannot be read meanwhile.
+ */
+static void ftfc_launch_and_wait(void)
+{
+    IP_FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+
+    while ((IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U)
+    {
+    }
+}
+
+static FTFC_STATUS_t ftfc_result(void)
+{
+    uint8_t fstat = IP_FTFC->FSTAT;
+
+    if ((fstat & FTFC_FSTAT_ACCERR_MASK) != 0U)
+    {
+        return FTFC_STATUS_ACCESS;
+    }
+
+    if ((fstat & FTFC_FSTAT_FPVIOL_MASK) != 0U)
+    {
+        return FTFC_STATUS_PROTECTION;
+    }
+
+    if ((fstat & FTFC_FSTAT_MGSTAT0_MASK) != 0U)
+    {
+        return FTFC_STATUS_VERIFY;
+    }
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Load FCCOB for the next command of a job and advance it.
+ *
+ * Program jobs use Program Section when FlexRAM is plain RAM, the address is
+ * section aligned and at least one section unit remains; the chunk stops at
+ * the next FTFC_SECTION_MAX_BYTES boundary.
+ */
+static void ftfc_stage(ftfc_job_t *job)
+{
+    uint32_t cmd_addr = job->address;
+    uint32_t chunk;
+    uint32_t i;
+    volatile uint32_t *flexram;
+    const uint8_t *src = job->data;
+
+    if (FTFC_IS_DFLASH(cmd_addr))
+    {
+        cmd_addr = (cmd_addr - FTFC_DFLASH_BASE) | FTFC_DFLASH_CMD_OFFSET;
+    }
+
+    /* Clear stale error flags from the previous command */
+    IP_FTFC->FSTAT = FTFC_FSTAT_ERRORS;
+
+    FTFC_FCCOB(1U) = (uint8_t)(cmd_addr >> 16U);
+    FTFC_FCCOB(2U) = (uint8_t)(cmd_addr >> 8U);
+    FTFC_FCCOB(3U) = (uint8_t)cmd_addr;
+
+    if (job->op == FTFC_OP_ERASE)
+    {
+        FTFC_FCCOB(0U) = FTFC_CMD_ERASE_SECTOR;
+        chunk = FTFC_IS_DFLASH(job->address) ? FTFC_DFLASH_SECTOR_SIZE : FTFC_PFLASH_SECTOR_SIZE;
+    }
+    else if (((IP_FTFC->FCNFG & FTFC_FCNFG_RAMRDY_MASK) != 0U) &&
+             ((job->address % FTFC_SECTION_UNIT) == 0U) && (job->remaining >= FTFC_SECTION_UNIT))
+    {
+        chunk = FTFC_SECTION_MAX_BYTES - (job->address % FTFC_SECTION_MAX_BYTES);
+        chunk = (chunk > job->remaining) ? job->remaining : chunk;
+        chunk -= chunk % FTFC_SECTION_UNIT;
+
+        /* Stage the section in FlexRAM with word writes */
+        flexram = (volatile uint32_t *)FTFC_FLEXRAM_BASE;
+        for (i = 0U; i < chunk; i += 4U)
+        {
+            flexram[i / 4U] = (uint32_t)src[i] | ((uint32_t)src[i + 1U] << 8U) |
+                              ((uint32_t)src[i + 2U] << 16U) | ((uint32_t)src[i + 3U] << 24U);
+        }
+
+        FTFC_FCCOB(0U) = FTFC_CMD_PROGRAM_SECTION;
+        FTFC_FCCOB(4U) = (uint8_t)((chunk / FTFC_SECTION_UNIT) >> 8U);
+        FTFC_FCCOB(5U) = (uint8_t)(chunk / FTFC_SECTION_UNIT);
+    }
+    else
+    {
+        chunk = FTFC_PHRASE_SIZE;
+
+        /* Phrase bytes go to FCCOB4..B in register (memory) order */
+        for (i = 0U; i < FTFC_PHRASE_SIZE; i++)
+        {
+            IP_FTFC->FCCOB[4U + i] = src[i];
+        }
+
+        FTFC_FCCOB(0U) = FTFC_CMD_PROGRAM_PHRASE;
+    }
+
+    job->address += chunk;
+    job->remaining -= chunk;
+    if (job->data != NULL)
+    {
+        job->data += chunk;
+    }
+}
+
+static FTFC_STATUS_t ftfc_start(FTFC_OP_t op, uint32_t address, const uint8_t *data, uint32_t len)
+{
+    uint32_t align = FTFC_PHRASE_SIZE;
+    FTFC_STATUS_t status;
+
+    if (op == FTFC_OP_ERASE)
+    {
+        align = FTFC_IS_DFLASH(address) ? FTFC_DFLASH_SECTOR_SIZE : FTFC_PFLASH_SECTOR_SIZE;
+    }
+    else if (data == NULL)
+    {
+        return FTFC_STATUS_ERROR;
+    }
+
+    status = ftfc_check_range(address, len, align);
+    if (status != FTFC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if (s_ftfc_job.busy || ((IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U))
+    {
+        return FTFC_STATUS_BUSY;
+    }
+
+    s_ftfc_job.busy = true;
+    s_ftfc_job.op = op;
+    s_ftfc_job.start = address;
+    s_ftfc_job.length = len;
+    s_ftfc_job.address = address;
+    s_ftfc_job.data = data;
+    s_ftfc_job.remaining = len;
+    s_ftfc_job.callback = NULL;
+    s_ftfc_job.user = NULL;
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+static FTFC_STATUS_t ftfc_run(void)
+{
+    FTFC_STATUS_t status = FTFC_STATUS_SUCCESS;
+
+    while ((status == FTFC_STATUS_SUCCESS) && (s_ftfc_job.remaining > 0U))
+    {
+        ftfc_stage(&s_ftfc_job);
+
+        FTFC_IRQ_DISABLE();
+        ftfc_launch_and_wait();
+        FTFC_IRQ_ENABLE();
+
+        status = ftfc_result();
+    }
+
+    ftfc_finish();
+
+    return status;
+}
+
+/**
+ * @brief End a job: drop cached lines of the rewritten range and go idle.
+ *
+ * Called once the last command is complete, so flash is readable again.
+ */
+static void ftfc_finish(void)
+{
+    if (LMEM_IsEnabled())
+    {
+        LMEM_InvalidateRange(s_ftfc_job.start, s_ftfc_job.length);
+    }
+
+    s_ftfc_job.busy = false;
+}
+
+/**
+ * @brief Launch a command already loaded in FCCOB and wait for it.
+ */
+static FTFC_STATUS_t ftfc_execute(void)
+{
+    FTFC_IRQ_DISABLE();
+    ftfc_launch_and_wait();
+    FTFC_IRQ_ENABLE();
+
+    return ftfc_result();
+}
+
+static FTFC_STATUS_t ftfc_wait_eee(void)
+{
+    while ((IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U)
+    {
+    }
+
+    return ftfc_result();
+}
+
+/**
+ * @brief Erase the sectors covering [address, address + len).
+ *
+ * @param address Sector aligned P-Flash or FlexNVM address.
+ * @param len Multiple of the sector size of that region.
+ * @return FTFC_STATUS_t SUCCESS or the first failing status.
+ */
+FTFC_STATUS_t FTFC_Erase(uint32_t address, uint32_t len)
+{
+    FTFC_STATUS_t status = ftfc_start(FTFC_OP_ERASE, address, NULL, len);
+
+    if (status != FTFC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return ftfc_run();
+}
+
+/**
+ * @brief Program erased flash.
+ *
+ * @param address Phrase aligned destination.
+ * @param data Source bytes, any alignment.
+ * @param len Multiple of FTFC_PHRASE_SIZE.
+ * @return FTFC_STATUS_t SUCCESS or the first failing status.
+ */
+FTFC_STATUS_t FTFC_Program(uint32_t address, const uint8_t *data, uint32_t len)
+{
+    FTFC_STATUS_t status = ftfc_start(FTFC_OP_PROGRAM, address, data, len);
+
+    if (status != FTFC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return ftfc_run();
+}
+
+/**
+ * @brief Start an erase job; sectors are erased one per interrupt.
+ *
+ * @return FTFC_STATUS_t SUCCESS if started, ERROR or BUSY.
+ */
+FTFC_STATUS_t FTFC_EraseAsync(uint32_t address, uint32_t len, ftfc_callback_t callback, void *user)
+{
+    FTFC_STATUS_t status = ftfc_start(FTFC_OP_ERASE, address, NULL, len);
+
+    if (status != FTFC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    s_ftfc_job.callback = callback;
+    s_ftfc_job.user = user;
+
+    ftfc_stage(&s_ftfc_job);
+    IP_FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+    IP_FTFC->FCNFG |= FTFC_FCNFG_CCIE_MASK;
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start a program job; one section (or phrase) per interrupt.
+ *
+ * @return FTFC_STATUS_t SUCCESS if started, ERROR or BUSY.
+ */
+FTFC_STATUS_t FTFC_ProgramAsync(uint32_t address, const uint8_t *data, uint32_t len,
+                                ftfc_callback_t callback, void *user)
+{
+    FTFC_STATUS_t status = ftfc_start(FTFC_OP_PROGRAM, address, data, len);
+
+    if (status != FTFC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    s_ftfc_job.callback = callback;
+    s_ftfc_job.user = user;
+
+    ftfc_stage(&s_ftfc_job);
+    IP_FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+    IP_FTFC->FCNFG |= FTFC_FCNFG_CCIE_MASK;
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Partition FlexNVM between D-Flash and EEE backup.
+ *
+ * FlexRAM is loaded with the EEE data set at reset and no CSEc keys are
+ * reserved.
+ *
+ * @param eee_size_code EEE data set size code.
+ * @param depart_code FlexNVM partition code.
+ * @return FTFC_STATUS_t SUCCESS, BUSY or ACCESS if already partitioned.
+ */
+FTFC_STATUS_t FTFC_ProgramPartition(uint8_t eee_size_code, uint8_t depart_code)
+{
+    if (FTFC_IsBusy())
+    {
+        return FTFC_STATUS_BUSY;
+    }
+
+    IP_FTFC->FSTAT = FTFC_FSTAT_ERRORS;
+    FTFC_FCCOB(0U) = FTFC_CMD_PROGRAM_PARTITION;
+    FTFC_FCCOB(1U) = 0U;
+    FTFC_FCCOB(2U) = 0U;
+    FTFC_FCCOB(3U) = 0U;
+    FTFC_FCCOB(4U) = eee_size_code;
+    FTFC_FCCOB(5U) = depart_code;
+
+    return ftfc_execute();
+}
+
+/**
+ * @brief Switch FlexRAM between emulated EEPROM and plain RAM.
+ *
+ * @param mode FTFC_FLEXRAM_EEE or FTFC_FLEXRAM_RAM.
+ * @return FTFC_STATUS_t SUCCESS, BUSY or ACCESS.
+ */
+FTFC_STATUS_t FTFC_SetFlexRam(FTFC_FLEXRAM_t mode)
+{
+    if (FTFC_IsBusy())
+    {
+        return FTFC_STATUS_BUSY;
+    }
+
+    IP_FTFC->FSTAT = FTFC_FSTAT_ERRORS;
+    FTFC_FCCOB(0U) = FTFC_CMD_SET_FLEXRAM;
+    FTFC_FCCOB(1U) = (uint8_t)mode;
+
+    return ftfc_execute();
+}
+
+/**
+ * @brief Write to emulated EEPROM and wait for each record to be saved.
+ *
+ * A FlexRAM write in EEE mode clears CCIF until the new value is backed up,
+ * so every write is followed by a wait; FlexNVM is not read meanwhile.
+ *
+ * @param offset Byte offset in FlexRAM.
+ * @param data Source bytes.
+ * @param len Number of bytes.
+ * @return FTFC_STATUS_t SUCCESS, ERROR if EEE is not ready or out of range.
+ */
+FTFC_STATUS_t FTFC_EeeWrite(uint32_t offset, const uint8_t *data, uint32_t len)
+{
+    FTFC_STATUS_t status = FTFC_STATUS_SUCCESS;
+    uint32_t addr = FTFC_FLEXRAM_BASE + offset;
+
+    if ((data == NULL) || (offset > FTFC_FLEXRAM_SIZE) || (len > (FTFC_FLEXRAM_SIZE - offset)))
+    {
+        return FTFC_STATUS_ERROR;
+    }
+
+    if ((IP_FTFC->FCNFG & FTFC_FCNFG_EEERDY_MASK) == 0U)
+    {
+        return FTFC_STATUS_ERROR;
+    }
+
+    if (s_ftfc_job.busy)
+    {
+        return FTFC_STATUS_BUSY;
+    }
+
+    IP_FTFC->FSTAT = FTFC_FSTAT_ERRORS;
+
+    while ((status == FTFC_STATUS_SUCCESS) && (len > 0U))
+    {
+        if (((addr & 3U) == 0U) && (len >= 4U))
+        {
+            *(volatile uint32_t *)addr = (uint32_t)data[0] | ((uint32_t)data[1] << 8U) |
+                                         ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U);
+            addr += 4U;
+            data += 4U;
+            len -= 4U;
+        }
+        else
+        {
+            *(volatile uint8_t *)addr = *data;
+            addr++;
+            data++;
+            len--;
+        }
+
+        status = ftfc_wait_eee();
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check whether a command or async job is in progress.
+ */
+bool FTFC_IsBusy(void)
+{
+    return s_ftfc_job.busy || ((IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U);
+}
+
+/**
+ * @brief Command complete handler; advances the async job.
+ *
+ * CCIE keeps the request asserted while CCIF is set, so it is cleared before
+ * the callback runs at the end of the job.
+ */
+void FTFC_IRQHandler(void)
+{
+    FTFC_STATUS_t status = ftfc_result();
+
+    if ((status == FTFC_STATUS_SUCCESS) && (s_ftfc_job.remaining > 0U))
+    {
+        ftfc_stage(&s_ftfc_job);
+        IP_FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+        return;
+    }
+
+    IP_FTFC->FCNFG &= (uint8_t)~FTFC_FCNFG_CCIE_MASK;
+    ftfc_finish();
+
+    if (s_ftfc_job.callback != NULL)
+    {
+        s_ftfc_job.callback(status, s_ftfc_job.user);
+    }
+}
@@ -0,0 +1,943 @@
+/**
+ * @file Driver_FTM.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief FlexTimer driver implementation: PWM with synchronized duty updates,
+ *        input capture with 64-bit timestamps, eDMA capture ring, quadrature.
+ * @version 0.1
+ * @date 2025-10-22
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_FTM.h"
+#include "../driver/inc/Driver_EDMA.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Counter limits: CPWMS requires MOD <= 0x7FFF; edge aligned 100 % needs
+ * CnV = MOD + 1 in the 16-bit CnV field, so MOD stops at 0xFFFE */
+#define FTM_MOD_MAX_EDGE                (0xFFFEU)
+#define FTM_MOD_MAX_CENTER              (0x7FFFU)
+/* SC[PS] selects divide by 2^PS */
+#define FTM_PRESCALER_MAX               (7U)
+/* Deadtime value field is DTVALEX:DTVAL, 10 bits */
+#define FTM_DEADTIME_VAL_MAX            (1023U)
+#define FTM_DEADTIME_VAL_LOW_BITS       (6U)
+/* DEADTIME[DTPS] encodings */
+#define FTM_DTPS_DIV1                   (0U)
+#define FTM_DTPS_DIV4                   (2U)
+#define FTM_DTPS_DIV16                  (3U)
+/* Bits per channel pair in COMBINE */
+#define FTM_COMBINE_PAIR_WIDTH          (8U)
+/* Bits per channel in FILTER */
+#define FTM_FILTER_CHANNEL_WIDTH        (4U)
+#define FTM_FILTER_VAL_MAX              (15U)
+/* Free-running capture counter */
+#define FTM_COUNTER_MAX                 (0xFFFFU)
+#define FTM_COUNTER_HALF                (0x8000U)
+
+#define FTM_INSTANCE_IS_VALID(n)        ((uint32_t)(n) < FTM_INSTANCE_NUMS)
+
+/**
+ * @brief Per-instance state: PWM period, capture overflows, decoder revolutions.
+ */
+typedef struct
+{
+    uint16_t mod;
+    FTM_ALIGN_t align;
+    uint8_t channels;
+    bool quadrature;
+    uint32_t counts_per_rev;
+    volatile uint32_t overflows;
+    volatile int32_t revolutions;
+} ftm_state_t;
+
+/*******************************************************************************
+ * 									Prototypes
+ ******************************************************************************/
+static bool ftm_calc_period(uint32_t clk_hz, uint32_t frequency_hz, FTM_ALIGN_t align, uint32_t *ps, uint32_t *mod);
+static uint32_t ftm_encode_deadtime(uint32_t ticks);
+static uint32_t ftm_duty_to_cnv(const ftm_state_t *state, uint16_t duty);
+static FTM_STATUS_t ftm_enable(FTM_INSTANCE_t instance);
+static uint64_t ftm_now(const FTM_Type *base, const ftm_state_t *state, uint16_t *count);
+void FTM0_Ovf_Reload_IRQHandler(void);
+void FTM1_Ovf_Reload_IRQHandler(void);
+void FTM2_Ovf_Reload_IRQHandler(void);
+void FTM3_Ovf_Reload_IRQHandler(void);
+
+/*******************************************************************************
+ * 									Variables
+ ******************************************************************************/
+
+static FTM_Type *const s_ftm_base_ptr[FTM_INSTANCE_NUMS] = IP_FTM_BASE_PTRS;
+static const PCC_PERIPHERALS_t s_ftm_pcc[FTM_INSTANCE_NUMS] = { PCC_FTM0, PCC_FTM1, PCC_FTM2, PCC_FTM3 };
+static ftm_state_t s_ftm_state[FTM_INSTANCE_NUMS];
+/* FTM1/FTM2 raise one DMA request per channel, FTM0/FTM3 one for all channels */
+static const uint8_t s_ftm_dma_req[FTM_INSTANCE_NUMS] =
+{
+    (uint8_t)EDMA_REQ_FTM0_OR_CH0_CH7, (uint8_t)EDMA_REQ_FTM1_CHANNEL_0,
+    (uint8_t)EDMA_REQ_FTM2_CHANNEL_0, (uint8_t)EDMA_REQ_FTM3_OR_CH0_CH7
+};
+static const bool s_ftm_dma_per_channel[FTM_INSTANCE_NUMS] = { false, true, true, false };
+/* Phase A/B inputs are only routed to FTM1 and FTM2 */
+static const bool s_ftm_has_quad[FTM_INSTANCE_NUMS] = { false, true, true, false };
+
+/*******************************************************************************
+ * 										Code
+ ******************************************************************************/
+
+/**
+ * @brief Pick the smallest prescaler whose period fits the counter.
+ *
+ * @param clk_hz Counter clock before the prescaler.
+ * @param frequency_hz PWM frequency.
+ * @param align Alignment (center aligned counts up and down).
+ * @param ps Output SC[PS] value.
+ * @param mod Output MOD value.
+ * @return bool true if a prescaler was found.
+ */
+static bool ftm_calc_period(uint32_t clk_hz, uint32_t frequency_hz, FTM_ALIGN_t align, uint32_t *ps, uint32_t *mod)
+{
+    uint32_t ticks;
+    uint32_t i;
+
+    for (i = 0U; i <= FTM_PRESCALER_MAX; i++)
+    {
+        ticks = (clk_hz >> i) / frequency_hz;
+
+        if (align == FTM_ALIGN_CENTER)
+        {
+            /* Period = 2 * MOD */
+            if (((ticks / 2U) >= 1U) && ((ticks / 2U) <= FTM_MOD_MAX_CENTER))
+            {
+                *ps = i;
+                *mod = ticks / 2U;
+                return true;
+            }
+        }
+        else
+        {
+            /* Period = MOD + 1 */
+            if ((ticks >= 2U) && ((ticks - 1U) <= FTM_MOD_MAX_EDGE))
+            {
+                *ps = i;
+                *mod = ticks - 1U;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Encode a deadtime in clock ticks as DTPS/DTVAL/DTVALEX, rounding up.
+ */
+static uint32_t ftm_encode_deadtime(uint32_t ticks)
+{
+    uint32_t dtps = FTM_DTPS_DIV1;
+    uint32_t value = ticks;
+
+    if (value > FTM_DEADTIME_VAL_MAX)
+    {
+        dtps = FTM_DTPS_DIV4;
+        value = (ticks + 3U) / 4U;
+    }
+    if (value > FTM_DEADTIME_VAL_MAX)
+    {
+        dtps = FTM_DTPS_DIV16;
+        value = (ticks + 15U) / 16U;
+    }
+
+    return FTM_DEADTIME_DTPS(dtps) |
+           FTM_DEADTIME_DTVAL(value) |
+           FTM_DEADTIME_DTVALEX(value >> FTM_DEADTIME_VAL_LOW_BITS);
+}
+
+/**
+ * @brief Convert a duty cycle (0..FTM_DUTY_MAX) to a channel value.
+ *
+ * Edge aligned: CnV = (MOD + 1) * duty, so 100 % gives CnV > MOD (always on).
+ * Center aligned: CnV = MOD * duty.
+ */
+static uint32_t ftm_duty_to_cnv(const ftm_state_t *state, uint16_t duty)
+{
+    uint32_t period = (state->align == FTM_ALIGN_CENTER) ? state->mod : ((uint32_t)state->mod + 1U);
+
+    return (period * duty) >> 15;
+}
+
+/**
+ * @brief Gate the clock, unlock the registers and stop the counter.
+ *
+ * Leaves the instance with MODE[WPDIS|FTMEN], counter stopped, CNTIN = 0 and
+ * no pair or decoder function, ready for a mode-specific setup.
+ */
+static FTM_STATUS_t ftm_enable(FTM_INSTANCE_t instance)
+{
+    FTM_Type *base = s_ftm_base_ptr[instance];
+    ftm_state_t *state = &s_ftm_state[instance];
+
+    if (PCC_EnableClock(s_ftm_pcc[instance]) != PCC_STATUS_SUCCESS)
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    /* Unlock write-protected registers, enable the FTM-specific register set */
+    base->MODE = FTM_MODE_WPDIS(1U) | FTM_MODE_FTMEN(1U);
+
+    /* Counter stopped: MOD, CNTIN and CnV are written directly, not buffered */
+    base->SC = 0U;
+    base->CNTIN = 0U;
+    base->CNT = 0U;
+    base->COMBINE = 0U;
+    base->QDCTRL = 0U;
+    base->FILTER = 0U;
+
+    state->channels = 0U;
+    state->quadrature = false;
+    state->counts_per_rev = 0U;
+    state->overflows = 0U;
+    state->revolutions = 0;
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Read the counter extended by the overflow count.
+ *
+ * The overflow count is re-read until stable against the ISR; an overflow
+ * still pending (TOF set, counter already wrapped) is counted here.
+ *
+ * @param base FTM register block.
+ * @param state Instance state.
+ * @param count Output raw counter value used for the result.
+ * @return uint64_t Extended counter value.
+ */
+static uint64_t ftm_now(const FTM_Type *base, const ftm_state_t *state, uint16_t *count)
+{
+    uint32_t ovf;
+    uint32_t cnt;
+    bool tof;
+
+    do
+    {
+        ovf = state->overflows;
+        cnt = base->CNT & FTM_COUNTER_MAX;
+        tof = ((base->SC & FTM_SC_TOF_MASK) != 0U);
+    } while (ovf != state->overflows);
+
+    if (tof && (cnt < FTM_COUNTER_HALF))
+    {
+        ovf++;
+    }
+
+    *count = (uint16_t)cnt;
+
+    return ((uint64_t)ovf << 16) | cnt;
+}
+
+/**
+ * @brief Initialize an FTM instance as a PWM generator.
+ *
+ * @param instance FTM instance.
+ * @param config PWM configuration.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_PwmInit(FTM_INSTANCE_t instance, const ftm_pwm_config_t *config)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+    uint32_t clkHz;
+    uint32_t ps;
+    uint32_t mod;
+    uint32_t cnsc;
+    uint32_t combine = 0U;
+    uint32_t pwmen = 0U;
+    uint32_t pair;
+    uint32_t i;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (config == NULL) || (config->frequency_hz == 0U) ||
+        ((config->channel_count != 0U) && (config->channels == NULL)) ||
+        (config->deadtime_ticks > FTM_DEADTIME_MAX_TICKS))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    clkHz = config->clk_hz;
+    if ((clkHz == 0U) && (config->clk_src == FTM_CLK_SYSTEM))
+    {
+        clkHz = SCG_GetCoreClock();
+    }
+
+    if (!ftm_calc_period(clkHz, config->frequency_hz, config->align, &ps, &mod))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < config->channel_count; i++)
+    {
+        const ftm_pwm_channel_config_t *ch = &config->channels[i];
+
+        if ((ch->channel >= FTM_CHANNEL_NUMS) || (ch->duty > FTM_DUTY_MAX) ||
+            (ch->complementary && ((ch->channel & 1U) != 0U)))
+        {
+            return FTM_STATUS_ERROR;
+        }
+    }
+
+    if (ftm_enable(instance) != FTM_STATUS_SUCCESS)
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    state = &s_ftm_state[instance];
+
+    state->mod = (uint16_t)mod;
+    state->align = config->align;
+
+    base->MOD = mod;
+    base->OUTMASK = 0U;
+    base->POL = 0U;
+
+    for (i = 0U; i < config->channel_count; i++)
+    {
+        const ftm_pwm_channel_config_t *ch = &config->channels[i];
+
+        cnsc = FTM_CnSC_MSB(1U) |
+               FTM_CnSC_ELSB((ch->polarity == FTM_POLARITY_HIGH) ? 1U : 0U) |
+               FTM_CnSC_ELSA((ch->polarity == FTM_POLARITY_LOW) ? 1U : 0U);
+
+        base->CONTROLS[ch->channel].CnSC = cnsc;
+        base->CONTROLS[ch->channel].CnV = ftm_duty_to_cnv(state, ch->duty);
+        pwmen |= FTM_SC_PWMEN0_MASK << ch->channel;
+        state->channels |= (uint8_t)(1U << ch->channel);
+
+        if (ch->complementary)
+        {
+            /* Odd channel mirrors the mode; COMP generates its waveform */
+            base->CONTROLS[ch->channel + 1U].CnSC = cnsc;
+            pwmen |= FTM_SC_PWMEN0_MASK << (ch->channel + 1U);
+            state->channels |= (uint8_t)(1U << (ch->channel + 1U));
+
+            pair = (uint32_t)ch->channel / 2U;
+            combine |= (FTM_COMBINE_COMP0_MASK |
+                        ((config->deadtime_ticks != 0U) ? FTM_COMBINE_DTEN0_MASK : 0U)) <<
+                       (pair * FTM_COMBINE_PAIR_WIDTH);
+        }
+    }
+
+    /* CnV of every pair loads from its buffer only on synchronisation */
+    for (pair = 0U; pair < (FTM_CHANNEL_NUMS / 2U); pair++)
+    {
+        combine |= FTM_COMBINE_SYNCEN0_MASK << (pair * FTM_COMBINE_PAIR_WIDTH);
+    }
+    base->COMBINE = combine;
+    base->DEADTIME = ftm_encode_deadtime(config->deadtime_ticks);
+
+    /* Enhanced sync: software trigger updates the buffers at the loading point */
+    base->SYNCONF = FTM_SYNCONF_SYNCMODE(1U) | FTM_SYNCONF_SWWRBUF(1U) | FTM_SYNCONF_SWRSTCNT(0U);
+    base->SYNC = FTM_SYNC_CNTMAX(1U) |
+                 FTM_SYNC_CNTMIN((config->align == FTM_ALIGN_CENTER) ? 1U : 0U);
+
+    /* Start the counter with the outputs enabled in one store */
+    base->SC = FTM_SC_CLKS(config->clk_src) |
+               FTM_SC_PS(ps) |
+               FTM_SC_CPWMS((config->align == FTM_ALIGN_CENTER) ? 1U : 0U) |
+               pwmen;
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop the counter, release the outputs and gate the FTM clock.
+ */
+FTM_STATUS_t FTM_PwmDeinit(FTM_INSTANCE_t instance)
+{
+    FTM_Type *base;
+
+    if (!FTM_INSTANCE_IS_VALID(instance))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+
+    base->SC = 0U;
+    base->COMBINE = 0U;
+    s_ftm_state[instance].channels = 0U;
+
+    return (PCC_DisableClock(s_ftm_pcc[instance]) == PCC_STATUS_SUCCESS) ? FTM_STATUS_SUCCESS : FTM_STATUS_ERROR;
+}
+
+/**
+ * @brief Buffer a new duty cycle for a channel.
+ *
+ * @param instance FTM instance.
+ * @param channel Channel 0..7.
+ * @param duty 0..FTM_DUTY_MAX.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_SetDuty(FTM_INSTANCE_t instance, uint8_t channel, uint16_t duty)
+{
+    const ftm_state_t *state;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (channel >= FTM_CHANNEL_NUMS) || (duty > FTM_DUTY_MAX))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    state = &s_ftm_state[instance];
+    if ((state->channels & (1U << channel)) == 0U)
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    s_ftm_base_ptr[instance]->CONTROLS[channel].CnV = ftm_duty_to_cnv(state, duty);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Load every buffered duty cycle at the next loading point.
+ *
+ * SWSYNC self-clears once the buffers have been transferred.
+ */
+void FTM_SyncDuty(FTM_INSTANCE_t instance)
+{
+    if (FTM_INSTANCE_IS_VALID(instance))
+    {
+        s_ftm_base_ptr[instance]->SYNC |= FTM_SYNC_SWSYNC_MASK;
+    }
+}
+
+/**
+ * @brief Buffer several duty cycles and load them together.
+ */
+FTM_STATUS_t FTM_SetDutySync(FTM_INSTANCE_t instance, const uint8_t *channels, const uint16_t *duties,
+                             uint8_t count)
+{
+    uint8_t i;
+
+    if ((channels == NULL) || (duties == NULL))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        if (FTM_SetDuty(instance, channels[i], duties[i]) != FTM_STATUS_SUCCESS)
+        {
+            return FTM_STATUS_ERROR;
+        }
+    }
+
+    FTM_SyncDuty(instance);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Return the PWM period in counter ticks.
+ */
+uint32_t FTM_GetPeriodTicks(FTM_INSTANCE_t instance)
+{
+    const ftm_state_t *state;
+
+    if (!FTM_INSTANCE_IS_VALID(instance))
+    {
+        return 0U;
+    }
+
+    state = &s_ftm_state[instance];
+
+    return (state->align == FTM_ALIGN_CENTER) ? (2U * (uint32_t)state->mod) : ((uint32_t)state->mod + 1U);
+}
+
+/**
+ * @brief Initialize an FTM instance for input capture.
+ *
+ * The counter runs freely over 16 bits; channels capture on the selected edge
+ * and either set CHF for polling or raise a DMA request.
+ *
+ * @param instance FTM instance.
+ * @param config Capture configuration.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_CaptureInit(FTM_INSTANCE_t instance, const ftm_capture_config_t *config)
+{
+    FTM_Type *base;
+    uint32_t filter = 0U;
+    uint32_t i;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (config == NULL) || (config->prescaler > FTM_PRESCALER_MAX) ||
+        ((config->channel_count != 0U) && (config->channels == NULL)))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < config->channel_count; i++)
+    {
+        const ftm_capture_channel_config_t *ch = &config->channels[i];
+
+        if ((ch->channel >= FTM_CHANNEL_NUMS) || (ch->edge < FTM_EDGE_RISING) || (ch->edge > FTM_EDGE_BOTH) ||
+            (ch->filter > FTM_FILTER_VAL_MAX) ||
+            ((ch->filter != 0U) && (ch->channel >= FTM_FILTER_CHANNEL_NUMS)))
+        {
+            return FTM_STATUS_ERROR;
+        }
+    }
+
+    if (ftm_enable(instance) != FTM_STATUS_SUCCESS)
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    base->MOD = FTM_COUNTER_MAX;
+
+    for (i = 0U; i < config->channel_count; i++)
+    {
+        const ftm_capture_channel_config_t *ch = &config->channels[i];
+
+        /* MSB:MSA = 00 input capture; with DMA = 1 CHIE requests a transfer */
+        base->CONTROLS[ch->channel].CnSC = ((uint32_t)ch->edge << FTM_CnSC_ELSA_SHIFT) |
+                                           FTM_CnSC_CHIE(ch->dma ? 1U : 0U) |
+                                           FTM_CnSC_DMA(ch->dma ? 1U : 0U);
+        filter |= (uint32_t)ch->filter << (ch->channel * FTM_FILTER_CHANNEL_WIDTH);
+        s_ftm_state[instance].channels |= (uint8_t)(1U << ch->channel);
+    }
+    base->FILTER = filter;
+
+    base->SC = FTM_SC_CLKS(config->clk_src) |
+               FTM_SC_PS(config->prescaler) |
+               FTM_SC_TOIE(config->overflow_irq ? 1U : 0U);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Return the current counter time extended to 64 bits.
+ */
+uint64_t FTM_GetTimestamp(FTM_INSTANCE_t instance)
+{
+    uint16_t count;
+
+    if (!FTM_INSTANCE_IS_VALID(instance))
+    {
+        return 0U;
+    }
+
+    return ftm_now(s_ftm_base_ptr[instance], &s_ftm_state[instance], &count);
+}
+
+/**
+ * @brief Read and clear a pending capture, extended to 64 bits.
+ *
+ * The capture is placed (CNT - CnV) mod 2^16 ticks before the extended current
+ * time, which avoids guessing on which side of an overflow the edge fell.
+ */
+FTM_STATUS_t FTM_ReadCapture(FTM_INSTANCE_t instance, uint8_t channel, uint64_t *timestamp)
+{
+    FTM_Type *base;
+    uint64_t now;
+    uint16_t count;
+    uint16_t value;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (channel >= FTM_CHANNEL_NUMS) || (timestamp == NULL))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+
+    if ((base->CONTROLS[channel].CnSC & FTM_CnSC_CHF_MASK) == 0U)
+    {
+        return FTM_STATUS_NO_DATA;
+    }
+
+    value = (uint16_t)base->CONTROLS[channel].CnV;
+    now = ftm_now(base, &s_ftm_state[instance], &count);
+    base->CONTROLS[channel].CnSC &= ~FTM_CnSC_CHF_MASK;
+
+    *timestamp = now - (uint16_t)(count - value);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Switch a channel pair to dual-edge capture for pulse measurement.
+ *
+ * In one-shot mode the pair is re-armed by FTM_ReadPulseWidth(), so each read
+ * returns the first pulse after the previous read; in continuous mode the
+ * registers always hold the latest pulse.
+ */
+FTM_STATUS_t FTM_ConfigPulseMeasure(FTM_INSTANCE_t instance, uint8_t pair, FTM_PULSE_t pulse, bool continuous)
+{
+    FTM_Type *base;
+    uint32_t ch;
+    uint32_t shift;
+    FTM_EDGE_t first;
+    FTM_EDGE_t second;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (pair >= (FTM_CHANNEL_NUMS / 2U)) || (pulse > FTM_PULSE_PERIOD))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    ch = 2U * (uint32_t)pair;
+    shift = (uint32_t)pair * FTM_COMBINE_PAIR_WIDTH;
+    first = (pulse == FTM_PULSE_LOW) ? FTM_EDGE_FALLING : FTM_EDGE_RISING;
+    second = (pulse == FTM_PULSE_HIGH) ? FTM_EDGE_FALLING : FTM_EDGE_RISING;
+
+    /* Disarm, set the edges, then enable dual-edge capture and arm it */
+    base->COMBINE &= ~((FTM_COMBINE_DECAPEN0_MASK | FTM_COMBINE_DECAP0_MASK) << shift);
+    base->CONTROLS[ch].CnSC = ((uint32_t)first << FTM_CnSC_ELSA_SHIFT) | FTM_CnSC_MSA(continuous ? 1U : 0U);
+    base->CONTROLS[ch + 1U].CnSC = (uint32_t)second << FTM_CnSC_ELSA_SHIFT;
+    base->COMBINE |= FTM_COMBINE_DECAPEN0_MASK << shift;
+    base->COMBINE |= FTM_COMBINE_DECAP0_MASK << shift;
+
+    s_ftm_state[instance].channels |= (uint8_t)(3U << ch);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Read a completed pulse measurement in counter ticks.
+ */
+FTM_STATUS_t FTM_ReadPulseWidth(FTM_INSTANCE_t instance, uint8_t pair, uint32_t *ticks)
+{
+    FTM_Type *base;
+    uint32_t ch;
+    uint16_t start;
+    uint16_t end;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (pair >= (FTM_CHANNEL_NUMS / 2U)) || (ticks == NULL))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    ch = 2U * (uint32_t)pair;
+
+    /* CH(n+1)F marks the second edge */
+    if ((base->CONTROLS[ch + 1U].CnSC & FTM_CnSC_CHF_MASK) == 0U)
+    {
+        return FTM_STATUS_NO_DATA;
+    }
+
+    start = (uint16_t)base->CONTROLS[ch].CnV;
+    end = (uint16_t)base->CONTROLS[ch + 1U].CnV;
+    base->CONTROLS[ch].CnSC &= ~FTM_CnSC_CHF_MASK;
+    base->CONTROLS[ch + 1U].CnSC &= ~FTM_CnSC_CHF_MASK;
+
+    if ((base->CONTROLS[ch].CnSC & FTM_CnSC_MSA_MASK) == 0U)
+    {
+        /* One-shot: DECAP cleared itself after the second edge */
+        base->COMBINE |= FTM_COMBINE_DECAP0_MASK << ((uint32_t)pair * FTM_COMBINE_PAIR_WIDTH);
+    }
+
+    *ticks = (uint16_t)(end - start);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start the eDMA drain of a capture channel into a ring.
+ *
+ * Each request copies the low half-word of CnV; the DMA acknowledge clears CHF.
+ * The destination wraps after len entries and the channel stays enabled.
+ */
+FTM_STATUS_t FTM_StartCaptureDma(ftm_capture_ring_t *ring)
+{
+    edma_transfer_config_t xfer;
+    FTM_Type *base;
+    uint8_t source;
+
+    if ((ring == NULL) || (ring->buf == NULL) || (ring->len == 0U) ||
+        (!FTM_INSTANCE_IS_VALID(ring->instance)) || (ring->channel >= FTM_CHANNEL_NUMS))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[ring->instance];
+
+    if ((base->CONTROLS[ring->channel].CnSC & FTM_CnSC_DMA_MASK) == 0U)
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    source = s_ftm_dma_req[ring->instance];
+    if (s_ftm_dma_per_channel[ring->instance])
+    {
+        source = (uint8_t)(source + ring->channel);
+    }
+
+    xfer.src_addr = (uint32_t)&base->CONTROLS[ring->channel].CnV;
+    xfer.dst_addr = (uint32_t)ring->buf;
+    xfer.src_offset = 0;
+    xfer.dst_offset = (int16_t)sizeof(uint16_t);
+    xfer.src_size = EDMA_SIZE_2_BYTES;
+    xfer.dst_size = EDMA_SIZE_2_BYTES;
+    xfer.minor_bytes = sizeof(uint16_t);
+    xfer.major_count = ring->len;
+    xfer.src_last = 0;
+    xfer.dst_last = -(int32_t)((uint32_t)ring->len * sizeof(uint16_t));
+    xfer.int_major = false;
+    xfer.int_half = false;
+    xfer.loop = true;
+
+    ring->rd = 0U;
+    ring->last = FTM_GetTimestamp(ring->instance);
+
+    if ((EDMA_ConfigTransfer(ring->dma_channel, &xfer) != EDMA_STATUS_SUCCESS) ||
+        (EDMA_SetChannelSource(ring->dma_channel, source) != EDMA_STATUS_SUCCESS))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    EDMA_StartChannel(ring->dma_channel);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop the eDMA drain of a capture channel.
+ */
+void FTM_StopCaptureDma(ftm_capture_ring_t *ring)
+{
+    if (ring != NULL)
+    {
+        EDMA_StopChannel(ring->dma_channel);
+        (void)EDMA_SetChannelSource(ring->dma_channel, 0U);
+    }
+}
+
+/**
+ * @brief Number of captures waiting in the ring.
+ *
+ * The producer index comes from the channel DADDR; a ring smaller than the
+ * worst-case backlog overwrites unread captures.
+ */
+uint16_t FTM_CaptureRingPending(const ftm_capture_ring_t *ring)
+{
+    uint32_t wr;
+
+    if ((ring == NULL) || (ring->len == 0U))
+    {
+        return 0U;
+    }
+
+    wr = (EDMA_GetDestAddress(ring->dma_channel) - (uint32_t)ring->buf) / sizeof(uint16_t);
+    if (wr >= ring->len)
+    {
+        wr = 0U;
+    }
+
+    return (uint16_t)((wr + ring->len - ring->rd) % ring->len);
+}
+
+/**
+ * @brief Pop one capture from the ring, extended to 64 bits.
+ *
+ * Each entry is extended from the previous one by the 16-bit forward distance.
+ */
+FTM_STATUS_t FTM_CaptureRingRead(ftm_capture_ring_t *ring, uint64_t *timestamp)
+{
+    uint16_t value;
+
+    if ((ring == NULL) || (timestamp == NULL))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    if (FTM_CaptureRingPending(ring) == 0U)
+    {
+        return FTM_STATUS_NO_DATA;
+    }
+
+    value = ring->buf[ring->rd];
+    ring->rd = (uint16_t)((ring->rd + 1U) % ring->len);
+    ring->last += (uint16_t)(value - (uint16_t)ring->last);
+
+    *timestamp = ring->last;
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Initialize an FTM instance as quadrature decoder.
+ *
+ * @param instance FTM1 or FTM2.
+ * @param config Decoder configuration.
+ * @return FTM_STATUS_t SUCCESS or ERROR.
+ */
+FTM_STATUS_t FTM_QuadInit(FTM_INSTANCE_t instance, const ftm_quad_config_t *config)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+
+    if ((!FTM_INSTANCE_IS_VALID(instance)) || (config == NULL) || (!s_ftm_has_quad[instance]) ||
+        (config->counts_per_rev < 2U) || (config->counts_per_rev > (FTM_COUNTER_MAX + 1U)) ||
+        (config->filter_a > FTM_FILTER_VAL_MAX) || (config->filter_b > FTM_FILTER_VAL_MAX))
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    if (ftm_enable(instance) != FTM_STATUS_SUCCESS)
+    {
+        return FTM_STATUS_ERROR;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    state = &s_ftm_state[instance];
+
+    base->MOD = config->counts_per_rev - 1U;
+
+    /* Phase A/B filters reuse the channel 0/1 filter values */
+    base->FILTER = FTM_FILTER_CH0FVAL(config->filter_a) | FTM_FILTER_CH1FVAL(config->filter_b);
+    base->QDCTRL = FTM_QDCTRL_QUADEN(1U) |
+                   FTM_QDCTRL_QUADMODE(config->mode) |
+                   FTM_QDCTRL_PHAFLTREN((config->filter_a != 0U) ? 1U : 0U) |
+                   FTM_QDCTRL_PHBFLTREN((config->filter_b != 0U) ? 1U : 0U) |
+                   FTM_QDCTRL_PHAPOL(config->invert_a ? 1U : 0U) |
+                   FTM_QDCTRL_PHBPOL(config->invert_b ? 1U : 0U);
+
+    state->quadrature = true;
+    state->counts_per_rev = config->counts_per_rev;
+
+    /* The decoder clocks the counter; CLKS only has to be non-zero */
+    base->SC = FTM_SC_CLKS(FTM_CLK_SYSTEM) | FTM_SC_TOIE(1U);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Return the signed position: revolutions * counts_per_rev + counter.
+ *
+ * A wrap still pending in TOF is accounted for using TOFDIR and the side of the
+ * counter range the count is on.
+ */
+int64_t FTM_QuadGetPosition(FTM_INSTANCE_t instance)
+{
+    const FTM_Type *base;
+    const ftm_state_t *state;
+    int32_t revs;
+    uint32_t cnt;
+    uint32_t sc;
+    uint32_t qdctrl;
+
+    if (!FTM_INSTANCE_IS_VALID(instance))
+    {
+        return 0;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    state = &s_ftm_state[instance];
+
+    if (!state->quadrature)
+    {
+        return 0;
+    }
+
+    do
+    {
+        revs = state->revolutions;
+        cnt = base->CNT & FTM_COUNTER_MAX;
+        sc = base->SC;
+        qdctrl = base->QDCTRL;
+    } while (revs != state->revolutions);
+
+    if ((sc & FTM_SC_TOF_MASK) != 0U)
+    {
+        if (((qdctrl & FTM_QDCTRL_TOFDIR_MASK) != 0U) && (cnt < (state->counts_per_rev / 2U)))
+        {
+            revs++;
+        }
+        else if (((qdctrl & FTM_QDCTRL_TOFDIR_MASK) == 0U) && (cnt >= (state->counts_per_rev / 2U)))
+        {
+            revs--;
+        }
+        else
+        {
+            /* Wrap already visible in the count */
+        }
+    }
+
+    return ((int64_t)revs * (int64_t)state->counts_per_rev) + (int64_t)cnt;
+}
+
+/**
+ * @brief Return true while the counter is counting up.
+ */
+bool FTM_QuadIsCountingUp(FTM_INSTANCE_t instance)
+{
+    return FTM_INSTANCE_IS_VALID(instance) &&
+           ((s_ftm_base_ptr[instance]->QDCTRL & FTM_QDCTRL_QUADIR_MASK) != 0U);
+}
+
+/**
+ * @brief Counter overflow service.
+ *
+ * TOFDIR is sampled before TOF is cleared: it tells whether the quadrature
+ * counter wrapped upwards (MOD -> CNTIN) or downwards.
+ */
+void FTM_OverflowIRQHandler(FTM_INSTANCE_t instance)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+
+    if (!FTM_INSTANCE_IS_VALID(instance))
+    {
+        return;
+    }
+
+    base = s_ftm_base_ptr[instance];
+    state = &s_ftm_state[instance];
+
+    if ((base->SC & FTM_SC_TOF_MASK) == 0U)
+    {
+        return;
+    }
+
+    if (state->quadrature)
+    {
+        state->revolutions += ((base->QDCTRL & FTM_QDCTRL_TOFDIR_MASK) != 0U) ? 1 : -1;
+    }
+    else
+    {
+        state->overflows++;
+    }
+
+    base->SC &= ~FTM_SC_TOF_MASK;
+}
+
+void FTM0_Ovf_Reload_IRQHandler(void)
+{
+    FTM_OverflowIRQHandler(FTM_0);
+}
+
+void FTM1_Ovf_Reload_IRQHandler(void)
+{
+    FTM_OverflowIRQHandler(FTM_1);
+}
+
+void FTM2_Ovf_Reload_IRQHandler(void)
+{
+    FTM_OverflowIRQHandler(FTM_2);
+}
+
+void FTM3_Ovf_Reload_IRQHandler(void)
+{
+    FTM_OverflowIRQHandler(FTM_3);
+}
@@ -0,0 +1,309 @@
+/**
+ * @file Driver_LMEM.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief LMEM code cache driver implementation.
+ * @version 0.1
+ * @date 2025-10-29
+ *
+ * Cache-wide commands go through PCCCR[GO]. Line commands either take a
+ * physical address (PCCSAR, LADSEL = 1) or a set and way (PCCLCR[CACHEADDR],
+ * WSEL). Both kinds complete when their LGO bit reads back as 0.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_LMEM.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* PCCLCR[LCMD] encodings */
+#define LMEM_LCMD_READ                  0U
+#define LMEM_LCMD_INVALIDATE            1U
+#define LMEM_LCMD_PUSH                  2U
+#define LMEM_LCMD_CLEAR                 3U
+
+#define LMEM_SIZE                       (LMEM_LINE_SIZE * LMEM_SETS * LMEM_WAYS)
+
+/* Region n mode field, region 0 in the top bits */
+#define LMEM_REGION_SHIFT(n)            (30U - (2U * (uint32_t)(n)))
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void lmem_cache_command(uint32_t command);
+static void lmem_line_command(uint32_t address, uint32_t lcmd);
+static void lmem_range_command(uint32_t address, uint32_t len, uint32_t lcmd);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void lmem_cache_command(uint32_t command)
+{
+    /* Way bits of the previous command stay set, only keep the enables */
+    uint32_t ccr = IP_LMEM->PCCCR & (LMEM_PCCCR_ENCACHE_MASK | LMEM_PCCCR_PCCR2_MASK | LMEM_PCCCR_PCCR3_MASK);
+
+    IP_LMEM->PCCCR = ccr | command | LMEM_PCCCR_GO_MASK;
+
+    while ((IP_LMEM->PCCCR & LMEM_PCCCR_GO_MASK) != 0U)
+    {
+    }
+}
+
+static void lmem_line_command(uint32_t address, uint32_t lcmd)
+{
+    uint32_t lcr = IP_LMEM->PCCLCR & ~(LMEM_PCCLCR_LCMD_MASK | LMEM_PCCLCR_TDSEL_MASK);
+
+    IP_LMEM->PCCLCR = lcr | LMEM_PCCLCR_LCMD(lcmd) | LMEM_PCCLCR_LADSEL_MASK;
+    IP_LMEM->PCCSAR = (address & LMEM_PCCSAR_PHYADDR_MASK) | LMEM_PCCSAR_LGO_MASK;
+
+    while ((IP_LMEM->PCCSAR & LMEM_PCCSAR_LGO_MASK) != 0U)
+    {
+    }
+}
+
+static void lmem_range_command(uint32_t address, uint32_t len, uint32_t lcmd)
+{
+    uint32_t end;
+
+    if (len == 0U)
+    {
+        return;
+    }
+
+    if (len >= LMEM_SIZE)
+    {
+        lmem_cache_command((lcmd == LMEM_LCMD_INVALIDATE) ?
+                           (LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK) :
+                           (LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_PUSHW1_MASK |
+                            LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK));
+        return;
+    }
+
+    end = address + len;
+    address &= ~(LMEM_LINE_SIZE - 1U);
+
+    while (address < end)
+    {
+        lmem_line_command(address, lcmd);
+        address += LMEM_LINE_SIZE;
+    }
+}
+
+/**
+ * @brief Invalidate the whole cache and turn it on.
+ */
+void LMEM_Enable(void)
+{
+    lmem_cache_command(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+    IP_LMEM->PCCCR |= LMEM_PCCCR_ENCACHE_MASK;
+}
+
+/**
+ * @brief Push and invalidate the whole cache and turn it off.
+ */
+void LMEM_Disable(void)
+{
+    LMEM_ClearAll();
+    IP_LMEM->PCCCR &= ~LMEM_PCCCR_ENCACHE_MASK;
+}
+
+/**
+ * @brief Check whether the cache is on.
+ */
+bool LMEM_IsEnabled(void)
+{
+    return (IP_LMEM->PCCCR & LMEM_PCCCR_ENCACHE_MASK) != 0U;
+}
+
+/**
+ * @brief Set the cache mode of a region.
+ *
+ * @param region Region number (0..LMEM_REGION_COUNT-1).
+ * @param mode Cache mode.
+ * @return LMEM_STATUS_t SUCCESS or ERROR.
+ */
+LMEM_STATUS_t LMEM_SetRegionMode(uint8_t region, LMEM_MODE_t mode)
+{
+    uint32_t rmr;
+
+    if ((region >= LMEM_REGION_COUNT) ||
+        ((mode != LMEM_MODE_NON_CACHEABLE) && (mode != LMEM_MODE_WRITE_THROUGH) && (mode != LMEM_MODE_WRITE_BACK)))
+    {
+        return LMEM_STATUS_ERROR;
+    }
+
+    rmr = IP_LMEM->PCCRMR & ~(3UL << LMEM_REGION_SHIFT(region));
+    IP_LMEM->PCCRMR = rmr | ((uint32_t)mode << LMEM_REGION_SHIFT(region));
+
+    if (LMEM_IsEnabled())
+    {
+        LMEM_ClearAll();
+    }
+
+    return LMEM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Read the cache mode of a region (non-cacheable for a bad region).
+ */
+LMEM_MODE_t LMEM_GetRegionMode(uint8_t region)
+{
+    uint32_t mode;
+
+    if (region >= LMEM_REGION_COUNT)
+    {
+        return LMEM_MODE_NON_CACHEABLE;
+    }
+
+    mode = (IP_LMEM->PCCRMR >> LMEM_REGION_SHIFT(region)) & 3U;
+
+    /* 01 is also non-cacheable */
+    return (mode < (uint32_t)LMEM_MODE_WRITE_THROUGH) ? LMEM_MODE_NON_CACHEABLE : (LMEM_MODE_t)mode;
+}
+
+/**
+ * @brief Invalidate every line of both ways.
+ */
+void LMEM_InvalidateAll(void)
+{
+    lmem_cache_command(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+}
+
+/**
+ * @brief Push modified lines, then invalidate, in both ways.
+ */
+void LMEM_ClearAll(void)
+{
+    lmem_cache_command(LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_PUSHW1_MASK |
+                       LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+}
+
+/**
+ * @brief Invalidate every line of one way.
+ *
+ * @param way Way number (0..LMEM_WAYS-1).
+ * @return LMEM_STATUS_t SUCCESS or ERROR.
+ */
+LMEM_STATUS_t LMEM_InvalidateWay(uint8_t way)
+{
+    if (way >= LMEM_WAYS)
+    {
+        return LMEM_STATUS_ERROR;
+    }
+
+    lmem_cache_command((way == 0U) ? LMEM_PCCCR_INVW0_MASK : LMEM_PCCCR_INVW1_MASK);
+
+    return LMEM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Push and invalidate every line of one way.
+ *
+ * @param way Way number (0..LMEM_WAYS-1).
+ * @return LMEM_STATUS_t SUCCESS or ERROR.
+ */
+LMEM_STATUS_t LMEM_ClearWay(uint8_t way)
+{
+    if (way >= LMEM_WAYS)
+    {
+        return LMEM_STATUS_ERROR;
+    }
+
+    lmem_cache_command((way == 0U) ? (LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_INVW0_MASK) :
+                                     (LMEM_PCCCR_PUSHW1_MASK | LMEM_PCCCR_INVW1_MASK));
+
+    return LMEM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Invalidate the line holding a physical address, if cached.
+ */
+void LMEM_InvalidateLine(uint32_t address)
+{
+    lmem_line_command(address, LMEM_LCMD_INVALIDATE);
+}
+
+/**
+ * @brief Push and invalidate the line holding a physical address, if cached.
+ */
+void LMEM_ClearLine(uint32_t address)
+{
+    lmem_line_command(address, LMEM_LCMD_CLEAR);
+}
+
+/**
+ * @brief Invalidate all lines covering [address, address + len).
+ *
+ * @param address Start address, any alignment.
+ * @param len Number of bytes.
+ */
+void LMEM_InvalidateRange(uint32_t address, uint32_t len)
+{
+    lmem_range_command(address, len, LMEM_LCMD_INVALIDATE);
+}
+
+/**
+ * @brief Push and invalidate all lines covering [address, address + len).
+ *
+ * @param address Start address, any alignment.
+ * @param len Number of bytes.
+ */
+void LMEM_ClearRange(uint32_t address, uint32_t len)
+{
+    lmem_range_command(address, len, LMEM_LCMD_CLEAR);
+}
+
+/**
+ * @brief Check whether the line holding a physical address is in the cache.
+ *
+ * A search-and-read line command leaves the valid bit of the hit line in
+ * PCCLCR[LCIVB]; a miss reads back as invalid.
+ */
+bool LMEM_IsCached(uint32_t address)
+{
+    lmem_line_command(address, LMEM_LCMD_READ);
+
+    return (IP_LMEM->PCCLCR & LMEM_PCCLCR_LCIVB_MASK) != 0U;
+}
+
+/**
+ * @brief Count valid lines in both ways.
+ *
+ * Reads the tag of every set and way with set/way line commands.
+ *
+ * @return uint32_t Valid lines, 0..LMEM_WAYS * LMEM_SETS.
+ */
+uint32_t LMEM_GetValidLines(void)
+{
+    uint32_t way;
+    uint32_t set;
+    uint32_t count = 0U;
+
+    for (way = 0U; way < LMEM_WAYS; way++)
+    {
+        for (set = 0U; set < LMEM_SETS; set++)
+        {
+            IP_LMEM->PCCLCR = LMEM_PCCLCR_LCMD(LMEM_LCMD_READ) | LMEM_PCCLCR_TDSEL_MASK |
+                              LMEM_PCCLCR_WSEL(way) | LMEM_PCCLCR_CACHEADDR(set * (LMEM_LINE_SIZE / 4U)) |
+                              LMEM_PCCLCR_LGO_MASK;
+
+            while ((IP_LMEM->PCCLCR & LMEM_PCCLCR_LGO_MASK) != 0U)
+            {
+            }
+
+            if ((IP_LMEM->PCCLCR & LMEM_PCCLCR_LCIVB_MASK) != 0U)
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file Driver_MPU.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief System MPU (SYSMPU) region manager implementation.
+ * @version 0.1
+ * @date 2025-11-09
+ *
+ * Writing WORD0..WORD2 of a descriptor clears its VLD, WORD3 sets it again;
+ * the set's words are stored in register order, so each descriptor is
+ * complete when it becomes valid. RGD0 word 2 is changed through RGDAAC0,
+ * which leaves its fixed start and end alone.
+ *
+ * Task and shared descriptors grant nothing to the debugger and DMA masters
+ * (supervisor field "same as user", user field none): those keep what RGD0
+ * gives them.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_MPU.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+#include "../include/S32K144_fields.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* M0SM..M3SM = 3: supervisor rights as the user field */
+#define MPU_SM_AS_USER              3U
+#define MPU_WORD2_BASE              (MPU_RGD_WORD2_M0SM(MPU_SM_AS_USER) | MPU_RGD_WORD2_M1SM(MPU_SM_AS_USER) | \
+                                     MPU_RGD_WORD2_M2SM(MPU_SM_AS_USER) | MPU_RGD_WORD2_M3SM(MPU_SM_AS_USER))
+
+/* One SP bit per off-platform slot: 8 slots of 4 bits per OPACR */
+#define MPU_OPACR_SP_ALL            0x44444444U
+#define MPU_OPACR_SP(slot)          (AIPS_OPACR_SP0_MASK >> (((slot) & 7U) * 4U))
+
+/* Linker script RAM regions */
+extern uint32_t __m_data_start__[];
+extern uint32_t __m_data_end__[];
+extern uint32_t __m_data_2_start__[];
+extern uint32_t __m_data_2_end__[];
+/* RAM vector table (.interrupts_ram), at the start of m_data */
+extern uint32_t __interrupts_ram_start__[];
+extern uint32_t __interrupts_ram_end__[];
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static bool mpu_in_ram(uint32_t start, uint32_t end);
+static bool mpu_region_valid(const mpu_region_t *region);
+static void mpu_encode(const mpu_region_t *region, uint32_t words[4]);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+/* OPACRs with every slot supervisor-only, as MPU_Init() left them */
+static uint32_t s_mpu_opacr[AIPS_OPACR_COUNT];
+static bool s_mpu_ready = false;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static bool mpu_in_ram(uint32_t start, uint32_t end)
+{
+    return ((start >= (uint32_t)__m_data_start__) && (end < (uint32_t)__m_data_end__)) ||
+           ((start >= (uint32_t)__m_data_2_start__) && (end < (uint32_t)__m_data_2_end__));
+}
+
+static bool mpu_region_valid(const mpu_region_t *region)
+{
+    if ((region->access == 0U) || ((region->access & ~(MPU_ACCESS_R | MPU_ACCESS_W | MPU_ACCESS_X)) != 0U) ||
+        (region->end <= region->start) || ((region->start & (MPU_GRANULE - 1U)) != 0U) ||
+        (((region->end + 1U) & (MPU_GRANULE - 1U)) != 0U))
+    {
+        return false;
+    }
+
+    if ((region->access & MPU_ACCESS_W) == 0U)
+    {
+        return true;
+    }
+
+    /* end is inclusive; nothing writable may touch the live vector table */
+    return mpu_in_ram(region->start, region->end) &&
+           ((region->end < (uint32_t)__interrupts_ram_start__) || (region->start >= (uint32_t)__interrupts_ram_end__));
+}
+
+static void mpu_encode(const mpu_region_t *region, uint32_t words[4])
+{
+    words[0] = region->start & MPU_RGD_WORD0_SRTADDR_MASK;
+    words[1] = region->end & MPU_RGD_WORD1_ENDADDR_MASK;
+    words[2] = MPU_WORD2_BASE | MPU_RGD_WORD2_M0UM(region->access);
+    words[3] = MPU_RGD_WORD3_VLD_MASK;
+}
+
+MPU_STATUS_t MPU_Init(const mpu_region_t *shared, uint8_t count)
+{
+    uint32_t words[4];
+    uint32_t i;
+
+    if ((count > MPU_SHARED_MAX) || ((count != 0U) && (shared == NULL)))
+    {
+        return MPU_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        if (!mpu_region_valid(&shared[i]))
+        {
+            return MPU_STATUS_ERROR;
+        }
+    }
+
+    /* Core: supervisor r/w/x, user nothing */
+    IP_MPU->RGDAAC[0] = IP_MPU->RGD[0].WORD2 &
+                        ~(MPU_RGD_WORD2_M0UM_MASK | MPU_RGD_WORD2_M0SM_MASK | MPU_RGD_WORD2_M0PE_MASK);
+
+    for (i = 1U; i < MPU_RGD_COUNT; i++)
+    {
+        if (i <= count)
+        {
+            mpu_encode(&shared[i - 1U], words);
+            IP_MPU->RGD[i].WORD0 = words[0];
+            IP_MPU->RGD[i].WORD1 = words[1];
+            IP_MPU->RGD[i].WORD2 = words[2];
+            IP_MPU->RGD[i].WORD3 = words[3];
+        }
+        else
+        {
+            IP_MPU->RGD[i].WORD3 = 0U;
+        }
+    }
+
+    for (i = 0U; i < AIPS_OPACR_COUNT; i++)
+    {
+        s_mpu_opacr[i] = IP_AIPS->OPACR[i] | MPU_OPACR_SP_ALL;
+        IP_AIPS->OPACR[i] = s_mpu_opacr[i];
+    }
+
+    IP_MPU->CESR = MPU_CESR_W1C_BASE(IP_MPU->CESR) | MPU_CESR_VLD_MASK;
+    s_mpu_ready = true;
+
+    return MPU_STATUS_SUCCESS;
+}
+
+MPU_STATUS_t MPU_BuildTaskSet(mpu_task_set_t *set, const mpu_region_t *regions, uint8_t count,
+                              const uint32_t *periph, uint8_t periph_count)
+{
+    uint32_t slot;
+    uint32_t i;
+
+    if ((set == NULL) || !s_mpu_ready || (count > MPU_TASK_REGIONS) || ((count != 0U) && (regions == NULL)) ||
+        ((periph_count != 0U) && (periph == NULL)))
+    {
+        return MPU_STATUS_ERROR;
+    }
+
+    MPU_EmptyTaskSet(set);
+
+    for (i = 0U; i < count; i++)
+    {
+        if (!mpu_region_valid(&regions[i]))
+        {
+            return MPU_STATUS_ERROR;
+        }
+        mpu_encode(&regions[i], set->rgd[i]);
+    }
+
+    for (i = 0U; i < periph_count; i++)
+    {
+        if (periph[i] < MPU_PERIPH_FIRST)
+        {
+            return MPU_STATUS_ERROR;
+        }
+        slot = (periph[i] - MPU_PERIPH_FIRST) / MPU_PERIPH_SLOT_SIZE;
+        if (slot >= MPU_PERIPH_SLOTS)
+        {
+            return MPU_STATUS_ERROR;
+        }
+        set->opacr[slot / 8U] &= ~MPU_OPACR_SP(slot);
+    }
+
+    return MPU_STATUS_SUCCESS;
+}
+
+void MPU_EmptyTaskSet(mpu_task_set_t *set)
+{
+    uint32_t i;
+
+    for (i = 0U; i < MPU_TASK_REGIONS; i++)
+    {
+        set->rgd[i][0] = 0U;
+        set->rgd[i][1] = 0U;
+        set->rgd[i][2] = 0U;
+        set->rgd[i][3] = 0U;
+    }
+
+    for (i = 0U; i < AIPS_OPACR_COUNT; i++)
+    {
+        set->opacr[i] = s_mpu_opacr[i];
+    }
+}
+
+void MPU_SwitchTaskSet(const mpu_task_set_t *set)
+{
+    const uint32_t *src = &set->rgd[0][0];
+    volatile uint32_t *rgd = &IP_MPU->RGD[MPU_TASK_FIRST].WORD0;
+    volatile uint32_t *opacr = &IP_AIPS->OPACR[0];
+
+    /* 4 descriptors, then 12 OPACRs, four words per LDM/STM pair */
+    __asm volatile ("ldmia %0!, {r2-r5}\n\t" "stmia %1!, {r2-r5}\n\t"
+                    "ldmia %0!, {r2-r5}\n\t" "stmia %1!, {r2-r5}\n\t"
+                    "ldmia %0!, {r2-r5}\n\t" "stmia %1!, {r2-r5}\n\t"
+                    "ldmia %0!, {r2-r5}\n\t" "stmia %1!, {r2-r5}\n\t"
+                    "ldmia %0!, {r2-r5}\n\t" "stmia %2!, {r2-r5}\n\t"
+                    "ldmia %0!, {r2-r5}\n\t" "stmia %2!, {r2-r5}\n\t"
+                    "ldmia %0!, {r2-r5}\n\t" "stmia %2!, {r2-r5}"
+                    : "+r" (src), "+r" (rgd), "+r" (opacr)
+                    :
+                    : "r2", "r3", "r4", "r5", "memory");
+}
+
+bool MPU_GetError(uint8_t *port, uint32_t *address, uint32_t *detail)
+{
+    uint32_t cesr = IP_MPU->CESR;
+    uint32_t i;
+
+    for (i = 0U; i < MPU_EAR_EDR_COUNT; i++)
+    {
+        if ((cesr & (MPU_CESR_SPERR0_MASK >> i)) != 0U)
+        {
+            *port = (uint8_t)i;
+            *address = IP_MPU->EAR_EDR[i].EAR;
+            *detail = IP_MPU->EAR_EDR[i].EDR;
+            IP_MPU->CESR = MPU_CESR_W1C_BASE(cesr) | (MPU_CESR_SPERR0_MASK >> i);
+
+            return true;
+        }
+    }
+
+    return false;
+}
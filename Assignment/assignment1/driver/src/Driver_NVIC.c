@@ -0,0 +1,345 @@
+/**
+ * @file Driver_NVIC.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief NVIC and RAM vector table driver implementation.
+ * @version 0.1
+ * @date 2025-11-02
+ *
+ * The NVIC register block is not described by S32K144.h, so it is mapped here.
+ * Priorities are held in the top NVIC_PRIO_BITS of each priority byte; the
+ * grouping splits those bits at AIRCR[PRIGROUP] + 1. Disabling is followed by
+ * DSB/ISB so an interrupt pending at the ICER write cannot still be taken
+ * after the call returns.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_NVIC.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Armv7-M NVIC, not part of S32K144.h */
+typedef struct
+{
+    volatile uint32_t ISER[8];
+    uint32_t RESERVED_0[24];
+    volatile uint32_t ICER[8];
+    uint32_t RESERVED_1[24];
+    volatile uint32_t ISPR[8];
+    uint32_t RESERVED_2[24];
+    volatile uint32_t ICPR[8];
+    uint32_t RESERVED_3[24];
+    volatile uint32_t IABR[8];
+    uint32_t RESERVED_4[56];
+    volatile uint8_t IP[240];
+} nvic_regs_t;
+
+#define NVIC_REGS                   ((nvic_regs_t *)0xE000E100U)
+
+/* SHPR1..3 as bytes: exception 4 (MemManage) first */
+#define NVIC_SHPR                   ((volatile uint8_t *)&S32_SCB->SHPR1)
+#define NVIC_SHPR_FIRST             4
+
+#define NVIC_AIRCR_VECTKEY          0x05FAU
+/* PRIGROUP values with every implemented bit preemption, resp. subpriority */
+#define NVIC_PRIGROUP_ALL_PREEMPT   (7U - NVIC_PRIO_BITS)
+#define NVIC_PRIGROUP_NO_PREEMPT    7U
+
+/* System exceptions with a configurable priority, by -irq */
+#define NVIC_SYS_PRIO_MASK          ((1UL << 12U) | (1UL << 11U) | (1UL << 10U) | \
+                                     (1UL << 5U) | (1UL << 4U) | (1UL << 2U) | (1UL << 1U))
+
+/* Code-bus part of SRAM starts here, everything below is flash */
+#define NVIC_SRAM_START             0x1FFF8000U
+
+#define NVIC_IRQ_WORD(irq)          ((uint32_t)(irq) >> 5U)
+#define NVIC_IRQ_BIT(irq)           (1UL << ((uint32_t)(irq) & 31U))
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static bool nvic_is_device_irq(IRQn_Type irq);
+static volatile uint8_t *nvic_priority_byte(IRQn_Type irq);
+static void nvic_barrier(void);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static bool nvic_is_device_irq(IRQn_Type irq)
+{
+    return ((int32_t)irq >= 0) && ((uint32_t)irq < NVIC_IRQ_COUNT);
+}
+
+static volatile uint8_t *nvic_priority_byte(IRQn_Type irq)
+{
+    volatile uint8_t *prio = NULL;
+
+    if (nvic_is_device_irq(irq))
+    {
+        prio = &NVIC_REGS->IP[(uint32_t)irq];
+    }
+    else if (((int32_t)irq < 0) && ((int32_t)irq >= (int32_t)MemoryManagement_IRQn) &&
+             ((NVIC_SYS_PRIO_MASK & (1UL << (uint32_t)(-(int32_t)irq))) != 0U))
+    {
+        prio = &NVIC_SHPR[(int32_t)irq + NVIC_VECTOR_OFFSET - NVIC_SHPR_FIRST];
+    }
+    else
+    {
+        /* NMI/HardFault have fixed priorities */
+    }
+
+    return prio;
+}
+
+static void nvic_barrier(void)
+{
+#if !defined(__x86_64__)
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+#endif
+}
+
+NVIC_STATUS_t NVIC_SetPriorityGrouping(uint8_t preempt_bits)
+{
+    uint32_t aircr;
+
+    if (preempt_bits > NVIC_PRIO_BITS)
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    /* VECTKEY reads back as VECTKEYSTAT; every write must carry the key */
+    aircr = S32_SCB->AIRCR & ~(S32_SCB_AIRCR_VECTKEY_MASK | S32_SCB_AIRCR_PRIGROUP_MASK);
+    S32_SCB->AIRCR = aircr | S32_SCB_AIRCR_VECTKEY(NVIC_AIRCR_VECTKEY) |
+                     S32_SCB_AIRCR_PRIGROUP(NVIC_PRIGROUP_NO_PREEMPT - preempt_bits);
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+uint8_t NVIC_GetPriorityGrouping(void)
+{
+    uint32_t prigroup = (S32_SCB->AIRCR & S32_SCB_AIRCR_PRIGROUP_MASK) >> S32_SCB_AIRCR_PRIGROUP_SHIFT;
+
+    /* PRIGROUP below the implemented bits leaves no subpriority either way */
+    if (prigroup < NVIC_PRIGROUP_ALL_PREEMPT)
+    {
+        prigroup = NVIC_PRIGROUP_ALL_PREEMPT;
+    }
+
+    return (uint8_t)(NVIC_PRIGROUP_NO_PREEMPT - prigroup);
+}
+
+NVIC_STATUS_t NVIC_SetPriority(IRQn_Type irq, uint8_t preempt, uint8_t sub)
+{
+    volatile uint8_t *prio = nvic_priority_byte(irq);
+    uint32_t sub_bits = NVIC_PRIO_BITS - NVIC_GetPriorityGrouping();
+
+    if ((prio == NULL) || ((uint32_t)preempt >= (1UL << (NVIC_PRIO_BITS - sub_bits))) ||
+        ((uint32_t)sub >= (1UL << sub_bits)))
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    *prio = (uint8_t)((((uint32_t)preempt << sub_bits) | sub) << (8U - NVIC_PRIO_BITS));
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+NVIC_STATUS_t NVIC_GetPriority(IRQn_Type irq, uint8_t *preempt, uint8_t *sub)
+{
+    volatile uint8_t *prio = nvic_priority_byte(irq);
+    uint32_t sub_bits = NVIC_PRIO_BITS - NVIC_GetPriorityGrouping();
+    uint32_t value;
+
+    if (prio == NULL)
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    value = (uint32_t)*prio >> (8U - NVIC_PRIO_BITS);
+
+    if (preempt != NULL)
+    {
+        *preempt = (uint8_t)(value >> sub_bits);
+    }
+    if (sub != NULL)
+    {
+        *sub = (uint8_t)(value & ((1UL << sub_bits) - 1U));
+    }
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+NVIC_STATUS_t NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if (!nvic_is_device_irq(irq))
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    NVIC_REGS->ISER[NVIC_IRQ_WORD(irq)] = NVIC_IRQ_BIT(irq);
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+NVIC_STATUS_t NVIC_DisableIRQ(IRQn_Type irq)
+{
+    if (!nvic_is_device_irq(irq))
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    NVIC_REGS->ICER[NVIC_IRQ_WORD(irq)] = NVIC_IRQ_BIT(irq);
+    nvic_barrier();
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+bool NVIC_IsEnabled(IRQn_Type irq)
+{
+    return nvic_is_device_irq(irq) && ((NVIC_REGS->ISER[NVIC_IRQ_WORD(irq)] & NVIC_IRQ_BIT(irq)) != 0U);
+}
+
+void NVIC_EnableSet(const nvic_irq_set_t *set)
+{
+    uint32_t i;
+
+    for (i = 0U; i < NVIC_WORD_COUNT; i++)
+    {
+        if (set->word[i] != 0U)
+        {
+            NVIC_REGS->ISER[i] = set->word[i];
+        }
+    }
+}
+
+void NVIC_DisableSet(const nvic_irq_set_t *set)
+{
+    uint32_t i;
+
+    for (i = 0U; i < NVIC_WORD_COUNT; i++)
+    {
+        if (set->word[i] != 0U)
+        {
+            NVIC_REGS->ICER[i] = set->word[i];
+        }
+    }
+
+    nvic_barrier();
+}
+
+void NVIC_EnableIRQs(const IRQn_Type *irqs, uint32_t count)
+{
+    nvic_irq_set_t set;
+    uint32_t i;
+
+    NVIC_SetClear(&set);
+    for (i = 0U; i < count; i++)
+    {
+        NVIC_SetAdd(&set, irqs[i]);
+    }
+
+    NVIC_EnableSet(&set);
+}
+
+void NVIC_DisableIRQs(const IRQn_Type *irqs, uint32_t count)
+{
+    nvic_irq_set_t set;
+    uint32_t i;
+
+    NVIC_SetClear(&set);
+    for (i = 0U; i < count; i++)
+    {
+        NVIC_SetAdd(&set, irqs[i]);
+    }
+
+    NVIC_DisableSet(&set);
+}
+
+NVIC_STATUS_t NVIC_SetPending(IRQn_Type irq)
+{
+    if (!nvic_is_device_irq(irq))
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    NVIC_REGS->ISPR[NVIC_IRQ_WORD(irq)] = NVIC_IRQ_BIT(irq);
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+NVIC_STATUS_t NVIC_ClearPending(IRQn_Type irq)
+{
+    if (!nvic_is_device_irq(irq))
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    NVIC_REGS->ICPR[NVIC_IRQ_WORD(irq)] = NVIC_IRQ_BIT(irq);
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+bool NVIC_IsPending(IRQn_Type irq)
+{
+    return nvic_is_device_irq(irq) && ((NVIC_REGS->ISPR[NVIC_IRQ_WORD(irq)] & NVIC_IRQ_BIT(irq)) != 0U);
+}
+
+void NVIC_ClearPendingSet(const nvic_irq_set_t *set)
+{
+    uint32_t i;
+
+    for (i = 0U; i < NVIC_WORD_COUNT; i++)
+    {
+        if (set->word[i] != 0U)
+        {
+            NVIC_REGS->ICPR[i] = set->word[i];
+        }
+    }
+}
+
+bool NVIC_IsActive(IRQn_Type irq)
+{
+    return nvic_is_device_irq(irq) && ((NVIC_REGS->IABR[NVIC_IRQ_WORD(irq)] & NVIC_IRQ_BIT(irq)) != 0U);
+}
+
+NVIC_STATUS_t NVIC_InstallHandler(IRQn_Type irq, nvic_handler_t handler, nvic_handler_t *previous)
+{
+    /* The table VTOR points at: __VECTOR_RAM after startup */
+    nvic_handler_t *vectors = (nvic_handler_t *)S32_SCB->VTOR;
+    uint32_t index = (uint32_t)((int32_t)irq + NVIC_VECTOR_OFFSET);
+
+    if (((int32_t)irq < (int32_t)NonMaskableInt_IRQn) || ((int32_t)irq >= (int32_t)NVIC_IRQ_COUNT) ||
+        (handler == NULL) || ((uint32_t)vectors < NVIC_SRAM_START))
+    {
+        return NVIC_STATUS_ERROR;
+    }
+
+    if (previous != NULL)
+    {
+        *previous = vectors[index];
+    }
+
+    vectors[index] = handler;
+
+    return NVIC_STATUS_SUCCESS;
+}
+
+nvic_handler_t NVIC_GetHandler(IRQn_Type irq)
+{
+    const nvic_handler_t *vectors = (const nvic_handler_t *)S32_SCB->VTOR;
+
+    if (((int32_t)irq < (int32_t)NonMaskableInt_IRQn) || ((int32_t)irq >= (int32_t)NVIC_IRQ_COUNT))
+    {
+        return NULL;
+    }
+
+    return vectors[(int32_t)irq + NVIC_VECTOR_OFFSET];
+}
@@ -0,0 +1,293 @@
+/**
+ * @file Driver_PORT.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief PORT pin control driver implementation.
+ * @version 0.1
+ * @date 2025-11-03
+ *
+ * Each (port, half, register) is one pass over the table: pins of that half
+ * are sorted into at most 16 groups by their 16-bit data, then one store per
+ * group sets the group's pins in GPWE/GIWE and the data in GPWD/GIWD. The
+ * same pass feeds PORT_ConfigPins() (stores to the PORT) and
+ * PORT_PlanWrites() (stores to an array).
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_PORT.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define PORT_DECODE_PORT(pin)           (((uint32_t)(pin) >> 8U) & 0xFFU)
+#define PORT_DECODE_PIN(pin)            ((uint32_t)(pin) & 0xFFU)
+
+/* PCC slots of PORTA..PORTE are consecutive */
+#define PORT_PCC(port)                  ((PCC_PERIPHERALS_t)((uint32_t)PCC_PORTA + (4U * (port))))
+
+typedef void (*port_emit_t)(void *ctx, uint8_t port, PORT_GLOBAL_REG_t reg, uint32_t value);
+
+typedef struct
+{
+    port_global_write_t *writes;
+    uint32_t max_writes;
+    uint32_t count;
+} port_plan_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void port_emit_group_writes(const port_pin_config_t *pins, uint32_t count, uint8_t port,
+                                   PORT_GLOBAL_REG_t reg, port_emit_t emit, void *ctx);
+static void port_emit_all(const port_pin_config_t *pins, uint32_t count, uint32_t port_mask,
+                          port_emit_t emit, void *ctx);
+static void port_emit_store(void *ctx, uint8_t port, PORT_GLOBAL_REG_t reg, uint32_t value);
+static void port_emit_plan(void *ctx, uint8_t port, PORT_GLOBAL_REG_t reg, uint32_t value);
+static uint32_t port_used_ports(const port_pin_config_t *pins, uint32_t count);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const PORT_GLOBAL_REG_t s_port_global_regs[] =
+{
+    PORT_GLOBAL_GPCLR, PORT_GLOBAL_GPCHR, PORT_GLOBAL_GICLR, PORT_GLOBAL_GICHR
+};
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void port_emit_group_writes(const port_pin_config_t *pins, uint32_t count, uint8_t port,
+                                   PORT_GLOBAL_REG_t reg, port_emit_t emit, void *ctx)
+{
+    uint16_t data[PORT_PINS_PER_GLOBAL];
+    uint16_t mask[PORT_PINS_PER_GLOBAL];
+    uint32_t first_pin = ((reg == PORT_GLOBAL_GPCHR) || (reg == PORT_GLOBAL_GICHR)) ? 16U : 0U;
+    bool irq = (reg == PORT_GLOBAL_GICLR) || (reg == PORT_GLOBAL_GICHR);
+    uint32_t groups = 0U;
+    uint32_t i;
+    uint32_t g;
+
+    for (i = 0U; i < count; i++)
+    {
+        uint32_t pin = PORT_DECODE_PIN(pins[i].pin);
+        uint32_t pcr;
+        uint16_t value;
+
+        if ((PORT_DECODE_PORT(pins[i].pin) != port) || (pin < first_pin) ||
+            (pin >= (first_pin + PORT_PINS_PER_GLOBAL)))
+        {
+            continue;
+        }
+
+        pcr = PORT_PinValue(&pins[i]);
+        value = (uint16_t)(irq ? (pcr >> 16U) : (pcr & 0xFFFFU));
+
+        for (g = 0U; (g < groups) && (data[g] != value); g++)
+        {
+        }
+        if (g == groups)
+        {
+            /* At most one group per pin of the half, checked pins are unique */
+            data[g] = value;
+            mask[g] = 0U;
+            groups++;
+        }
+        mask[g] |= (uint16_t)(1U << (pin - first_pin));
+    }
+
+    for (g = 0U; g < groups; g++)
+    {
+        if (irq)
+        {
+            emit(ctx, port, reg, PORT_GICLR_GIWE(mask[g]) | PORT_GICLR_GIWD(data[g]));
+        }
+        else
+        {
+            emit(ctx, port, reg, PORT_GPCLR_GPWE(mask[g]) | PORT_GPCLR_GPWD(data[g]));
+        }
+    }
+}
+
+static void port_emit_all(const port_pin_config_t *pins, uint32_t count, uint32_t port_mask,
+                          port_emit_t emit, void *ctx)
+{
+    uint8_t port;
+    uint32_t r;
+
+    for (port = 0U; port < PORT_NUMS; port++)
+    {
+        if ((port_mask & (1UL << port)) == 0U)
+        {
+            continue;
+        }
+
+        /* Pin control before interrupt control: the mux is set when IRQC arms */
+        for (r = 0U; r < (sizeof(s_port_global_regs) / sizeof(s_port_global_regs[0])); r++)
+        {
+            port_emit_group_writes(pins, count, port, s_port_global_regs[r], emit, ctx);
+        }
+    }
+}
+
+static void port_emit_store(void *ctx, uint8_t port, PORT_GLOBAL_REG_t reg, uint32_t value)
+{
+    PORT_Type *base = s_port_base_ptr[port];
+
+    (void)ctx;
+
+    switch (reg)
+    {
+    case PORT_GLOBAL_GPCLR:
+        base->GPCLR = value;
+        break;
+    case PORT_GLOBAL_GPCHR:
+        base->GPCHR = value;
+        break;
+    case PORT_GLOBAL_GICLR:
+        base->GICLR = value;
+        break;
+    default:
+        base->GICHR = value;
+        break;
+    }
+}
+
+static void port_emit_plan(void *ctx, uint8_t port, PORT_GLOBAL_REG_t reg, uint32_t value)
+{
+    port_plan_t *plan = (port_plan_t *)ctx;
+
+    if (plan->count < plan->max_writes)
+    {
+        plan->writes[plan->count].port = port;
+        plan->writes[plan->count].reg = reg;
+        plan->writes[plan->count].value = value;
+    }
+
+    plan->count++;
+}
+
+/**
+ * @brief Ports used by a checked table, one bit per port.
+ */
+static uint32_t port_used_ports(const port_pin_config_t *pins, uint32_t count)
+{
+    uint32_t port_mask = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        port_mask |= 1UL << PORT_DECODE_PORT(pins[i].pin);
+    }
+
+    return port_mask;
+}
+
+uint32_t PORT_PinValue(const port_pin_config_t *config)
+{
+    uint32_t pcr = PORT_PCR_MUX(config->mux) | PORT_PCR_IRQC(config->irqc);
+
+    if (config->pull != PORT_PULL_NONE)
+    {
+        pcr |= PORT_PCR_PE_MASK;
+        if (config->pull == PORT_PULL_UP)
+        {
+            pcr |= PORT_PCR_PS_MASK;
+        }
+    }
+    if (config->drive == PORT_DRIVE_HIGH)
+    {
+        pcr |= PORT_PCR_DSE_MASK;
+    }
+    if (config->passive_filter)
+    {
+        pcr |= PORT_PCR_PFE_MASK;
+    }
+
+    return pcr;
+}
+
+PORT_STATUS_t PORT_CheckPins(const port_pin_config_t *pins, uint32_t count)
+{
+    uint32_t used[PORT_NUMS] = { 0U };
+    uint32_t i;
+
+    if ((pins == NULL) && (count != 0U))
+    {
+        return PORT_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        uint32_t port = PORT_DECODE_PORT(pins[i].pin);
+        uint32_t pin = PORT_DECODE_PIN(pins[i].pin);
+        uint32_t irqc = (uint32_t)pins[i].irqc;
+
+        if ((port >= PORT_NUMS) || (pin >= PORT_PINS_PER_PORT) || ((used[port] & (1UL << pin)) != 0U))
+        {
+            return PORT_STATUS_ERROR;
+        }
+        if (((uint32_t)pins[i].mux > (uint32_t)PORT_MUX_ALT7) || ((uint32_t)pins[i].pull > (uint32_t)PORT_PULL_UP) ||
+            ((uint32_t)pins[i].drive > (uint32_t)PORT_DRIVE_HIGH) ||
+            ((irqc > (uint32_t)PORT_IRQC_DMA_EITHER) && ((irqc < (uint32_t)PORT_IRQC_LOGIC_ZERO) ||
+                                                        (irqc > (uint32_t)PORT_IRQC_LOGIC_ONE))))
+        {
+            return PORT_STATUS_ERROR;
+        }
+
+        used[port] |= 1UL << pin;
+    }
+
+    return PORT_STATUS_SUCCESS;
+}
+
+PORT_STATUS_t PORT_ConfigPins(const port_pin_config_t *pins, uint32_t count)
+{
+    uint32_t port_mask;
+    uint32_t port;
+
+    if (PORT_CheckPins(pins, count) != PORT_STATUS_SUCCESS)
+    {
+        return PORT_STATUS_ERROR;
+    }
+
+    port_mask = port_used_ports(pins, count);
+
+    for (port = 0U; port < PORT_NUMS; port++)
+    {
+        if (((port_mask & (1UL << port)) != 0U) && (PCC_EnableClock(PORT_PCC(port)) != PCC_STATUS_SUCCESS))
+        {
+            return PORT_STATUS_ERROR;
+        }
+    }
+
+    port_emit_all(pins, count, port_mask, port_emit_store, NULL);
+
+    return PORT_STATUS_SUCCESS;
+}
+
+uint32_t PORT_PlanWrites(const port_pin_config_t *pins, uint32_t count,
+                         port_global_write_t *writes, uint32_t max_writes)
+{
+    port_plan_t plan;
+
+    if (PORT_CheckPins(pins, count) != PORT_STATUS_SUCCESS)
+    {
+        return 0U;
+    }
+
+    plan.writes = writes;
+    plan.max_writes = (writes != NULL) ? max_writes : 0U;
+    plan.count = 0U;
+
+    port_emit_all(pins, count, port_used_ports(pins, count), port_emit_plan, &plan);
+
+    return plan.count;
+}
@@ -11,7 +11,10 @@
 
 #include "../driver/inc/Driver_Common.h"
 #include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/reg_access.h"
 #include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+#include "../include/system_S32K144.h"
 
 /*******************************************************************************
  *                                  Definitions
@@ -19,8 +22,8 @@
 
 #define TIMEOUT                       10000
 #define SCG_CSR_VLD_BIT_MASK         (0x1000000U)
-#define SCG_CSR_VLD_BIT_SHIFT        (0x24U)
-#define SCG_CSR_ENABLE_BIT_SHIFT     (0x1U)
+#define SCG_CSR_VLD_BIT_SHIFT        (24U)
+#define SCG_CSR_ENABLE_BIT_SHIFT     (0U)
 
 /*******************************************************************************
  * 									Prototypes
@@ -32,6 +35,7 @@ static void scg_config_system_div_core(SCG_DIV_CORE_t div_core, uint32_t *pReg);
 static void scg_config_system_div_bus(SCG_DIV_BUS_t div_bus, uint32_t *pReg);
 static void scg_config_system_div_slow(SCG_DIV_SLOW_t div_slow,uint32_t *pReg);
 static SCG_STATUS_t scg_system_clock_status(SCG_CLOCK_SOURCE_t src);
+static uint32_t scg_get_source_freq(SCG_CLOCK_SOURCE_t src);
 
 /*******************************************************************************
  * 										Code
@@ -132,25 +136,22 @@ static SCG_STATUS_t scg_check_source_valid(SCG_CLOCK_SOURCE_t src)
  */
 static void scg_config_system_source(SCG_CLOCK_SOURCE_t src, uint32_t *pReg)
 {
-    /* Clear the previous source */
-    *pReg &= ~(0xFU << SCG_CSR_SCS_SHIFT);
-
-    /* Config system source */
-    *pReg |= (src << SCG_CSR_SCS_SHIFT);
+    /* HCCR, RCCR and VCCR share the RCCR layout */
+    REG_MODIFY(*pReg, SCG_RCCR, (SCS, src));
 }
 
 /**
  * @brief Set the core clock divider field in the working copy.
  *
- * Masks out the previous DIVCORE field then inserts the new divider. Does not
- * access hardware directly.
+ * Masks out the previous DIVCORE field then inserts the new divider, shifted
+ * into place. Does not access hardware directly.
  *
  * @param div_core Core divider enumeration value.
- * @param mode (Unused) kept for comment style consistency.
+ * @param pReg Pointer to working register copy for the active mode.
  */
 static void scg_config_system_div_core(SCG_DIV_CORE_t div_core, uint32_t *pReg)
 {
-    *pReg = ((*pReg) & ~(0xFU << SCG_CSR_DIVCORE_SHIFT)) | div_core;
+    REG_MODIFY(*pReg, SCG_RCCR, (DIVCORE, div_core));
 }
 
 /**
@@ -159,12 +160,11 @@ static void scg_config_system_div_core(SCG_DIV_CORE_t div_core, uint32_t *pReg)
  * Clears DIVBUS bits then inserts the provided divider value.
  *
  * @param div_bus Bus divider enumeration value.
- * @param mode (Unused).
+ * @param pReg Pointer to working register copy for the active mode.
  */
 static void scg_config_system_div_bus(SCG_DIV_BUS_t div_bus, uint32_t *pReg)
 {
-
-    *pReg = ((*pReg) & ~(0xFU << SCG_CSR_DIVBUS_SHIFT)) | div_bus;
+    REG_MODIFY(*pReg, SCG_RCCR, (DIVBUS, div_bus));
 }
 
 /**
@@ -173,11 +173,11 @@ static void scg_config_system_div_bus(SCG_DIV_BUS_t div_bus, uint32_t *pReg)
  * Clears DIVSLOW bits and writes the new divider. Used for low-speed peripheral domain.
  *
  * @param div_slow Slow divider enumeration value.
- * @param mode (Unused).
+ * @param pReg Pointer to working register copy for the active mode.
  */
 static void scg_config_system_div_slow(SCG_DIV_SLOW_t div_slow, uint32_t *pReg)
 {
-    *pReg = ((*pReg) & ~(0xFU << SCG_CSR_DIVSLOW_SHIFT)) | div_slow;
+    REG_MODIFY(*pReg, SCG_RCCR, (DIVSLOW, div_slow));
 }
 
 /**
@@ -346,7 +346,6 @@ SCG_STATUS_t SCG_SourceInit(SCG_CLOCK_SOURCE_t src)
  */
 SCG_STATUS_t SCG_FIRC_SlowRun_48Mhz(void)
 {
-    volatile uint32_t tempReg = 0;
     SCG_STATUS_t result = SCG_STATUS_SUCCESS;
 
     /* Check FIRC is valid */
@@ -358,20 +357,12 @@ SCG_STATUS_t SCG_FIRC_SlowRun_48Mhz(void)
         return result;
     }
 
-    /* Config FIRC for the source of system */
-    tempReg |= SCG_FIRC_CLK << SCG_RCCR_SCS_SHIFT;
-
-    /* Config divcore divide by 1 */
-    tempReg |= SCG_DIV_CORE_BY_1 << SCG_RCCR_DIVCORE_SHIFT;
-
-    /* Config divbus divide by 1 */
-    tempReg |= SCG_DIV_BUS_BY_1 << SCG_RCCR_DIVBUS_SHIFT;
-
-    /* Config divslow divide by 2 */
-    tempReg |= SCG_DIV_SLOW_BY_2 << SCG_RCCR_DIVSLOW_SHIFT;
-
-    /* Write temp reg value to RCCR */
-    IP_SCG->RCCR = tempReg;
+    /* System source and dividers in one store */
+    REG_WRITE(IP_SCG->RCCR, SCG_RCCR,
+              (SCS, SCG_FIRC_CLK),
+              (DIVCORE, SCG_DIV_CORE_BY_1),
+              (DIVBUS, SCG_DIV_BUS_BY_1),
+              (DIVSLOW, SCG_DIV_SLOW_BY_2));
 
     /* Check the source is init successfully or not */
     result = scg_system_clock_status(SCG_FIRC_CLK);
@@ -389,7 +380,6 @@ SCG_STATUS_t SCG_FIRC_SlowRun_48Mhz(void)
  */
 SCG_STATUS_t SCG_SPLL_NormalRun_80Mhz()
 {
-    volatile uint32_t tempReg = 0;
     SCG_STATUS_t result = SCG_STATUS_SUCCESS;
 
     /* Check SPLL is valid */
@@ -401,20 +391,12 @@ SCG_STATUS_t SCG_SPLL_NormalRun_80Mhz()
         return result;
     }
 
-    /* Config FIRC for the source of system */
-    tempReg |= SCG_SPLL_CLK << SCG_RCCR_SCS_SHIFT;
-
-    /* Config divcore divide by 1 */
-    tempReg |= SCG_DIV_CORE_BY_2 << SCG_RCCR_DIVCORE_SHIFT;
-
-    /* Config divbus divide by 1 */
-    tempReg |= SCG_DIV_BUS_BY_2 << SCG_RCCR_DIVBUS_SHIFT;
-
-    /* Config divslow divide by 2 */
-    tempReg |= SCG_DIV_SLOW_BY_3 << SCG_RCCR_DIVSLOW_SHIFT;
-
-    /* Write temp reg value to RCCR */
-    IP_SCG->RCCR = tempReg;
+    /* System source and dividers in one store */
+    REG_WRITE(IP_SCG->RCCR, SCG_RCCR,
+              (SCS, SCG_SPLL_CLK),
+              (DIVCORE, SCG_DIV_CORE_BY_2),
+              (DIVBUS, SCG_DIV_BUS_BY_2),
+              (DIVSLOW, SCG_DIV_SLOW_BY_3));
 
     /* Check the source is init successfully or not */
     result = scg_system_clock_status(SCG_SPLL_CLK);
@@ -432,7 +414,6 @@ SCG_STATUS_t SCG_SPLL_NormalRun_80Mhz()
  */
 SCG_STATUS_t SCG_SPLL_NormalRun_64Mhz()
 {
-    volatile uint32_t tempReg = 0;
     SCG_STATUS_t result = SCG_STATUS_SUCCESS;
 
     /* Check SPLL is valid */
@@ -444,20 +425,12 @@ SCG_STATUS_t SCG_SPLL_NormalRun_64Mhz()
         return result;
     }
 
-    /* Config FIRC for the source of system */
-    tempReg |= SCG_SPLL_CLK << SCG_RCCR_SCS_SHIFT;
-
-    /* Config divcore divide by 1 */
-    tempReg |= SCG_DIV_CORE_BY_2 << SCG_RCCR_DIVCORE_SHIFT;
-
-    /* Config divbus divide by 1 */
-    tempReg |= SCG_DIV_BUS_BY_2 << SCG_RCCR_DIVBUS_SHIFT;
-
-    /* Config divslow divide by 2 */
-    tempReg |= SCG_DIV_SLOW_BY_3 << SCG_RCCR_DIVSLOW_SHIFT;
-
-    /* Write temp reg value to RCCR */
-    IP_SCG->RCCR = tempReg;
+    /* System source and dividers in one store */
+    REG_WRITE(IP_SCG->RCCR, SCG_RCCR,
+              (SCS, SCG_SPLL_CLK),
+              (DIVCORE, SCG_DIV_CORE_BY_2),
+              (DIVBUS, SCG_DIV_BUS_BY_2),
+              (DIVSLOW, SCG_DIV_SLOW_BY_3));
 
     /* Check the source is init successfully or not */
     result = scg_system_clock_status(SCG_SPLL_CLK);
@@ -469,13 +442,13 @@ SCG_STATUS_t SCG_SPLL_NormalRun_64Mhz()
  * @brief Configure HSRUN mode to use SPLL targeting ~112 MHz core clock.
  *
  * Dividers: core /1, bus /2, slow /4. High performance profile – ensure HSRUN
- * is enabled at system level.
+ * is enabled at system level. Writes HCCR, which only clocks the system in
+ * HSRUN: call it once SMC_PMSTAT shows HSRUN, or the status check fails.
  *
  * @return SCG_STATUS_t Switch result status.
  */
 SCG_STATUS_t SCG_SPLL_HSRun_112Mhz()
 {
-    volatile uint32_t tempReg = 0;
     SCG_STATUS_t result = SCG_STATUS_SUCCESS;
 
     /* Check SPLL is valid */
@@ -487,20 +460,12 @@ SCG_STATUS_t SCG_SPLL_HSRun_112Mhz()
         return result;
     }
 
-    /* Config FIRC for the source of system */
-    tempReg |= SCG_SPLL_CLK << SCG_RCCR_SCS_SHIFT;
-
-    /* Config divcore divide by 1 */
-    tempReg |= SCG_DIV_CORE_BY_1 << SCG_RCCR_DIVCORE_SHIFT;
-
-    /* Config divbus divide by 1 */
-    tempReg |= SCG_DIV_BUS_BY_2 << SCG_RCCR_DIVBUS_SHIFT;
-
-    /* Config divslow divide by 2 */
-    tempReg |= SCG_DIV_SLOW_BY_4 << SCG_RCCR_DIVSLOW_SHIFT;
-
-    /* Write temp reg value to RCCR */
-    IP_SCG->RCCR = tempReg;
+    /* System source and dividers in one store */
+    REG_WRITE(IP_SCG->HCCR, SCG_HCCR,
+              (SCS, SCG_SPLL_CLK),
+              (DIVCORE, SCG_DIV_CORE_BY_1),
+              (DIVBUS, SCG_DIV_BUS_BY_2),
+              (DIVSLOW, SCG_DIV_SLOW_BY_4));
 
     /* Check the source is init successfully or not */
     result = scg_system_clock_status(SCG_SPLL_CLK);
@@ -511,13 +476,12 @@ SCG_STATUS_t SCG_SPLL_HSRun_112Mhz()
 /**
  * @brief Configure HSRUN mode to use SPLL targeting ~80 MHz core clock.
  *
- * Dividers: core /2, bus /2, slow /3.
+ * Dividers: core /2, bus /2, slow /3. Writes HCCR, call it in HSRUN.
  *
  * @return SCG_STATUS_t Switch result status.
  */
 SCG_STATUS_t SCG_SPLL_HSRun_80Mhz()
 {
-    volatile uint32_t tempReg = 0;
     SCG_STATUS_t result = SCG_STATUS_SUCCESS;
 
     /* Check SPLL is valid */
@@ -529,20 +493,12 @@ SCG_STATUS_t SCG_SPLL_HSRun_80Mhz()
         return result;
     }
 
-    /* Config FIRC for the source of system */
-    tempReg |= SCG_SPLL_CLK << SCG_RCCR_SCS_SHIFT;
-
-    /* Config divcore divide by 1 */
-    tempReg |= SCG_DIV_CORE_BY_2 << SCG_RCCR_DIVCORE_SHIFT;
-
-    /* Config divbus divide by 1 */
-    tempReg |= SCG_DIV_BUS_BY_2 << SCG_RCCR_DIVBUS_SHIFT;
-
-    /* Config divslow divide by 2 */
-    tempReg |= SCG_DIV_SLOW_BY_3 << SCG_RCCR_DIVSLOW_SHIFT;
-
-    /* Write temp reg value to RCCR */
-    IP_SCG->RCCR = tempReg;
+    /* System source and dividers in one store */
+    REG_WRITE(IP_SCG->HCCR, SCG_HCCR,
+              (SCS, SCG_SPLL_CLK),
+              (DIVCORE, SCG_DIV_CORE_BY_2),
+              (DIVBUS, SCG_DIV_BUS_BY_2),
+              (DIVSLOW, SCG_DIV_SLOW_BY_3));
 
     /* Check the source is init successfully or not */
     result = scg_system_clock_status(SCG_SPLL_CLK);
@@ -559,7 +515,6 @@ SCG_STATUS_t SCG_SPLL_HSRun_80Mhz()
  */
 SCG_STATUS_t SCG_SIRC_VLPRRun_4Mhz()
 {
-    volatile uint32_t tempReg = 0;
     SCG_STATUS_t result = SCG_STATUS_SUCCESS;
 
     /* Check SIRC is valid */
@@ -571,20 +526,12 @@ SCG_STATUS_t SCG_SIRC_VLPRRun_4Mhz()
         return result;
     }
 
-    /* Config FIRC for the source of system */
-    tempReg |= SCG_SIRC_CLK << SCG_RCCR_SCS_SHIFT;
-
-    /* Config divcore divide by 1 */
-    tempReg |= SCG_DIV_CORE_BY_2 << SCG_RCCR_DIVCORE_SHIFT;
-
-    /* Config divbus divide by 1 */
-    tempReg |= SCG_DIV_BUS_BY_1 << SCG_RCCR_DIVBUS_SHIFT;
-
-    /* Config divslow divide by 2 */
-    tempReg |= SCG_DIV_SLOW_BY_4 << SCG_RCCR_DIVSLOW_SHIFT;
-
-    /* Write temp reg value to RCCR */
-    IP_SCG->RCCR = tempReg;
+    /* System source and dividers in one store */
+    REG_WRITE(IP_SCG->RCCR, SCG_RCCR,
+              (SCS, SCG_SIRC_CLK),
+              (DIVCORE, SCG_DIV_CORE_BY_2),
+              (DIVBUS, SCG_DIV_BUS_BY_1),
+              (DIVSLOW, SCG_DIV_SLOW_BY_4));
 
     /* Check the source is init successfully or not */
     result = scg_system_clock_status(SCG_SIRC_CLK);
@@ -593,27 +540,90 @@ SCG_STATUS_t SCG_SIRC_VLPRRun_4Mhz()
 }
 
 /**
- * @brief (Not implemented) Return current bus clock frequency.
+ * @brief Return the output frequency of an SCG clock source.
+ *
+ * SOSC is taken from CPU_XTAL_CLK_HZ, SIRC from its RANGE bit, FIRC is fixed
+ * and SPLL is derived from SOSC: SOSC * (MULT + 16) / (PREDIV + 1) / 2.
+ *
+ * @param src Clock source.
+ * @return uint32_t Frequency in Hz; 0 if the source is unknown.
+ */
+static uint32_t scg_get_source_freq(SCG_CLOCK_SOURCE_t src)
+{
+    uint32_t freq = 0U;
+    uint32_t prediv;
+    uint32_t mult;
+
+    switch (src)
+    {
+        case SCG_SOSC_CLK:
+            freq = CPU_XTAL_CLK_HZ;
+            break;
+        case SCG_SIRC_CLK:
+            freq = ((IP_SCG->SIRCCFG & SCG_SIRCCFG_RANGE_MASK) != 0U) ? FEATURE_SCG_SIRC_HIGH_RANGE_FREQ : 2000000U;
+            break;
+        case SCG_FIRC_CLK:
+            freq = FEATURE_SCG_FIRC_FREQ0;
+            break;
+        case SCG_SPLL_CLK:
+            prediv = ((IP_SCG->SPLLCFG & SCG_SPLLCFG_PREDIV_MASK) >> SCG_SPLLCFG_PREDIV_SHIFT) + 1U;
+            mult = ((IP_SCG->SPLLCFG & SCG_SPLLCFG_MULT_MASK) >> SCG_SPLLCFG_MULT_SHIFT) + 16U;
+            freq = (CPU_XTAL_CLK_HZ / prediv) * mult / 2U;
+            break;
+        default:
+            break;
+    }
+
+    return freq;
+}
+
+/**
+ * @brief Return current bus clock frequency.
  *
- * Planned: Read active system source, determine base frequency, apply BUS divider.
- * Currently unimplemented: returns empty value.
+ * BUS_CLK is the core/system clock divided by DIVBUS of the active CSR.
  *
- * @return uint32_t Bus frequency (Hz) – TBD.
+ * @return uint32_t Bus frequency (Hz), 0 if the system source is unknown.
  */
 uint32_t SCG_GetBusClock(void)
 {
+    uint32_t csr = IP_SCG->CSR;
+    uint32_t divBus = ((csr & SCG_CSR_DIVBUS_MASK) >> SCG_CSR_DIVBUS_SHIFT) + 1U;
 
+    return SCG_GetCoreClock() / divBus;
 }
 
 /**
- * @brief (Not implemented) Return current core clock frequency.
+ * @brief Return current core (system) clock frequency.
  *
- * Planned: Read SCS field to identify source, map to base (FIRC/SIRC/SOSC/SPLL),
- * apply CORE divider. Currently unimplemented.
+ * Reads the SCS field to identify the active source and applies DIVCORE.
  *
- * @return uint32_t Core frequency (Hz) – TBD.
+ * @return uint32_t Core frequency (Hz), 0 if the system source is unknown.
  */
 uint32_t SCG_GetCoreClock(void)
 {
+    uint32_t csr = IP_SCG->CSR;
+    uint32_t divCore = ((csr & SCG_CSR_DIVCORE_MASK) >> SCG_CSR_DIVCORE_SHIFT) + 1U;
+    SCG_CLOCK_SOURCE_t src = (SCG_CLOCK_SOURCE_t)((csr & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT);
+
+    return scg_get_source_freq(src) / divCore;
+}
+
+/**
+ * @brief Return the SOSCDIV2 asynchronous peripheral clock frequency.
+ *
+ * SOSCDIV2 encodes 0 = disabled, n = divide by 2^(n-1). Returns 0 when the
+ * divider output is disabled or SOSC is not valid.
+ *
+ * @return uint32_t SOSCDIV2_CLK frequency (Hz).
+ */
+uint32_t SCG_GetSoscDiv2Clock(void)
+{
+    uint32_t div2 = (IP_SCG->SOSCDIV & SCG_SOSCDIV_SOSCDIV2_MASK) >> SCG_SOSCDIV_SOSCDIV2_SHIFT;
+
+    if ((div2 == 0U) || ((IP_SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK) == 0U))
+    {
+        return 0U;
+    }
 
+    return CPU_XTAL_CLK_HZ >> (div2 - 1U);
 }
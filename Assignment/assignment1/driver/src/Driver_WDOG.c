@@ -0,0 +1,115 @@
+/**
+ * @file Driver_WDOG.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Watchdog timer (WDOG) driver implementation.
+ * @version 0.1
+ * @date 2025-11-07
+ *
+ * Reconfiguration follows the reference manual sequence: unlock key to CNT,
+ * wait for CS[ULK], then WIN and TOVAL and CS last, all within 128 bus
+ * clocks of the unlock, and wait for CS[RCS] once the new configuration is
+ * in effect. Only the unlock-to-CS part runs with interrupts masked.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_WDOG.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+#include "../include/s32_core_cm4.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define WDOG_TIMEOUT                10000U
+
+#if !defined(__x86_64__)
+#define WDOG_IRQ_DISABLE()          DISABLE_INTERRUPTS()
+#define WDOG_IRQ_ENABLE()           ENABLE_INTERRUPTS()
+#else
+#define WDOG_IRQ_DISABLE()
+#define WDOG_IRQ_ENABLE()
+#endif
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static bool wdog_clock_running(WDOG_CLK_t clock);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static bool wdog_clock_running(WDOG_CLK_t clock)
+{
+    switch (clock)
+    {
+        case WDOG_CLK_SOSC:
+            return ((IP_SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK) != 0U);
+        case WDOG_CLK_SIRC:
+            return ((IP_SCG->SIRCCSR & SCG_SIRCCSR_SIRCVLD_MASK) != 0U);
+        case WDOG_CLK_BUS:
+        case WDOG_CLK_LPO:
+            return true;
+        default:
+            return false;
+    }
+}
+
+WDOG_STATUS_t WDOG_Init(const wdog_config_t *config)
+{
+    uint32_t timeOut = 0U;
+    uint32_t cs;
+
+    if ((config == NULL) || (config->timeout == 0U) || (config->window >= config->timeout) ||
+        !wdog_clock_running(config->clock))
+    {
+        return WDOG_STATUS_ERROR;
+    }
+
+    if ((IP_WDOG->CS & WDOG_CS_UPDATE_MASK) == 0U)
+    {
+        return WDOG_STATUS_ERROR;
+    }
+
+    cs = WDOG_CS_EN_MASK | WDOG_CS_CMD32EN_MASK | WDOG_CS_CLK((uint32_t)config->clock) |
+         WDOG_CS_PRES(config->prescaler ? 1U : 0U) | WDOG_CS_WIN((config->window != 0U) ? 1U : 0U) |
+         WDOG_CS_INT(config->interrupt ? 1U : 0U) | WDOG_CS_DBG(config->debug ? 1U : 0U) |
+         WDOG_CS_WAIT(config->wait ? 1U : 0U) | WDOG_CS_STOP(config->stop ? 1U : 0U) |
+         WDOG_CS_UPDATE(config->lock ? 0U : 1U) | WDOG_CS_FLG_MASK;
+
+    WDOG_IRQ_DISABLE();
+
+    IP_WDOG->CNT = FEATURE_WDOG_UNLOCK_VALUE;
+    /* Dummy read: the unlock write completes before CS[ULK] is polled */
+    (void)IP_WDOG->CNT;
+
+    while ((timeOut < WDOG_TIMEOUT) && ((IP_WDOG->CS & WDOG_CS_ULK_MASK) == 0U))
+    {
+        ++timeOut;
+    }
+
+    if (timeOut >= WDOG_TIMEOUT)
+    {
+        WDOG_IRQ_ENABLE();
+        return WDOG_STATUS_TIMEOUT;
+    }
+
+    IP_WDOG->WIN = config->window;
+    IP_WDOG->TOVAL = config->timeout;
+    IP_WDOG->CS = cs;
+
+    WDOG_IRQ_ENABLE();
+
+    timeOut = 0U;
+    while ((timeOut < WDOG_TIMEOUT) && ((IP_WDOG->CS & WDOG_CS_RCS_MASK) == 0U))
+    {
+        ++timeOut;
+    }
+
+    return (timeOut < WDOG_TIMEOUT) ? WDOG_STATUS_SUCCESS : WDOG_STATUS_TIMEOUT;
+}
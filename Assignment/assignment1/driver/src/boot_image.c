@@ -0,0 +1,329 @@
+/**
+ * @file boot_image.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief A/B firmware image header and boot selector implementation.
+ * @version 0.1
+ * @date 2025-10-27
+ *
+ * The selection decision reads two headers and two vector pairs; the only
+ * expensive step, the image CRC, runs for the preferred slot and, if that
+ * fails, for the other one, and is skipped for confirmed images.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_CRC.h"
+#include "../driver/inc/Driver_FTFC.h"
+#include "../driver/inc/boot_image.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+#include "../include/s32_core_cm4.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define BOOT_CRC_WORD_OFFSET        (BOOT_HEADER_OFFSET + 12U)
+#define BOOT_CODE_OFFSET            (BOOT_HEADER_OFFSET + BOOT_HEADER_SIZE)
+
+/* Valid initial stack pointer: SRAM_L start to SRAM_U end */
+#define BOOT_SRAM_START             0x1FFF8000U
+#define BOOT_SRAM_END               0x20007000U
+
+#ifndef BOOT_APP_VERSION
+#define BOOT_APP_VERSION            1U
+#endif
+
+#if !defined(__x86_64__)
+#define BOOT_IRQ_DISABLE()          DISABLE_INTERRUPTS()
+#else
+#define BOOT_IRQ_DISABLE()
+#endif
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static uint32_t boot_slot_base(BOOT_SLOT_t slot);
+static bool boot_check_header(uint32_t base);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+#if defined(BOOT_APP_SLOT)
+/* Defined by S32K144_64_flash_ab.ld */
+extern const uint8_t __image_length__[];
+
+/* crc stays erased here; tools/image_crc/image_crc.py fills it in after the link */
+__attribute__((section(".image_header"), used))
+const boot_image_header_t g_boot_image_header =
+{
+    BOOT_IMAGE_MAGIC,
+    BOOT_APP_VERSION,
+    (uint32_t)__image_length__,
+    0xFFFFFFFFU
+};
+#endif
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t boot_slot_base(BOOT_SLOT_t slot)
+{
+    return (slot == BOOT_SLOT_A) ? BOOT_SLOT_A_BASE : BOOT_SLOT_B_BASE;
+}
+
+/* Cheap checks only: header fields and the first two vectors */
+static bool boot_check_header(uint32_t base)
+{
+    const boot_image_header_t *header = (const boot_image_header_t *)(base + BOOT_HEADER_OFFSET);
+    const uint32_t *vectors = (const uint32_t *)base;
+    uint32_t sp = vectors[0];
+    uint32_t pc = vectors[1];
+
+    if ((header->magic != BOOT_IMAGE_MAGIC) || (header->version == 0xFFFFFFFFU))
+    {
+        return false;
+    }
+
+    if ((header->length <= BOOT_CODE_OFFSET) || (header->length > BOOT_CONFIRM_OFFSET) ||
+        ((header->length & (FTFC_PHRASE_SIZE - 1U)) != 0U))
+    {
+        return false;
+    }
+
+    if ((sp < BOOT_SRAM_START) || (sp > BOOT_SRAM_END) || ((sp & 7U) != 0U))
+    {
+        return false;
+    }
+
+    /* Thumb entry inside the image code */
+    return ((pc & 1U) != 0U) && (pc >= (base + BOOT_CODE_OFFSET)) && (pc < (base + header->length));
+}
+
+/**
+ * @brief CRC of an image as stored in its header.
+ *
+ * @param base Slot base address.
+ * @param length Image length from the header.
+ * @param crc Computed CRC.
+ * @return CRC_STATUS_t SUCCESS, ERROR or BUSY if the CRC module is owned.
+ */
+CRC_STATUS_t BOOT_ComputeImageCrc(uint32_t base, uint32_t length, uint32_t *crc)
+{
+    const crc_config_t config = CRC_CONFIG_CRC32;
+    CRC_STATUS_t status;
+
+    if ((crc == NULL) || (length <= BOOT_CODE_OFFSET))
+    {
+        return CRC_STATUS_ERROR;
+    }
+
+    status = CRC_Init(&config);
+
+    if (status != CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    (void)CRC_Update((const uint8_t *)base, BOOT_CRC_WORD_OFFSET);
+    (void)CRC_Update((const uint8_t *)(base + BOOT_CODE_OFFSET), length - BOOT_CODE_OFFSET);
+    *crc = CRC_GetResult();
+    CRC_Release();
+
+    return CRC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Check whether a slot carries the confirmation mark.
+ *
+ * @param slot Slot to check.
+ * @return bool true if confirmed.
+ */
+bool BOOT_IsConfirmed(BOOT_SLOT_t slot)
+{
+    const uint32_t *mark;
+
+    if (slot >= BOOT_SLOT_NONE)
+    {
+        return false;
+    }
+
+    mark = (const uint32_t *)(boot_slot_base(slot) + BOOT_CONFIRM_OFFSET);
+
+    return (mark[0] == BOOT_CONFIRM_MAGIC) && (mark[1] == ~BOOT_CONFIRM_MAGIC);
+}
+
+/**
+ * @brief Check a slot: header, vectors and, unless confirmed, the CRC.
+ *
+ * @param slot Slot to check.
+ * @param verify_crc Check the CRC even if the image is confirmed.
+ * @return bool true if the slot holds a bootable image.
+ */
+bool BOOT_CheckSlot(BOOT_SLOT_t slot, bool verify_crc)
+{
+    const boot_image_header_t *header;
+    uint32_t base;
+    uint32_t crc;
+
+    if (slot >= BOOT_SLOT_NONE)
+    {
+        return false;
+    }
+
+    base = boot_slot_base(slot);
+
+    if (!boot_check_header(base))
+    {
+        return false;
+    }
+
+    if ((!verify_crc) && BOOT_IsConfirmed(slot))
+    {
+        return true;
+    }
+
+    header = (const boot_image_header_t *)(base + BOOT_HEADER_OFFSET);
+
+    if (BOOT_ComputeImageCrc(base, header->length, &crc) != CRC_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return crc == header->crc;
+}
+
+/**
+ * @brief Pick the slot to boot: the highest valid version, A on a tie.
+ *
+ * @return BOOT_SLOT_t Slot, or BOOT_SLOT_NONE if neither is valid.
+ */
+BOOT_SLOT_t BOOT_Select(void)
+{
+    const boot_image_header_t *header_a = (const boot_image_header_t *)(BOOT_SLOT_A_BASE + BOOT_HEADER_OFFSET);
+    const boot_image_header_t *header_b = (const boot_image_header_t *)(BOOT_SLOT_B_BASE + BOOT_HEADER_OFFSET);
+    bool valid_a = boot_check_header(BOOT_SLOT_A_BASE);
+    bool valid_b = boot_check_header(BOOT_SLOT_B_BASE);
+    BOOT_SLOT_t first;
+    BOOT_SLOT_t second;
+
+    if (valid_a && valid_b)
+    {
+        first = (header_b->version > header_a->version) ? BOOT_SLOT_B : BOOT_SLOT_A;
+        second = (first == BOOT_SLOT_A) ? BOOT_SLOT_B : BOOT_SLOT_A;
+    }
+    else if (valid_a || valid_b)
+    {
+        first = valid_a ? BOOT_SLOT_A : BOOT_SLOT_B;
+        second = BOOT_SLOT_NONE;
+    }
+    else
+    {
+        return BOOT_SLOT_NONE;
+    }
+
+    /* A newer image that fails its CRC falls back to the older one */
+    if (BOOT_CheckSlot(first, (BOOT_VERIFY_CONFIRMED != 0)))
+    {
+        return first;
+    }
+
+    if (BOOT_CheckSlot(second, (BOOT_VERIFY_CONFIRMED != 0)))
+    {
+        return second;
+    }
+
+    return BOOT_SLOT_NONE;
+}
+
+/**
+ * @brief Start the image in a slot: VTOR, MSP and reset vector. No return.
+ *
+ * Same hand-over init_data_bss() does for __VECTOR_RAM: the image's own
+ * startup then copies its table to RAM and repoints VTOR.
+ *
+ * @param slot Slot to start.
+ */
+void BOOT_Jump(BOOT_SLOT_t slot)
+{
+    const uint32_t *vectors;
+
+    if (slot >= BOOT_SLOT_NONE)
+    {
+        return;
+    }
+
+    vectors = (const uint32_t *)boot_slot_base(slot);
+
+    BOOT_IRQ_DISABLE();
+    S32_SCB->VTOR = (uint32_t)vectors;
+#if !defined(__x86_64__)
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+    __asm volatile ("msr msp, %0\n\tbx %1" : : "r" (vectors[0]), "r" (vectors[1]) : "memory");
+#endif
+
+    for (;;)
+    {
+    }
+}
+
+/**
+ * @brief Select and jump; returns only if no slot is valid.
+ */
+void BOOT_SelectAndJump(void)
+{
+    BOOT_Jump(BOOT_Select());
+}
+
+/**
+ * @brief Slot the caller is executing from, BOOT_SLOT_NONE in the selector.
+ */
+BOOT_SLOT_t BOOT_GetRunningSlot(void)
+{
+    uint32_t pc = (uint32_t)&BOOT_GetRunningSlot;
+
+    if ((pc >= BOOT_SLOT_A_BASE) && (pc < (BOOT_SLOT_A_BASE + BOOT_SLOT_SIZE)))
+    {
+        return BOOT_SLOT_A;
+    }
+
+    if ((pc >= BOOT_SLOT_B_BASE) && (pc < (BOOT_SLOT_B_BASE + BOOT_SLOT_SIZE)))
+    {
+        return BOOT_SLOT_B;
+    }
+
+    return BOOT_SLOT_NONE;
+}
+
+/**
+ * @brief Mark the running image as good so later boots skip its CRC.
+ *
+ * @return FTFC_STATUS_t SUCCESS (also if already confirmed), ERROR outside
+ *         a slot, or the programming status.
+ */
+FTFC_STATUS_t BOOT_ConfirmImage(void)
+{
+    BOOT_SLOT_t slot = BOOT_GetRunningSlot();
+    uint32_t mark[2];
+
+    if (slot == BOOT_SLOT_NONE)
+    {
+        return FTFC_STATUS_ERROR;
+    }
+
+    if (BOOT_IsConfirmed(slot))
+    {
+        return FTFC_STATUS_SUCCESS;
+    }
+
+    /* Source must not be in the flash block being programmed */
+    mark[0] = BOOT_CONFIRM_MAGIC;
+    mark[1] = ~BOOT_CONFIRM_MAGIC;
+
+    return FTFC_Program(boot_slot_base(slot) + BOOT_CONFIRM_OFFSET, (const uint8_t *)mark, sizeof(mark));
+}
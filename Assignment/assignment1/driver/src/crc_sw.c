@@ -0,0 +1,231 @@
+/**
+ * @file crc_sw.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Table-driven software CRC (slice-by-4/8).
+ * @version 0.1
+ * @date 2025-10-24
+ *
+ * Reflected algorithms keep the register LSB aligned and shift right, normal
+ * algorithms keep it MSB aligned in 32 bits and shift left, so both widths
+ * share one set of loops.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../inc/crc_sw.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define CRC_SW_WIDTH_BITS(w)        (((w) == CRC_WIDTH_32) ? 32U : 16U)
+#define CRC_SW_WIDTH_MASK(w)        (((w) == CRC_WIDTH_32) ? 0xFFFFFFFFU : 0xFFFFU)
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static uint32_t crc_sw_reflect(uint32_t value, uint8_t bits);
+static uint32_t crc_sw_load_le(const uint8_t *p);
+static uint32_t crc_sw_load_be(const uint8_t *p);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t crc_sw_reflect(uint32_t value, uint8_t bits)
+{
+    uint32_t out = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < bits; i++)
+    {
+        out = (out << 1U) | (value & 1U);
+        value >>= 1U;
+    }
+
+    return out;
+}
+
+static uint32_t crc_sw_load_le(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8U) | ((uint32_t)p[2] << 16U) | ((uint32_t)p[3] << 24U);
+}
+
+static uint32_t crc_sw_load_be(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24U) | ((uint32_t)p[1] << 16U) | ((uint32_t)p[2] << 8U) | (uint32_t)p[3];
+}
+
+bool CRC_SwInitTable(crc_sw_table_t *sw)
+{
+    uint8_t bits;
+    uint32_t poly;
+    uint32_t c;
+    uint32_t i;
+    uint8_t k;
+
+    if ((sw == NULL) || (sw->table == NULL) || ((sw->slices != 4U) && (sw->slices != 8U)))
+    {
+        return false;
+    }
+
+    bits = (uint8_t)CRC_SW_WIDTH_BITS(sw->config.width);
+
+    if (sw->config.reflect_in)
+    {
+        poly = crc_sw_reflect(sw->config.polynomial, bits);
+
+        for (i = 0U; i < 256U; i++)
+        {
+            c = i;
+            for (k = 0U; k < 8U; k++)
+            {
+                c = ((c & 1U) != 0U) ? ((c >> 1U) ^ poly) : (c >> 1U);
+            }
+            sw->table[0][i] = c;
+        }
+
+        for (k = 1U; k < sw->slices; k++)
+        {
+            for (i = 0U; i < 256U; i++)
+            {
+                c = sw->table[k - 1U][i];
+                sw->table[k][i] = (c >> 8U) ^ sw->table[0][c & 0xFFU];
+            }
+        }
+    }
+    else
+    {
+        poly = sw->config.polynomial << (32U - bits);
+
+        for (i = 0U; i < 256U; i++)
+        {
+            c = i << 24U;
+            for (k = 0U; k < 8U; k++)
+            {
+                c = ((c & 0x80000000U) != 0U) ? ((c << 1U) ^ poly) : (c << 1U);
+            }
+            sw->table[0][i] = c;
+        }
+
+        for (k = 1U; k < sw->slices; k++)
+        {
+            for (i = 0U; i < 256U; i++)
+            {
+                c = sw->table[k - 1U][i];
+                sw->table[k][i] = (c << 8U) ^ sw->table[0][c >> 24U];
+            }
+        }
+    }
+
+    return true;
+}
+
+uint32_t CRC_SwStart(const crc_sw_table_t *sw)
+{
+    uint8_t bits = (uint8_t)CRC_SW_WIDTH_BITS(sw->config.width);
+    uint32_t seed = sw->config.seed & CRC_SW_WIDTH_MASK(sw->config.width);
+
+    return sw->config.reflect_in ? crc_sw_reflect(seed, bits) : (seed << (32U - bits));
+}
+
+uint32_t CRC_SwUpdate(const crc_sw_table_t *sw, uint32_t reg, const uint8_t *data, size_t len)
+{
+    uint32_t (*t)[256] = sw->table;
+    uint32_t w;
+
+    if (sw->config.reflect_in)
+    {
+        if (sw->slices == 8U)
+        {
+            while (len >= 8U)
+            {
+                reg ^= crc_sw_load_le(data);
+                w = crc_sw_load_le(data + 4U);
+                reg = t[7][reg & 0xFFU] ^ t[6][(reg >> 8U) & 0xFFU] ^
+                      t[5][(reg >> 16U) & 0xFFU] ^ t[4][reg >> 24U] ^
+                      t[3][w & 0xFFU] ^ t[2][(w >> 8U) & 0xFFU] ^
+                      t[1][(w >> 16U) & 0xFFU] ^ t[0][w >> 24U];
+                data += 8U;
+                len -= 8U;
+            }
+        }
+
+        while (len >= 4U)
+        {
+            reg ^= crc_sw_load_le(data);
+            reg = t[3][reg & 0xFFU] ^ t[2][(reg >> 8U) & 0xFFU] ^
+                  t[1][(reg >> 16U) & 0xFFU] ^ t[0][reg >> 24U];
+            data += 4U;
+            len -= 4U;
+        }
+
+        while (len > 0U)
+        {
+            reg = (reg >> 8U) ^ t[0][(reg ^ *data) & 0xFFU];
+            data++;
+            len--;
+        }
+    }
+    else
+    {
+        if (sw->slices == 8U)
+        {
+            while (len >= 8U)
+            {
+                reg ^= crc_sw_load_be(data);
+                w = crc_sw_load_be(data + 4U);
+                reg = t[7][reg >> 24U] ^ t[6][(reg >> 16U) & 0xFFU] ^
+                      t[5][(reg >> 8U) & 0xFFU] ^ t[4][reg & 0xFFU] ^
+                      t[3][w >> 24U] ^ t[2][(w >> 16U) & 0xFFU] ^
+                      t[1][(w >> 8U) & 0xFFU] ^ t[0][w & 0xFFU];
+                data += 8U;
+                len -= 8U;
+            }
+        }
+
+        while (len >= 4U)
+        {
+            reg ^= crc_sw_load_be(data);
+            reg = t[3][reg >> 24U] ^ t[2][(reg >> 16U) & 0xFFU] ^
+                  t[1][(reg >> 8U) & 0xFFU] ^ t[0][reg & 0xFFU];
+            data += 4U;
+            len -= 4U;
+        }
+
+        while (len > 0U)
+        {
+            reg = (reg << 8U) ^ t[0][((reg >> 24U) ^ *data) & 0xFFU];
+            data++;
+            len--;
+        }
+    }
+
+    return reg;
+}
+
+uint32_t CRC_SwFinish(const crc_sw_table_t *sw, uint32_t reg)
+{
+    uint8_t bits = (uint8_t)CRC_SW_WIDTH_BITS(sw->config.width);
+    uint32_t value;
+
+    if (sw->config.reflect_in)
+    {
+        /* Register already holds the reflected CRC */
+        value = sw->config.reflect_out ? reg : crc_sw_reflect(reg, bits);
+    }
+    else
+    {
+        value = reg >> (32U - bits);
+        value = sw->config.reflect_out ? crc_sw_reflect(value, bits) : value;
+    }
+
+    return (value ^ sw->config.xor_out) & CRC_SW_WIDTH_MASK(sw->config.width);
+}
+
+uint32_t CRC_SwCompute(const crc_sw_table_t *sw, const uint8_t *data, size_t len)
+{
+    return CRC_SwFinish(sw, CRC_SwUpdate(sw, CRC_SwStart(sw), data, len));
+}
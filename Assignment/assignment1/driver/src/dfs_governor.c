@@ -0,0 +1,367 @@
+/**
+ * @file dfs_governor.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Dynamic frequency scaling governor implementation.
+ * @version 0.1
+ * @date 2025-11-06
+ *
+ * A switch is: PRE notification, SPLL reprogramming if the target level's
+ * SPLLCFG differs, SMC run mode change if its mode differs (RUN <-> HSRUN,
+ * waiting for PMSTAT), the level's SCG preset and a check of the resulting
+ * core clock against the mode limit, POST notification. When any step fails
+ * the previous level is applied again the same way, so the system is never
+ * left between two levels.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/dfs_governor.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/reg_access.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define DFS_TIMEOUT                 10000U
+
+/* SMC PMCTRL[RUNM] and PMSTAT encodings */
+#define DFS_RUNM_RUN                0U
+#define DFS_RUNM_HSRUN              3U
+#define DFS_PMSTAT_RUN              0x01U
+#define DFS_PMSTAT_HSRUN            0x80U
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static DFS_STATUS_t dfs_set_run_mode(SCG_CLOCK_MODE_t mode);
+static DFS_STATUS_t dfs_set_spll(uint32_t spllcfg);
+static DFS_STATUS_t dfs_apply(uint8_t level);
+static void dfs_notify(DFS_EVENT_t event, uint8_t from, uint8_t to);
+static DFS_STATUS_t dfs_switch(uint8_t to);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const dfs_level_t *s_dfs_levels = NULL;
+static uint8_t s_dfs_count = 0U;
+static uint8_t s_dfs_level = 0U;
+static uint8_t s_dfs_max = 0U;
+static dfs_config_t s_dfs_config;
+
+static uint8_t s_dfs_above = 0U;
+static uint8_t s_dfs_below = 0U;
+static uint16_t s_dfs_load = 0U;
+static dfs_stats_t s_dfs_stats;
+
+static dfs_notifier_t *s_dfs_notifiers = NULL;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/**
+ * @brief Move the SMC between RUN and HSRUN.
+ *
+ * Entering HSRUN runs the system from HCCR at once; leaving it from RCCR.
+ * Both hold the last preset of their mode (reset: FIRC), which is within
+ * the limits of the mode.
+ */
+static DFS_STATUS_t dfs_set_run_mode(SCG_CLOCK_MODE_t mode)
+{
+    uint32_t runm = (mode == SCG_HSRUN_MODE) ? DFS_RUNM_HSRUN : DFS_RUNM_RUN;
+    uint32_t pmstat = (mode == SCG_HSRUN_MODE) ? DFS_PMSTAT_HSRUN : DFS_PMSTAT_RUN;
+    uint32_t timeOut = 0U;
+
+    if ((IP_SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) == pmstat)
+    {
+        return DFS_STATUS_SUCCESS;
+    }
+
+    REG_MODIFY(IP_SMC->PMCTRL, SMC_PMCTRL, (RUNM, runm));
+
+    while ((timeOut < DFS_TIMEOUT) && ((IP_SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) != pmstat))
+    {
+        ++timeOut;
+    }
+
+    return (timeOut < DFS_TIMEOUT) ? DFS_STATUS_SUCCESS : DFS_STATUS_TIMEOUT;
+}
+
+/**
+ * @brief Restart the SPLL with a new SPLLCFG.
+ *
+ * Only possible while the SPLL clocks nothing: the system runs from FIRC in
+ * RUN meanwhile. Entering HSRUN afterwards picks up HCCR with the new SPLL.
+ */
+static DFS_STATUS_t dfs_set_spll(uint32_t spllcfg)
+{
+    if (dfs_set_run_mode(SCG_RUN_MODE) != DFS_STATUS_SUCCESS)
+    {
+        return DFS_STATUS_TIMEOUT;
+    }
+
+    if (((IP_SCG->CSR & SCG_CSR_SCS_MASK) == SCG_CSR_SCS(SCG_SPLL_CLK)) &&
+        (SCG_FIRC_SlowRun_48Mhz() != SCG_STATUS_SUCCESS))
+    {
+        return DFS_STATUS_TIMEOUT;
+    }
+
+    REG_MODIFY(IP_SCG->SPLLCSR, SCG_SPLLCSR, (SPLLEN, 0U));
+    IP_SCG->SPLLCFG = spllcfg;
+
+    return (SCG_SourceInit(SCG_SPLL_CLK) == SCG_STATUS_SUCCESS) ? DFS_STATUS_SUCCESS : DFS_STATUS_TIMEOUT;
+}
+
+static DFS_STATUS_t dfs_apply(uint8_t level)
+{
+    const dfs_level_t *target = &s_dfs_levels[level];
+    uint32_t max_hz = (target->mode == SCG_HSRUN_MODE) ? DFS_HSRUN_MAX_HZ : DFS_RUN_MAX_HZ;
+
+    if ((target->spllcfg != 0U) && (IP_SCG->SPLLCFG != target->spllcfg) &&
+        (dfs_set_spll(target->spllcfg) != DFS_STATUS_SUCCESS))
+    {
+        return DFS_STATUS_TIMEOUT;
+    }
+
+    if ((dfs_set_run_mode(target->mode) != DFS_STATUS_SUCCESS) || (target->apply() != SCG_STATUS_SUCCESS))
+    {
+        return DFS_STATUS_TIMEOUT;
+    }
+
+    /* The preset only divides: a wrong SPLL for it shows here */
+    return (SCG_GetCoreClock() <= max_hz) ? DFS_STATUS_SUCCESS : DFS_STATUS_ERROR;
+}
+
+static void dfs_notify(DFS_EVENT_t event, uint8_t from, uint8_t to)
+{
+    dfs_change_t change;
+    dfs_notifier_t *it;
+
+    change.event = event;
+    change.from = from;
+    change.to = to;
+    change.core_hz = SCG_GetCoreClock();
+    change.bus_hz = SCG_GetBusClock();
+
+    for (it = s_dfs_notifiers; it != NULL; it = it->next)
+    {
+        it->notify(&change, it->ctx);
+    }
+}
+
+static DFS_STATUS_t dfs_switch(uint8_t to)
+{
+    uint8_t from = s_dfs_level;
+    DFS_STATUS_t result;
+
+    s_dfs_above = 0U;
+    s_dfs_below = 0U;
+
+    if (to == from)
+    {
+        return DFS_STATUS_SUCCESS;
+    }
+
+    dfs_notify(DFS_EVENT_PRE, from, to);
+
+    result = dfs_apply(to);
+    if (result == DFS_STATUS_SUCCESS)
+    {
+        s_dfs_level = to;
+        if (to > from)
+        {
+            s_dfs_stats.ups++;
+        }
+        else
+        {
+            s_dfs_stats.downs++;
+        }
+    }
+    else
+    {
+        s_dfs_stats.failures++;
+        (void)dfs_apply(from);
+    }
+
+    dfs_notify(DFS_EVENT_POST, from, s_dfs_level);
+
+    return result;
+}
+
+DFS_STATUS_t DFS_Init(const dfs_level_t *levels, uint8_t count, const dfs_config_t *config, uint8_t start)
+{
+    DFS_STATUS_t result;
+    bool hsrun = false;
+    uint8_t i;
+
+    if ((levels == NULL) || (count == 0U) || (config == NULL) || (start >= count) ||
+        (config->down_permille >= config->up_permille) || (config->up_permille > DFS_PERMILLE) ||
+        (config->up_windows == 0U) || (config->down_windows == 0U))
+    {
+        return DFS_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        if ((levels[i].apply == NULL) ||
+            ((levels[i].mode != SCG_RUN_MODE) && (levels[i].mode != SCG_HSRUN_MODE)))
+        {
+            return DFS_STATUS_ERROR;
+        }
+        hsrun = hsrun || (levels[i].mode == SCG_HSRUN_MODE);
+    }
+
+    if (hsrun)
+    {
+        /* Write-once, the same value as PWR_Init() */
+        IP_SMC->PMPROT = SMC_PMPROT_AVLP_MASK | SMC_PMPROT_AHSRUN_MASK;
+        if ((IP_SMC->PMPROT & SMC_PMPROT_AHSRUN_MASK) == 0U)
+        {
+            return DFS_STATUS_ERROR;
+        }
+    }
+
+    s_dfs_levels = levels;
+    s_dfs_count = count;
+    s_dfs_max = (uint8_t)(count - 1U);
+    s_dfs_config = *config;
+    s_dfs_above = 0U;
+    s_dfs_below = 0U;
+    s_dfs_load = 0U;
+    s_dfs_stats.windows = 0U;
+    s_dfs_stats.ups = 0U;
+    s_dfs_stats.downs = 0U;
+    s_dfs_stats.failures = 0U;
+
+    /* Nothing runs on the new clock yet: no notifications */
+    s_dfs_level = start;
+
+    result = dfs_apply(start);
+    if (result != DFS_STATUS_SUCCESS)
+    {
+        /* Not left on a level that failed, possibly above the mode limit */
+        (void)dfs_apply(0U);
+        s_dfs_level = 0U;
+        s_dfs_levels = NULL;
+    }
+
+    return result;
+}
+
+DFS_STATUS_t DFS_RegisterNotifier(dfs_notifier_t *notifier)
+{
+    dfs_notifier_t *it;
+
+    if ((notifier == NULL) || (notifier->notify == NULL))
+    {
+        return DFS_STATUS_ERROR;
+    }
+
+    for (it = s_dfs_notifiers; it != NULL; it = it->next)
+    {
+        if (it == notifier)
+        {
+            return DFS_STATUS_ERROR;
+        }
+    }
+
+    notifier->next = s_dfs_notifiers;
+    s_dfs_notifiers = notifier;
+
+    return DFS_STATUS_SUCCESS;
+}
+
+uint8_t DFS_Sample(uint32_t idle, uint32_t window)
+{
+    uint32_t load;
+
+    if ((s_dfs_levels == NULL) || (window == 0U))
+    {
+        return s_dfs_level;
+    }
+
+    if (idle > window)
+    {
+        idle = window;
+    }
+
+    load = (uint32_t)(((uint64_t)(window - idle) * DFS_PERMILLE) / window);
+    s_dfs_load = (uint16_t)load;
+    s_dfs_stats.windows++;
+
+    if (load > s_dfs_config.up_permille)
+    {
+        s_dfs_below = 0U;
+        if (s_dfs_above < s_dfs_config.up_windows)
+        {
+            s_dfs_above++;
+        }
+        if ((s_dfs_above >= s_dfs_config.up_windows) && (s_dfs_level < s_dfs_max))
+        {
+            (void)dfs_switch((uint8_t)(s_dfs_level + 1U));
+        }
+    }
+    else if (load < s_dfs_config.down_permille)
+    {
+        s_dfs_above = 0U;
+        if (s_dfs_below < s_dfs_config.down_windows)
+        {
+            s_dfs_below++;
+        }
+        if ((s_dfs_below >= s_dfs_config.down_windows) && (s_dfs_level > 0U))
+        {
+            (void)dfs_switch((uint8_t)(s_dfs_level - 1U));
+        }
+    }
+    else
+    {
+        /* Inside the band: keep the level */
+        s_dfs_above = 0U;
+        s_dfs_below = 0U;
+    }
+
+    return s_dfs_level;
+}
+
+DFS_STATUS_t DFS_SetLevel(uint8_t level)
+{
+    if ((s_dfs_levels == NULL) || (level >= s_dfs_count))
+    {
+        return DFS_STATUS_ERROR;
+    }
+
+    return dfs_switch((level > s_dfs_max) ? s_dfs_max : level);
+}
+
+DFS_STATUS_t DFS_SetMaxLevel(uint8_t level)
+{
+    if ((s_dfs_levels == NULL) || (level >= s_dfs_count))
+    {
+        return DFS_STATUS_ERROR;
+    }
+
+    s_dfs_max = level;
+
+    return (s_dfs_level > level) ? dfs_switch(level) : DFS_STATUS_SUCCESS;
+}
+
+uint8_t DFS_GetLevel(void)
+{
+    return s_dfs_level;
+}
+
+uint16_t DFS_GetLoad(void)
+{
+    return s_dfs_load;
+}
+
+void DFS_GetStats(dfs_stats_t *stats)
+{
+    *stats = s_dfs_stats;
+}
@@ -0,0 +1,234 @@
+/**
+ * @file fault_capture.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Fault capture to .noinit RAM implementation.
+ * @version 0.1
+ * @date 2025-11-08
+ *
+ * The handlers are naked: before any compiler-generated code can touch
+ * r4-r11 or the stack, FAULT_ENTRY stores r4-r11 at the start of the record
+ * (hence r4_r11 first), picks MSP or PSP from EXC_RETURN and tail-calls
+ * fault_capture(). If MSP is below __StackLimit (stack overflow) it is moved
+ * back to __StackTop first, so the C part has a stack to run on; the frame
+ * pointer was taken before.
+ *
+ * When stacking itself failed (CFSR MSTKERR/STKERR) or the stack pointer is
+ * outside SRAM the frame is not read, a second fault in the handler would
+ * lock the core up instead of resetting it.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/fault_capture.h"
+#include "../driver/inc/cycle_counter.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define FAULT_AIRCR_VECTKEY         0x05FAU
+
+/* CFSR: MemManage and BusFault on exception entry stacking */
+#define FAULT_CFSR_MSTKERR          0x00000010U
+#define FAULT_CFSR_STKERR           0x00001000U
+
+/* EXC_RETURN bits */
+#define FAULT_EXC_RETURN_PSP        0x04U
+#define FAULT_EXC_RETURN_NO_FPU     0x10U
+
+/* SRAM_L + SRAM_U */
+#define FAULT_SRAM_START            0x1FFF8000U
+#define FAULT_SRAM_END              0x20007000U
+
+#define FAULT_FRAME_WORDS           8U
+
+/* Debug Halting Control and Status Register, not part of S32K144.h */
+#define FAULT_DHCSR                 (*(volatile uint32_t *)0xE000EDF0U)
+#define FAULT_DHCSR_C_DEBUGEN       0x00000001U
+
+/* Common naked entry: r0 = EXC_RETURN, r1 = stacked frame */
+#define FAULT_ENTRY                 "ldr   r0, =s_fault_record\n\t" \
+                                    "stmia r0, {r4-r11}\n\t"        \
+                                    "mov   r0, lr\n\t"              \
+                                    "tst   lr, #4\n\t"              \
+                                    "ite   eq\n\t"                  \
+                                    "mrseq r1, msp\n\t"             \
+                                    "mrsne r1, psp\n\t"             \
+                                    "ldr   r2, =__StackLimit\n\t"   \
+                                    "mrs   r3, msp\n\t"             \
+                                    "cmp   r3, r2\n\t"              \
+                                    "bhs   1f\n\t"                  \
+                                    "ldr   r3, =__StackTop\n\t"     \
+                                    "msr   msp, r3\n\t"             \
+                                    "1:\n\t"                        \
+                                    "b     fault_capture\n\t"       \
+                                    ".ltorg"
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void fault_capture(uint32_t exc_return, const uint32_t *sp) __attribute__((used, noinline, noreturn));
+void HardFault_Handler(void) __attribute__((naked));
+void MemManage_Handler(void) __attribute__((naked));
+void BusFault_Handler(void) __attribute__((naked));
+void UsageFault_Handler(void) __attribute__((naked));
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static fault_record_t s_fault_record __attribute__((section(".noinit"), used));
+
+static fault_isr_entry_t s_fault_ring[FAULT_ISR_RING];
+static volatile uint32_t s_fault_ring_count = 0U;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void fault_capture(uint32_t exc_return, const uint32_t *sp)
+{
+    fault_record_t *record = &s_fault_record;
+    uint32_t cfsr = S32_SCB->CFSR;
+    uint32_t addr = (uint32_t)sp;
+    uint32_t flags = 0U;
+    uint32_t count = s_fault_ring_count;
+    uint32_t ipsr;
+    uint32_t i;
+
+    record->cycles = CYCLE_Get();
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+
+    if (record->magic != FAULT_RECORD_MAGIC)
+    {
+        record->count = 0U;
+    }
+
+    record->exception = ipsr;
+    record->exc_return = exc_return;
+    record->sp = addr;
+    record->cfsr = cfsr;
+    record->hfsr = S32_SCB->HFSR;
+    record->mmfar = S32_SCB->MMFAR;
+    record->bfar = S32_SCB->BFAR;
+
+    if ((exc_return & FAULT_EXC_RETURN_PSP) != 0U)
+    {
+        flags |= FAULT_FLAG_PSP;
+    }
+    if ((exc_return & FAULT_EXC_RETURN_NO_FPU) == 0U)
+    {
+        flags |= FAULT_FLAG_FPU_FRAME;
+    }
+
+    if (((cfsr & (FAULT_CFSR_MSTKERR | FAULT_CFSR_STKERR)) == 0U) && ((addr & 3U) == 0U) &&
+        (addr >= FAULT_SRAM_START) && (addr <= (FAULT_SRAM_END - (FAULT_FRAME_WORDS * 4U))))
+    {
+        for (i = 0U; i < FAULT_FRAME_WORDS; i++)
+        {
+            record->frame[i] = sp[i];
+        }
+        flags |= FAULT_FLAG_FRAME_VALID;
+    }
+    else
+    {
+        for (i = 0U; i < FAULT_FRAME_WORDS; i++)
+        {
+            record->frame[i] = 0U;
+        }
+    }
+
+    /* Oldest first: the slot the next entry would overwrite */
+    for (i = 0U; i < FAULT_ISR_RING; i++)
+    {
+        record->isr[i] = s_fault_ring[(count + i) & (FAULT_ISR_RING - 1U)];
+    }
+    record->isr_count = count;
+    record->flags = flags;
+    record->count++;
+    record->magic = FAULT_RECORD_MAGIC;
+
+    __asm volatile ("dsb" : : : "memory");
+
+    if ((FAULT_DHCSR & FAULT_DHCSR_C_DEBUGEN) != 0U)
+    {
+        __asm volatile ("bkpt #0");
+    }
+
+    S32_SCB->AIRCR = S32_SCB_AIRCR_VECTKEY(FAULT_AIRCR_VECTKEY) | S32_SCB_AIRCR_SYSRESETREQ_MASK;
+    __asm volatile ("dsb" : : : "memory");
+
+    for (;;)
+    {
+    }
+}
+
+void HardFault_Handler(void)
+{
+    __asm volatile (FAULT_ENTRY);
+}
+
+void MemManage_Handler(void)
+{
+    __asm volatile (FAULT_ENTRY);
+}
+
+void BusFault_Handler(void)
+{
+    __asm volatile (FAULT_ENTRY);
+}
+
+void UsageFault_Handler(void)
+{
+    __asm volatile (FAULT_ENTRY);
+}
+
+void FAULT_Init(void)
+{
+    if ((CYCLE_DWT_CTRL & CYCLE_DWT_CTRL_CYCCNTENA) == 0U)
+    {
+        CYCLE_Init();
+    }
+
+    S32_SCB->SHCSR |= S32_SCB_SHCSR_MEMFAULTENA_MASK | S32_SCB_SHCSR_BUSFAULTENA_MASK |
+                      S32_SCB_SHCSR_USGFAULTENA_MASK;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+void FAULT_TraceIsr(void)
+{
+    uint32_t n = __atomic_fetch_add(&s_fault_ring_count, 1U, __ATOMIC_RELAXED);
+    fault_isr_entry_t *entry = &s_fault_ring[n & (FAULT_ISR_RING - 1U)];
+    uint32_t ipsr;
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+
+    entry->exception = ipsr;
+    entry->cycles = CYCLE_Get();
+}
+
+bool FAULT_GetRecord(fault_record_t *record)
+{
+    if ((record == NULL) || (s_fault_record.magic != FAULT_RECORD_MAGIC) || (s_fault_record.exception == 0U))
+    {
+        return false;
+    }
+
+    *record = s_fault_record;
+
+    return true;
+}
+
+void FAULT_ClearRecord(void)
+{
+    if (s_fault_record.magic == FAULT_RECORD_MAGIC)
+    {
+        s_fault_record.exception = 0U;
+    }
+}
@@ -0,0 +1,845 @@
+/**
+ * @file kvs.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Key-value store on an append-only, wear-levelled record log.
+ * @version 0.1
+ * @date 2025-10-26
+ *
+ * Index entries hold the record offset from kvs_flash_t.base, or the offset in
+ * the commit buffer with KVS_LOC_PENDING set; 0 means no value (offset 0 is
+ * always a sector header).
+ *
+ * One sector is kept free so the tail can always be compacted into a fresh
+ * head: when opening a head takes the last free sector, the tail is compacted
+ * before returning. Compaction is strictly oldest-first, which is what makes
+ * dropping deletes and replaying sectors in sequence order safe.
+ *
+ * A sector opened for a compaction carries the tail's sequence number as its
+ * tag, and holds nothing but copies until the compaction appends a GC_DONE
+ * record and erases the tail. Mount uses both to recover: a tagged head
+ * without GC_DONE whose tail still exists is discarded (the tail is intact),
+ * one with GC_DONE has its tail erased.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../inc/kvs.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define KVS_MAGIC                   0x3153564BU     /* "KVS1" */
+#define KVS_SECTOR_HEADER_SIZE      16U
+#define KVS_LOC_PENDING             0x80000000U
+#define KVS_KEY_ERASED              0xFFFFU
+#define KVS_KEY_GC_DONE             0xFFFEU
+#define KVS_SCAN_CHUNK              32U
+#define KVS_GC_THRESHOLD            2U
+
+#define KVS_SECTOR_OFFSET(kvs, s)   ((uint32_t)(s) * (kvs)->flash->sector_size)
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static uint32_t kvs_crc(uint32_t crc, const uint8_t *data, uint32_t len);
+static uint16_t kvs_get16(const uint8_t *p);
+static uint32_t kvs_get32(const uint8_t *p);
+static void kvs_put16(uint8_t *p, uint16_t v);
+static void kvs_put32(uint8_t *p, uint32_t v);
+static bool kvs_is_erased(const uint8_t *p, uint32_t len);
+static int32_t kvs_read(kvs_t *kvs, uint32_t offset, uint8_t *buf, uint32_t len);
+static bool kvs_range_erased(kvs_t *kvs, uint32_t offset, uint32_t len);
+static bool kvs_record_valid(kvs_t *kvs, uint32_t offset, const uint8_t *hdr, uint32_t room);
+static uint32_t kvs_scan(kvs_t *kvs, uint16_t sector, bool *gc_done);
+static bool kvs_replay(kvs_t *kvs);
+static KVS_STATUS_t kvs_erase(kvs_t *kvs, uint16_t sector);
+static KVS_STATUS_t kvs_commit(kvs_t *kvs);
+static KVS_STATUS_t kvs_open_sector(kvs_t *kvs);
+static KVS_STATUS_t kvs_reserve(kvs_t *kvs, uint32_t size);
+static KVS_STATUS_t kvs_stage(kvs_t *kvs, uint16_t key, const uint8_t *data, uint16_t len);
+static bool kvs_gc_start(kvs_t *kvs, uint16_t exclude);
+static KVS_STATUS_t kvs_gc_step(kvs_t *kvs);
+static KVS_STATUS_t kvs_gc_finish(kvs_t *kvs);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* Bitwise CRC-32 (reflected 0x04C11DB7); records are short */
+static uint32_t kvs_crc(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    uint8_t bit;
+
+    while (len > 0U)
+    {
+        crc ^= *data;
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ 0xEDB88320U) : (crc >> 1U);
+        }
+        data++;
+        len--;
+    }
+
+    return crc;
+}
+
+static uint16_t kvs_get16(const uint8_t *p)
+{
+    return (uint16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8U));
+}
+
+static uint32_t kvs_get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8U) | ((uint32_t)p[2] << 16U) | ((uint32_t)p[3] << 24U);
+}
+
+static void kvs_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8U);
+}
+
+static void kvs_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8U);
+    p[2] = (uint8_t)(v >> 16U);
+    p[3] = (uint8_t)(v >> 24U);
+}
+
+static bool kvs_is_erased(const uint8_t *p, uint32_t len)
+{
+    while (len > 0U)
+    {
+        if (*p != 0xFFU)
+        {
+            return false;
+        }
+        p++;
+        len--;
+    }
+
+    return true;
+}
+
+static int32_t kvs_read(kvs_t *kvs, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    return kvs->flash->read(kvs->flash->ctx, kvs->flash->base + offset, buf, len);
+}
+
+static bool kvs_range_erased(kvs_t *kvs, uint32_t offset, uint32_t len)
+{
+    uint8_t chunk[KVS_SCAN_CHUNK];
+    uint32_t n;
+
+    while (len > 0U)
+    {
+        n = (len > KVS_SCAN_CHUNK) ? KVS_SCAN_CHUNK : len;
+        if ((kvs_read(kvs, offset, chunk, n) != 0) || !kvs_is_erased(chunk, n))
+        {
+            return false;
+        }
+        offset += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check key, length and CRC of the record whose header is in hdr.
+ */
+static bool kvs_record_valid(kvs_t *kvs, uint32_t offset, const uint8_t *hdr, uint32_t room)
+{
+    uint8_t chunk[KVS_SCAN_CHUNK];
+    uint16_t key = kvs_get16(&hdr[0]);
+    uint16_t len = kvs_get16(&hdr[2]);
+    uint32_t crc;
+    uint32_t n;
+    uint32_t left = len;
+
+    if (((key >= kvs->key_count) && ((key != KVS_KEY_GC_DONE) || (len != 0U))) || (KVS_RECORD_SIZE(len) > room))
+    {
+        return false;
+    }
+
+    crc = kvs_crc(0xFFFFFFFFU, hdr, 4U);
+    offset += KVS_RECORD_HEADER_SIZE;
+
+    while (left > 0U)
+    {
+        n = (left > KVS_SCAN_CHUNK) ? KVS_SCAN_CHUNK : left;
+        if (kvs_read(kvs, offset, chunk, n) != 0)
+        {
+            return false;
+        }
+        crc = kvs_crc(crc, chunk, n);
+        offset += n;
+        left -= n;
+    }
+
+    return ((crc ^ 0xFFFFFFFFU) == kvs_get32(&hdr[4]));
+}
+
+/**
+ * @brief Replay the records of a sector into the index.
+ *
+ * @param gc_done Set when the sector holds a GC_DONE record.
+ * @return uint32_t End of the valid log, or sector_size if the sector holds
+ *         anything that cannot be appended after.
+ */
+static uint32_t kvs_scan(kvs_t *kvs, uint16_t sector, bool *gc_done)
+{
+    uint32_t size = kvs->flash->sector_size;
+    uint32_t base = KVS_SECTOR_OFFSET(kvs, sector);
+    uint32_t off = KVS_SECTOR_HEADER_SIZE;
+    uint8_t hdr[KVS_RECORD_HEADER_SIZE];
+    uint16_t key;
+    uint16_t len;
+
+    while ((off + KVS_RECORD_HEADER_SIZE) <= size)
+    {
+        if (kvs_read(kvs, base + off, hdr, KVS_RECORD_HEADER_SIZE) != 0)
+        {
+            return size;
+        }
+
+        if (kvs_is_erased(hdr, KVS_RECORD_HEADER_SIZE))
+        {
+            /* Only a fully erased remainder can take new records */
+            return kvs_range_erased(kvs, base + off, size - off) ? off : size;
+        }
+
+        if (!kvs_record_valid(kvs, base + off, hdr, size - off))
+        {
+            return size;
+        }
+
+        key = kvs_get16(&hdr[0]);
+        len = kvs_get16(&hdr[2]);
+        if (key == KVS_KEY_GC_DONE)
+        {
+            *gc_done = true;
+        }
+        else
+        {
+            kvs->index[key] = (len == 0U) ? 0U : (base + off);
+        }
+        off += KVS_RECORD_SIZE(len);
+    }
+
+    return off;
+}
+
+/**
+ * @brief Rebuild the index from all sectors, oldest first.
+ *
+ * @return bool true if the newest sector holds a GC_DONE record.
+ */
+static bool kvs_replay(kvs_t *kvs)
+{
+    uint16_t count = kvs->flash->sector_count;
+    uint32_t last = 0U;
+    uint16_t next;
+    uint16_t s;
+    uint16_t i;
+    bool gc_done = false;
+
+    for (i = 0U; i < kvs->key_count; i++)
+    {
+        kvs->index[i] = 0U;
+    }
+
+    for (;;)
+    {
+        next = count;
+        for (s = 0U; s < count; s++)
+        {
+            if ((kvs->seq[s] > last) && ((next == count) || (kvs->seq[s] < kvs->seq[next])))
+            {
+                next = s;
+            }
+        }
+
+        if (next == count)
+        {
+            break;
+        }
+
+        gc_done = false;
+        kvs->head = next;
+        kvs->head_used = kvs_scan(kvs, next, &gc_done);
+        last = kvs->seq[next];
+    }
+
+    return gc_done;
+}
+
+static KVS_STATUS_t kvs_erase(kvs_t *kvs, uint16_t sector)
+{
+    if (kvs->flash->erase(kvs->flash->ctx, kvs->flash->base + KVS_SECTOR_OFFSET(kvs, sector)) != 0)
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    if (kvs->seq[sector] != 0U)
+    {
+        kvs->seq[sector] = 0U;
+        kvs->free_count++;
+    }
+
+    return KVS_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Program the commit buffer at the head and point the index at flash.
+ */
+static KVS_STATUS_t kvs_commit(kvs_t *kvs)
+{
+    KVS_STATUS_t status;
+    uint32_t dest;
+    uint32_t off = 0U;
+    uint16_t key;
+
+    while ((kvs->head_used + kvs->pending) > kvs->flash->sector_size)
+    {
+        status = kvs_open_sector(kvs);
+        if (status != KVS_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    if (kvs->pending == 0U)
+    {
+        return KVS_STATUS_SUCCESS;
+    }
+
+    dest = KVS_SECTOR_OFFSET(kvs, kvs->head) + kvs->head_used;
+
+    if (kvs->flash->program(kvs->flash->ctx, kvs->flash->base + dest, kvs->buffer, kvs->pending) != 0)
+    {
+        /* Space after a failed program is unknown, close the head */
+        kvs->head_used = kvs->flash->sector_size;
+        return KVS_STATUS_ERROR;
+    }
+
+    while (off < kvs->pending)
+    {
+        key = kvs_get16(&kvs->buffer[off]);
+        if ((key < kvs->key_count) && (kvs->index[key] == (KVS_LOC_PENDING | off)))
+        {
+            kvs->index[key] = dest + off;
+        }
+        off += KVS_RECORD_SIZE(kvs_get16(&kvs->buffer[off + 2U]));
+    }
+
+    kvs->head_used += kvs->pending;
+    kvs->pending = 0U;
+
+    return KVS_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start a new head in a free sector.
+ *
+ * The search starts after the current head so erases rotate over the area.
+ * Taking the last free sector compacts the tail into the new head at once;
+ * the header is tagged with the tail sequence whenever copies will land here.
+ */
+static KVS_STATUS_t kvs_open_sector(kvs_t *kvs)
+{
+    uint8_t hdr[KVS_SECTOR_HEADER_SIZE];
+    uint16_t s = kvs->head;
+    uint16_t i;
+    uint32_t tag = 0U;
+    bool compact = false;
+
+    for (i = 0U; i < kvs->flash->sector_count; i++)
+    {
+        s = (uint16_t)((s + 1U) % kvs->flash->sector_count);
+        if (kvs->seq[s] == 0U)
+        {
+            break;
+        }
+    }
+
+    if (kvs->seq[s] != 0U)
+    {
+        return KVS_STATUS_FULL;
+    }
+
+    if (!kvs->gc_running && (kvs->free_count == 1U))
+    {
+        compact = kvs->gc_active || kvs_gc_start(kvs, s);
+    }
+
+    if (kvs->gc_running || compact)
+    {
+        tag = kvs->seq[kvs->gc_sector];
+    }
+
+    kvs_put32(&hdr[0], KVS_MAGIC);
+    kvs_put32(&hdr[4], kvs->max_seq + 1U);
+    kvs_put32(&hdr[8], tag);
+    kvs_put32(&hdr[12], kvs_crc(0xFFFFFFFFU, hdr, 12U) ^ 0xFFFFFFFFU);
+
+    if (kvs->flash->program(kvs->flash->ctx, kvs->flash->base + KVS_SECTOR_OFFSET(kvs, s), hdr, sizeof(hdr)) != 0)
+    {
+        (void)kvs->flash->erase(kvs->flash->ctx, kvs->flash->base + KVS_SECTOR_OFFSET(kvs, s));
+        return KVS_STATUS_ERROR;
+    }
+
+    kvs->max_seq++;
+    kvs->seq[s] = kvs->max_seq;
+    kvs->head = s;
+    kvs->head_used = KVS_SECTOR_HEADER_SIZE;
+    kvs->free_count--;
+
+    return compact ? kvs_gc_finish(kvs) : KVS_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Make room for size bytes in the buffer and the head.
+ */
+static KVS_STATUS_t kvs_reserve(kvs_t *kvs, uint32_t size)
+{
+    KVS_STATUS_t status;
+    uint16_t tries;
+
+    for (tries = 0U; tries <= kvs->flash->sector_count; tries++)
+    {
+        if (((kvs->pending + size) <= kvs->buffer_len) &&
+            ((kvs->head_used + kvs->pending + size) <= kvs->flash->sector_size))
+        {
+            return KVS_STATUS_SUCCESS;
+        }
+
+        status = kvs_commit(kvs);
+        if (status != KVS_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if ((kvs->head_used + size) <= kvs->flash->sector_size)
+        {
+            return KVS_STATUS_SUCCESS;
+        }
+
+        status = kvs_open_sector(kvs);
+        if (status != KVS_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    return KVS_STATUS_FULL;
+}
+
+/**
+ * @brief Pick the oldest used sector other than exclude for compaction.
+ */
+static bool kvs_gc_start(kvs_t *kvs, uint16_t exclude)
+{
+    uint16_t s;
+    bool found = false;
+
+    for (s = 0U; s < kvs->flash->sector_count; s++)
+    {
+        if ((kvs->seq[s] != 0U) && (s != exclude) &&
+            (!found || (kvs->seq[s] < kvs->seq[kvs->gc_sector])))
+        {
+            kvs->gc_sector = s;
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        kvs->gc_active = true;
+        kvs->gc_offset = KVS_SECTOR_HEADER_SIZE;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Copy the next live record of the tail, or retire the tail.
+ *
+ * Copies and the GC_DONE record are committed before the erase, so a reset
+ * in between only leaves duplicates that replay to the same values.
+ */
+static KVS_STATUS_t kvs_gc_step(kvs_t *kvs)
+{
+    KVS_STATUS_t status = KVS_STATUS_SUCCESS;
+    uint32_t size = kvs->flash->sector_size;
+    uint32_t loc = KVS_SECTOR_OFFSET(kvs, kvs->gc_sector) + kvs->gc_offset;
+    uint8_t hdr[KVS_RECORD_HEADER_SIZE];
+    uint32_t rsize = size;
+    uint16_t key = KVS_KEY_ERASED;
+
+    kvs->gc_running = true;
+
+    if (((kvs->gc_offset + KVS_RECORD_HEADER_SIZE) <= size) &&
+        (kvs_read(kvs, loc, hdr, KVS_RECORD_HEADER_SIZE) == 0))
+    {
+        key = kvs_get16(&hdr[0]);
+        rsize = KVS_RECORD_SIZE(kvs_get16(&hdr[2]));
+    }
+
+    if (((key < kvs->key_count) || (key == KVS_KEY_GC_DONE)) && (rsize <= (size - kvs->gc_offset)))
+    {
+        if ((key < kvs->key_count) && (kvs->index[key] == loc))
+        {
+            status = kvs_reserve(kvs, rsize);
+            if ((status == KVS_STATUS_SUCCESS) &&
+                (kvs_read(kvs, loc, &kvs->buffer[kvs->pending], rsize) == 0))
+            {
+                kvs->index[key] = KVS_LOC_PENDING | kvs->pending;
+                kvs->pending = (uint16_t)(kvs->pending + rsize);
+            }
+            else if (status == KVS_STATUS_SUCCESS)
+            {
+                status = KVS_STATUS_ERROR;
+            }
+        }
+
+        if (status == KVS_STATUS_SUCCESS)
+        {
+            kvs->gc_offset += rsize;
+        }
+    }
+    else
+    {
+        status = kvs_stage(kvs, KVS_KEY_GC_DONE, NULL, 0U);
+        if (status == KVS_STATUS_SUCCESS)
+        {
+            status = kvs_commit(kvs);
+        }
+        if (status == KVS_STATUS_SUCCESS)
+        {
+            status = kvs_erase(kvs, kvs->gc_sector);
+        }
+        if (status == KVS_STATUS_SUCCESS)
+        {
+            kvs->gc_active = false;
+        }
+    }
+
+    kvs->gc_running = false;
+
+    return status;
+}
+
+static KVS_STATUS_t kvs_gc_finish(kvs_t *kvs)
+{
+    KVS_STATUS_t status = KVS_STATUS_SUCCESS;
+
+    while ((status == KVS_STATUS_SUCCESS) && kvs->gc_active)
+    {
+        status = kvs_gc_step(kvs);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Mount a store, rebuilding the index from flash.
+ */
+KVS_STATUS_t KVS_Mount(kvs_t *kvs, const kvs_flash_t *flash, uint32_t *index, uint16_t key_count,
+                       uint8_t *buffer, uint16_t buffer_len)
+{
+    uint8_t hdr[KVS_SECTOR_HEADER_SIZE];
+    uint32_t tag;
+    uint16_t s;
+    bool gc_done;
+
+    if ((kvs == NULL) || (flash == NULL) || (index == NULL) || (buffer == NULL) ||
+        (flash->sector_count < 2U) || (flash->sector_count > KVS_SECTOR_MAX) ||
+        ((flash->sector_size % KVS_PHRASE_SIZE) != 0U) || (key_count >= KVS_KEY_GC_DONE) ||
+        ((buffer_len % KVS_PHRASE_SIZE) != 0U) || (buffer_len < (2U * KVS_RECORD_HEADER_SIZE)) ||
+        (buffer_len > (flash->sector_size - KVS_SECTOR_HEADER_SIZE)))
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    kvs->flash = flash;
+    kvs->index = index;
+    kvs->key_count = key_count;
+    kvs->buffer = buffer;
+    kvs->buffer_len = buffer_len;
+    kvs->pending = 0U;
+    kvs->max_seq = 0U;
+    kvs->head = 0U;
+    kvs->head_used = flash->sector_size;
+    kvs->free_count = 0U;
+    kvs->gc_threshold = KVS_GC_THRESHOLD;
+    kvs->gc_active = false;
+    kvs->gc_running = false;
+
+    /* Classify sectors: valid header, fully erased, or anything else (erase it) */
+    for (s = 0U; s < flash->sector_count; s++)
+    {
+        kvs->seq[s] = 0U;
+
+        if (kvs_read(kvs, KVS_SECTOR_OFFSET(kvs, s), hdr, sizeof(hdr)) != 0)
+        {
+            return KVS_STATUS_ERROR;
+        }
+
+        if ((kvs_get32(&hdr[0]) == KVS_MAGIC) && (kvs_get32(&hdr[4]) != 0U) &&
+            (kvs_get32(&hdr[12]) == (kvs_crc(0xFFFFFFFFU, hdr, 12U) ^ 0xFFFFFFFFU)))
+        {
+            kvs->seq[s] = kvs_get32(&hdr[4]);
+            kvs->max_seq = (kvs->seq[s] > kvs->max_seq) ? kvs->seq[s] : kvs->max_seq;
+            continue;
+        }
+
+        kvs->free_count++;
+
+        if (!kvs_range_erased(kvs, KVS_SECTOR_OFFSET(kvs, s), flash->sector_size) &&
+            (flash->erase(flash->ctx, flash->base + KVS_SECTOR_OFFSET(kvs, s)) != 0))
+        {
+            return KVS_STATUS_ERROR;
+        }
+    }
+
+    if (kvs->max_seq == 0U)
+    {
+        return KVS_Format(kvs);
+    }
+
+    /* Undo or complete a compaction cut short by a reset; each pass erases a sector */
+    for (;;)
+    {
+        gc_done = kvs_replay(kvs);
+
+        if (kvs_read(kvs, KVS_SECTOR_OFFSET(kvs, kvs->head), hdr, sizeof(hdr)) != 0)
+        {
+            return KVS_STATUS_ERROR;
+        }
+
+        tag = kvs_get32(&hdr[8]);
+        for (s = 0U; s < flash->sector_count; s++)
+        {
+            if ((tag != 0U) && (kvs->seq[s] == tag))
+            {
+                break;
+            }
+        }
+
+        if (s == flash->sector_count)
+        {
+            break;
+        }
+
+        if (kvs_erase(kvs, gc_done ? s : kvs->head) != KVS_STATUS_SUCCESS)
+        {
+            return KVS_STATUS_ERROR;
+        }
+    }
+
+    if ((kvs->free_count == 0U) && kvs_gc_start(kvs, kvs->head))
+    {
+        return kvs_gc_finish(kvs);
+    }
+
+    return KVS_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Erase all sectors and start an empty log.
+ */
+KVS_STATUS_t KVS_Format(kvs_t *kvs)
+{
+    uint16_t s;
+    uint16_t i;
+
+    if ((kvs == NULL) || (kvs->flash == NULL))
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    for (s = 0U; s < kvs->flash->sector_count; s++)
+    {
+        if (kvs->flash->erase(kvs->flash->ctx, kvs->flash->base + KVS_SECTOR_OFFSET(kvs, s)) != 0)
+        {
+            return KVS_STATUS_ERROR;
+        }
+        kvs->seq[s] = 0U;
+    }
+
+    for (i = 0U; i < kvs->key_count; i++)
+    {
+        kvs->index[i] = 0U;
+    }
+
+    kvs->free_count = kvs->flash->sector_count;
+    kvs->max_seq = 0U;
+    kvs->pending = 0U;
+    kvs->gc_active = false;
+    kvs->head = (uint16_t)(kvs->flash->sector_count - 1U);
+
+    return kvs_open_sector(kvs);
+}
+
+/**
+ * @brief Read the latest value of a key, committed or not.
+ */
+KVS_STATUS_t KVS_Get(kvs_t *kvs, uint16_t key, uint8_t *buf, uint16_t size, uint16_t *len)
+{
+    uint8_t hdr[KVS_RECORD_HEADER_SIZE];
+    uint32_t loc;
+    uint16_t value_len;
+    uint16_t i;
+
+    if ((kvs == NULL) || (key >= kvs->key_count) || ((buf == NULL) && (size > 0U)))
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    loc = kvs->index[key];
+
+    if (loc == 0U)
+    {
+        return KVS_STATUS_NOT_FOUND;
+    }
+
+    if ((loc & KVS_LOC_PENDING) != 0U)
+    {
+        loc &= ~KVS_LOC_PENDING;
+        value_len = kvs_get16(&kvs->buffer[loc + 2U]);
+        size = (size > value_len) ? value_len : size;
+        for (i = 0U; i < size; i++)
+        {
+            buf[i] = kvs->buffer[loc + KVS_RECORD_HEADER_SIZE + i];
+        }
+    }
+    else
+    {
+        if (kvs_read(kvs, loc, hdr, sizeof(hdr)) != 0)
+        {
+            return KVS_STATUS_ERROR;
+        }
+        value_len = kvs_get16(&hdr[2]);
+        size = (size > value_len) ? value_len : size;
+        if ((size > 0U) && (kvs_read(kvs, loc + KVS_RECORD_HEADER_SIZE, buf, size) != 0))
+        {
+            return KVS_STATUS_ERROR;
+        }
+    }
+
+    if (len != NULL)
+    {
+        *len = value_len;
+    }
+
+    return KVS_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stage a record (value or delete) in the commit buffer.
+ */
+static KVS_STATUS_t kvs_stage(kvs_t *kvs, uint16_t key, const uint8_t *data, uint16_t len)
+{
+    KVS_STATUS_t status;
+    uint32_t rsize = KVS_RECORD_SIZE(len);
+    uint8_t *rec;
+    uint32_t i;
+
+    status = kvs_reserve(kvs, rsize);
+    if (status != KVS_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    rec = &kvs->buffer[kvs->pending];
+    kvs_put16(&rec[0], key);
+    kvs_put16(&rec[2], len);
+    for (i = 0U; i < (rsize - KVS_RECORD_HEADER_SIZE); i++)
+    {
+        rec[KVS_RECORD_HEADER_SIZE + i] = (i < len) ? data[i] : 0xFFU;
+    }
+    kvs_put32(&rec[4], kvs_crc(kvs_crc(0xFFFFFFFFU, rec, 4U), data, len) ^ 0xFFFFFFFFU);
+
+    if (key < kvs->key_count)
+    {
+        kvs->index[key] = (len == 0U) ? 0U : (KVS_LOC_PENDING | kvs->pending);
+    }
+    kvs->pending = (uint16_t)(kvs->pending + rsize);
+
+    return KVS_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stage a new value; it is persistent after KVS_Commit().
+ */
+KVS_STATUS_t KVS_Set(kvs_t *kvs, uint16_t key, const uint8_t *data, uint16_t len)
+{
+    if ((kvs == NULL) || (key >= kvs->key_count) || (data == NULL) || (len == 0U) ||
+        (KVS_RECORD_SIZE(len) > kvs->buffer_len))
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    return kvs_stage(kvs, key, data, len);
+}
+
+/**
+ * @brief Stage a delete; deleting a missing key is a no-op.
+ */
+KVS_STATUS_t KVS_Delete(kvs_t *kvs, uint16_t key)
+{
+    if ((kvs == NULL) || (key >= kvs->key_count))
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    if (kvs->index[key] == 0U)
+    {
+        return KVS_STATUS_SUCCESS;
+    }
+
+    return kvs_stage(kvs, key, NULL, 0U);
+}
+
+/**
+ * @brief Program all staged records in one write.
+ */
+KVS_STATUS_t KVS_Commit(kvs_t *kvs)
+{
+    if (kvs == NULL)
+    {
+        return KVS_STATUS_ERROR;
+    }
+
+    return kvs_commit(kvs);
+}
+
+/**
+ * @brief Do a bounded slice of background compaction.
+ */
+bool KVS_CompactStep(kvs_t *kvs)
+{
+    if (kvs == NULL)
+    {
+        return false;
+    }
+
+    if (!kvs->gc_active && ((kvs->free_count >= kvs->gc_threshold) || !kvs_gc_start(kvs, kvs->head)))
+    {
+        return false;
+    }
+
+    /* If the step had to open the spare sector, the tail must be retired now */
+    if ((kvs_gc_step(kvs) == KVS_STATUS_SUCCESS) && (kvs->free_count == 0U))
+    {
+        (void)kvs_gc_finish(kvs);
+    }
+
+    return kvs->gc_active;
+}
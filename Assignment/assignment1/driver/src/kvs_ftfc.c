@@ -0,0 +1,127 @@
+/**
+ * @file kvs_ftfc.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief kvs_flash_t backends on the S32K144 FTFC.
+ * @version 0.1
+ * @date 2025-10-26
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_FTFC.h"
+#include "../driver/inc/kvs_ftfc.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define KVS_FTFC_FILL_CHUNK     32U
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static int32_t kvs_ftfc_read(void *ctx, uint32_t address, uint8_t *buf, uint32_t len);
+static int32_t kvs_ftfc_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len);
+static int32_t kvs_ftfc_erase(void *ctx, uint32_t address);
+static int32_t kvs_eee_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len);
+static int32_t kvs_eee_erase(void *ctx, uint32_t address);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* Both FlexNVM and FlexRAM are memory mapped */
+static int32_t kvs_ftfc_read(void *ctx, uint32_t address, uint8_t *buf, uint32_t len)
+{
+    const volatile uint8_t *src = (const volatile uint8_t *)address;
+
+    (void)ctx;
+
+    while (len > 0U)
+    {
+        *buf = *src;
+        buf++;
+        src++;
+        len--;
+    }
+
+    return 0;
+}
+
+static int32_t kvs_ftfc_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len)
+{
+    (void)ctx;
+
+    return (FTFC_Program(address, data, len) == FTFC_STATUS_SUCCESS) ? 0 : -1;
+}
+
+static int32_t kvs_ftfc_erase(void *ctx, uint32_t address)
+{
+    (void)ctx;
+
+    return (FTFC_Erase(address, FTFC_DFLASH_SECTOR_SIZE) == FTFC_STATUS_SUCCESS) ? 0 : -1;
+}
+
+static int32_t kvs_eee_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len)
+{
+    (void)ctx;
+
+    return (FTFC_EeeWrite(address - FTFC_FLEXRAM_BASE, data, len) == FTFC_STATUS_SUCCESS) ? 0 : -1;
+}
+
+static int32_t kvs_eee_erase(void *ctx, uint32_t address)
+{
+    static const uint8_t fill[KVS_FTFC_FILL_CHUNK] = {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    };
+    const kvs_flash_t *flash = (const kvs_flash_t *)ctx;
+    uint32_t left = flash->sector_size;
+    uint32_t n;
+
+    while (left > 0U)
+    {
+        n = (left > KVS_FTFC_FILL_CHUNK) ? KVS_FTFC_FILL_CHUNK : left;
+        if (FTFC_EeeWrite(address - FTFC_FLEXRAM_BASE, fill, n) != FTFC_STATUS_SUCCESS)
+        {
+            return -1;
+        }
+        address += n;
+        left -= n;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Describe a D-Flash area as a kvs_flash_t.
+ */
+void KVS_FtfcDflash(kvs_flash_t *flash, uint32_t base, uint16_t sector_count)
+{
+    flash->base = base;
+    flash->sector_size = FTFC_DFLASH_SECTOR_SIZE;
+    flash->sector_count = sector_count;
+    flash->read = kvs_ftfc_read;
+    flash->program = kvs_ftfc_program;
+    flash->erase = kvs_ftfc_erase;
+    flash->ctx = NULL;
+}
+
+/**
+ * @brief Describe emulated EEPROM (FlexRAM in EEE mode) as a kvs_flash_t.
+ */
+void KVS_FtfcEee(kvs_flash_t *flash, uint32_t sector_size, uint16_t sector_count)
+{
+    flash->base = FTFC_FLEXRAM_BASE;
+    flash->sector_size = sector_size;
+    flash->sector_count = sector_count;
+    flash->read = kvs_ftfc_read;
+    flash->program = kvs_eee_program;
+    flash->erase = kvs_eee_erase;
+    flash->ctx = flash;
+}
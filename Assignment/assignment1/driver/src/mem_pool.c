@@ -0,0 +1,375 @@
+/**
+ * @file mem_pool.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Fixed-block memory pools implementation.
+ * @version 0.1
+ * @date 2025-11-11
+ *
+ * Every class gets one static array, generated from POOL_CLASSES, in the
+ * section of its region. A free block holds the link to the next free block
+ * in its first word, so the pools need no memory besides the blocks and the
+ * class table. The sections are NOLOAD: the startup code initialises their
+ * ECC with the rest of the used RAM and POOL_Init() writes every link, the
+ * contents are never read before that.
+ *
+ * The host simulation (x86-64) builds this file without the PRIMASK
+ * instructions; it runs single-threaded there.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/mem_pool.h"
+
+#ifdef POOL_REPLACE_MALLOC
+#include <string.h>
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define POOL_SECTION_SRAM_L         ".pool_sram_l"
+#define POOL_SECTION_SRAM_U         ".pool_sram_u"
+
+/**
+ * @brief One size class.
+ */
+typedef struct
+{
+    uint8_t *base;
+    uint8_t *end;
+    uint32_t size;
+    uint32_t count;
+    void *free;
+    uint32_t used;
+    uint32_t high_water;
+    uint32_t empty;
+} pool_class_t;
+
+/* Block storage and the class table; a size that is not a multiple of
+ * POOL_ALIGN or an empty class fails on pool_check_<size>_<count> */
+#define POOL_X_STORAGE(a, size, count, region) \
+    typedef char pool_check_##size##_##count[(((size) >= POOL_ALIGN) && (((size) % POOL_ALIGN) == 0U) && \
+                                              ((count) > 0U)) ? 1 : -1]; \
+    static uint64_t s_pool_##size##_##count[((size) / 8U) * (count)] \
+        __attribute__((section(POOL_SECTION_##region), aligned(POOL_ALIGN)));
+#define POOL_X_CLASS(a, size, count, region) \
+    { (uint8_t *)s_pool_##size##_##count, (uint8_t *)s_pool_##size##_##count + sizeof(s_pool_##size##_##count), \
+      (size), (count), NULL, 0U, 0U, 0U },
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static uint32_t pool_mask(void);
+static void pool_unmask(uint32_t primask);
+static pool_class_t *pool_find(const void *block);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+POOL_CLASSES(POOL_X_STORAGE, 0)
+
+static pool_class_t s_pool_class[POOL_CLASS_COUNT] =
+{
+    POOL_CLASSES(POOL_X_CLASS, 0)
+};
+
+static bool s_pool_ready = false;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t pool_mask(void)
+{
+    uint32_t primask = 0U;
+
+#if !defined(__x86_64__)
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+#endif
+
+    return primask;
+}
+
+static void pool_unmask(uint32_t primask)
+{
+#if !defined(__x86_64__)
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+
+static pool_class_t *pool_find(const void *block)
+{
+    const uint8_t *addr = (const uint8_t *)block;
+    uint32_t i;
+
+    for (i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        if ((addr >= s_pool_class[i].base) && (addr < s_pool_class[i].end))
+        {
+            if ((((uint32_t)(addr - s_pool_class[i].base)) % s_pool_class[i].size) != 0U)
+            {
+                return NULL;
+            }
+            return &s_pool_class[i];
+        }
+    }
+
+    return NULL;
+}
+
+POOL_STATUS_t POOL_Init(void)
+{
+    uint32_t primask;
+    uint32_t i;
+    uint32_t n;
+    uint8_t *block;
+
+    for (i = 1U; i < POOL_CLASS_COUNT; i++)
+    {
+        if (s_pool_class[i].size <= s_pool_class[i - 1U].size)
+        {
+            return POOL_STATUS_ERROR;
+        }
+    }
+
+    primask = pool_mask();
+
+    for (i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        pool_class_t *cls = &s_pool_class[i];
+
+        /* Link every block to the next, the first one ends up at the head */
+        cls->free = NULL;
+        block = cls->end;
+        for (n = 0U; n < cls->count; n++)
+        {
+            block -= cls->size;
+            *(void **)block = cls->free;
+            cls->free = block;
+        }
+        cls->used = 0U;
+        cls->high_water = 0U;
+        cls->empty = 0U;
+    }
+    s_pool_ready = true;
+
+    pool_unmask(primask);
+
+    return POOL_STATUS_SUCCESS;
+}
+
+void *POOL_Alloc(uint32_t size)
+{
+    void *block = NULL;
+    uint32_t primask;
+    uint32_t i;
+
+    if ((size == 0U) || (!s_pool_ready && (POOL_Init() != POOL_STATUS_SUCCESS)))
+    {
+        return NULL;
+    }
+
+    primask = pool_mask();
+
+    for (i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        pool_class_t *cls = &s_pool_class[i];
+
+        if (cls->size < size)
+        {
+            continue;
+        }
+        if (cls->free == NULL)
+        {
+            cls->empty++;
+            continue;
+        }
+
+        block = cls->free;
+        cls->free = *(void **)block;
+        cls->used++;
+        if (cls->used > cls->high_water)
+        {
+            cls->high_water = cls->used;
+        }
+        break;
+    }
+
+    pool_unmask(primask);
+
+    return block;
+}
+
+POOL_STATUS_t POOL_Free(void *block)
+{
+    pool_class_t *cls;
+    uint32_t primask;
+
+    if (block == NULL)
+    {
+        return POOL_STATUS_SUCCESS;
+    }
+
+    cls = pool_find(block);
+    if (cls == NULL)
+    {
+        return POOL_STATUS_ERROR;
+    }
+
+    primask = pool_mask();
+
+    /* Double free: nothing out of the class, or the block just freed */
+    if ((cls->used == 0U) || (cls->free == block))
+    {
+        pool_unmask(primask);
+        return POOL_STATUS_ERROR;
+    }
+
+    *(void **)block = cls->free;
+    cls->free = block;
+    cls->used--;
+
+    pool_unmask(primask);
+
+    return POOL_STATUS_SUCCESS;
+}
+
+uint32_t POOL_BlockSize(const void *block)
+{
+    const pool_class_t *cls = pool_find(block);
+
+    return (cls != NULL) ? cls->size : 0U;
+}
+
+POOL_STATUS_t POOL_GetStats(uint8_t index, pool_stats_t *stats)
+{
+    uint32_t primask;
+
+    if ((index >= POOL_CLASS_COUNT) || (stats == NULL))
+    {
+        return POOL_STATUS_ERROR;
+    }
+
+    primask = pool_mask();
+
+    stats->block_size = s_pool_class[index].size;
+    stats->blocks = s_pool_class[index].count;
+    stats->used = s_pool_class[index].used;
+    stats->high_water = s_pool_class[index].high_water;
+    stats->empty = s_pool_class[index].empty;
+
+    pool_unmask(primask);
+
+    return POOL_STATUS_SUCCESS;
+}
+
+void POOL_ResetStats(void)
+{
+    uint32_t primask = pool_mask();
+    uint32_t i;
+
+    for (i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        s_pool_class[i].high_water = s_pool_class[i].used;
+        s_pool_class[i].empty = 0U;
+    }
+
+    pool_unmask(primask);
+}
+
+#ifdef POOL_REPLACE_MALLOC
+
+/* newlib reentrant entry points; the reent pointer is not needed */
+struct _reent;
+
+void *malloc(size_t size)
+{
+    return POOL_Alloc((uint32_t)size);
+}
+
+void free(void *ptr)
+{
+    (void)POOL_Free(ptr);
+}
+
+void *calloc(size_t n, size_t size)
+{
+    void *block;
+
+    if ((size != 0U) && (n > (0xFFFFFFFFU / size)))
+    {
+        return NULL;
+    }
+
+    block = POOL_Alloc((uint32_t)(n * size));
+    if (block != NULL)
+    {
+        memset(block, 0, n * size);
+    }
+
+    return block;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    uint32_t old_size;
+    void *block;
+
+    if (ptr == NULL)
+    {
+        return POOL_Alloc((uint32_t)size);
+    }
+    if (size == 0U)
+    {
+        (void)POOL_Free(ptr);
+        return NULL;
+    }
+
+    old_size = POOL_BlockSize(ptr);
+    if (size <= old_size)
+    {
+        return ptr;
+    }
+
+    block = POOL_Alloc((uint32_t)size);
+    if (block != NULL)
+    {
+        memcpy(block, ptr, old_size);
+        (void)POOL_Free(ptr);
+    }
+
+    return block;
+}
+
+void *_malloc_r(struct _reent *r, size_t size)
+{
+    (void)r;
+    return malloc(size);
+}
+
+void _free_r(struct _reent *r, void *ptr)
+{
+    (void)r;
+    free(ptr);
+}
+
+void *_calloc_r(struct _reent *r, size_t n, size_t size)
+{
+    (void)r;
+    return calloc(n, size);
+}
+
+void *_realloc_r(struct _reent *r, void *ptr, size_t size)
+{
+    (void)r;
+    return realloc(ptr, size);
+}
+
+#endif /* POOL_REPLACE_MALLOC */
@@ -0,0 +1,477 @@
+/**
+ * @file power_mgr.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Low-power mode manager implementation.
+ * @version 0.1
+ * @date 2025-11-05
+ *
+ * PWR_Idle() runs with PRIMASK set from the mode choice to the restored
+ * clock profile: WFI still wakes on a pending enabled interrupt, but its
+ * handler only runs once interrupts are enabled again at the end.
+ *
+ * VLP entry order (RUN only): RCCR to SIRC, VCCR to SIRC, SPLL/FIRC/SOSC
+ * off, then RUNM = VLPR (VLPW) or STOPM = VLPS. Exit is the reverse: back to
+ * RUN, sources on in SOSC, FIRC, SPLL order (SPLL runs from SOSC), then the
+ * saved RCCR. The exit path is timed in two parts, at the VLP core clock up
+ * to the RCCR switch and at the restored core clock after it.
+ *
+ * Every clock switch is confirmed in CSR: entry goes no further than SIRC
+ * until CSR shows a core clock within the VLP limit, and exit writes the
+ * saved RCCR back word for word and waits until CSR reports it.
+ *
+ * The host simulation (x86-64) builds this file with the PRIMASK and WFI
+ * instructions left out; the register sequence is the same.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/power_mgr.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/cycle_counter.h"
+#include "../driver/inc/reg_access.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+#include "../include/s32_core_cm4.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define PWR_TIMEOUT                 10000U
+
+/* SMC PMCTRL/STOPCTRL encodings */
+#define PWR_RUNM_RUN                0U
+#define PWR_RUNM_VLPR               2U
+#define PWR_STOPM_STOP              0U
+#define PWR_STOPM_VLPS              2U
+#define PWR_STOPO_STOP1             1U
+
+/* SMC PMSTAT values */
+#define PWR_PMSTAT_RUN              0x01U
+#define PWR_PMSTAT_VLPR             0x04U
+
+#define PWR_SOURCE_BIT(src)         (1UL << (uint32_t)(src))
+
+/* RCCR fields CSR reports once a switch has completed (same layout) */
+#define PWR_CCR_MASK                (SCG_CSR_SCS_MASK | SCG_CSR_DIVCORE_MASK | SCG_CSR_DIVBUS_MASK | \
+                                     SCG_CSR_DIVSLOW_MASK)
+
+#if !defined(__x86_64__)
+#define PWR_IRQ_DISABLE()           DISABLE_INTERRUPTS()
+#define PWR_IRQ_ENABLE()            ENABLE_INTERRUPTS()
+#define PWR_WFI()                   __asm volatile ("dsb\n\twfi\n\tisb" : : : "memory")
+#else
+#define PWR_IRQ_DISABLE()
+#define PWR_IRQ_ENABLE()
+#define PWR_WFI()
+#endif
+
+/**
+ * @brief RUN clock profile saved across a VLP mode.
+ *
+ * rccr     RCCR before entry.
+ * sources  Enabled SOSC/FIRC/SPLL, one PWR_SOURCE_BIT() each.
+ * core_hz  Core clock of rccr.
+ */
+typedef struct
+{
+    uint32_t rccr;
+    uint32_t sources;
+    uint32_t core_hz;
+} pwr_profile_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void pwr_save_profile(pwr_profile_t *profile);
+static PWR_STATUS_t pwr_enter_vlp_clocks(void);
+static PWR_STATUS_t pwr_restore_sources(const pwr_profile_t *profile);
+static PWR_STATUS_t pwr_restore_rccr(const pwr_profile_t *profile);
+static PWR_STATUS_t pwr_set_run_mode(uint32_t runm, uint32_t pmstat);
+static bool pwr_wait_csr(uint32_t ccr);
+static void pwr_wait_for_interrupt(bool deep);
+static uint32_t pwr_cycles_to_ns(uint32_t cycles, uint32_t hz);
+static void pwr_record(PWR_MODE_t mode, bool ok, bool aborted, uint32_t ns);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+/* SIRC 8 MHz: 4 MHz core and bus, 1 MHz flash; first in RUN, then for VLPR */
+static scg_config_struct_t s_pwr_sirc_run =
+{
+    SCG_RUN_MODE, SCG_SIRC_CLK, SCG_DIV_CORE_BY_2, SCG_DIV_BUS_BY_1, SCG_DIV_SLOW_BY_4
+};
+static scg_config_struct_t s_pwr_sirc_vlpr =
+{
+    SCG_VLPR_MODE, SCG_SIRC_CLK, SCG_DIV_CORE_BY_2, SCG_DIV_BUS_BY_1, SCG_DIV_SLOW_BY_4
+};
+
+/* Sources that must be off in VLP modes, in the order they are enabled again */
+static const SCG_CLOCK_SOURCE_t s_pwr_fast_sources[] = { SCG_SOSC_CLK, SCG_FIRC_CLK, SCG_SPLL_CLK };
+
+static pwr_constraint_t *s_pwr_constraints = NULL;
+static bool s_pwr_vlp_allowed = false;
+static pwr_mode_stats_t s_pwr_stats[PWR_MODE_COUNT];
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void pwr_save_profile(pwr_profile_t *profile)
+{
+    profile->rccr = IP_SCG->RCCR;
+    profile->sources = 0U;
+    profile->core_hz = SCG_GetCoreClock();
+
+    if ((IP_SCG->SOSCCSR & SCG_SOSCCSR_SOSCEN_MASK) != 0U)
+    {
+        profile->sources |= PWR_SOURCE_BIT(SCG_SOSC_CLK);
+    }
+    if ((IP_SCG->FIRCCSR & SCG_FIRCCSR_FIRCEN_MASK) != 0U)
+    {
+        profile->sources |= PWR_SOURCE_BIT(SCG_FIRC_CLK);
+    }
+    if ((IP_SCG->SPLLCSR & SCG_SPLLCSR_SPLLEN_MASK) != 0U)
+    {
+        profile->sources |= PWR_SOURCE_BIT(SCG_SPLL_CLK);
+    }
+}
+
+/**
+ * @brief Run from SIRC and stop the sources VLPR/VLPS do not allow.
+ *
+ * A source cannot be disabled while it clocks the system, so RCCR moves to
+ * SIRC first. SPLL goes before SOSC, its reference. Nothing is stopped, and
+ * VLPR is not requested, unless CSR shows SIRC with a core clock within
+ * PWR_VLP_CORE_HZ: VLPR above it is outside the specification.
+ */
+static PWR_STATUS_t pwr_enter_vlp_clocks(void)
+{
+    if ((SCG_SetSystemClockConfig(&s_pwr_sirc_run) != SCG_STATUS_SUCCESS) ||
+        (SCG_SetSystemClockConfig(&s_pwr_sirc_vlpr) != SCG_STATUS_SUCCESS))
+    {
+        return PWR_STATUS_TIMEOUT;
+    }
+
+    if (((IP_SCG->CSR & SCG_CSR_SCS_MASK) != SCG_CSR_SCS(SCG_SIRC_CLK)) ||
+        (SCG_GetCoreClock() > PWR_VLP_CORE_HZ))
+    {
+        return PWR_STATUS_ERROR;
+    }
+
+    REG_MODIFY(IP_SCG->SPLLCSR, SCG_SPLLCSR, (SPLLEN, 0U));
+    REG_MODIFY(IP_SCG->FIRCCSR, SCG_FIRCCSR, (FIRCEN, 0U));
+    REG_MODIFY(IP_SCG->SOSCCSR, SCG_SOSCCSR, (SOSCEN, 0U));
+
+    return PWR_STATUS_SUCCESS;
+}
+
+static PWR_STATUS_t pwr_restore_sources(const pwr_profile_t *profile)
+{
+    PWR_STATUS_t result = PWR_STATUS_SUCCESS;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(s_pwr_fast_sources) / sizeof(s_pwr_fast_sources[0])); i++)
+    {
+        if (((profile->sources & PWR_SOURCE_BIT(s_pwr_fast_sources[i])) != 0U) &&
+            (SCG_SourceInit(s_pwr_fast_sources[i]) != SCG_STATUS_SUCCESS))
+        {
+            result = PWR_STATUS_TIMEOUT;
+        }
+    }
+
+    return result;
+}
+
+/* The saved word as it was, then CSR must report all of it */
+static PWR_STATUS_t pwr_restore_rccr(const pwr_profile_t *profile)
+{
+    IP_SCG->RCCR = profile->rccr;
+
+    return pwr_wait_csr(profile->rccr) ? PWR_STATUS_SUCCESS : PWR_STATUS_TIMEOUT;
+}
+
+static PWR_STATUS_t pwr_set_run_mode(uint32_t runm, uint32_t pmstat)
+{
+    uint32_t timeOut = 0U;
+
+    REG_MODIFY(IP_SMC->PMCTRL, SMC_PMCTRL, (RUNM, runm));
+
+    while ((timeOut < PWR_TIMEOUT) && ((IP_SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) != pmstat))
+    {
+        ++timeOut;
+    }
+
+    return (timeOut < PWR_TIMEOUT) ? PWR_STATUS_SUCCESS : PWR_STATUS_TIMEOUT;
+}
+
+static bool pwr_wait_csr(uint32_t ccr)
+{
+    uint32_t timeOut = 0U;
+
+    while ((timeOut < PWR_TIMEOUT) && ((IP_SCG->CSR & PWR_CCR_MASK) != (ccr & PWR_CCR_MASK)))
+    {
+        ++timeOut;
+    }
+
+    return timeOut < PWR_TIMEOUT;
+}
+
+static void pwr_wait_for_interrupt(bool deep)
+{
+    if (deep)
+    {
+        S32_SCB->SCR |= S32_SCB_SCR_SLEEPDEEP_MASK;
+        /* The STOPM write must have completed before WFI */
+        (void)IP_SMC->PMCTRL;
+    }
+    else
+    {
+        S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+    }
+
+    PWR_WFI();
+
+    S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+}
+
+static uint32_t pwr_cycles_to_ns(uint32_t cycles, uint32_t hz)
+{
+    return (hz != 0U) ? (uint32_t)(((uint64_t)cycles * 1000000000ULL) / hz) : 0U;
+}
+
+static void pwr_record(PWR_MODE_t mode, bool ok, bool aborted, uint32_t ns)
+{
+    pwr_mode_stats_t *stats = &s_pwr_stats[mode];
+
+    stats->entries++;
+
+    if (!ok)
+    {
+        stats->failures++;
+        return;
+    }
+    if (aborted)
+    {
+        stats->aborts++;
+    }
+
+    stats->last_ns = ns;
+    if (ns > stats->max_ns)
+    {
+        stats->max_ns = ns;
+    }
+}
+
+PWR_STATUS_t PWR_Init(void)
+{
+    /* Write-once: later writes are ignored, so HSRUN (dfs_governor) too */
+    IP_SMC->PMPROT = SMC_PMPROT_AVLP_MASK | SMC_PMPROT_AHSRUN_MASK;
+    s_pwr_vlp_allowed = ((IP_SMC->PMPROT & SMC_PMPROT_AVLP_MASK) != 0U);
+
+    /* VLPR/VLPS need the low-power bias */
+    REG_MODIFY(IP_PMC->REGSC, PMC_REGSC, (BIASEN, 1U));
+
+    CYCLE_Init();
+    PWR_ResetStats();
+
+    return s_pwr_vlp_allowed ? PWR_STATUS_SUCCESS : PWR_STATUS_ERROR;
+}
+
+PWR_STATUS_t PWR_RegisterConstraint(pwr_constraint_t *constraint)
+{
+    pwr_constraint_t *it;
+
+    if ((constraint == NULL) || ((uint32_t)constraint->deepest >= (uint32_t)PWR_MODE_COUNT))
+    {
+        return PWR_STATUS_ERROR;
+    }
+
+    for (it = s_pwr_constraints; it != NULL; it = it->next)
+    {
+        if (it == constraint)
+        {
+            return PWR_STATUS_ERROR;
+        }
+    }
+
+    constraint->active = false;
+    constraint->next = s_pwr_constraints;
+    s_pwr_constraints = constraint;
+
+    return PWR_STATUS_SUCCESS;
+}
+
+void PWR_SetConstraintActive(pwr_constraint_t *constraint, bool active)
+{
+    constraint->active = active;
+}
+
+PWR_MODE_t PWR_GetAllowedMode(void)
+{
+    PWR_MODE_t mode = PWR_MODE_VLPS;
+    const pwr_constraint_t *it;
+
+    for (it = s_pwr_constraints; it != NULL; it = it->next)
+    {
+        PWR_MODE_t limit = it->deepest;
+
+        if (!it->active)
+        {
+            continue;
+        }
+
+        /* A bus clock need rules out the stop modes, a fast one VLPR too */
+        if ((it->min_bus_hz != 0U) && (limit > PWR_MODE_VLPW))
+        {
+            limit = PWR_MODE_VLPW;
+        }
+        if ((it->min_bus_hz > PWR_VLP_BUS_HZ) && (limit > PWR_MODE_WAIT))
+        {
+            limit = PWR_MODE_WAIT;
+        }
+
+        if (limit < mode)
+        {
+            mode = limit;
+        }
+    }
+
+    if (!s_pwr_vlp_allowed)
+    {
+        if (mode == PWR_MODE_VLPS)
+        {
+            mode = PWR_MODE_STOP;
+        }
+        else if (mode == PWR_MODE_VLPW)
+        {
+            mode = PWR_MODE_WAIT;
+        }
+        else
+        {
+            /* Not a VLP mode */
+        }
+    }
+
+    return mode;
+}
+
+PWR_MODE_t PWR_Idle(void)
+{
+    PWR_MODE_t mode = PWR_GetAllowedMode();
+    pwr_profile_t profile;
+    PWR_STATUS_t result = PWR_STATUS_SUCCESS;
+    bool vlp;
+    bool aborted = false;
+    uint32_t wake = 0U;
+    uint32_t switched = 0U;
+    uint32_t done;
+
+    if (mode == PWR_MODE_RUN)
+    {
+        return mode;
+    }
+
+    PWR_IRQ_DISABLE();
+
+    /* VLPR and the stop modes are entered from RUN only */
+    if ((IP_SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) != PWR_PMSTAT_RUN)
+    {
+        mode = PWR_MODE_WAIT;
+    }
+
+    vlp = (mode == PWR_MODE_VLPW) || (mode == PWR_MODE_VLPS);
+    pwr_save_profile(&profile);
+
+    if (vlp)
+    {
+        result = pwr_enter_vlp_clocks();
+    }
+    if ((result == PWR_STATUS_SUCCESS) && (mode == PWR_MODE_VLPW))
+    {
+        result = pwr_set_run_mode(PWR_RUNM_VLPR, PWR_PMSTAT_VLPR);
+    }
+
+    if (result == PWR_STATUS_SUCCESS)
+    {
+        if (mode == PWR_MODE_STOP)
+        {
+            REG_MODIFY(IP_SMC->STOPCTRL, SMC_STOPCTRL, (STOPO, PWR_STOPO_STOP1));
+            REG_MODIFY(IP_SMC->PMCTRL, SMC_PMCTRL, (STOPM, PWR_STOPM_STOP));
+        }
+        else if (mode == PWR_MODE_VLPS)
+        {
+            REG_MODIFY(IP_SMC->PMCTRL, SMC_PMCTRL, (STOPM, PWR_STOPM_VLPS));
+        }
+        else
+        {
+            /* WAIT/VLPW: sleep, not deep sleep */
+        }
+
+        pwr_wait_for_interrupt(mode >= PWR_MODE_STOP);
+        wake = CYCLE_Get();
+
+        aborted = (mode == PWR_MODE_VLPS) && ((IP_SMC->PMCTRL & SMC_PMCTRL_VLPSA_MASK) != 0U);
+    }
+
+    if (mode == PWR_MODE_VLPW)
+    {
+        (void)pwr_set_run_mode(PWR_RUNM_RUN, PWR_PMSTAT_RUN);
+    }
+    if (vlp)
+    {
+        if (pwr_restore_sources(&profile) != PWR_STATUS_SUCCESS)
+        {
+            result = PWR_STATUS_TIMEOUT;
+        }
+        switched = CYCLE_Get();
+        if (pwr_restore_rccr(&profile) != PWR_STATUS_SUCCESS)
+        {
+            result = PWR_STATUS_TIMEOUT;
+        }
+    }
+    done = CYCLE_Get();
+
+    if (!vlp)
+    {
+        switched = wake;
+    }
+
+    pwr_record(mode, result == PWR_STATUS_SUCCESS, aborted,
+               pwr_cycles_to_ns(switched - wake, PWR_VLP_CORE_HZ) +
+               pwr_cycles_to_ns(done - switched, profile.core_hz));
+
+    PWR_IRQ_ENABLE();
+
+    return mode;
+}
+
+PWR_STATUS_t PWR_GetStats(PWR_MODE_t mode, pwr_mode_stats_t *stats)
+{
+    if (((uint32_t)mode >= (uint32_t)PWR_MODE_COUNT) || (stats == NULL))
+    {
+        return PWR_STATUS_ERROR;
+    }
+
+    *stats = s_pwr_stats[mode];
+
+    return PWR_STATUS_SUCCESS;
+}
+
+void PWR_ResetStats(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (uint32_t)PWR_MODE_COUNT; i++)
+    {
+        s_pwr_stats[i].entries = 0U;
+        s_pwr_stats[i].aborts = 0U;
+        s_pwr_stats[i].failures = 0U;
+        s_pwr_stats[i].last_ns = 0U;
+        s_pwr_stats[i].max_ns = 0U;
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * @file stack_monitor.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Stack painting and high-water monitoring implementation.
+ * @version 0.1
+ * @date 2025-11-12
+ *
+ * A region keeps the number of untouched words above its base (the mark)
+ * and the scan position of the running round. Only STK_Poll() writes them
+ * and a word read is atomic, so the scan runs with interrupts enabled; a
+ * stack growing past the cursor meanwhile is found in a later round.
+ *
+ * STK_Init() paints the main stack with its own loop and calls nothing, so
+ * every word below the SP it reads is free while interrupts are masked.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/stack_monitor.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/**
+ * @brief One monitored stack.
+ */
+typedef struct
+{
+    volatile uint32_t *base;
+    uint32_t words;
+    volatile uint32_t mark;
+    uint32_t cursor;
+} stk_region_t;
+
+/* Linker script: main stack */
+extern uint32_t __StackLimit[];
+extern uint32_t __StackTop[];
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void stk_paint(volatile uint32_t *from, volatile uint32_t *to);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static stk_region_t s_stk_region[STK_MAX_REGIONS];
+static uint8_t s_stk_count = 0U;
+static uint8_t s_stk_current = 0U;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void stk_paint(volatile uint32_t *from, volatile uint32_t *to)
+{
+    while (from < to)
+    {
+        *from = STK_PAINT_PATTERN;
+        from++;
+    }
+}
+
+void STK_Init(void)
+{
+    volatile uint32_t *from = (volatile uint32_t *)__StackLimit;
+    volatile uint32_t *sp;
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+
+    /* Inline, a call would push below sp */
+    while (from < sp)
+    {
+        *from = STK_PAINT_PATTERN;
+        from++;
+    }
+
+    s_stk_region[STK_MAIN].base = (volatile uint32_t *)__StackLimit;
+    s_stk_region[STK_MAIN].words = (uint32_t)(__StackTop - __StackLimit);
+    s_stk_region[STK_MAIN].mark = (uint32_t)(sp - (volatile uint32_t *)__StackLimit);
+    s_stk_region[STK_MAIN].cursor = 0U;
+    if (s_stk_count == 0U)
+    {
+        s_stk_count = 1U;
+    }
+    s_stk_current = STK_MAIN;
+
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+STK_STATUS_t STK_Register(void *base, uint32_t size, uint8_t *index)
+{
+    stk_region_t *region;
+
+    if ((base == NULL) || (((uint32_t)base & 3U) != 0U) || (size < 4U) || ((size & 3U) != 0U))
+    {
+        return STK_STATUS_ERROR;
+    }
+
+    /* Region STK_MAIN stays for STK_Init() */
+    if (s_stk_count == 0U)
+    {
+        s_stk_count = 1U;
+    }
+    if (s_stk_count >= STK_MAX_REGIONS)
+    {
+        return STK_STATUS_ERROR;
+    }
+
+    region = &s_stk_region[s_stk_count];
+    region->base = (volatile uint32_t *)base;
+    region->words = size / 4U;
+    stk_paint(region->base, region->base + region->words);
+    region->mark = region->words;
+    region->cursor = 0U;
+
+    if (index != NULL)
+    {
+        *index = s_stk_count;
+    }
+    s_stk_count++;
+
+    return STK_STATUS_SUCCESS;
+}
+
+bool STK_Poll(uint32_t words)
+{
+    bool round = false;
+    uint8_t visited = 0U;
+
+    while ((words > 0U) && (s_stk_count > 0U))
+    {
+        stk_region_t *region = &s_stk_region[s_stk_current];
+
+        /* Empty until STK_Init() */
+        if (region->words != 0U)
+        {
+            while ((words > 0U) && (region->cursor < region->mark))
+            {
+                if (region->base[region->cursor] != STK_PAINT_PATTERN)
+                {
+                    region->mark = region->cursor;
+                    break;
+                }
+                region->cursor++;
+                words--;
+            }
+            if (words == 0U)
+            {
+                break;
+            }
+            region->cursor = 0U;
+        }
+
+        s_stk_current++;
+        if (s_stk_current >= s_stk_count)
+        {
+            s_stk_current = 0U;
+            round = true;
+        }
+
+        /* Everything scanned up to its mark within this call */
+        if (++visited >= s_stk_count)
+        {
+            break;
+        }
+    }
+
+    return round;
+}
+
+STK_STATUS_t STK_GetUsage(uint8_t index, stk_usage_t *usage)
+{
+    uint32_t mark;
+
+    if ((index >= s_stk_count) || (usage == NULL))
+    {
+        return STK_STATUS_ERROR;
+    }
+
+    mark = s_stk_region[index].mark;
+    usage->size = s_stk_region[index].words * 4U;
+    usage->free_min = mark * 4U;
+    usage->used_max = usage->size - usage->free_min;
+
+    return STK_STATUS_SUCCESS;
+}
@@ -0,0 +1,238 @@
+/**
+ * @file wdog_service.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Task liveness aggregation over the WDOG/EWM implementation.
+ * @version 0.1
+ * @date 2025-11-07
+ *
+ * The fast path of WDS_CheckIn() is the bit-band store and one load of the
+ * word. The refresh decision (all bits set, window open, clear the word) is
+ * taken with PRIMASK set, so a check-in lands either before the clear and
+ * counts for the period that ends, or after it and counts for the next one.
+ *
+ * The pre-reset record carries a magic: .noinit is zeroed on power-on, but
+ * an image with a different record layout may have written it before a
+ * software or watchdog reset.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/wdog_service.h"
+#include "../driver/inc/Driver_WDOG.h"
+#include "../driver/inc/Driver_EWM.h"
+#include "../driver/inc/Driver_NVIC.h"
+#include "../driver/inc/cycle_counter.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define WDS_RECORD_MAGIC            0x31534457U     /* "WDS1" */
+
+/* SRAM_U bit-band region and its alias, one word per bit */
+#define WDS_BITBAND_START           0x20000000U
+#define WDS_BITBAND_END             0x200FFFFFU
+#define WDS_BITBAND_ALIAS           0x22000000U
+#define WDS_BITBAND(addr, bit)      (*(volatile uint32_t *)(WDS_BITBAND_ALIAS + \
+                                      (((uint32_t)(addr) - WDS_BITBAND_START) << 5U) + ((uint32_t)(bit) << 2U)))
+
+/**
+ * @brief Pre-reset record as kept in .noinit.
+ */
+typedef struct
+{
+    uint32_t magic;
+    wds_record_t record;
+} wds_noinit_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static uint32_t wds_mask(void);
+static void wds_unmask(uint32_t primask);
+static bool wds_refresh(void);
+static void wds_save_record(WDS_SOURCE_t source);
+void WDOG_EWM_IRQHandler(void);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static volatile uint32_t s_wds_checkin = 0U;
+static volatile uint32_t s_wds_expected = 0U;
+static volatile uint32_t s_wds_refreshes = 0U;
+static bool s_wds_ewm = false;
+
+static wds_noinit_t s_wds_noinit __attribute__((section(".noinit")));
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t wds_mask(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    return primask;
+}
+
+static void wds_unmask(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+static bool wds_refresh(void)
+{
+    uint32_t primask = wds_mask();
+    uint32_t expected = s_wds_expected;
+    bool done = false;
+
+    if ((expected != 0U) && ((s_wds_checkin & expected) == expected) && WDOG_IsWindowOpen())
+    {
+        s_wds_checkin = 0U;
+        WDOG_Refresh();
+        if (s_wds_ewm)
+        {
+            EWM_Refresh();
+        }
+        s_wds_refreshes++;
+        done = true;
+    }
+
+    wds_unmask(primask);
+
+    return done;
+}
+
+static void wds_save_record(WDS_SOURCE_t source)
+{
+    if (s_wds_noinit.magic != WDS_RECORD_MAGIC)
+    {
+        s_wds_noinit.record.count = 0U;
+    }
+
+    s_wds_noinit.record.cycles = CYCLE_Get();
+    s_wds_noinit.record.checkin = s_wds_checkin;
+    s_wds_noinit.record.expected = s_wds_expected;
+    s_wds_noinit.record.source = source;
+    s_wds_noinit.record.count++;
+    s_wds_noinit.magic = WDS_RECORD_MAGIC;
+}
+
+/**
+ * @brief Pre-reset hook, shared by the WDOG and the EWM.
+ *
+ * The WDOG resets 128 bus clocks after raising its flag, the record is
+ * written first and nothing else is done. The EWM does not reset: its
+ * interrupt is switched off so it is recorded once.
+ */
+void WDOG_EWM_IRQHandler(void)
+{
+    if (WDOG_IsInterruptPending())
+    {
+        wds_save_record(WDS_SOURCE_WDOG);
+        __asm volatile ("dsb" : : : "memory");
+        return;
+    }
+
+    wds_save_record(WDS_SOURCE_EWM);
+    EWM_SetInterrupt(false);
+}
+
+WDS_STATUS_t WDS_Init(uint32_t expected, bool ewm)
+{
+    uint32_t addr = (uint32_t)&s_wds_checkin;
+
+    if ((expected == 0U) || (addr < WDS_BITBAND_START) || (addr > WDS_BITBAND_END))
+    {
+        return WDS_STATUS_ERROR;
+    }
+
+    if ((CYCLE_DWT_CTRL & CYCLE_DWT_CTRL_CYCCNTENA) == 0U)
+    {
+        CYCLE_Init();
+    }
+
+    s_wds_checkin = 0U;
+    s_wds_refreshes = 0U;
+    s_wds_ewm = ewm && EWM_IsEnabled();
+    s_wds_expected = expected;
+
+    (void)NVIC_SetPriority(WDOG_EWM_IRQn, 0U, 0U);
+    (void)NVIC_EnableIRQ(WDOG_EWM_IRQn);
+
+    return WDS_STATUS_SUCCESS;
+}
+
+void WDS_CheckIn(uint8_t task)
+{
+    uint32_t expected = s_wds_expected;
+
+    if (task >= WDS_MAX_TASKS)
+    {
+        return;
+    }
+
+    WDS_BITBAND(&s_wds_checkin, task) = 1U;
+    /* The alias write reaches the word before it is read back */
+    __asm volatile ("dmb" : : : "memory");
+
+    if ((expected != 0U) && ((s_wds_checkin & expected) == expected))
+    {
+        (void)wds_refresh();
+    }
+}
+
+bool WDS_Poll(void)
+{
+    return wds_refresh();
+}
+
+void WDS_SetExpected(uint32_t expected)
+{
+    uint32_t primask = wds_mask();
+
+    s_wds_expected = expected;
+
+    wds_unmask(primask);
+
+    /* Dropping the last missing task completes the period */
+    (void)wds_refresh();
+}
+
+uint32_t WDS_GetCheckins(void)
+{
+    return s_wds_checkin;
+}
+
+uint32_t WDS_GetRefreshCount(void)
+{
+    return s_wds_refreshes;
+}
+
+bool WDS_GetResetRecord(wds_record_t *record)
+{
+    if ((record == NULL) || (s_wds_noinit.magic != WDS_RECORD_MAGIC) ||
+        (s_wds_noinit.record.source == WDS_SOURCE_NONE))
+    {
+        return false;
+    }
+
+    *record = s_wds_noinit.record;
+
+    return true;
+}
+
+void WDS_ClearResetRecord(void)
+{
+    if (s_wds_noinit.magic == WDS_RECORD_MAGIC)
+    {
+        s_wds_noinit.record.source = WDS_SOURCE_NONE;
+    }
+}
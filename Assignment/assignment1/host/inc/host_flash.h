@@ -0,0 +1,105 @@
+/**
+ * @file host_flash.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Simulated NOR flash array for the KVS, with power-cut injection.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * HOSTFLASH_Init() fills a kvs_flash_t whose read/program/erase work on a
+ * RAM array with D-Flash semantics: erase sets a sector to 0xFF, program
+ * only clears bits. Every program and erase is one operation.
+ *
+ * HOSTFLASH_CutAfter(flash, n) lets n more operations complete and tears the
+ * next one: a program writes a prefix of its data plus one phrase with only
+ * some bits cleared, an erase sets only some bits of the sector. From then on
+ * the power is off and every call fails until HOSTFLASH_PowerOn(), after
+ * which the array is remounted as the next boot would:
+ *
+ *   HOSTFLASH_CutAfter(&flash, n);
+ *   run_workload(&kvs);                 (stops once flash.cut is set)
+ *   HOSTFLASH_PowerOn(&flash);
+ *   KVS_Mount(&kvs, &backend, ...);
+ *
+ * Torn contents come from a seeded generator, so a cut point replays the
+ * same way on every run. A program over bytes that are not erased is
+ * counted in overwrites: the KVS must never do it.
+ */
+
+#ifndef HOST_FLASH_H_
+#define HOST_FLASH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../driver/inc/kvs.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* HOSTFLASH_CutAfter() value that never cuts */
+#define HOSTFLASH_NO_CUT            0xFFFFFFFFU
+
+/**
+ * @brief Simulated flash array. Fields other than the counters are private.
+ *
+ * mem          Array, sector_size * sector_count bytes.
+ * base         Address of mem[0] as seen by the KVS.
+ * ops          Program and erase operations started since init.
+ * overwrites   Programs that hit a byte not erased.
+ * cut          Power is off: the cut operation happened.
+ */
+typedef struct
+{
+    uint8_t *mem;
+    uint32_t base;
+    uint32_t size;
+    uint32_t sector_size;
+    uint32_t ops;
+    uint32_t overwrites;
+    uint32_t cut_at;
+    uint32_t seed;
+    bool cut;
+} hostflash_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Set up an erased array and the KVS backend that reaches it.
+ *
+ * @param flash Array state.
+ * @param mem sector_size * sector_count bytes.
+ * @param base Address the KVS sees for mem[0].
+ * @param sector_size Erase unit, multiple of KVS_PHRASE_SIZE.
+ * @param sector_count Number of sectors.
+ * @param backend Backend out, ctx = flash.
+ */
+void HOSTFLASH_Init(hostflash_t *flash, uint8_t *mem, uint32_t base, uint32_t sector_size,
+                    uint16_t sector_count, kvs_flash_t *backend);
+
+/**
+ * @brief Let ops more program/erase operations complete and tear the next.
+ *
+ * @param flash Array state.
+ * @param ops Operations to complete first, HOSTFLASH_NO_CUT for none.
+ * @param seed Seed of the torn contents.
+ */
+void HOSTFLASH_CutAfter(hostflash_t *flash, uint32_t ops, uint32_t seed);
+
+/**
+ * @brief Restore power after a cut; the array keeps its torn contents.
+ */
+void HOSTFLASH_PowerOn(hostflash_t *flash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_FLASH_H_ */
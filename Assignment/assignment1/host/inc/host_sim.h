@@ -0,0 +1,311 @@
+/**
+ * @file host_sim.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host (Linux x86-64) peripheral simulation and register access tracer.
+ * @version 0.1
+ * @date 2025-10-31
+ *
+ * Lets the drivers run unmodified in a Linux process. HOSTSIM_Init() maps
+ * simulated register memory at the real S32K144 addresses, so IP_SCG,
+ * IP_PCC_BASE, IP_PTD and the rest point at it without any change to
+ * S32K144.h or to the drivers:
+ *
+ *   0x40000000..0x400FFFFF  AIPS peripherals and GPIO
+ *   0xE0000000..0xE00FFFFF  private peripheral bus (SCB, NVIC, DWT, LMEM)
+ *
+ * Both windows stay PROT_NONE. Every driver load or store faults, is
+ * counted in the tracer, runs the behavioural model of its register and is
+ * then single-stepped with the page opened. Register contents live in a
+ * second, always-accessible mapping of the same memory, which the models
+ * and HOSTSIM_Reg() use without being traced.
+ *
+ * Behavioural models (host_sim_models.c):
+ * - SCG: a clock source sets xCSR[VLD] on the Nth read after xCSR[EN] is
+ *   set and keeps EN while it clocks the system (SEL), CSR follows the
+ *   RCCR/VCCR/HCCR of the SMC run mode once the selected source is valid.
+ * - SMC: PMPROT is write-once, PMCTRL[RUNM] moves PMSTAT between RUN and
+ *   VLPR/HSRUN (from RUN only, if PMPROT allows it). Stop modes are not
+ *   modelled.
+ * - PCC: PR is set for the modules present on the S32K144 and is read-only,
+ *   writes to absent modules are dropped.
+ * - ADC: a write to SC1[n] starts a conversion, COCO sets on the Nth read of
+ *   SC1[n] with R[n] = HOSTSIM_AdcSetInput() value, reading R[n] clears COCO.
+ * - GPIO: PSOR/PCOR/PTOR update PDOR and read as 0, PDIR returns outputs
+ *   for PDDR pins and HOSTSIM_GpioSetInput() levels for the rest.
+ * - PORT: GPCLR/GPCHR and GICLR/GICHR update the PCR halves of their enabled
+ *   pins (GPCxR skips locked pins) and read as 0.
+ * - FlexCAN: MCR[LPMACK] follows MDIS and FRZACK follows FRZ+HALT at once,
+ *   SOFTRST completes at once, IFLAG1 is write-1-to-clear. Bus traffic comes
+ *   from HOSTSIM_CanReceive(): the frame goes through the format-A RX FIFO
+ *   filter table (RXIMR/RXFGMASK) into the 6-deep FIFO (BUF5I, BUF6I at 5,
+ *   BUF7I when lost; clearing BUF5I shows the next frame), else into the
+ *   first matching empty, then full, RX mailbox (IRMQ/EACEN masks, FULL or
+ *   OVERRUN). HOSTSIM_CanTransmit() sends the TX_DATA mailbox that wins
+ *   arbitration (PRIO and ID with LPRIOEN, ID only without). Timing, error
+ *   states, remote answers and the RX FIFO DMA request are not modelled.
+ * - FTM: HOSTSIM_FtmAdvance() runs the up counter CNTIN..MOD (TOF on
+ *   every wrap) while SC[CLKS] is set. HOSTSIM_FtmSetInput() edges latch CNT
+ *   into CnV and set CHF for capture channels (ELSB:ELSA), or for dual-edge
+ *   pairs (DECAPEN) the first edge into the even and the second into the odd
+ *   channel, clearing DECAP in one-shot mode. With QDCTRL[QUADEN] channels
+ *   0/1 are phase A/B, decoded x4 (or count/direction) into CNT with QUADIR,
+ *   TOF and TOFDIR on the MOD/CNTIN wrap. TOF and CHF clear on a 0 write,
+ *   a CNT write loads CNTIN. Up-down counting (CPWMS), input filters, PWM
+ *   outputs and the DMA request are not modelled.
+ * - CRC: a DATA write with CTRL[WAS] loads the seed, otherwise its bytes
+ *   (8, 16 or 32-bit, CTRL[TOT] applied) go MSB first through the 16 or
+ *   32-bit (TCRC) shift register with GPOLY. DATA reads return the register
+ *   with CTRL[TOTR] applied. CTRL[FXOR] is not modelled.
+ * - LMEM: PCCCR[GO], PCCLCR[LGO] and PCCSAR[LGO] complete at once. A tag per
+ *   way and set holds the lines HOSTSIM_LmemFetch() allocated; INVW0/INVW1
+ *   and line invalidate/clear drop them, a line read sets PCCLCR[LCIVB] and
+ *   LCWAY for a valid line (search: by address, set/way: by CACHEADDR and
+ *   WSEL). No line is ever modified, so push does nothing.
+ * - FTFC: writing FSTAT[CCIF] runs the FCCOB command at once on a simulated
+ *   P-Flash and FlexNVM (HOSTSIM_FtfcFlash(), erased at reset): Program
+ *   Phrase (MGSTAT0 if a bit would go 0 -> 1), Erase Sector, Program
+ *   Partition (once) and Set FlexRAM (RAMRDY/EEERDY). Misaligned or
+ *   out-of-range addresses and other commands give ACCERR, FPROT/FDPROT
+ *   regions FPVIOL; ACCERR and FPVIOL are write-1-to-clear and block the
+ *   launch. FlexRAM itself lies outside the windows, so Program Section and
+ *   EEE writes cannot run on the host.
+ * - WDOG: the unlock key written to CNT sets CS[ULK] while CS[UPDATE] is
+ *   set; with ULK set a CS write takes effect at once (RCS set, ULK clear),
+ *   otherwise WIN/TOVAL/CS writes are dropped. CNT reads as 0.
+ * - NVIC: ISER/ICER and ISPR/ICPR set and clear one enable and one pending
+ *   state, which both registers of a pair read back.
+ * All other registers are plain memory.
+ *
+ * Access counts are per 32-bit register; an 8/16-bit access counts on the
+ * word holding it (the models get its byte lanes from the instruction) and a read-modify-write instruction counts as one store.
+ * Build the drivers with -O0, as for the target, to keep their loads and
+ * stores separate. Single-threaded only.
+ */
+
+#ifndef HOST_SIM_H_
+#define HOST_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Reads of xCSR after enable before VLD sets */
+#define HOSTSIM_SCG_VALID_READS         3U
+
+/* Reads of SC1[n] after the trigger before COCO sets */
+#define HOSTSIM_ADC_CONVERSION_READS    2U
+
+/**
+ * @brief Host simulation status codes.
+ *
+ * HOSTSIM_STATUS_SUCCESS  Operation completed successfully.
+ * HOSTSIM_STATUS_ERROR    Mapping or handler setup failed, or bad argument.
+ */
+typedef enum
+{
+    HOSTSIM_STATUS_SUCCESS = 0,
+    HOSTSIM_STATUS_ERROR = -1
+} HOSTSIM_STATUS_t;
+
+/**
+ * @brief Where HOSTSIM_CanReceive() put a frame.
+ *
+ * HOSTSIM_CAN_REJECTED  No filter accepted it, or the module is disabled or
+ *                       frozen: software never sees it.
+ * HOSTSIM_CAN_FIFO      Queued in the RX FIFO.
+ * HOSTSIM_CAN_MAILBOX   Stored in an RX mailbox.
+ * HOSTSIM_CAN_LOST      Accepted by the FIFO filter, but the FIFO was full
+ *                       and no mailbox took it (BUF7I set).
+ */
+typedef enum
+{
+    HOSTSIM_CAN_REJECTED = 0,
+    HOSTSIM_CAN_FIFO,
+    HOSTSIM_CAN_MAILBOX,
+    HOSTSIM_CAN_LOST
+} HOSTSIM_CAN_RX_t;
+
+/**
+ * @brief A frame on the simulated CAN bus, ID right-aligned.
+ */
+typedef struct
+{
+    uint32_t id;
+    bool ext;
+    bool remote;
+    bool fd;
+    bool brs;
+    uint8_t dlc;
+    uint8_t data[64];
+} hostsim_can_frame_t;
+
+/**
+ * @brief Access counts of one register or of all registers.
+ *
+ * loads   Driver reads.
+ * stores  Driver writes.
+ */
+typedef struct
+{
+    uint32_t loads;
+    uint32_t stores;
+} hostsim_trace_t;
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Map the register windows, install the fault handlers and reset.
+ *
+ * @return HOSTSIM_STATUS_t SUCCESS, or ERROR if an address range is taken.
+ */
+HOSTSIM_STATUS_t HOSTSIM_Init(void);
+
+/**
+ * @brief Clear all registers, load the modelled reset values, clear the trace.
+ */
+void HOSTSIM_Reset(void);
+
+/**
+ * @brief Untraced pointer to a simulated register, for test setup and checks.
+ *
+ * @param address Target address of the register.
+ * @return volatile uint32_t* Register, or NULL outside the windows.
+ */
+volatile uint32_t *HOSTSIM_Reg(uint32_t address);
+
+/**
+ * @brief Set all access counts to 0.
+ */
+void HOSTSIM_TraceReset(void);
+
+/**
+ * @brief Access counts of the register at an address.
+ *
+ * @param address Target address of the register.
+ * @param trace Counts out, 0 outside the windows.
+ */
+void HOSTSIM_TraceGet(uint32_t address, hostsim_trace_t *trace);
+
+/**
+ * @brief Access counts summed over all registers.
+ */
+void HOSTSIM_TraceTotal(hostsim_trace_t *trace);
+
+/**
+ * @brief Print every accessed register as "PERIPH+offset loads stores".
+ */
+void HOSTSIM_TraceDump(FILE *out);
+
+/**
+ * @brief Change the SCG model's reads-until-valid (0 = valid at once).
+ */
+void HOSTSIM_ScgSetValidReads(uint32_t reads);
+
+/**
+ * @brief Set the value the ADC model converts on a channel.
+ *
+ * @param instance 0 or 1.
+ * @param channel SC1[ADCH] value.
+ * @param value Conversion result.
+ * @return HOSTSIM_STATUS_t SUCCESS or ERROR.
+ */
+HOSTSIM_STATUS_t HOSTSIM_AdcSetInput(uint8_t instance, uint8_t channel, uint16_t value);
+
+/**
+ * @brief Set the levels the GPIO model returns in PDIR for input pins.
+ *
+ * @param port 0 (PTA) .. 4 (PTE).
+ * @param levels Pin levels, bit n = pin n.
+ * @return HOSTSIM_STATUS_t SUCCESS or ERROR.
+ */
+HOSTSIM_STATUS_t HOSTSIM_GpioSetInput(uint8_t port, uint32_t levels);
+
+/**
+ * @brief Put a frame on the bus of a FlexCAN instance, as received from
+ *        another node.
+ *
+ * @param instance 0..2.
+ * @param frame Frame; classic frames have dlc 0..8.
+ * @return HOSTSIM_CAN_RX_t Where the frame went.
+ */
+HOSTSIM_CAN_RX_t HOSTSIM_CanReceive(uint8_t instance, const hostsim_can_frame_t *frame);
+
+/**
+ * @brief Let a FlexCAN instance win arbitration once: the pending TX mailbox
+ *        with the lowest arbitration value is sent, its code goes back to
+ *        TX_INACTIVE and its IFLAG1 bit is set.
+ *
+ * @param instance 0..2.
+ * @param frame Sent frame out, may be NULL.
+ * @return int32_t Mailbox sent from, -1 if none is pending.
+ */
+int32_t HOSTSIM_CanTransmit(uint8_t instance, hostsim_can_frame_t *frame);
+
+/**
+ * @brief Run the counter of an FTM instance by a number of counts; nothing
+ *        happens while SC[CLKS] is 0 or the quadrature decoder is on.
+ *
+ * @param instance 0..3.
+ * @param counts Counter increments (prescaled clock ticks).
+ */
+void HOSTSIM_FtmAdvance(uint8_t instance, uint32_t counts);
+
+/**
+ * @brief Drive an FTM channel input (or quadrature phase) to a level, at the
+ *        current counter value.
+ *
+ * @param instance 0..3.
+ * @param channel 0..7; 0/1 are phase A/B with QDCTRL[QUADEN].
+ * @param level Input level; only a change is an edge.
+ * @return HOSTSIM_STATUS_t SUCCESS or ERROR.
+ */
+HOSTSIM_STATUS_t HOSTSIM_FtmSetInput(uint8_t instance, uint8_t channel, bool level);
+
+/**
+ * @brief Fetch through the LMEM code cache: with PCCCR[ENCACHE] set the line
+ *        holding an address is allocated, in a free way, else in way 0.
+ *
+ * @param address Any address of the line.
+ */
+void HOSTSIM_LmemFetch(uint32_t address);
+
+/**
+ * @brief Simulated flash behind the FTFC model, for test setup and checks.
+ *
+ * @param address P-Flash (0x00000000..) or FlexNVM (0x10000000..) address.
+ * @return uint8_t* The byte at address, NULL outside both blocks.
+ */
+uint8_t *HOSTSIM_FtfcFlash(uint32_t address);
+
+/*******************************************************************************
+ *                     Model hooks (host_sim.c -> host_sim_models.c)
+ ******************************************************************************/
+
+/* Reset values of the modelled registers, after all memory is cleared */
+void hostsim_models_reset(void);
+
+/* Before a driver load from the word at address */
+void hostsim_model_read(uint32_t address);
+
+/*
+ * After a driver store to the word at address, before = previous contents,
+ * bytes = lanes written (bit n = byte n, 0xF for a 32-bit store)
+ */
+void hostsim_model_write(uint32_t address, uint32_t before, uint32_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SIM_H_ */
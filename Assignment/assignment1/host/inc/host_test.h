@@ -0,0 +1,92 @@
+/**
+ * @file host_test.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Checks for the host driver tests (host/test/test_*.c).
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * A test is a plain program against libdrivers_host: it calls HOSTSIM_Init(),
+ * runs a driver function and checks the register contents and the access
+ * counts it left behind. A failed check prints file, line and both values
+ * and the test goes on; HOSTTEST_Done() prints the totals and returns the
+ * exit status:
+ *
+ *   HOSTSIM_TraceReset();
+ *   HOSTTEST_EQ(PCC_EnableClock(PCC_PORTD), PCC_STATUS_SUCCESS);
+ *   HOSTTEST_EQ(*HOSTSIM_Reg(IP_PCC_BASE + PCC_PORTD) & PCC_PCCn_CGC_MASK, PCC_PCCn_CGC_MASK);
+ *   HOSTTEST_ACCESS(IP_PCC_BASE + PCC_PORTD, 2U, 1U);
+ *
+ *   return HOSTTEST_Done("pcc");
+ *
+ * The expected counts are those of the target's -O0 build: one load per
+ * volatile read and one store per volatile write, a read-modify-write being
+ * one of each.
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Condition holds */
+#define HOSTTEST_CHECK(cond) \
+    HOSTTEST_Check((cond), #cond, __FILE__, __LINE__)
+
+/* Two integer values, compared as uint32_t */
+#define HOSTTEST_EQ(actual, expected) \
+    HOSTTEST_Equal((uint32_t)(actual), (uint32_t)(expected), #actual, __FILE__, __LINE__)
+
+/* Traced loads and stores of the register at address since the last reset */
+#define HOSTTEST_ACCESS(address, loads, stores) \
+    HOSTTEST_Access((uint32_t)(address), (loads), (stores), #address, __FILE__, __LINE__)
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Count a check, report it if cond is false. Use HOSTTEST_CHECK().
+ *
+ * @return bool cond.
+ */
+bool HOSTTEST_Check(bool cond, const char *text, const char *file, int line);
+
+/**
+ * @brief Count a check, report it if the values differ. Use HOSTTEST_EQ().
+ *
+ * @return bool true if equal.
+ */
+bool HOSTTEST_Equal(uint32_t actual, uint32_t expected, const char *text, const char *file, int line);
+
+/**
+ * @brief Count a check on the traced access counts of a register. Use
+ *        HOSTTEST_ACCESS().
+ *
+ * @return bool true if both counts match.
+ */
+bool HOSTTEST_Access(uint32_t address, uint32_t loads, uint32_t stores, const char *text,
+                     const char *file, int line);
+
+/**
+ * @brief Print "<name>: <checks> checks, <failed> failed".
+ *
+ * @param name Test name.
+ * @return int Exit status, 0 if no check failed.
+ */
+int HOSTTEST_Done(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,210 @@
+/**
+ * @file host_flash.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Simulated NOR flash array for the KVS, with power-cut injection.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * A torn program keeps a random number of whole phrases and clears a random
+ * subset of the wanted bits in the phrase after them; a torn erase sets a
+ * random subset of the bits of the sector, from barely started to nearly
+ * done. Nothing after the torn phrase is touched.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "host_flash.h"
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static uint8_t hostflash_random(hostflash_t *flash);
+static bool hostflash_range(const hostflash_t *flash, uint32_t address, uint32_t len);
+static bool hostflash_start(hostflash_t *flash);
+static int32_t hostflash_read(void *ctx, uint32_t address, uint8_t *buf, uint32_t len);
+static int32_t hostflash_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len);
+static int32_t hostflash_erase(void *ctx, uint32_t address);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint8_t hostflash_random(hostflash_t *flash)
+{
+    flash->seed = (flash->seed * 1103515245U) + 12345U;
+    return (uint8_t)(flash->seed >> 16U);
+}
+
+static bool hostflash_range(const hostflash_t *flash, uint32_t address, uint32_t len)
+{
+    return (address >= flash->base) && ((address - flash->base) <= flash->size) &&
+           (len <= (flash->size - (address - flash->base)));
+}
+
+/* Count a program/erase; false if the power is off and it must not run at all */
+static bool hostflash_start(hostflash_t *flash)
+{
+    if (flash->cut)
+    {
+        return false;
+    }
+
+    flash->ops++;
+
+    return true;
+}
+
+static int32_t hostflash_read(void *ctx, uint32_t address, uint8_t *buf, uint32_t len)
+{
+    hostflash_t *flash = (hostflash_t *)ctx;
+
+    if (flash->cut || !hostflash_range(flash, address, len))
+    {
+        return -1;
+    }
+
+    memcpy(buf, &flash->mem[address - flash->base], len);
+
+    return 0;
+}
+
+static int32_t hostflash_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len)
+{
+    hostflash_t *flash = (hostflash_t *)ctx;
+    uint8_t *dst;
+    uint32_t keep;
+    uint32_t end;
+    uint32_t i;
+
+    if (!hostflash_range(flash, address, len) || ((address - flash->base) % KVS_PHRASE_SIZE) != 0U ||
+        !hostflash_start(flash))
+    {
+        return -1;
+    }
+
+    dst = &flash->mem[address - flash->base];
+
+    for (i = 0U; i < len; i++)
+    {
+        if (dst[i] != 0xFFU)
+        {
+            flash->overwrites++;
+            break;
+        }
+    }
+
+    if (flash->ops != flash->cut_at)
+    {
+        for (i = 0U; i < len; i++)
+        {
+            dst[i] &= data[i];
+        }
+
+        return 0;
+    }
+
+    /* Whole phrases before the torn one, then some of its bits */
+    keep = (hostflash_random(flash) % ((len + KVS_PHRASE_SIZE - 1U) / KVS_PHRASE_SIZE)) * KVS_PHRASE_SIZE;
+    end = ((keep + KVS_PHRASE_SIZE) > len) ? len : (keep + KVS_PHRASE_SIZE);
+
+    for (i = 0U; i < keep; i++)
+    {
+        dst[i] &= data[i];
+    }
+
+    for (; i < end; i++)
+    {
+        dst[i] &= (uint8_t)(data[i] | hostflash_random(flash));
+    }
+
+    flash->cut = true;
+
+    return -1;
+}
+
+static int32_t hostflash_erase(void *ctx, uint32_t address)
+{
+    hostflash_t *flash = (hostflash_t *)ctx;
+    uint8_t *dst;
+    uint8_t progress;
+    uint8_t bits;
+    uint32_t i;
+
+    if (!hostflash_range(flash, address, flash->sector_size) ||
+        ((address - flash->base) % flash->sector_size) != 0U || !hostflash_start(flash))
+    {
+        return -1;
+    }
+
+    dst = &flash->mem[address - flash->base];
+
+    if (flash->ops != flash->cut_at)
+    {
+        memset(dst, 0xFF, flash->sector_size);
+        return 0;
+    }
+
+    /* 0: a quarter of the bits, 1: half, 2: three quarters */
+    progress = (uint8_t)(hostflash_random(flash) % 3U);
+
+    for (i = 0U; i < flash->sector_size; i++)
+    {
+        bits = hostflash_random(flash);
+        bits = (progress == 0U) ? (uint8_t)(bits & hostflash_random(flash)) :
+               (progress == 2U) ? (uint8_t)(bits | hostflash_random(flash)) : bits;
+        dst[i] |= bits;
+    }
+
+    flash->cut = true;
+
+    return -1;
+}
+
+/**
+ * @brief Set up an erased array and the KVS backend that reaches it.
+ */
+void HOSTFLASH_Init(hostflash_t *flash, uint8_t *mem, uint32_t base, uint32_t sector_size,
+                    uint16_t sector_count, kvs_flash_t *backend)
+{
+    flash->mem = mem;
+    flash->base = base;
+    flash->size = sector_size * sector_count;
+    flash->sector_size = sector_size;
+    flash->ops = 0U;
+    flash->overwrites = 0U;
+    flash->cut_at = HOSTFLASH_NO_CUT;
+    flash->seed = 0U;
+    flash->cut = false;
+    memset(mem, 0xFF, flash->size);
+
+    backend->base = base;
+    backend->sector_size = sector_size;
+    backend->sector_count = sector_count;
+    backend->read = hostflash_read;
+    backend->program = hostflash_program;
+    backend->erase = hostflash_erase;
+    backend->ctx = flash;
+}
+
+/**
+ * @brief Let ops more program/erase operations complete and tear the next.
+ */
+void HOSTFLASH_CutAfter(hostflash_t *flash, uint32_t ops, uint32_t seed)
+{
+    flash->cut_at = (ops == HOSTFLASH_NO_CUT) ? HOSTFLASH_NO_CUT : (flash->ops + ops + 1U);
+    flash->seed = seed;
+}
+
+/**
+ * @brief Restore power after a cut; the array keeps its torn contents.
+ */
+void HOSTFLASH_PowerOn(hostflash_t *flash)
+{
+    flash->cut = false;
+    flash->cut_at = HOSTFLASH_NO_CUT;
+}
@@ -0,0 +1,504 @@
+/**
+ * @file host_sim.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host peripheral simulation: register windows, access trapping, tracer.
+ * @version 0.1
+ * @date 2025-10-31
+ *
+ * Each window is a memfd mapped twice: PROT_NONE at the target address (the
+ * bus the drivers see) and read/write anywhere (the register contents).
+ * A driver access raises SIGSEGV: the handler counts it, runs the read model
+ * or snapshots the word for the write model, opens the page and sets the
+ * x86 trap flag. The SIGTRAP after the single instruction closes the page
+ * again and runs the write model.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "host_sim.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "host_sim needs Linux on x86-64 (page fault error code and trap flag)"
+#endif
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_WINDOW_SIZE         0x100000U
+#define HOSTSIM_WINDOW_COUNT        2U
+#define HOSTSIM_WINDOW_WORDS        (HOSTSIM_WINDOW_SIZE / 4U)
+#define HOSTSIM_PAGE_SIZE           0x1000U
+
+/* One instruction touches at most this many simulated words */
+#define HOSTSIM_PENDING_MAX         4U
+
+/* x86 page fault error code: write access; EFLAGS: trap flag */
+#define HOSTSIM_PF_WRITE            0x2U
+#define HOSTSIM_EFLAGS_TF           0x100U
+
+typedef struct
+{
+    uint32_t base;
+    uint8_t *bus;
+    uint8_t *regs;
+} hostsim_window_t;
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t before;
+    uint8_t is_write;
+    uint8_t bytes;
+} hostsim_pending_t;
+
+typedef struct
+{
+    uint32_t base;
+    const char *name;
+} hostsim_name_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static hostsim_window_t *hostsim_find_window(uintptr_t address);
+static uint32_t hostsim_access_width(const uint8_t *ip);
+static void hostsim_fault_handler(int sig, siginfo_t *info, void *context);
+static void hostsim_trap_handler(int sig, siginfo_t *info, void *context);
+static const hostsim_name_t *hostsim_find_name(uint32_t address);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static hostsim_window_t s_hostsim_windows[HOSTSIM_WINDOW_COUNT] =
+{
+    { 0x40000000U, NULL, NULL },
+    { 0xE0000000U, NULL, NULL }
+};
+
+static uint32_t s_hostsim_loads[HOSTSIM_WINDOW_COUNT][HOSTSIM_WINDOW_WORDS];
+static uint32_t s_hostsim_stores[HOSTSIM_WINDOW_COUNT][HOSTSIM_WINDOW_WORDS];
+
+static hostsim_pending_t s_hostsim_pending[HOSTSIM_PENDING_MAX];
+static uint32_t s_hostsim_pending_count;
+
+/* Sorted by base for the dump */
+static const hostsim_name_t s_hostsim_names[] =
+{
+    { IP_AIPS_BASE,     "AIPS" },
+    { IP_MSCM_BASE,     "MSCM" },
+    { IP_DMA_BASE,      "DMA" },
+    { IP_ERM_BASE,      "ERM" },
+    { IP_EIM_BASE,      "EIM" },
+    { IP_FTFC_BASE,     "FTFC" },
+    { IP_DMAMUX_BASE,   "DMAMUX" },
+    { IP_FLEXCAN0_BASE, "FLEXCAN0" },
+    { IP_FLEXCAN1_BASE, "FLEXCAN1" },
+    { IP_FTM3_BASE,     "FTM3" },
+    { IP_ADC1_BASE,     "ADC1" },
+    { IP_FLEXCAN2_BASE, "FLEXCAN2" },
+    { IP_LPSPI0_BASE,   "LPSPI0" },
+    { IP_LPSPI1_BASE,   "LPSPI1" },
+    { IP_LPSPI2_BASE,   "LPSPI2" },
+    { IP_PDB1_BASE,     "PDB1" },
+    { IP_CRC_BASE,      "CRC" },
+    { IP_PDB0_BASE,     "PDB0" },
+    { IP_LPIT0_BASE,    "LPIT0" },
+    { IP_FTM0_BASE,     "FTM0" },
+    { IP_FTM1_BASE,     "FTM1" },
+    { IP_FTM2_BASE,     "FTM2" },
+    { IP_ADC0_BASE,     "ADC0" },
+    { IP_RTC_BASE,      "RTC" },
+    { IP_LPTMR0_BASE,   "LPTMR0" },
+    { IP_SIM_BASE,      "SIM" },
+    { IP_PORTA_BASE,    "PORTA" },
+    { IP_PORTB_BASE,    "PORTB" },
+    { IP_PORTC_BASE,    "PORTC" },
+    { IP_PORTD_BASE,    "PORTD" },
+    { IP_PORTE_BASE,    "PORTE" },
+    { IP_WDOG_BASE,     "WDOG" },
+    { IP_FLEXIO_BASE,   "FLEXIO" },
+    { IP_EWM_BASE,      "EWM" },
+    { IP_TRGMUX_BASE,   "TRGMUX" },
+    { IP_SCG_BASE,      "SCG" },
+    { IP_PCC_BASE,      "PCC" },
+    { IP_LPI2C0_BASE,   "LPI2C0" },
+    { IP_LPUART0_BASE,  "LPUART0" },
+    { IP_LPUART1_BASE,  "LPUART1" },
+    { IP_LPUART2_BASE,  "LPUART2" },
+    { IP_CMP0_BASE,     "CMP0" },
+    { IP_PMC_BASE,      "PMC" },
+    { IP_SMC_BASE,      "SMC" },
+    { IP_RCM_BASE,      "RCM" },
+    { IP_PTA_BASE,      "PTA" },
+    { IP_PTB_BASE,      "PTB" },
+    { IP_PTC_BASE,      "PTC" },
+    { IP_PTD_BASE,      "PTD" },
+    { IP_PTE_BASE,      "PTE" },
+    { 0xE0000000U,      "PPB" },
+    { 0xE0001000U,      "DWT" },
+    { S32_SCB_BASE,     "SCS" },
+    { IP_MCM_BASE,      "MCM" },
+    { IP_LMEM_BASE,     "LMEM" },
+    { IP_MPU_BASE,      "MPU" }
+};
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static hostsim_window_t *hostsim_find_window(uintptr_t address)
+{
+    uint32_t i;
+
+    for (i = 0U; i < HOSTSIM_WINDOW_COUNT; i++)
+    {
+        if ((address >= s_hostsim_windows[i].base) &&
+            (address < ((uintptr_t)s_hostsim_windows[i].base + HOSTSIM_WINDOW_SIZE)))
+        {
+            return &s_hostsim_windows[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Operand size of the faulting instruction, from the opcode forms the
+ * compiler emits for volatile accesses: MOV, MOVZX/MOVSX and the ALU, TEST,
+ * XCHG and unary groups. Anything else is taken as 32-bit.
+ */
+static uint32_t hostsim_access_width(const uint8_t *ip)
+{
+    uint32_t width = 4U;
+
+    /* Legacy prefixes: operand size, address size, segment, LOCK/REP */
+    for (;;)
+    {
+        if (*ip == 0x66U)
+        {
+            width = 2U;
+        }
+        else if ((*ip != 0x67U) && (*ip != 0xF0U) && (*ip != 0xF2U) && (*ip != 0xF3U) &&
+                 (*ip != 0x26U) && (*ip != 0x2EU) && (*ip != 0x36U) && (*ip != 0x3EU) &&
+                 (*ip != 0x64U) && (*ip != 0x65U))
+        {
+            break;
+        }
+
+        ip++;
+    }
+
+    /* REX, W selects 64-bit */
+    if ((*ip & 0xF0U) == 0x40U)
+    {
+        width = ((*ip & 0x08U) != 0U) ? 8U : width;
+        ip++;
+    }
+
+    if (*ip == 0x0FU)
+    {
+        /* MOVZX/MOVSX r, r/m8 and r/m16 */
+        if ((ip[1] == 0xB6U) || (ip[1] == 0xBEU))
+        {
+            return 1U;
+        }
+
+        return ((ip[1] == 0xB7U) || (ip[1] == 0xBFU)) ? 2U : width;
+    }
+
+    /* ALU r/m8 forms (00, 02, 08, .. 3A), MOV, TEST, XCHG and groups on r/m8 */
+    if (((*ip < 0x40U) && ((*ip & 0x05U) == 0x00U)) || (*ip == 0x80U) || (*ip == 0x84U) ||
+        (*ip == 0x86U) || (*ip == 0x88U) || (*ip == 0x8AU) || (*ip == 0xC6U) || (*ip == 0xF6U) ||
+        (*ip == 0xFEU))
+    {
+        return 1U;
+    }
+
+    return width;
+}
+
+static void hostsim_fault_handler(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    uintptr_t fault = (uintptr_t)info->si_addr;
+    hostsim_window_t *window = hostsim_find_window(fault);
+    uint32_t address = (uint32_t)fault & ~3U;
+    uint32_t index;
+    uint32_t offset;
+    uint32_t width;
+    hostsim_pending_t *pending;
+
+    (void)sig;
+
+    /* A real crash: fall back to the default action on re-execution */
+    if ((window == NULL) || (s_hostsim_pending_count >= HOSTSIM_PENDING_MAX))
+    {
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    index = (uint32_t)(window - s_hostsim_windows);
+    offset = address - window->base;
+    pending = &s_hostsim_pending[s_hostsim_pending_count];
+    pending->address = address;
+    pending->is_write = ((uc->uc_mcontext.gregs[REG_ERR] & HOSTSIM_PF_WRITE) != 0) ? 1U : 0U;
+
+    if (pending->is_write != 0U)
+    {
+        s_hostsim_stores[index][offset / 4U]++;
+        pending->before = *(volatile uint32_t *)(window->regs + offset);
+        /* Byte lanes of the word written; the rest of a wider store is the next word */
+        width = hostsim_access_width((const uint8_t *)uc->uc_mcontext.gregs[REG_RIP]);
+        pending->bytes = (uint8_t)((((1U << width) - 1U) << (fault & 3U)) & 0xFU);
+    }
+    else
+    {
+        s_hostsim_loads[index][offset / 4U]++;
+        hostsim_model_read(address);
+    }
+
+    s_hostsim_pending_count++;
+
+    (void)mprotect(window->bus + (offset & ~(HOSTSIM_PAGE_SIZE - 1U)), HOSTSIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= HOSTSIM_EFLAGS_TF;
+}
+
+static void hostsim_trap_handler(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    hostsim_window_t *window;
+    uint32_t offset;
+    uint32_t i;
+
+    (void)sig;
+    (void)info;
+
+    uc->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)HOSTSIM_EFLAGS_TF;
+
+    for (i = 0U; i < s_hostsim_pending_count; i++)
+    {
+        window = hostsim_find_window(s_hostsim_pending[i].address);
+        offset = s_hostsim_pending[i].address - window->base;
+
+        (void)mprotect(window->bus + (offset & ~(HOSTSIM_PAGE_SIZE - 1U)), HOSTSIM_PAGE_SIZE, PROT_NONE);
+
+        if (s_hostsim_pending[i].is_write != 0U)
+        {
+            hostsim_model_write(s_hostsim_pending[i].address, s_hostsim_pending[i].before,
+                                s_hostsim_pending[i].bytes);
+        }
+    }
+
+    s_hostsim_pending_count = 0U;
+}
+
+static const hostsim_name_t *hostsim_find_name(uint32_t address)
+{
+    const hostsim_name_t *best = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(s_hostsim_names) / sizeof(s_hostsim_names[0])); i++)
+    {
+        if ((s_hostsim_names[i].base <= address) &&
+            ((best == NULL) || (s_hostsim_names[i].base > best->base)))
+        {
+            best = &s_hostsim_names[i];
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Map the register windows, install the fault handlers and reset.
+ *
+ * @return HOSTSIM_STATUS_t SUCCESS, or ERROR if an address range is taken.
+ */
+HOSTSIM_STATUS_t HOSTSIM_Init(void)
+{
+    struct sigaction action;
+    uint32_t i;
+    int fd;
+
+    for (i = 0U; i < HOSTSIM_WINDOW_COUNT; i++)
+    {
+        fd = memfd_create("hostsim", 0);
+
+        if ((fd < 0) || (ftruncate(fd, HOSTSIM_WINDOW_SIZE) != 0))
+        {
+            return HOSTSIM_STATUS_ERROR;
+        }
+
+        s_hostsim_windows[i].bus = mmap((void *)(uintptr_t)s_hostsim_windows[i].base, HOSTSIM_WINDOW_SIZE,
+                                        PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+        s_hostsim_windows[i].regs = mmap(NULL, HOSTSIM_WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        (void)close(fd);
+
+        if ((s_hostsim_windows[i].bus != (uint8_t *)(uintptr_t)s_hostsim_windows[i].base) ||
+            (s_hostsim_windows[i].regs == MAP_FAILED))
+        {
+            return HOSTSIM_STATUS_ERROR;
+        }
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+
+    action.sa_sigaction = hostsim_fault_handler;
+    if (sigaction(SIGSEGV, &action, NULL) != 0)
+    {
+        return HOSTSIM_STATUS_ERROR;
+    }
+
+    action.sa_sigaction = hostsim_trap_handler;
+    if (sigaction(SIGTRAP, &action, NULL) != 0)
+    {
+        return HOSTSIM_STATUS_ERROR;
+    }
+
+    HOSTSIM_Reset();
+
+    return HOSTSIM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Clear all registers, load the modelled reset values, clear the trace.
+ */
+void HOSTSIM_Reset(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < HOSTSIM_WINDOW_COUNT; i++)
+    {
+        memset(s_hostsim_windows[i].regs, 0, HOSTSIM_WINDOW_SIZE);
+    }
+
+    hostsim_models_reset();
+    HOSTSIM_TraceReset();
+}
+
+/**
+ * @brief Untraced pointer to a simulated register, for test setup and checks.
+ *
+ * @param address Target address of the register.
+ * @return volatile uint32_t* Register, or NULL outside the windows.
+ */
+volatile uint32_t *HOSTSIM_Reg(uint32_t address)
+{
+    hostsim_window_t *window = hostsim_find_window(address);
+
+    if ((window == NULL) || (window->regs == NULL))
+    {
+        return NULL;
+    }
+
+    return (volatile uint32_t *)(window->regs + ((address & ~3U) - window->base));
+}
+
+/**
+ * @brief Set all access counts to 0.
+ */
+void HOSTSIM_TraceReset(void)
+{
+    memset(s_hostsim_loads, 0, sizeof(s_hostsim_loads));
+    memset(s_hostsim_stores, 0, sizeof(s_hostsim_stores));
+}
+
+/**
+ * @brief Access counts of the register at an address.
+ *
+ * @param address Target address of the register.
+ * @param trace Counts out, 0 outside the windows.
+ */
+void HOSTSIM_TraceGet(uint32_t address, hostsim_trace_t *trace)
+{
+    hostsim_window_t *window = hostsim_find_window(address);
+    uint32_t index;
+    uint32_t word;
+
+    if (trace == NULL)
+    {
+        return;
+    }
+
+    trace->loads = 0U;
+    trace->stores = 0U;
+
+    if (window != NULL)
+    {
+        index = (uint32_t)(window - s_hostsim_windows);
+        word = (address - window->base) / 4U;
+        trace->loads = s_hostsim_loads[index][word];
+        trace->stores = s_hostsim_stores[index][word];
+    }
+}
+
+/**
+ * @brief Access counts summed over all registers.
+ */
+void HOSTSIM_TraceTotal(hostsim_trace_t *trace)
+{
+    uint32_t i;
+    uint32_t word;
+
+    if (trace == NULL)
+    {
+        return;
+    }
+
+    trace->loads = 0U;
+    trace->stores = 0U;
+
+    for (i = 0U; i < HOSTSIM_WINDOW_COUNT; i++)
+    {
+        for (word = 0U; word < HOSTSIM_WINDOW_WORDS; word++)
+        {
+            trace->loads += s_hostsim_loads[i][word];
+            trace->stores += s_hostsim_stores[i][word];
+        }
+    }
+}
+
+/**
+ * @brief Print every accessed register as "PERIPH+offset loads stores".
+ */
+void HOSTSIM_TraceDump(FILE *out)
+{
+    const hostsim_name_t *name;
+    uint32_t address;
+    uint32_t i;
+    uint32_t word;
+
+    for (i = 0U; i < HOSTSIM_WINDOW_COUNT; i++)
+    {
+        for (word = 0U; word < HOSTSIM_WINDOW_WORDS; word++)
+        {
+            if ((s_hostsim_loads[i][word] == 0U) && (s_hostsim_stores[i][word] == 0U))
+            {
+                continue;
+            }
+
+            address = s_hostsim_windows[i].base + (word * 4U);
+            name = hostsim_find_name(address);
+
+            fprintf(out, "0x%08X  %-8s +0x%03X  loads %6u  stores %6u\n", (unsigned)address, name->name,
+                    (unsigned)(address - name->base), (unsigned)s_hostsim_loads[i][word],
+                    (unsigned)s_hostsim_stores[i][word]);
+        }
+    }
+}
@@ -0,0 +1,2013 @@
+/**
+ * @file host_sim_models.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Behavioural register models for the host peripheral simulation.
+ * @version 0.1
+ * @date 2025-10-31
+ *
+ * Only the behaviour the drivers poll or rely on is modelled: SCG source
+ * valid and system clock switch, SMC run mode, PCC present bits, ADC
+ * conversion complete, GPIO set/clear/toggle, the FlexCAN mode handshakes,
+ * acceptance filtering, RX FIFO and TX arbitration, the FTM counter, input
+ * capture and quadrature decoder, the CRC shift register, LMEM cache
+ * commands and tags, FTFC flash commands, the WDOG unlock sequence and the
+ * NVIC set/clear register pairs. Timing is
+ * counted in register reads (FTM: in HOSTSIM_FtmAdvance() counts), not time,
+ * so a polling loop with a retry limit sees the same sequence on every run.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "host_sim.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_SCG_SOURCE_COUNT    4U
+#define HOSTSIM_ADC_COUNT           2U
+#define HOSTSIM_ADC_CHANNELS        (ADC_SC1_ADCH_MASK + 1U)
+#define HOSTSIM_GPIO_COUNT          5U
+#define HOSTSIM_GPIO_STEP           (IP_PTB_BASE - IP_PTA_BASE)
+#define HOSTSIM_PCC_SLOTS           128U
+#define HOSTSIM_PORT_COUNT          5U
+#define HOSTSIM_PORT_STEP           (IP_PORTB_BASE - IP_PORTA_BASE)
+
+/* Same bit positions in SOSCCSR, SIRCCSR, FIRCCSR and SPLLCSR */
+#define HOSTSIM_SCG_EN              SCG_SOSCCSR_SOSCEN_MASK
+#define HOSTSIM_SCG_VLD             SCG_SOSCCSR_SOSCVLD_MASK
+#define HOSTSIM_SCG_SEL             SCG_SOSCCSR_SOSCSEL_MASK
+#define HOSTSIM_SCG_ERR             SCG_SOSCCSR_SOSCERR_MASK
+
+/* Reset values (reference manual): FIRC runs the core, SIRC enabled */
+#define HOSTSIM_SCG_CCR_RESET       0x03000001U
+#define HOSTSIM_SCG_VCCR_RESET      0x02000001U
+#define HOSTSIM_SCG_FIRCCSR_RESET   0x03000001U
+#define HOSTSIM_SCG_SIRCCSR_RESET   0x01000005U
+
+/* SMC PMCTRL[RUNM] and PMSTAT encodings */
+#define HOSTSIM_SMC_RUNM_RUN        0U
+#define HOSTSIM_SMC_RUNM_VLPR       2U
+#define HOSTSIM_SMC_RUNM_HSRUN      3U
+#define HOSTSIM_SMC_PMSTAT_RUN      0x01U
+#define HOSTSIM_SMC_PMSTAT_VLPR     0x04U
+#define HOSTSIM_SMC_PMSTAT_HSRUN    0x80U
+
+#define HOSTSIM_ADC_IDLE            (ADC_SC1_ADCH_MASK >> ADC_SC1_ADCH_SHIFT)
+
+#define HOSTSIM_CAN_COUNT           3U
+#define HOSTSIM_CAN_FIFO_DEPTH      6U
+/* RXF warning (BUF6I) at this many frames */
+#define HOSTSIM_CAN_FIFO_WARNING    5U
+/* MB0..5 are the RX FIFO engine, the filter table follows */
+#define HOSTSIM_CAN_FIFO_MBS        6U
+#define HOSTSIM_CAN_CLASSIC_WORDS   4U
+#define HOSTSIM_CAN_HEADER_WORDS    2U
+
+/* Message buffer C/S word */
+#define HOSTSIM_CAN_CS_EDL          0x80000000U
+#define HOSTSIM_CAN_CS_BRS          0x40000000U
+#define HOSTSIM_CAN_CS_CODE_MASK    0x0F000000U
+#define HOSTSIM_CAN_CS_CODE_SHIFT   24U
+#define HOSTSIM_CAN_CS_SRR          0x00400000U
+#define HOSTSIM_CAN_CS_IDE          0x00200000U
+#define HOSTSIM_CAN_CS_RTR          0x00100000U
+#define HOSTSIM_CAN_CS_DLC_MASK     0x000F0000U
+#define HOSTSIM_CAN_CS_DLC_SHIFT    16U
+
+#define HOSTSIM_CAN_CODE_FULL       0x2U
+#define HOSTSIM_CAN_CODE_EMPTY      0x4U
+#define HOSTSIM_CAN_CODE_OVERRUN    0x6U
+#define HOSTSIM_CAN_CODE_TX_INACTIVE 0x8U
+#define HOSTSIM_CAN_CODE_TX_DATA    0xCU
+
+/* Message buffer ID word */
+#define HOSTSIM_CAN_ID_PRIO_MASK    0xE0000000U
+#define HOSTSIM_CAN_ID_MASK         0x1FFFFFFFU
+#define HOSTSIM_CAN_ID_STD_SHIFT    18U
+
+/* RXIMR/RXMGMASK with CTRL2[EACEN]: compare RTR and IDE */
+#define HOSTSIM_CAN_MASK_RTR        0x80000000U
+#define HOSTSIM_CAN_MASK_IDE        0x40000000U
+
+/* RX FIFO filter element and mask, format A */
+#define HOSTSIM_CAN_FIFO_RTR        0x80000000U
+#define HOSTSIM_CAN_FIFO_IDE        0x40000000U
+#define HOSTSIM_CAN_FIFO_STD_SHIFT  19U
+#define HOSTSIM_CAN_FIFO_EXT_SHIFT  1U
+
+#define HOSTSIM_CAN_REG(n, r)       HOSTSIM_Reg(s_hostsim_can_bases[n] + offsetof(FLEXCAN_Type, r))
+#define HOSTSIM_CAN_RAM(n, w)       HOSTSIM_Reg(s_hostsim_can_bases[n] + offsetof(FLEXCAN_Type, RAMn) + ((w) * 4U))
+
+#define HOSTSIM_FTM_COUNT           4U
+#define HOSTSIM_FTM_CHANNELS        8U
+#define HOSTSIM_FTM_COUNTER_MASK    0xFFFFU
+/* Bits per channel pair in COMBINE */
+#define HOSTSIM_FTM_PAIR_WIDTH      8U
+/* CnSC[ELSB:ELSA] in capture mode: 1 rising, 2 falling, 3 both */
+#define HOSTSIM_FTM_ELS_RISING      1U
+#define HOSTSIM_FTM_ELS_FALLING     2U
+
+#define HOSTSIM_FTM_REG(n, r)       HOSTSIM_Reg(s_hostsim_ftm_bases[n] + offsetof(FTM_Type, r))
+#define HOSTSIM_FTM_CNSC(n, ch)     HOSTSIM_Reg(s_hostsim_ftm_bases[n] + offsetof(FTM_Type, CONTROLS) + ((ch) * 8U))
+#define HOSTSIM_FTM_CNV(n, ch)      HOSTSIM_Reg(s_hostsim_ftm_bases[n] + offsetof(FTM_Type, CONTROLS) + ((ch) * 8U) + 4U)
+
+/* CTRL[TOT]/CTRL[TOTR] encodings */
+#define HOSTSIM_CRC_TOT_BITS        1U
+#define HOSTSIM_CRC_TOT_BITS_BYTES  2U
+#define HOSTSIM_CRC_TOT_BYTES       3U
+#define HOSTSIM_CRC_GPOLY_RESET     0x00001021U
+
+#define HOSTSIM_CRC_REG(r)          HOSTSIM_Reg(IP_CRC_BASE + offsetof(CRC_Type, r))
+
+/* LMEM code cache: 2 ways of 128 lines of 16 bytes */
+#define HOSTSIM_LMEM_WAYS           2U
+#define HOSTSIM_LMEM_SETS           128U
+#define HOSTSIM_LMEM_LINE_SIZE      16U
+/* PCCLCR[LCMD] encodings */
+#define HOSTSIM_LMEM_LCMD_READ      0U
+#define HOSTSIM_LMEM_LCMD_INVALIDATE 1U
+#define HOSTSIM_LMEM_LCMD_CLEAR     3U
+/* Regions 0..3 write-through, 6/7 write-back, 8/9 write-through */
+#define HOSTSIM_LMEM_PCCRMR_RESET   0xAA0FA000U
+
+#define HOSTSIM_LMEM_REG(r)         HOSTSIM_Reg(IP_LMEM_BASE + offsetof(LMEM_Type, r))
+
+#define HOSTSIM_FTFC_PFLASH_SIZE    0x00080000U
+#define HOSTSIM_FTFC_PFLASH_SECTOR  4096U
+#define HOSTSIM_FTFC_DFLASH_BASE    0x10000000U
+#define HOSTSIM_FTFC_DFLASH_SIZE    0x00010000U
+#define HOSTSIM_FTFC_DFLASH_SECTOR  2048U
+/* FlexNVM is addressed with bit 23 set in FCCOB */
+#define HOSTSIM_FTFC_DFLASH_FCCOB   0x00800000U
+#define HOSTSIM_FTFC_PHRASE         8U
+/* FPROT: 32 P-Flash regions, FDPROT: 8 FlexNVM regions, bit clear = protected */
+#define HOSTSIM_FTFC_PFLASH_REGION  (HOSTSIM_FTFC_PFLASH_SIZE / 32U)
+#define HOSTSIM_FTFC_DFLASH_REGION  (HOSTSIM_FTFC_DFLASH_SIZE / 8U)
+
+#define HOSTSIM_FTFC_CMD_PROGRAM_PHRASE     0x07U
+#define HOSTSIM_FTFC_CMD_ERASE_SECTOR       0x09U
+#define HOSTSIM_FTFC_CMD_PROGRAM_PARTITION  0x80U
+#define HOSTSIM_FTFC_CMD_SET_FLEXRAM        0x81U
+#define HOSTSIM_FTFC_FLEXRAM_EEE    0x00U
+#define HOSTSIM_FTFC_FLEXRAM_RAM    0xFFU
+
+#define HOSTSIM_FTFC_ERRORS         (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_RDCOLERR_MASK)
+/* FSEC, FOPT and FCNFG[RAMRDY/EEERDY] in the FSTAT word */
+#define HOSTSIM_FTFC_READ_ONLY      (0xFFFF0000U | ((uint32_t)(FTFC_FCNFG_RAMRDY_MASK | FTFC_FCNFG_EEERDY_MASK) << 8U))
+
+#define HOSTSIM_FTFC_BYTE(offset)   (((volatile uint8_t *)HOSTSIM_Reg(IP_FTFC_BASE))[offset])
+/* FCCOB registers are big-endian per 32-bit group (FCCOB0 at offset 7) */
+#define HOSTSIM_FTFC_FCCOB(n)       HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FCCOB) + ((n) & ~3U) + 3U - ((n) & 3U))
+
+#define HOSTSIM_WDOG_UNLOCK         0xD928C520U
+/* Out of reset: enabled on the LPO, unlocked, updates allowed */
+#define HOSTSIM_WDOG_CS_RESET       (WDOG_CS_CMD32EN_MASK | WDOG_CS_ULK_MASK | WDOG_CS_CLK(1U) | \
+                                     WDOG_CS_EN_MASK | WDOG_CS_UPDATE_MASK)
+#define HOSTSIM_WDOG_TOVAL_RESET    0x0500U
+
+#define HOSTSIM_WDOG_REG(r)         HOSTSIM_Reg(IP_WDOG_BASE + offsetof(WDOG_Type, r))
+
+/* Armv7-M NVIC: ISER, ICER, ISPR, ICPR of 8 words, 0x80 apart */
+#define HOSTSIM_NVIC_BASE           0xE000E100U
+#define HOSTSIM_NVIC_WORDS          8U
+#define HOSTSIM_NVIC_CLEAR          0x80U
+#define HOSTSIM_NVIC_PENDING        0x100U
+
+typedef struct
+{
+    uint32_t offset;
+    uint32_t scs;
+} hostsim_scg_source_t;
+
+/* One frame in the RX FIFO, as shown in the output mailbox */
+typedef struct
+{
+    uint32_t cs;
+    uint32_t id;
+    uint32_t data[2];
+    uint32_t hit;
+} hostsim_can_fifo_entry_t;
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static int32_t hostsim_scg_source(uint32_t offset);
+static void hostsim_scg_read(uint32_t offset);
+static uint32_t hostsim_scg_mode_ccr(void);
+static void hostsim_scg_select(void);
+static void hostsim_scg_write(uint32_t offset, uint32_t before);
+static void hostsim_smc_write(uint32_t offset, uint32_t before);
+static void hostsim_pcc_write(uint32_t offset, uint32_t before);
+static void hostsim_adc_complete(uint32_t instance, uint32_t n);
+static void hostsim_adc_read(uint32_t instance, uint32_t offset);
+static void hostsim_adc_write(uint32_t instance, uint32_t offset, uint32_t before);
+static void hostsim_gpio_read(uint32_t port, uint32_t offset);
+static void hostsim_gpio_write(uint32_t port, uint32_t offset);
+static void hostsim_port_write(uint32_t port, uint32_t offset);
+static bool hostsim_can_on_bus(uint32_t n);
+static uint32_t hostsim_can_mb_words(uint32_t n);
+static uint32_t hostsim_can_first_mb(uint32_t n);
+static uint32_t hostsim_can_mb_count(uint32_t n);
+static void hostsim_can_fifo_show(uint32_t n);
+static int32_t hostsim_can_fifo_match(uint32_t n, const hostsim_can_frame_t *frame);
+static int32_t hostsim_can_mb_match(uint32_t n, uint32_t cs, uint32_t id);
+static void hostsim_can_write(uint32_t n, uint32_t offset, uint32_t before);
+static void hostsim_ftm_write(uint32_t n, uint32_t offset, uint32_t before);
+static bool hostsim_ftm_edge_match(uint32_t n, uint32_t ch, bool rising);
+static void hostsim_ftm_capture(uint32_t n, uint32_t ch);
+static void hostsim_ftm_quad_count(uint32_t n, bool up);
+static void hostsim_ftm_quad_edge(uint32_t n, uint32_t ch);
+static uint32_t hostsim_crc_transpose(uint32_t value, uint32_t bytes, uint32_t type);
+static void hostsim_crc_read(uint32_t offset);
+static void hostsim_crc_write(uint32_t offset, uint32_t bytes);
+static void hostsim_lmem_line(uint32_t way, uint32_t set);
+static void hostsim_lmem_write(uint32_t offset);
+static uint32_t hostsim_ftfc_target(uint32_t addr, uint32_t len, uint8_t **bytes);
+static uint32_t hostsim_ftfc_command(void);
+static void hostsim_ftfc_write(uint32_t offset, uint32_t before, uint32_t bytes);
+static void hostsim_wdog_write(uint32_t offset, uint32_t before);
+static void hostsim_nvic_write(uint32_t offset, uint32_t before);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const hostsim_scg_source_t s_hostsim_scg_sources[HOSTSIM_SCG_SOURCE_COUNT] =
+{
+    { offsetof(SCG_Type, SOSCCSR), 1U },
+    { offsetof(SCG_Type, SIRCCSR), 2U },
+    { offsetof(SCG_Type, FIRCCSR), 3U },
+    { offsetof(SCG_Type, SPLLCSR), 6U }
+};
+
+/* PCC slots of the modules present on the S32K144 */
+static const uint8_t s_hostsim_pcc_present[] =
+{
+    PCC_FTFC_INDEX, PCC_DMAMUX_INDEX, 36U /* FlexCAN0 */, 37U /* FlexCAN1 */,
+    PCC_FTM3_INDEX, PCC_ADC1_INDEX, 43U /* FlexCAN2 */, PCC_LPSPI0_INDEX,
+    PCC_LPSPI1_INDEX, PCC_LPSPI2_INDEX, PCC_PDB1_INDEX, PCC_CRC_INDEX,
+    PCC_PDB0_INDEX, PCC_LPIT_INDEX, PCC_FTM0_INDEX, PCC_FTM1_INDEX,
+    PCC_FTM2_INDEX, PCC_ADC0_INDEX, PCC_RTC_INDEX, PCC_LPTMR0_INDEX,
+    PCC_PORTA_INDEX, PCC_PORTB_INDEX, PCC_PORTC_INDEX, PCC_PORTD_INDEX,
+    PCC_PORTE_INDEX, 90U /* FlexIO */, PCC_EWM_INDEX, PCC_LPI2C0_INDEX,
+    PCC_LPUART0_INDEX, PCC_LPUART1_INDEX, PCC_LPUART2_INDEX, PCC_CMP0_INDEX
+};
+
+static const uint32_t s_hostsim_adc_bases[HOSTSIM_ADC_COUNT] = { IP_ADC0_BASE, IP_ADC1_BASE };
+
+static uint32_t s_hostsim_scg_valid_reads = HOSTSIM_SCG_VALID_READS;
+static uint32_t s_hostsim_scg_reads[HOSTSIM_SCG_SOURCE_COUNT];
+
+static bool s_hostsim_smc_pmprot_written;
+
+static uint16_t s_hostsim_adc_input[HOSTSIM_ADC_COUNT][HOSTSIM_ADC_CHANNELS];
+static uint32_t s_hostsim_adc_pending[HOSTSIM_ADC_COUNT][ADC_SC1_COUNT];
+
+static uint32_t s_hostsim_gpio_input[HOSTSIM_GPIO_COUNT];
+
+static const uint32_t s_hostsim_can_bases[HOSTSIM_CAN_COUNT] = IP_FLEXCAN_BASE_ADDRS;
+static const uint8_t s_hostsim_can_dlc_len[16] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+
+static hostsim_can_fifo_entry_t s_hostsim_can_fifo[HOSTSIM_CAN_COUNT][HOSTSIM_CAN_FIFO_DEPTH];
+static uint32_t s_hostsim_can_fifo_count[HOSTSIM_CAN_COUNT];
+
+static const uint32_t s_hostsim_ftm_bases[HOSTSIM_FTM_COUNT] = IP_FTM_BASE_ADDRS;
+/* Channel input levels, bit n = channel n (channels 0/1 are phase A/B in quadrature mode) */
+static uint8_t s_hostsim_ftm_input[HOSTSIM_FTM_COUNT];
+/* Dual-edge pairs that captured their first edge, bit n = pair n */
+static uint8_t s_hostsim_ftm_decap_first[HOSTSIM_FTM_COUNT];
+
+/* CRC shift register, right-aligned; DATA shows it through CTRL[TOTR] */
+static uint32_t s_hostsim_crc_value;
+
+/* LMEM tags: line address per way and set, valid bit alongside */
+static uint32_t s_hostsim_lmem_tag[HOSTSIM_LMEM_WAYS][HOSTSIM_LMEM_SETS];
+static bool s_hostsim_lmem_valid[HOSTSIM_LMEM_WAYS][HOSTSIM_LMEM_SETS];
+
+/* Flash behind the FTFC model, erased at reset */
+static uint8_t s_hostsim_pflash[HOSTSIM_FTFC_PFLASH_SIZE];
+static uint8_t s_hostsim_dflash[HOSTSIM_FTFC_DFLASH_SIZE];
+static bool s_hostsim_ftfc_partitioned;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* SCG: index of the source whose xCSR is at offset, -1 if none */
+static int32_t hostsim_scg_source(uint32_t offset)
+{
+    int32_t i;
+
+    for (i = 0; i < (int32_t)HOSTSIM_SCG_SOURCE_COUNT; i++)
+    {
+        if (s_hostsim_scg_sources[i].offset == offset)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void hostsim_scg_read(uint32_t offset)
+{
+    int32_t src = hostsim_scg_source(offset);
+    volatile uint32_t *csr;
+
+    if (src < 0)
+    {
+        return;
+    }
+
+    csr = HOSTSIM_Reg(IP_SCG_BASE + offset);
+
+    if (((*csr & HOSTSIM_SCG_EN) != 0U) && ((*csr & HOSTSIM_SCG_VLD) == 0U))
+    {
+        s_hostsim_scg_reads[src]++;
+
+        if (s_hostsim_scg_reads[src] >= s_hostsim_scg_valid_reads)
+        {
+            *csr |= HOSTSIM_SCG_VLD;
+        }
+    }
+}
+
+/* SCG: the clock control register of the current SMC run mode */
+static uint32_t hostsim_scg_mode_ccr(void)
+{
+    switch (*HOSTSIM_Reg(IP_SMC_BASE + offsetof(SMC_Type, PMSTAT)))
+    {
+        case HOSTSIM_SMC_PMSTAT_VLPR:
+            return offsetof(SCG_Type, VCCR);
+        case HOSTSIM_SMC_PMSTAT_HSRUN:
+            return offsetof(SCG_Type, HCCR);
+        default:
+            return offsetof(SCG_Type, RCCR);
+    }
+}
+
+/* SCG: switch the system clock to that register if its source is valid */
+static void hostsim_scg_select(void)
+{
+    volatile uint32_t *csr;
+    uint32_t ccr = *HOSTSIM_Reg(IP_SCG_BASE + hostsim_scg_mode_ccr());
+    uint32_t scs = (ccr & SCG_RCCR_SCS_MASK) >> SCG_RCCR_SCS_SHIFT;
+    int32_t src;
+    int32_t i;
+
+    for (i = 0; i < (int32_t)HOSTSIM_SCG_SOURCE_COUNT; i++)
+    {
+        if (s_hostsim_scg_sources[i].scs == scs)
+        {
+            break;
+        }
+    }
+
+    if ((i == (int32_t)HOSTSIM_SCG_SOURCE_COUNT) ||
+        ((*HOSTSIM_Reg(IP_SCG_BASE + s_hostsim_scg_sources[i].offset) & HOSTSIM_SCG_VLD) == 0U))
+    {
+        return;
+    }
+
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, CSR)) = ccr;
+
+    for (src = 0; src < (int32_t)HOSTSIM_SCG_SOURCE_COUNT; src++)
+    {
+        csr = HOSTSIM_Reg(IP_SCG_BASE + s_hostsim_scg_sources[src].offset);
+        *csr = (src == i) ? (*csr | HOSTSIM_SCG_SEL) : (*csr & ~HOSTSIM_SCG_SEL);
+    }
+}
+
+static void hostsim_scg_write(uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *reg = HOSTSIM_Reg(IP_SCG_BASE + offset);
+    uint32_t written = *reg;
+    uint32_t value;
+    int32_t src = hostsim_scg_source(offset);
+
+    if (src >= 0)
+    {
+        /* VLD and SEL are read-only, ERR is write-1-to-clear, EN stays while SEL */
+        value = (written & ~(HOSTSIM_SCG_VLD | HOSTSIM_SCG_SEL | HOSTSIM_SCG_ERR)) |
+                (before & (HOSTSIM_SCG_VLD | HOSTSIM_SCG_SEL)) |
+                (before & HOSTSIM_SCG_ERR & ~written);
+        if ((before & HOSTSIM_SCG_SEL) != 0U)
+        {
+            value |= HOSTSIM_SCG_EN;
+        }
+
+        if ((value & HOSTSIM_SCG_EN) == 0U)
+        {
+            value &= ~HOSTSIM_SCG_VLD;
+        }
+        else if ((before & HOSTSIM_SCG_EN) == 0U)
+        {
+            s_hostsim_scg_reads[src] = 0U;
+
+            if (s_hostsim_scg_valid_reads == 0U)
+            {
+                value |= HOSTSIM_SCG_VLD;
+            }
+        }
+
+        *reg = value;
+        return;
+    }
+
+    if (offset == offsetof(SCG_Type, CSR))
+    {
+        *reg = before;
+        return;
+    }
+
+    if (offset == hostsim_scg_mode_ccr())
+    {
+        hostsim_scg_select();
+    }
+}
+
+/* SMC: PMPROT is write-once, RUNM moves PMSTAT between RUN and VLPR/HSRUN */
+static void hostsim_smc_write(uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *reg = HOSTSIM_Reg(IP_SMC_BASE + offset);
+    volatile uint32_t *pmstat = HOSTSIM_Reg(IP_SMC_BASE + offsetof(SMC_Type, PMSTAT));
+    uint32_t pmprot = *HOSTSIM_Reg(IP_SMC_BASE + offsetof(SMC_Type, PMPROT));
+    uint32_t runm;
+    uint32_t next;
+
+    switch (offset)
+    {
+        case offsetof(SMC_Type, PMPROT):
+            if (s_hostsim_smc_pmprot_written)
+            {
+                *reg = before;
+            }
+            s_hostsim_smc_pmprot_written = true;
+            return;
+        case offsetof(SMC_Type, PMSTAT):
+            *reg = before;
+            return;
+        case offsetof(SMC_Type, PMCTRL):
+            break;
+        default:
+            return;
+    }
+
+    runm = (*reg & SMC_PMCTRL_RUNM_MASK) >> SMC_PMCTRL_RUNM_SHIFT;
+
+    /* VLPR and HSRUN are entered from RUN only, and only if allowed */
+    if (runm == HOSTSIM_SMC_RUNM_RUN)
+    {
+        next = HOSTSIM_SMC_PMSTAT_RUN;
+    }
+    else if ((runm == HOSTSIM_SMC_RUNM_VLPR) && ((pmprot & SMC_PMPROT_AVLP_MASK) != 0U) &&
+             (*pmstat == HOSTSIM_SMC_PMSTAT_RUN))
+    {
+        next = HOSTSIM_SMC_PMSTAT_VLPR;
+    }
+    else if ((runm == HOSTSIM_SMC_RUNM_HSRUN) && ((pmprot & SMC_PMPROT_AHSRUN_MASK) != 0U) &&
+             (*pmstat == HOSTSIM_SMC_PMSTAT_RUN))
+    {
+        next = HOSTSIM_SMC_PMSTAT_HSRUN;
+    }
+    else
+    {
+        /* Not allowed: RUNM keeps its value */
+        *reg = (*reg & ~SMC_PMCTRL_RUNM_MASK) | (before & SMC_PMCTRL_RUNM_MASK);
+        return;
+    }
+
+    if (next != *pmstat)
+    {
+        *pmstat = next;
+        hostsim_scg_select();
+    }
+}
+
+static void hostsim_pcc_write(uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *reg = HOSTSIM_Reg(IP_PCC_BASE + offset);
+    uint32_t written = *reg;
+
+    /* Absent module: the write is dropped */
+    if ((before & PCC_PCCn_PR_MASK) == 0U)
+    {
+        *reg = before;
+        return;
+    }
+
+    /* PCS is locked while the clock is gated on */
+    if (((before & PCC_PCCn_CGC_MASK) != 0U) && ((written & PCC_PCCn_CGC_MASK) != 0U))
+    {
+        written = (written & ~PCC_PCCn_PCS_MASK) | (before & PCC_PCCn_PCS_MASK);
+    }
+
+    *reg = written | PCC_PCCn_PR_MASK;
+}
+
+static void hostsim_adc_complete(uint32_t instance, uint32_t n)
+{
+    uint32_t base = s_hostsim_adc_bases[instance];
+    volatile uint32_t *sc1 = HOSTSIM_Reg(base + offsetof(ADC_Type, SC1) + (n * 4U));
+    uint32_t ch = (*sc1 & ADC_SC1_ADCH_MASK) >> ADC_SC1_ADCH_SHIFT;
+
+    *HOSTSIM_Reg(base + offsetof(ADC_Type, R) + (n * 4U)) = s_hostsim_adc_input[instance][ch];
+    *sc1 |= ADC_SC1_COCO_MASK;
+}
+
+static void hostsim_adc_read(uint32_t instance, uint32_t offset)
+{
+    uint32_t n;
+
+    if (offset < (offsetof(ADC_Type, SC1) + (ADC_SC1_COUNT * 4U)))
+    {
+        n = (offset - offsetof(ADC_Type, SC1)) / 4U;
+
+        if (s_hostsim_adc_pending[instance][n] != 0U)
+        {
+            s_hostsim_adc_pending[instance][n]--;
+
+            if (s_hostsim_adc_pending[instance][n] == 0U)
+            {
+                hostsim_adc_complete(instance, n);
+            }
+        }
+    }
+    else if ((offset >= offsetof(ADC_Type, R)) && (offset < (offsetof(ADC_Type, R) + (ADC_R_COUNT * 4U))))
+    {
+        /* Reading the result clears COCO */
+        n = (offset - offsetof(ADC_Type, R)) / 4U;
+        *HOSTSIM_Reg(s_hostsim_adc_bases[instance] + offsetof(ADC_Type, SC1) + (n * 4U)) &= ~ADC_SC1_COCO_MASK;
+    }
+}
+
+static void hostsim_adc_write(uint32_t instance, uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *reg;
+    uint32_t n;
+
+    (void)before;
+
+    if (offset >= (offsetof(ADC_Type, SC1) + (ADC_SC1_COUNT * 4U)))
+    {
+        return;
+    }
+
+    n = (offset - offsetof(ADC_Type, SC1)) / 4U;
+    reg = HOSTSIM_Reg(s_hostsim_adc_bases[instance] + offset);
+
+    /* COCO is read-only and cleared by a new trigger */
+    *reg &= ~ADC_SC1_COCO_MASK;
+    s_hostsim_adc_pending[instance][n] = 0U;
+
+    if (((*reg & ADC_SC1_ADCH_MASK) >> ADC_SC1_ADCH_SHIFT) == HOSTSIM_ADC_IDLE)
+    {
+        return;
+    }
+
+    if (HOSTSIM_ADC_CONVERSION_READS == 0U)
+    {
+        hostsim_adc_complete(instance, n);
+    }
+    else
+    {
+        s_hostsim_adc_pending[instance][n] = HOSTSIM_ADC_CONVERSION_READS;
+    }
+}
+
+static void hostsim_gpio_read(uint32_t port, uint32_t offset)
+{
+    uint32_t base = IP_PTA_BASE + (port * HOSTSIM_GPIO_STEP);
+    uint32_t pdor;
+    uint32_t pddr;
+    uint32_t pidr;
+
+    if (offset != offsetof(GPIO_Type, PDIR))
+    {
+        return;
+    }
+
+    pdor = *HOSTSIM_Reg(base + offsetof(GPIO_Type, PDOR));
+    pddr = *HOSTSIM_Reg(base + offsetof(GPIO_Type, PDDR));
+    pidr = *HOSTSIM_Reg(base + offsetof(GPIO_Type, PIDR));
+
+    *HOSTSIM_Reg(base + offset) = ((pdor & pddr) | (s_hostsim_gpio_input[port] & ~pddr)) & ~pidr;
+}
+
+static void hostsim_gpio_write(uint32_t port, uint32_t offset)
+{
+    uint32_t base = IP_PTA_BASE + (port * HOSTSIM_GPIO_STEP);
+    volatile uint32_t *pdor = HOSTSIM_Reg(base + offsetof(GPIO_Type, PDOR));
+    volatile uint32_t *reg = HOSTSIM_Reg(base + offset);
+
+    switch (offset)
+    {
+        case offsetof(GPIO_Type, PSOR):
+            *pdor |= *reg;
+            break;
+        case offsetof(GPIO_Type, PCOR):
+            *pdor &= ~*reg;
+            break;
+        case offsetof(GPIO_Type, PTOR):
+            *pdor ^= *reg;
+            break;
+        default:
+            return;
+    }
+
+    /* Write-only: always read as 0 */
+    *reg = 0U;
+}
+
+static void hostsim_port_write(uint32_t port, uint32_t offset)
+{
+    uint32_t base = IP_PORTA_BASE + (port * HOSTSIM_PORT_STEP);
+    volatile uint32_t *reg = HOSTSIM_Reg(base + offset);
+    uint32_t first_pin;
+    uint32_t pins;
+    uint32_t data;
+    uint32_t keep;
+    bool lockable;
+    uint32_t i;
+
+    switch (offset)
+    {
+        case offsetof(PORT_Type, GPCLR):
+        case offsetof(PORT_Type, GPCHR):
+            /* GPWE in the top half, PCR[15:0] data in the bottom half */
+            pins = *reg >> PORT_GPCLR_GPWE_SHIFT;
+            data = *reg & PORT_GPCLR_GPWD_MASK;
+            keep = ~PORT_GPCLR_GPWD_MASK;
+            lockable = true;
+            break;
+        case offsetof(PORT_Type, GICLR):
+        case offsetof(PORT_Type, GICHR):
+            /* GIWE in the bottom half, PCR[31:16] data in the top half */
+            pins = *reg & PORT_GICLR_GIWE_MASK;
+            data = *reg & PORT_GICLR_GIWD_MASK;
+            keep = PORT_GPCLR_GPWD_MASK;
+            lockable = false;
+            break;
+        default:
+            return;
+    }
+
+    first_pin = ((offset == offsetof(PORT_Type, GPCHR)) || (offset == offsetof(PORT_Type, GICHR))) ? 16U : 0U;
+
+    for (i = 0U; i < 16U; i++)
+    {
+        volatile uint32_t *pcr = HOSTSIM_Reg(base + offsetof(PORT_Type, PCR) + ((first_pin + i) * 4U));
+
+        /* Locked pins ignore global pin control */
+        if (((pins & (1UL << i)) != 0U) && (!lockable || ((*pcr & PORT_PCR_LK_MASK) == 0U)))
+        {
+            *pcr = (*pcr & keep) | data;
+        }
+    }
+
+    /* Write-only: always read as 0 */
+    *reg = 0U;
+}
+
+/* FlexCAN: enabled, out of freeze, so it takes part in bus traffic */
+static bool hostsim_can_on_bus(uint32_t n)
+{
+    return (*HOSTSIM_CAN_REG(n, MCR) & (FLEXCAN_MCR_MDIS_MASK | FLEXCAN_MCR_FRZACK_MASK)) == 0U;
+}
+
+/* FlexCAN: words per message buffer, from FDEN and MBDSR0 */
+static uint32_t hostsim_can_mb_words(uint32_t n)
+{
+    uint32_t mbdsr;
+
+    if ((*HOSTSIM_CAN_REG(n, MCR) & FLEXCAN_MCR_FDEN_MASK) == 0U)
+    {
+        return HOSTSIM_CAN_CLASSIC_WORDS;
+    }
+
+    mbdsr = (*HOSTSIM_CAN_REG(n, FDCTRL) & FLEXCAN_FDCTRL_MBDSR0_MASK) >> FLEXCAN_FDCTRL_MBDSR0_SHIFT;
+
+    return HOSTSIM_CAN_HEADER_WORDS + (2U << mbdsr);
+}
+
+/* FlexCAN: first mailbox after the RX FIFO engine and filter table */
+static uint32_t hostsim_can_first_mb(uint32_t n)
+{
+    uint32_t rffn;
+
+    if ((*HOSTSIM_CAN_REG(n, MCR) & FLEXCAN_MCR_RFEN_MASK) == 0U)
+    {
+        return 0U;
+    }
+
+    rffn = (*HOSTSIM_CAN_REG(n, CTRL2) & FLEXCAN_CTRL2_RFFN_MASK) >> FLEXCAN_CTRL2_RFFN_SHIFT;
+
+    return HOSTSIM_CAN_FIFO_MBS + (2U * (rffn + 1U));
+}
+
+/* FlexCAN: mailboxes in use, MAXMB + 1 bounded by the RAM */
+static uint32_t hostsim_can_mb_count(uint32_t n)
+{
+    uint32_t count = (*HOSTSIM_CAN_REG(n, MCR) & FLEXCAN_MCR_MAXMB_MASK) + 1U;
+    uint32_t fit = FLEXCAN_RAMn_COUNT / hostsim_can_mb_words(n);
+
+    return (count < fit) ? count : fit;
+}
+
+/* FlexCAN: the oldest FIFO frame into the output mailbox, BUF5I while one is there */
+static void hostsim_can_fifo_show(uint32_t n)
+{
+    const hostsim_can_fifo_entry_t *head = &s_hostsim_can_fifo[n][0];
+
+    if (s_hostsim_can_fifo_count[n] == 0U)
+    {
+        *HOSTSIM_CAN_REG(n, IFLAG1) &= ~FLEXCAN_IFLAG1_BUF5I_MASK;
+        return;
+    }
+
+    *HOSTSIM_CAN_RAM(n, 0U) = head->cs;
+    *HOSTSIM_CAN_RAM(n, 1U) = head->id;
+    *HOSTSIM_CAN_RAM(n, 2U) = head->data[0];
+    *HOSTSIM_CAN_RAM(n, 3U) = head->data[1];
+    *HOSTSIM_CAN_REG(n, RXFIR) = head->hit;
+    *HOSTSIM_CAN_REG(n, IFLAG1) |= FLEXCAN_IFLAG1_BUF5I_MASK;
+}
+
+/* FlexCAN: index of the first RX FIFO filter element accepting the frame, -1 if none */
+static int32_t hostsim_can_fifo_match(uint32_t n, const hostsim_can_frame_t *frame)
+{
+    uint32_t rffn = (*HOSTSIM_CAN_REG(n, CTRL2) & FLEXCAN_CTRL2_RFFN_MASK) >> FLEXCAN_CTRL2_RFFN_SHIFT;
+    uint32_t elements = 8U * (rffn + 1U);
+    uint32_t indiv = 0U;
+    uint32_t element;
+    uint32_t mask;
+    uint32_t i;
+
+    /* With IRMQ the first elements have individual masks, as many as MBs they cover */
+    if ((*HOSTSIM_CAN_REG(n, MCR) & FLEXCAN_MCR_IRMQ_MASK) != 0U)
+    {
+        indiv = hostsim_can_first_mb(n);
+        if (indiv > FLEXCAN_RXIMR_COUNT)
+        {
+            indiv = FLEXCAN_RXIMR_COUNT;
+        }
+    }
+
+    element = frame->remote ? HOSTSIM_CAN_FIFO_RTR : 0U;
+    if (frame->ext)
+    {
+        element |= HOSTSIM_CAN_FIFO_IDE | ((frame->id & HOSTSIM_CAN_ID_MASK) << HOSTSIM_CAN_FIFO_EXT_SHIFT);
+    }
+    else
+    {
+        element |= (frame->id & 0x7FFU) << HOSTSIM_CAN_FIFO_STD_SHIFT;
+    }
+
+    for (i = 0U; i < elements; i++)
+    {
+        mask = (i < indiv) ? *HOSTSIM_Reg(s_hostsim_can_bases[n] + offsetof(FLEXCAN_Type, RXIMR) + (i * 4U)) :
+                             *HOSTSIM_CAN_REG(n, RXFGMASK);
+
+        if (((*HOSTSIM_CAN_RAM(n, (HOSTSIM_CAN_FIFO_MBS * HOSTSIM_CAN_CLASSIC_WORDS) + i) ^ element) & mask) == 0U)
+        {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/* FlexCAN: RX mailbox for the frame, an empty one before a full one, -1 if none */
+static int32_t hostsim_can_mb_match(uint32_t n, uint32_t cs, uint32_t id)
+{
+    uint32_t words = hostsim_can_mb_words(n);
+    uint32_t count = hostsim_can_mb_count(n);
+    bool irmq = (*HOSTSIM_CAN_REG(n, MCR) & FLEXCAN_MCR_IRMQ_MASK) != 0U;
+    bool eacen = (*HOSTSIM_CAN_REG(n, CTRL2) & FLEXCAN_CTRL2_EACEN_MASK) != 0U;
+    int32_t full = -1;
+    uint32_t mb;
+
+    for (mb = hostsim_can_first_mb(n); mb < count; mb++)
+    {
+        uint32_t mbcs = *HOSTSIM_CAN_RAM(n, mb * words);
+        uint32_t code = (mbcs & HOSTSIM_CAN_CS_CODE_MASK) >> HOSTSIM_CAN_CS_CODE_SHIFT;
+        uint32_t mask;
+
+        if ((code != HOSTSIM_CAN_CODE_EMPTY) && (code != HOSTSIM_CAN_CODE_FULL) &&
+            (code != HOSTSIM_CAN_CODE_OVERRUN))
+        {
+            continue;
+        }
+
+        mask = (irmq && (mb < FLEXCAN_RXIMR_COUNT)) ?
+               *HOSTSIM_Reg(s_hostsim_can_bases[n] + offsetof(FLEXCAN_Type, RXIMR) + (mb * 4U)) :
+               *HOSTSIM_CAN_REG(n, RXMGMASK);
+
+        /* IDE is always compared without EACEN, RTR never; with EACEN both by mask */
+        if ((((mbcs ^ cs) & HOSTSIM_CAN_CS_IDE) != 0U) && (!eacen || ((mask & HOSTSIM_CAN_MASK_IDE) != 0U)))
+        {
+            continue;
+        }
+        if (eacen && ((mask & HOSTSIM_CAN_MASK_RTR) != 0U) && (((mbcs ^ cs) & HOSTSIM_CAN_CS_RTR) != 0U))
+        {
+            continue;
+        }
+        if (((*HOSTSIM_CAN_RAM(n, (mb * words) + 1U) ^ id) & mask & HOSTSIM_CAN_ID_MASK) != 0U)
+        {
+            continue;
+        }
+
+        if (code == HOSTSIM_CAN_CODE_EMPTY)
+        {
+            return (int32_t)mb;
+        }
+        if (full < 0)
+        {
+            full = (int32_t)mb;
+        }
+    }
+
+    return full;
+}
+
+static void hostsim_can_write(uint32_t n, uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *reg = HOSTSIM_Reg(s_hostsim_can_bases[n] + offset);
+    uint32_t written = *reg;
+    uint32_t value;
+    uint32_t i;
+
+    switch (offset)
+    {
+        case offsetof(FLEXCAN_Type, MCR):
+            /* Acknowledges follow the requests at once, soft reset completes at once */
+            value = written & ~(FLEXCAN_MCR_FRZACK_MASK | FLEXCAN_MCR_LPMACK_MASK |
+                                FLEXCAN_MCR_NOTRDY_MASK | FLEXCAN_MCR_SOFTRST_MASK);
+            if ((value & FLEXCAN_MCR_MDIS_MASK) != 0U)
+            {
+                value |= FLEXCAN_MCR_LPMACK_MASK | FLEXCAN_MCR_NOTRDY_MASK;
+            }
+            else if ((value & (FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK)) ==
+                     (FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK))
+            {
+                value |= FLEXCAN_MCR_FRZACK_MASK | FLEXCAN_MCR_NOTRDY_MASK;
+            }
+            if ((written & FLEXCAN_MCR_SOFTRST_MASK) != 0U)
+            {
+                s_hostsim_can_fifo_count[n] = 0U;
+            }
+            *reg = value;
+            break;
+        case offsetof(FLEXCAN_Type, IFLAG1):
+            /* Write 1 to clear; clearing BUF5I of the RX FIFO pops a frame */
+            *reg = before & ~written;
+            if (((*HOSTSIM_CAN_REG(n, MCR) & FLEXCAN_MCR_RFEN_MASK) != 0U) &&
+                ((written & before & FLEXCAN_IFLAG1_BUF5I_MASK) != 0U) && (s_hostsim_can_fifo_count[n] != 0U))
+            {
+                s_hostsim_can_fifo_count[n]--;
+                for (i = 0U; i < s_hostsim_can_fifo_count[n]; i++)
+                {
+                    s_hostsim_can_fifo[n][i] = s_hostsim_can_fifo[n][i + 1U];
+                }
+                hostsim_can_fifo_show(n);
+            }
+            break;
+        case offsetof(FLEXCAN_Type, ESR2):
+        case offsetof(FLEXCAN_Type, CRCR):
+        case offsetof(FLEXCAN_Type, RXFIR):
+            *reg = before;
+            break;
+        default:
+            break;
+    }
+}
+
+static void hostsim_ftm_write(uint32_t n, uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *reg = HOSTSIM_Reg(s_hostsim_ftm_bases[n] + offset);
+    uint32_t written = *reg;
+    uint32_t pair;
+
+    if ((offset >= offsetof(FTM_Type, CONTROLS)) &&
+        (offset < (offsetof(FTM_Type, CONTROLS) + (HOSTSIM_FTM_CHANNELS * 8U))) &&
+        (((offset - offsetof(FTM_Type, CONTROLS)) % 8U) == 0U))
+    {
+        /* CHF: writing 1 has no effect, writing 0 clears */
+        *reg = (written & ~FTM_CnSC_CHF_MASK) | (before & written & FTM_CnSC_CHF_MASK);
+        return;
+    }
+
+    switch (offset)
+    {
+        case offsetof(FTM_Type, SC):
+            /* TOF as CHF */
+            *reg = (written & ~FTM_SC_TOF_MASK) | (before & written & FTM_SC_TOF_MASK);
+            break;
+        case offsetof(FTM_Type, CNT):
+            /* Any write loads CNTIN */
+            *reg = *HOSTSIM_FTM_REG(n, CNTIN) & HOSTSIM_FTM_COUNTER_MASK;
+            break;
+        case offsetof(FTM_Type, COMBINE):
+            /* Setting DECAP arms the pair for its first edge */
+            for (pair = 0U; pair < (HOSTSIM_FTM_CHANNELS / 2U); pair++)
+            {
+                if (((written & ~before) & (FTM_COMBINE_DECAP0_MASK << (pair * HOSTSIM_FTM_PAIR_WIDTH))) != 0U)
+                {
+                    s_hostsim_ftm_decap_first[n] &= (uint8_t)~(1U << pair);
+                }
+            }
+            break;
+        case offsetof(FTM_Type, QDCTRL):
+            /* TOFDIR and QUADIR are read-only */
+            *reg = (written & ~(FTM_QDCTRL_TOFDIR_MASK | FTM_QDCTRL_QUADIR_MASK)) |
+                   (before & (FTM_QDCTRL_TOFDIR_MASK | FTM_QDCTRL_QUADIR_MASK));
+            break;
+        default:
+            break;
+    }
+}
+
+/* Capture-mode channel whose ELSB:ELSA select this edge */
+static bool hostsim_ftm_edge_match(uint32_t n, uint32_t ch, bool rising)
+{
+    uint32_t els = (*HOSTSIM_FTM_CNSC(n, ch) & (FTM_CnSC_ELSA_MASK | FTM_CnSC_ELSB_MASK)) >> FTM_CnSC_ELSA_SHIFT;
+
+    return (els & (rising ? HOSTSIM_FTM_ELS_RISING : HOSTSIM_FTM_ELS_FALLING)) != 0U;
+}
+
+/* Latch the counter into CnV and set CHF */
+static void hostsim_ftm_capture(uint32_t n, uint32_t ch)
+{
+    *HOSTSIM_FTM_CNV(n, ch) = *HOSTSIM_FTM_REG(n, CNT) & HOSTSIM_FTM_COUNTER_MASK;
+    *HOSTSIM_FTM_CNSC(n, ch) |= FTM_CnSC_CHF_MASK;
+}
+
+/* One quadrature count; wrapping at MOD/CNTIN sets TOF with TOFDIR */
+static void hostsim_ftm_quad_count(uint32_t n, bool up)
+{
+    volatile uint32_t *cnt = HOSTSIM_FTM_REG(n, CNT);
+    volatile uint32_t *qdctrl = HOSTSIM_FTM_REG(n, QDCTRL);
+    uint32_t cntin = *HOSTSIM_FTM_REG(n, CNTIN) & HOSTSIM_FTM_COUNTER_MASK;
+    uint32_t mod = *HOSTSIM_FTM_REG(n, MOD) & HOSTSIM_FTM_COUNTER_MASK;
+
+    *qdctrl = up ? (*qdctrl | FTM_QDCTRL_QUADIR_MASK) : (*qdctrl & ~FTM_QDCTRL_QUADIR_MASK);
+
+    if (up && (*cnt == mod))
+    {
+        *cnt = cntin;
+        *qdctrl |= FTM_QDCTRL_TOFDIR_MASK;
+        *HOSTSIM_FTM_REG(n, SC) |= FTM_SC_TOF_MASK;
+    }
+    else if ((!up) && (*cnt == cntin))
+    {
+        *cnt = mod;
+        *qdctrl &= ~FTM_QDCTRL_TOFDIR_MASK;
+        *HOSTSIM_FTM_REG(n, SC) |= FTM_SC_TOF_MASK;
+    }
+    else
+    {
+        *cnt = up ? (*cnt + 1U) : (*cnt - 1U);
+    }
+}
+
+/* Phase A/B edge: x4 decoding, or count on phase A rising with B as direction */
+static void hostsim_ftm_quad_edge(uint32_t n, uint32_t ch)
+{
+    uint32_t qdctrl = *HOSTSIM_FTM_REG(n, QDCTRL);
+    bool a = ((s_hostsim_ftm_input[n] & 1U) != 0U) != ((qdctrl & FTM_QDCTRL_PHAPOL_MASK) != 0U);
+    bool b = ((s_hostsim_ftm_input[n] & 2U) != 0U) != ((qdctrl & FTM_QDCTRL_PHBPOL_MASK) != 0U);
+
+    if ((qdctrl & FTM_QDCTRL_QUADMODE_MASK) != 0U)
+    {
+        if ((ch == 0U) && a)
+        {
+            hostsim_ftm_quad_count(n, b);
+        }
+        return;
+    }
+
+    /* Phase A leading B counts up: 00 -> 10 -> 11 -> 01 -> 00 */
+    hostsim_ftm_quad_count(n, (ch == 0U) ? (a != b) : (a == b));
+}
+
+/* CRC: transposition of an n-byte value, byte 0 in bits 7..0 */
+static uint32_t hostsim_crc_transpose(uint32_t value, uint32_t bytes, uint32_t type)
+{
+    uint32_t out = 0U;
+    uint32_t byte;
+    uint32_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < bytes; i++)
+    {
+        byte = (value >> (i * 8U)) & 0xFFU;
+
+        if ((type == HOSTSIM_CRC_TOT_BITS) || (type == HOSTSIM_CRC_TOT_BITS_BYTES))
+        {
+            uint32_t reflected = 0U;
+
+            for (bit = 0U; bit < 8U; bit++)
+            {
+                reflected |= ((byte >> bit) & 1U) << (7U - bit);
+            }
+            byte = reflected;
+        }
+
+        out |= byte << ((((type == HOSTSIM_CRC_TOT_BITS_BYTES) || (type == HOSTSIM_CRC_TOT_BYTES)) ?
+                         (bytes - 1U - i) : i) * 8U);
+    }
+
+    return out;
+}
+
+static void hostsim_crc_read(uint32_t offset)
+{
+    uint32_t ctrl = *HOSTSIM_CRC_REG(CTRL);
+
+    if (offset == offsetof(CRC_Type, DATAu))
+    {
+        *HOSTSIM_CRC_REG(DATAu) = hostsim_crc_transpose(s_hostsim_crc_value, 4U,
+                                                        (ctrl & CRC_CTRL_TOTR_MASK) >> CRC_CTRL_TOTR_SHIFT);
+    }
+}
+
+static void hostsim_crc_write(uint32_t offset, uint32_t bytes)
+{
+    uint32_t ctrl = *HOSTSIM_CRC_REG(CTRL);
+    uint32_t poly = *HOSTSIM_CRC_REG(GPOLY);
+    uint32_t value = *HOSTSIM_CRC_REG(DATAu);
+    bool wide = (ctrl & CRC_CTRL_TCRC_MASK) != 0U;
+    uint32_t lane = 0U;
+    uint32_t count = 0U;
+    uint32_t bit;
+
+    if ((offset != offsetof(CRC_Type, DATAu)) || (bytes == 0U))
+    {
+        return;
+    }
+
+    if ((ctrl & CRC_CTRL_WAS_MASK) != 0U)
+    {
+        s_hostsim_crc_value = wide ? value : (value & 0xFFFFU);
+        return;
+    }
+
+    while (((bytes >> lane) & 1U) == 0U)
+    {
+        lane++;
+    }
+
+    while (((lane + count) < 4U) && (((bytes >> (lane + count)) & 1U) != 0U))
+    {
+        count++;
+    }
+
+    /* The written bytes, transposed as one 8/16/32-bit datum, MSB first */
+    value = (count == 4U) ? value : ((value >> (lane * 8U)) & ((1U << (count * 8U)) - 1U));
+    value = hostsim_crc_transpose(value, count, (ctrl & CRC_CTRL_TOT_MASK) >> CRC_CTRL_TOT_SHIFT);
+
+    while (count > 0U)
+    {
+        count--;
+
+        if (wide)
+        {
+            s_hostsim_crc_value ^= ((value >> (count * 8U)) & 0xFFU) << 24U;
+
+            for (bit = 0U; bit < 8U; bit++)
+            {
+                s_hostsim_crc_value = ((s_hostsim_crc_value & 0x80000000U) != 0U) ?
+                                      ((s_hostsim_crc_value << 1U) ^ poly) : (s_hostsim_crc_value << 1U);
+            }
+        }
+        else
+        {
+            s_hostsim_crc_value ^= ((value >> (count * 8U)) & 0xFFU) << 8U;
+
+            for (bit = 0U; bit < 8U; bit++)
+            {
+                s_hostsim_crc_value = ((s_hostsim_crc_value & 0x8000U) != 0U) ?
+                                      ((s_hostsim_crc_value << 1U) ^ (poly & 0xFFFFU)) : (s_hostsim_crc_value << 1U);
+            }
+            s_hostsim_crc_value &= 0xFFFFU;
+        }
+    }
+
+    *HOSTSIM_CRC_REG(DATAu) = s_hostsim_crc_value;
+}
+
+/* LMEM: run PCCLCR[LCMD] on one line (way = HOSTSIM_LMEM_WAYS: search miss) */
+static void hostsim_lmem_line(uint32_t way, uint32_t set)
+{
+    volatile uint32_t *lcr = HOSTSIM_LMEM_REG(PCCLCR);
+    uint32_t value = *lcr & ~(LMEM_PCCLCR_LGO_MASK | LMEM_PCCLCR_LCIVB_MASK | LMEM_PCCLCR_LCIMB_MASK |
+                              LMEM_PCCLCR_LCWAY_MASK);
+    bool hit = (way < HOSTSIM_LMEM_WAYS) && s_hostsim_lmem_valid[way][set];
+
+    switch ((value & LMEM_PCCLCR_LCMD_MASK) >> LMEM_PCCLCR_LCMD_SHIFT)
+    {
+        case HOSTSIM_LMEM_LCMD_READ:
+            if (hit)
+            {
+                value |= LMEM_PCCLCR_LCIVB_MASK | LMEM_PCCLCR_LCWAY(way);
+            }
+            break;
+        case HOSTSIM_LMEM_LCMD_INVALIDATE:
+        case HOSTSIM_LMEM_LCMD_CLEAR:
+            if (hit)
+            {
+                s_hostsim_lmem_valid[way][set] = false;
+            }
+            break;
+        default:
+            /* Push: no line is ever modified */
+            break;
+    }
+
+    *lcr = value;
+}
+
+static void hostsim_lmem_write(uint32_t offset)
+{
+    volatile uint32_t *ccr = HOSTSIM_LMEM_REG(PCCCR);
+    volatile uint32_t *lcr = HOSTSIM_LMEM_REG(PCCLCR);
+    volatile uint32_t *sar = HOSTSIM_LMEM_REG(PCCSAR);
+    uint32_t address;
+    uint32_t way;
+    uint32_t set;
+
+    if ((offset == offsetof(LMEM_Type, PCCCR)) && ((*ccr & LMEM_PCCCR_GO_MASK) != 0U))
+    {
+        for (way = 0U; way < HOSTSIM_LMEM_WAYS; way++)
+        {
+            if ((*ccr & ((way == 0U) ? LMEM_PCCCR_INVW0_MASK : LMEM_PCCCR_INVW1_MASK)) != 0U)
+            {
+                for (set = 0U; set < HOSTSIM_LMEM_SETS; set++)
+                {
+                    s_hostsim_lmem_valid[way][set] = false;
+                }
+            }
+        }
+        *ccr &= ~LMEM_PCCCR_GO_MASK;
+    }
+    else if ((offset == offsetof(LMEM_Type, PCCLCR)) && ((*lcr & LMEM_PCCLCR_LGO_MASK) != 0U))
+    {
+        /* Set/way command: CACHEADDR is the word address within the way */
+        way = (*lcr & LMEM_PCCLCR_WSEL_MASK) >> LMEM_PCCLCR_WSEL_SHIFT;
+        set = (((*lcr & LMEM_PCCLCR_CACHEADDR_MASK) >> LMEM_PCCLCR_CACHEADDR_SHIFT) /
+               (HOSTSIM_LMEM_LINE_SIZE / 4U)) % HOSTSIM_LMEM_SETS;
+        hostsim_lmem_line(way, set);
+    }
+    else if ((offset == offsetof(LMEM_Type, PCCSAR)) && ((*sar & LMEM_PCCSAR_LGO_MASK) != 0U))
+    {
+        /* Search command: the way holding the line, if any */
+        address = *sar & ~(HOSTSIM_LMEM_LINE_SIZE - 1U);
+        set = (address / HOSTSIM_LMEM_LINE_SIZE) % HOSTSIM_LMEM_SETS;
+
+        for (way = 0U; way < HOSTSIM_LMEM_WAYS; way++)
+        {
+            if (s_hostsim_lmem_valid[way][set] && (s_hostsim_lmem_tag[way][set] == address))
+            {
+                break;
+            }
+        }
+
+        hostsim_lmem_line(way, set);
+        *sar &= ~LMEM_PCCSAR_LGO_MASK;
+    }
+    else
+    {
+        /* Configuration only */
+    }
+}
+
+/*
+ * FTFC: flash bytes of a FCCOB address checked for alignment and range
+ * (ACCERR) and protection (FPVIOL); returns those FSTAT bits
+ */
+static uint32_t hostsim_ftfc_target(uint32_t addr, uint32_t len, uint8_t **bytes)
+{
+    uint32_t prot;
+    uint32_t region;
+
+    if ((addr % len) != 0U)
+    {
+        return FTFC_FSTAT_ACCERR_MASK;
+    }
+
+    if ((addr & HOSTSIM_FTFC_DFLASH_FCCOB) != 0U)
+    {
+        addr &= ~HOSTSIM_FTFC_DFLASH_FCCOB;
+        if (addr >= HOSTSIM_FTFC_DFLASH_SIZE)
+        {
+            return FTFC_FSTAT_ACCERR_MASK;
+        }
+        prot = HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FDPROT));
+        region = addr / HOSTSIM_FTFC_DFLASH_REGION;
+        *bytes = &s_hostsim_dflash[addr];
+    }
+    else
+    {
+        if (addr >= HOSTSIM_FTFC_PFLASH_SIZE)
+        {
+            return FTFC_FSTAT_ACCERR_MASK;
+        }
+        /* FPROT3 (regions 0..7) is the first byte */
+        prot = *HOSTSIM_Reg(IP_FTFC_BASE + offsetof(FTFC_Type, FPROT));
+        region = addr / HOSTSIM_FTFC_PFLASH_REGION;
+        *bytes = &s_hostsim_pflash[addr];
+    }
+
+    return (((prot >> region) & 1U) != 0U) ? 0U : FTFC_FSTAT_FPVIOL_MASK;
+}
+
+/* FTFC: run the command loaded in FCCOB, returns the FSTAT error bits */
+static uint32_t hostsim_ftfc_command(void)
+{
+    uint32_t addr = ((uint32_t)HOSTSIM_FTFC_FCCOB(1U) << 16U) | ((uint32_t)HOSTSIM_FTFC_FCCOB(2U) << 8U) |
+                    (uint32_t)HOSTSIM_FTFC_FCCOB(3U);
+    uint32_t fcnfg = HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FCNFG));
+    uint32_t status;
+    uint32_t i;
+    uint8_t *bytes = NULL;
+    uint8_t data;
+
+    switch (HOSTSIM_FTFC_FCCOB(0U))
+    {
+        case HOSTSIM_FTFC_CMD_PROGRAM_PHRASE:
+            status = hostsim_ftfc_target(addr, HOSTSIM_FTFC_PHRASE, &bytes);
+            /* Phrase bytes are FCCOB4..B in register (memory) order; bits only go 1 -> 0 */
+            for (i = 0U; (status == 0U) && (i < HOSTSIM_FTFC_PHRASE); i++)
+            {
+                data = HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FCCOB) + 4U + i);
+                status = ((bytes[i] & data) != data) ? FTFC_FSTAT_MGSTAT0_MASK : 0U;
+                bytes[i] &= data;
+            }
+            return status;
+
+        case HOSTSIM_FTFC_CMD_ERASE_SECTOR:
+            i = ((addr & HOSTSIM_FTFC_DFLASH_FCCOB) != 0U) ? HOSTSIM_FTFC_DFLASH_SECTOR : HOSTSIM_FTFC_PFLASH_SECTOR;
+            status = hostsim_ftfc_target(addr, i, &bytes);
+            if (status == 0U)
+            {
+                memset(bytes, 0xFF, i);
+            }
+            return status;
+
+        case HOSTSIM_FTFC_CMD_PROGRAM_PARTITION:
+            if (s_hostsim_ftfc_partitioned)
+            {
+                return FTFC_FSTAT_ACCERR_MASK;
+            }
+            s_hostsim_ftfc_partitioned = true;
+            return 0U;
+
+        case HOSTSIM_FTFC_CMD_SET_FLEXRAM:
+            if (HOSTSIM_FTFC_FCCOB(1U) == HOSTSIM_FTFC_FLEXRAM_RAM)
+            {
+                fcnfg = (fcnfg & ~FTFC_FCNFG_EEERDY_MASK) | FTFC_FCNFG_RAMRDY_MASK;
+            }
+            else if ((HOSTSIM_FTFC_FCCOB(1U) == HOSTSIM_FTFC_FLEXRAM_EEE) && s_hostsim_ftfc_partitioned)
+            {
+                fcnfg = (fcnfg & ~FTFC_FCNFG_RAMRDY_MASK) | FTFC_FCNFG_EEERDY_MASK;
+            }
+            else
+            {
+                return FTFC_FSTAT_ACCERR_MASK;
+            }
+            HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FCNFG)) = (uint8_t)fcnfg;
+            return 0U;
+
+        default:
+            /* Program Section needs FlexRAM, which is not modelled */
+            return FTFC_FSTAT_ACCERR_MASK;
+    }
+}
+
+static void hostsim_ftfc_write(uint32_t offset, uint32_t before, uint32_t bytes)
+{
+    volatile uint32_t *reg = HOSTSIM_Reg(IP_FTFC_BASE + offset);
+    uint32_t written = *reg;
+    uint32_t fstat;
+
+    if (offset != 0U)
+    {
+        return;
+    }
+
+    *reg = (written & ~HOSTSIM_FTFC_READ_ONLY) | (before & HOSTSIM_FTFC_READ_ONLY);
+
+    if ((bytes & 1U) == 0U)
+    {
+        return;
+    }
+
+    /* Error flags are write-1-to-clear, CCIF = 1 launches unless ACCERR/FPVIOL remain */
+    fstat = (before & 0xFFU) & ~(written & HOSTSIM_FTFC_ERRORS);
+    if (((written & FTFC_FSTAT_CCIF_MASK) != 0U) &&
+        ((fstat & (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK)) == 0U))
+    {
+        fstat = (fstat & ~FTFC_FSTAT_MGSTAT0_MASK) | hostsim_ftfc_command();
+    }
+
+    *reg = (*reg & ~0xFFU) | fstat;
+}
+
+static void hostsim_wdog_write(uint32_t offset, uint32_t before)
+{
+    volatile uint32_t *cs = HOSTSIM_WDOG_REG(CS);
+    volatile uint32_t *reg = HOSTSIM_Reg(IP_WDOG_BASE + offset);
+    uint32_t written = *reg;
+    uint32_t unlocked = ((offset == offsetof(WDOG_Type, CS)) ? before : *cs) & WDOG_CS_ULK_MASK;
+
+    if (offset == offsetof(WDOG_Type, CNT))
+    {
+        /* The counter is not modelled: CNT reads as 0, the keys act on CS */
+        *reg = 0U;
+        if ((written == HOSTSIM_WDOG_UNLOCK) && ((*cs & WDOG_CS_UPDATE_MASK) != 0U))
+        {
+            *cs = (*cs | WDOG_CS_ULK_MASK) & ~WDOG_CS_RCS_MASK;
+        }
+        return;
+    }
+
+    if (unlocked == 0U)
+    {
+        *reg = before;
+        return;
+    }
+
+    if (offset == offsetof(WDOG_Type, CS))
+    {
+        /* FLG is write-1-to-clear; the new configuration takes effect at once */
+        *cs = (written & ~(WDOG_CS_ULK_MASK | WDOG_CS_RCS_MASK | WDOG_CS_FLG_MASK)) | WDOG_CS_RCS_MASK |
+              (before & WDOG_CS_FLG_MASK & ~written);
+    }
+}
+
+/* NVIC: ISER/ICER and ISPR/ICPR both read as the state they set/clear */
+static void hostsim_nvic_write(uint32_t offset, uint32_t before)
+{
+    uint32_t group = offset & ~(HOSTSIM_NVIC_CLEAR | 0x7FU);
+    uint32_t word = (offset & 0x7FU) / 4U;
+    volatile uint32_t *set_reg;
+    volatile uint32_t *clear_reg;
+    uint32_t state;
+
+    if ((group > HOSTSIM_NVIC_PENDING) || (word >= HOSTSIM_NVIC_WORDS))
+    {
+        return;
+    }
+
+    set_reg = HOSTSIM_Reg(HOSTSIM_NVIC_BASE + group + (word * 4U));
+    clear_reg = HOSTSIM_Reg(HOSTSIM_NVIC_BASE + group + HOSTSIM_NVIC_CLEAR + (word * 4U));
+    state = ((offset & HOSTSIM_NVIC_CLEAR) != 0U) ? (before & ~*clear_reg) : (before | *set_reg);
+
+    *set_reg = state;
+    *clear_reg = state;
+}
+
+/* Reset values of the modelled registers, after all memory is cleared */
+void hostsim_models_reset(void)
+{
+    uint32_t i;
+
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, CSR)) = HOSTSIM_SCG_CCR_RESET;
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, RCCR)) = HOSTSIM_SCG_CCR_RESET;
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, VCCR)) = HOSTSIM_SCG_VCCR_RESET;
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, HCCR)) = HOSTSIM_SCG_CCR_RESET;
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, FIRCCSR)) = HOSTSIM_SCG_FIRCCSR_RESET;
+    *HOSTSIM_Reg(IP_SCG_BASE + offsetof(SCG_Type, SIRCCSR)) = HOSTSIM_SCG_SIRCCSR_RESET;
+
+    for (i = 0U; i < HOSTSIM_SCG_SOURCE_COUNT; i++)
+    {
+        s_hostsim_scg_reads[i] = 0U;
+    }
+
+    *HOSTSIM_Reg(IP_SMC_BASE + offsetof(SMC_Type, PMSTAT)) = HOSTSIM_SMC_PMSTAT_RUN;
+    s_hostsim_smc_pmprot_written = false;
+
+    for (i = 0U; i < sizeof(s_hostsim_pcc_present); i++)
+    {
+        *HOSTSIM_Reg(IP_PCC_BASE + (s_hostsim_pcc_present[i] * 4U)) = PCC_PCCn_PR_MASK;
+    }
+
+    for (i = 0U; i < HOSTSIM_ADC_COUNT; i++)
+    {
+        uint32_t n;
+
+        for (n = 0U; n < ADC_SC1_COUNT; n++)
+        {
+            *HOSTSIM_Reg(s_hostsim_adc_bases[i] + offsetof(ADC_Type, SC1) + (n * 4U)) =
+                ADC_SC1_ADCH(HOSTSIM_ADC_IDLE);
+            s_hostsim_adc_pending[i][n] = 0U;
+        }
+    }
+
+    /* FlexCAN disabled out of reset */
+    for (i = 0U; i < HOSTSIM_CAN_COUNT; i++)
+    {
+        *HOSTSIM_CAN_REG(i, MCR) = FLEXCAN_MCR_MDIS_MASK | FLEXCAN_MCR_LPMACK_MASK | FLEXCAN_MCR_NOTRDY_MASK |
+                                   FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK | FLEXCAN_MCR_MAXMB(0xFU);
+        s_hostsim_can_fifo_count[i] = 0U;
+    }
+
+    /* FTM: registers 0 but MODE[WPDIS], inputs low */
+    for (i = 0U; i < HOSTSIM_FTM_COUNT; i++)
+    {
+        *HOSTSIM_FTM_REG(i, MODE) = FTM_MODE_WPDIS_MASK;
+        s_hostsim_ftm_input[i] = 0U;
+        s_hostsim_ftm_decap_first[i] = 0U;
+    }
+
+    /* CRC: 32 ones in the shift register, CRC-CCITT polynomial */
+    *HOSTSIM_CRC_REG(DATAu) = 0xFFFFFFFFU;
+    *HOSTSIM_CRC_REG(GPOLY) = HOSTSIM_CRC_GPOLY_RESET;
+    s_hostsim_crc_value = 0xFFFFFFFFU;
+
+    /* LMEM: cache off and empty */
+    *HOSTSIM_LMEM_REG(PCCRMR) = HOSTSIM_LMEM_PCCRMR_RESET;
+    memset(s_hostsim_lmem_valid, 0, sizeof(s_hostsim_lmem_valid));
+
+    /* FTFC: idle, unprotected, erased, FlexRAM not available */
+    HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FSTAT)) = FTFC_FSTAT_CCIF_MASK;
+    *HOSTSIM_Reg(IP_FTFC_BASE + offsetof(FTFC_Type, FPROT)) = 0xFFFFFFFFU;
+    HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FEPROT)) = 0xFFU;
+    HOSTSIM_FTFC_BYTE(offsetof(FTFC_Type, FDPROT)) = 0xFFU;
+    memset(s_hostsim_pflash, 0xFF, sizeof(s_hostsim_pflash));
+    memset(s_hostsim_dflash, 0xFF, sizeof(s_hostsim_dflash));
+    s_hostsim_ftfc_partitioned = false;
+
+    *HOSTSIM_WDOG_REG(CS) = HOSTSIM_WDOG_CS_RESET;
+    *HOSTSIM_WDOG_REG(TOVAL) = HOSTSIM_WDOG_TOVAL_RESET;
+}
+
+/* Before a driver load from the word at address */
+void hostsim_model_read(uint32_t address)
+{
+    uint32_t i;
+
+    if ((address >= IP_SCG_BASE) && (address < (IP_SCG_BASE + sizeof(SCG_Type))))
+    {
+        hostsim_scg_read(address - IP_SCG_BASE);
+        return;
+    }
+
+    for (i = 0U; i < HOSTSIM_ADC_COUNT; i++)
+    {
+        if ((address >= s_hostsim_adc_bases[i]) && (address < (s_hostsim_adc_bases[i] + sizeof(ADC_Type))))
+        {
+            hostsim_adc_read(i, address - s_hostsim_adc_bases[i]);
+            return;
+        }
+    }
+
+    if ((address >= IP_PTA_BASE) && (address < (IP_PTA_BASE + (HOSTSIM_GPIO_COUNT * HOSTSIM_GPIO_STEP))))
+    {
+        hostsim_gpio_read((address - IP_PTA_BASE) / HOSTSIM_GPIO_STEP, (address - IP_PTA_BASE) % HOSTSIM_GPIO_STEP);
+        return;
+    }
+
+    if ((address >= IP_CRC_BASE) && (address < (IP_CRC_BASE + sizeof(CRC_Type))))
+    {
+        hostsim_crc_read(address - IP_CRC_BASE);
+    }
+}
+
+/*
+ * After a driver store to the word at address, before = previous contents,
+ * bytes = lanes written (bit n = byte n, 0xF for a 32-bit store)
+ */
+void hostsim_model_write(uint32_t address, uint32_t before, uint32_t bytes)
+{
+    uint32_t i;
+
+    if ((address >= IP_SCG_BASE) && (address < (IP_SCG_BASE + sizeof(SCG_Type))))
+    {
+        hostsim_scg_write(address - IP_SCG_BASE, before);
+        return;
+    }
+
+    if ((address >= IP_PCC_BASE) && (address < (IP_PCC_BASE + (HOSTSIM_PCC_SLOTS * 4U))))
+    {
+        hostsim_pcc_write(address - IP_PCC_BASE, before);
+        return;
+    }
+
+    if ((address >= IP_SMC_BASE) && (address < (IP_SMC_BASE + sizeof(SMC_Type))))
+    {
+        hostsim_smc_write(address - IP_SMC_BASE, before);
+        return;
+    }
+
+    for (i = 0U; i < HOSTSIM_ADC_COUNT; i++)
+    {
+        if ((address >= s_hostsim_adc_bases[i]) && (address < (s_hostsim_adc_bases[i] + sizeof(ADC_Type))))
+        {
+            hostsim_adc_write(i, address - s_hostsim_adc_bases[i], before);
+            return;
+        }
+    }
+
+    if ((address >= IP_PTA_BASE) && (address < (IP_PTA_BASE + (HOSTSIM_GPIO_COUNT * HOSTSIM_GPIO_STEP))))
+    {
+        hostsim_gpio_write((address - IP_PTA_BASE) / HOSTSIM_GPIO_STEP, (address - IP_PTA_BASE) % HOSTSIM_GPIO_STEP);
+        return;
+    }
+
+    if ((address >= IP_PORTA_BASE) && (address < (IP_PORTA_BASE + (HOSTSIM_PORT_COUNT * HOSTSIM_PORT_STEP))))
+    {
+        hostsim_port_write((address - IP_PORTA_BASE) / HOSTSIM_PORT_STEP, (address - IP_PORTA_BASE) % HOSTSIM_PORT_STEP);
+        return;
+    }
+
+    for (i = 0U; i < HOSTSIM_CAN_COUNT; i++)
+    {
+        if ((address >= s_hostsim_can_bases[i]) && (address < (s_hostsim_can_bases[i] + sizeof(FLEXCAN_Type))))
+        {
+            hostsim_can_write(i, address - s_hostsim_can_bases[i], before);
+            return;
+        }
+    }
+
+    for (i = 0U; i < HOSTSIM_FTM_COUNT; i++)
+    {
+        if ((address >= s_hostsim_ftm_bases[i]) && (address < (s_hostsim_ftm_bases[i] + sizeof(FTM_Type))))
+        {
+            hostsim_ftm_write(i, address - s_hostsim_ftm_bases[i], before);
+            return;
+        }
+    }
+
+    if ((address >= IP_CRC_BASE) && (address < (IP_CRC_BASE + sizeof(CRC_Type))))
+    {
+        hostsim_crc_write(address - IP_CRC_BASE, bytes);
+        return;
+    }
+
+    if ((address >= IP_FTFC_BASE) && (address < (IP_FTFC_BASE + sizeof(FTFC_Type))))
+    {
+        hostsim_ftfc_write(address - IP_FTFC_BASE, before, bytes);
+        return;
+    }
+
+    if ((address >= IP_WDOG_BASE) && (address < (IP_WDOG_BASE + sizeof(WDOG_Type))))
+    {
+        hostsim_wdog_write(address - IP_WDOG_BASE, before);
+        return;
+    }
+
+    if ((address >= IP_LMEM_BASE) && (address < (IP_LMEM_BASE + sizeof(LMEM_Type))))
+    {
+        hostsim_lmem_write(address - IP_LMEM_BASE);
+        return;
+    }
+
+    if ((address >= HOSTSIM_NVIC_BASE) &&
+        (address < (HOSTSIM_NVIC_BASE + HOSTSIM_NVIC_PENDING + HOSTSIM_NVIC_CLEAR + (HOSTSIM_NVIC_WORDS * 4U))))
+    {
+        hostsim_nvic_write(address - HOSTSIM_NVIC_BASE, before);
+    }
+}
+
+/**
+ * @brief Change the SCG model's reads-until-valid (0 = valid at once).
+ */
+void HOSTSIM_ScgSetValidReads(uint32_t reads)
+{
+    s_hostsim_scg_valid_reads = reads;
+}
+
+/**
+ * @brief Set the value the ADC model converts on a channel.
+ *
+ * @param instance 0 or 1.
+ * @param channel SC1[ADCH] value.
+ * @param value Conversion result.
+ * @return HOSTSIM_STATUS_t SUCCESS or ERROR.
+ */
+HOSTSIM_STATUS_t HOSTSIM_AdcSetInput(uint8_t instance, uint8_t channel, uint16_t value)
+{
+    if ((instance >= HOSTSIM_ADC_COUNT) || (channel >= HOSTSIM_ADC_CHANNELS))
+    {
+        return HOSTSIM_STATUS_ERROR;
+    }
+
+    s_hostsim_adc_input[instance][channel] = value;
+
+    return HOSTSIM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Set the levels the GPIO model returns in PDIR for input pins.
+ *
+ * @param port 0 (PTA) .. 4 (PTE).
+ * @param levels Pin levels, bit n = pin n.
+ * @return HOSTSIM_STATUS_t SUCCESS or ERROR.
+ */
+HOSTSIM_STATUS_t HOSTSIM_GpioSetInput(uint8_t port, uint32_t levels)
+{
+    if (port >= HOSTSIM_GPIO_COUNT)
+    {
+        return HOSTSIM_STATUS_ERROR;
+    }
+
+    s_hostsim_gpio_input[port] = levels;
+
+    return HOSTSIM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Put a frame on the bus of a FlexCAN instance.
+ *
+ * @param instance 0..2.
+ * @param frame Frame, ID right-aligned.
+ * @return HOSTSIM_CAN_RX_t Where the frame went.
+ */
+HOSTSIM_CAN_RX_t HOSTSIM_CanReceive(uint8_t instance, const hostsim_can_frame_t *frame)
+{
+    hostsim_can_fifo_entry_t *entry;
+    uint32_t words;
+    uint32_t length;
+    uint32_t timer;
+    uint32_t cs;
+    uint32_t id;
+    int32_t hit = -1;
+    int32_t mb;
+    uint32_t i;
+
+    if ((instance >= HOSTSIM_CAN_COUNT) || (frame == NULL) || (frame->dlc > 15U) ||
+        (!frame->fd && (frame->dlc > 8U)) || !hostsim_can_on_bus(instance))
+    {
+        return HOSTSIM_CAN_REJECTED;
+    }
+
+    timer = (*HOSTSIM_CAN_REG(instance, TIMER) + 1U) & FLEXCAN_TIMER_TIMER_MASK;
+    *HOSTSIM_CAN_REG(instance, TIMER) = timer;
+
+    cs = ((uint32_t)frame->dlc << HOSTSIM_CAN_CS_DLC_SHIFT) | timer;
+    if (frame->ext)
+    {
+        cs |= HOSTSIM_CAN_CS_IDE | HOSTSIM_CAN_CS_SRR;
+        id = frame->id & HOSTSIM_CAN_ID_MASK;
+    }
+    else
+    {
+        id = (frame->id & 0x7FFU) << HOSTSIM_CAN_ID_STD_SHIFT;
+    }
+    if (frame->remote)
+    {
+        cs |= HOSTSIM_CAN_CS_RTR;
+    }
+    if (frame->fd)
+    {
+        cs |= HOSTSIM_CAN_CS_EDL | (frame->brs ? HOSTSIM_CAN_CS_BRS : 0U);
+    }
+    length = frame->remote ? 0U : s_hostsim_can_dlc_len[frame->dlc];
+
+    /* The RX FIFO (classic frames only) is matched before the mailboxes */
+    if (((*HOSTSIM_CAN_REG(instance, MCR) & FLEXCAN_MCR_RFEN_MASK) != 0U) && !frame->fd)
+    {
+        hit = hostsim_can_fifo_match(instance, frame);
+
+        if ((hit >= 0) && (s_hostsim_can_fifo_count[instance] < HOSTSIM_CAN_FIFO_DEPTH))
+        {
+            entry = &s_hostsim_can_fifo[instance][s_hostsim_can_fifo_count[instance]];
+            entry->cs = cs;
+            entry->id = id;
+            entry->hit = (uint32_t)hit;
+            for (i = 0U; i < 2U; i++)
+            {
+                entry->data[i] = ((uint32_t)frame->data[4U * i] << 24) | ((uint32_t)frame->data[(4U * i) + 1U] << 16) |
+                                 ((uint32_t)frame->data[(4U * i) + 2U] << 8) | (uint32_t)frame->data[(4U * i) + 3U];
+            }
+
+            s_hostsim_can_fifo_count[instance]++;
+            if (s_hostsim_can_fifo_count[instance] == 1U)
+            {
+                hostsim_can_fifo_show(instance);
+            }
+            if (s_hostsim_can_fifo_count[instance] == HOSTSIM_CAN_FIFO_WARNING)
+            {
+                *HOSTSIM_CAN_REG(instance, IFLAG1) |= FLEXCAN_IFLAG1_BUF6I_MASK;
+            }
+
+            return HOSTSIM_CAN_FIFO;
+        }
+    }
+
+    mb = hostsim_can_mb_match(instance, cs, id);
+    if (mb >= 0)
+    {
+        volatile uint32_t *mbw = HOSTSIM_CAN_RAM(instance, (uint32_t)mb * hostsim_can_mb_words(instance));
+        uint32_t code = (mbw[0] & HOSTSIM_CAN_CS_CODE_MASK) >> HOSTSIM_CAN_CS_CODE_SHIFT;
+
+        /* A full mailbox not yet serviced (flag still set) overruns */
+        if ((code != HOSTSIM_CAN_CODE_EMPTY) && (*HOSTSIM_CAN_REG(instance, IFLAG1) & (1UL << (uint32_t)mb)) != 0U)
+        {
+            code = HOSTSIM_CAN_CODE_OVERRUN;
+        }
+        else
+        {
+            code = HOSTSIM_CAN_CODE_FULL;
+        }
+
+        words = (length + 3U) / 4U;
+        if (words > (hostsim_can_mb_words(instance) - HOSTSIM_CAN_HEADER_WORDS))
+        {
+            words = hostsim_can_mb_words(instance) - HOSTSIM_CAN_HEADER_WORDS;
+        }
+
+        mbw[1] = id;
+        for (i = 0U; i < words; i++)
+        {
+            mbw[HOSTSIM_CAN_HEADER_WORDS + i] = ((uint32_t)frame->data[4U * i] << 24) |
+                                                ((uint32_t)frame->data[(4U * i) + 1U] << 16) |
+                                                ((uint32_t)frame->data[(4U * i) + 2U] << 8) |
+                                                (uint32_t)frame->data[(4U * i) + 3U];
+        }
+        mbw[0] = cs | (code << HOSTSIM_CAN_CS_CODE_SHIFT);
+        *HOSTSIM_CAN_REG(instance, IFLAG1) |= 1UL << (uint32_t)mb;
+
+        return HOSTSIM_CAN_MAILBOX;
+    }
+
+    /* Accepted by the FIFO but no room anywhere */
+    if (hit >= 0)
+    {
+        *HOSTSIM_CAN_REG(instance, IFLAG1) |= FLEXCAN_IFLAG1_BUF7I_MASK;
+        return HOSTSIM_CAN_LOST;
+    }
+
+    return HOSTSIM_CAN_REJECTED;
+}
+
+/**
+ * @brief Let a FlexCAN instance win arbitration once and send a frame.
+ *
+ * @param instance 0..2.
+ * @param frame Sent frame out, may be NULL.
+ * @return int32_t Mailbox sent from, -1 if none is pending.
+ */
+int32_t HOSTSIM_CanTransmit(uint8_t instance, hostsim_can_frame_t *frame)
+{
+    uint32_t words;
+    uint32_t count;
+    uint32_t key;
+    uint32_t bestKey = 0xFFFFFFFFU;
+    int32_t best = -1;
+    uint32_t length;
+    volatile uint32_t *mbw;
+    uint32_t timer;
+    uint32_t mb;
+    uint32_t i;
+
+    if ((instance >= HOSTSIM_CAN_COUNT) || !hostsim_can_on_bus(instance))
+    {
+        return -1;
+    }
+
+    words = hostsim_can_mb_words(instance);
+    count = hostsim_can_mb_count(instance);
+
+    /* Lowest arbitration value wins, PRIO first with LPRIOEN; ties go to the lowest mailbox */
+    for (mb = hostsim_can_first_mb(instance); mb < count; mb++)
+    {
+        mbw = HOSTSIM_CAN_RAM(instance, mb * words);
+        if (((mbw[0] & HOSTSIM_CAN_CS_CODE_MASK) >> HOSTSIM_CAN_CS_CODE_SHIFT) != HOSTSIM_CAN_CODE_TX_DATA)
+        {
+            continue;
+        }
+
+        key = mbw[1];
+        if ((*HOSTSIM_CAN_REG(instance, MCR) & FLEXCAN_MCR_LPRIOEN_MASK) == 0U)
+        {
+            key &= ~HOSTSIM_CAN_ID_PRIO_MASK;
+        }
+        if ((best < 0) || (key < bestKey))
+        {
+            bestKey = key;
+            best = (int32_t)mb;
+        }
+    }
+
+    if (best < 0)
+    {
+        return -1;
+    }
+
+    mbw = HOSTSIM_CAN_RAM(instance, (uint32_t)best * words);
+
+    if (frame != NULL)
+    {
+        frame->ext = (mbw[0] & HOSTSIM_CAN_CS_IDE) != 0U;
+        frame->remote = (mbw[0] & HOSTSIM_CAN_CS_RTR) != 0U;
+        frame->fd = (mbw[0] & HOSTSIM_CAN_CS_EDL) != 0U;
+        frame->brs = (mbw[0] & HOSTSIM_CAN_CS_BRS) != 0U;
+        frame->dlc = (uint8_t)((mbw[0] & HOSTSIM_CAN_CS_DLC_MASK) >> HOSTSIM_CAN_CS_DLC_SHIFT);
+        frame->id = frame->ext ? (mbw[1] & HOSTSIM_CAN_ID_MASK) : ((mbw[1] & HOSTSIM_CAN_ID_MASK) >> HOSTSIM_CAN_ID_STD_SHIFT);
+
+        length = frame->remote ? 0U : s_hostsim_can_dlc_len[frame->dlc];
+        if (!frame->fd && (length > 8U))
+        {
+            length = 8U;
+        }
+        if (length > ((words - HOSTSIM_CAN_HEADER_WORDS) * 4U))
+        {
+            length = (words - HOSTSIM_CAN_HEADER_WORDS) * 4U;
+        }
+        for (i = 0U; i < length; i++)
+        {
+            frame->data[i] = (uint8_t)(mbw[HOSTSIM_CAN_HEADER_WORDS + (i / 4U)] >> (24U - (8U * (i % 4U))));
+        }
+    }
+
+    timer = (*HOSTSIM_CAN_REG(instance, TIMER) + 1U) & FLEXCAN_TIMER_TIMER_MASK;
+    *HOSTSIM_CAN_REG(instance, TIMER) = timer;
+
+    mbw[0] = (mbw[0] & ~(HOSTSIM_CAN_CS_CODE_MASK | FLEXCAN_TIMER_TIMER_MASK)) |
+             (HOSTSIM_CAN_CODE_TX_INACTIVE << HOSTSIM_CAN_CS_CODE_SHIFT) | timer;
+    if ((uint32_t)best < 32U)
+    {
+        *HOSTSIM_CAN_REG(instance, IFLAG1) |= 1UL << (uint32_t)best;
+    }
+
+    return best;
+}
+
+/**
+ * @brief Run the counter of an FTM instance.
+ *
+ * @param instance 0..3.
+ * @param counts Counter increments (prescaled clock ticks).
+ */
+void HOSTSIM_FtmAdvance(uint8_t instance, uint32_t counts)
+{
+    volatile uint32_t *cnt;
+    uint32_t cntin;
+    uint32_t period;
+    uint32_t offset;
+
+    if ((instance >= HOSTSIM_FTM_COUNT) || ((*HOSTSIM_FTM_REG(instance, SC) & FTM_SC_CLKS_MASK) == 0U) ||
+        ((*HOSTSIM_FTM_REG(instance, QDCTRL) & FTM_QDCTRL_QUADEN_MASK) != 0U))
+    {
+        return;
+    }
+
+    cnt = HOSTSIM_FTM_REG(instance, CNT);
+    cntin = *HOSTSIM_FTM_REG(instance, CNTIN) & HOSTSIM_FTM_COUNTER_MASK;
+    period = (*HOSTSIM_FTM_REG(instance, MOD) & HOSTSIM_FTM_COUNTER_MASK) - cntin + 1U;
+    offset = *cnt - cntin;
+
+    /* Up counting CNTIN..MOD; every pass through MOD sets TOF */
+    if (((uint64_t)offset + counts) >= period)
+    {
+        *HOSTSIM_FTM_REG(instance, SC) |= FTM_SC_TOF_MASK;
+    }
+    *cnt = cntin + (uint32_t)(((uint64_t)offset + counts) % period);
+}
+
+/**
+ * @brief Drive an FTM channel input to a level.
+ *
+ * @param instance 0..3.
+ * @param channel 0..7; 0/1 are phase A/B with QDCTRL[QUADEN].
+ * @param level Input level; only a change is an edge.
+ * @return HOSTSIM_STATUS_t SUCCESS or ERROR.
+ */
+HOSTSIM_STATUS_t HOSTSIM_FtmSetInput(uint8_t instance, uint8_t channel, bool level)
+{
+    uint32_t combine;
+    uint32_t pair;
+    uint32_t first;
+    uint32_t mode;
+
+    if ((instance >= HOSTSIM_FTM_COUNT) || (channel >= HOSTSIM_FTM_CHANNELS))
+    {
+        return HOSTSIM_STATUS_ERROR;
+    }
+
+    if ((((s_hostsim_ftm_input[instance] >> channel) & 1U) != 0U) == level)
+    {
+        return HOSTSIM_STATUS_SUCCESS;
+    }
+    s_hostsim_ftm_input[instance] ^= (uint8_t)(1U << channel);
+
+    if (((*HOSTSIM_FTM_REG(instance, QDCTRL) & FTM_QDCTRL_QUADEN_MASK) != 0U) && (channel < 2U))
+    {
+        hostsim_ftm_quad_edge(instance, channel);
+        return HOSTSIM_STATUS_SUCCESS;
+    }
+
+    combine = *HOSTSIM_FTM_REG(instance, COMBINE);
+    pair = channel / 2U;
+    first = 2U * pair;
+
+    if (((combine >> (pair * HOSTSIM_FTM_PAIR_WIDTH)) & FTM_COMBINE_DECAPEN0_MASK) != 0U)
+    {
+        /* Dual edge: the even input feeds both channels, armed by DECAP */
+        if ((channel != first) ||
+            (((combine >> (pair * HOSTSIM_FTM_PAIR_WIDTH)) & FTM_COMBINE_DECAP0_MASK) == 0U))
+        {
+            return HOSTSIM_STATUS_SUCCESS;
+        }
+
+        if ((s_hostsim_ftm_decap_first[instance] & (1U << pair)) == 0U)
+        {
+            if (hostsim_ftm_edge_match(instance, first, level))
+            {
+                hostsim_ftm_capture(instance, first);
+                s_hostsim_ftm_decap_first[instance] |= (uint8_t)(1U << pair);
+            }
+        }
+        else if (hostsim_ftm_edge_match(instance, first + 1U, level))
+        {
+            hostsim_ftm_capture(instance, first + 1U);
+            s_hostsim_ftm_decap_first[instance] &= (uint8_t)~(1U << pair);
+            if ((*HOSTSIM_FTM_CNSC(instance, first) & FTM_CnSC_MSA_MASK) == 0U)
+            {
+                /* One-shot: disarm after the second edge */
+                *HOSTSIM_FTM_REG(instance, COMBINE) &= ~(FTM_COMBINE_DECAP0_MASK << (pair * HOSTSIM_FTM_PAIR_WIDTH));
+            }
+        }
+        else
+        {
+            /* Edge not selected for either channel */
+        }
+        return HOSTSIM_STATUS_SUCCESS;
+    }
+
+    /* Input capture: MSB:MSA = 00 */
+    mode = *HOSTSIM_FTM_CNSC(instance, channel) & (FTM_CnSC_MSA_MASK | FTM_CnSC_MSB_MASK);
+    if ((mode == 0U) && hostsim_ftm_edge_match(instance, channel, level))
+    {
+        hostsim_ftm_capture(instance, channel);
+    }
+
+    return HOSTSIM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Fetch through the LMEM code cache.
+ *
+ * @param address Any address of the line; allocated in a free way, else in
+ *        way 0, while PCCCR[ENCACHE] is set.
+ */
+void HOSTSIM_LmemFetch(uint32_t address)
+{
+    uint32_t set;
+    uint32_t way;
+
+    if ((*HOSTSIM_LMEM_REG(PCCCR) & LMEM_PCCCR_ENCACHE_MASK) == 0U)
+    {
+        return;
+    }
+
+    address &= ~(HOSTSIM_LMEM_LINE_SIZE - 1U);
+    set = (address / HOSTSIM_LMEM_LINE_SIZE) % HOSTSIM_LMEM_SETS;
+
+    for (way = 0U; way < HOSTSIM_LMEM_WAYS; way++)
+    {
+        if (s_hostsim_lmem_valid[way][set] && (s_hostsim_lmem_tag[way][set] == address))
+        {
+            return;
+        }
+    }
+
+    for (way = 0U; (way < HOSTSIM_LMEM_WAYS) && s_hostsim_lmem_valid[way][set]; way++)
+    {
+    }
+
+    way = (way < HOSTSIM_LMEM_WAYS) ? way : 0U;
+    s_hostsim_lmem_tag[way][set] = address;
+    s_hostsim_lmem_valid[way][set] = true;
+}
+
+/**
+ * @brief Simulated flash behind the FTFC model.
+ *
+ * @param address P-Flash or FlexNVM (0x10000000..) address.
+ * @return uint8_t* The byte at address, NULL outside both blocks.
+ */
+uint8_t *HOSTSIM_FtfcFlash(uint32_t address)
+{
+    if (address < HOSTSIM_FTFC_PFLASH_SIZE)
+    {
+        return &s_hostsim_pflash[address];
+    }
+
+    if ((address >= HOSTSIM_FTFC_DFLASH_BASE) && (address < (HOSTSIM_FTFC_DFLASH_BASE + HOSTSIM_FTFC_DFLASH_SIZE)))
+    {
+        return &s_hostsim_dflash[address - HOSTSIM_FTFC_DFLASH_BASE];
+    }
+
+    return NULL;
+}
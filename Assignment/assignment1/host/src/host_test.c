@@ -0,0 +1,82 @@
+/**
+ * @file host_test.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Checks for the host driver tests.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static uint32_t s_hosttest_checks = 0U;
+static uint32_t s_hosttest_failed = 0U;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+bool HOSTTEST_Check(bool cond, const char *text, const char *file, int line)
+{
+    s_hosttest_checks++;
+
+    if (!cond)
+    {
+        s_hosttest_failed++;
+        printf("%s:%d: FAILED %s\n", file, line, text);
+    }
+
+    return cond;
+}
+
+bool HOSTTEST_Equal(uint32_t actual, uint32_t expected, const char *text, const char *file, int line)
+{
+    s_hosttest_checks++;
+
+    if (actual != expected)
+    {
+        s_hosttest_failed++;
+        printf("%s:%d: FAILED %s == 0x%08lX, expected 0x%08lX\n", file, line, text,
+               (unsigned long)actual, (unsigned long)expected);
+        return false;
+    }
+
+    return true;
+}
+
+bool HOSTTEST_Access(uint32_t address, uint32_t loads, uint32_t stores, const char *text,
+                     const char *file, int line)
+{
+    hostsim_trace_t trace;
+
+    HOSTSIM_TraceGet(address, &trace);
+    s_hosttest_checks++;
+
+    if ((trace.loads != loads) || (trace.stores != stores))
+    {
+        s_hosttest_failed++;
+        printf("%s:%d: FAILED %s accessed %lu/%lu (loads/stores), expected %lu/%lu\n", file, line, text,
+               (unsigned long)trace.loads, (unsigned long)trace.stores,
+               (unsigned long)loads, (unsigned long)stores);
+        return false;
+    }
+
+    return true;
+}
+
+int HOSTTEST_Done(const char *name)
+{
+    printf("%s: %lu checks, %lu failed\n", name, (unsigned long)s_hosttest_checks,
+           (unsigned long)s_hosttest_failed);
+
+    return (s_hosttest_failed == 0U) ? 0 : 1;
+}
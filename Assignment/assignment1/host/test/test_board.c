@@ -0,0 +1,104 @@
+/**
+ * @file test_board.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: BOARD_InitPins() from the compile-time expansion of the
+ *        board map.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Every pin of the map must end with the PCR PORT_PinValue() gives for its
+ * table entry, through exactly the global stores PORT_PlanWrites() plans for
+ * BOARD_PORT_TABLE and no direct PCR store; used ports are clocked and the
+ * GPIO outputs start at their level.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../src/board.c"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_MAX_WRITES             (PORT_NUMS * 4U * 16U)
+#define TEST_GLOBAL_REGS            4U
+#define TEST_PORT(p)                (IP_PORTA_BASE + ((p) * BOARD_PORT_STEP))
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const port_pin_config_t s_test_table[BOARD_PIN_COUNT] = BOARD_PORT_TABLE;
+static const PORT_GLOBAL_REG_t s_test_regs[TEST_GLOBAL_REGS] =
+{
+    PORT_GLOBAL_GPCLR, PORT_GLOBAL_GPCHR, PORT_GLOBAL_GICLR, PORT_GLOBAL_GICHR
+};
+static GPIO_Type *const s_test_gpio[PORT_NUMS] = { IP_PTA, IP_PTB, IP_PTC, IP_PTD, IP_PTE };
+static port_global_write_t s_test_writes[TEST_MAX_WRITES];
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+int main(void)
+{
+    hostsim_trace_t trace;
+    uint32_t planned;
+    uint32_t expected;
+    uint32_t pcr_stores = 0U;
+    uint32_t port;
+    uint32_t r;
+    uint32_t i;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    planned = PORT_PlanWrites(s_test_table, BOARD_PIN_COUNT, s_test_writes, TEST_MAX_WRITES);
+    HOSTTEST_CHECK((planned > 0U) && (planned <= TEST_MAX_WRITES));
+
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(BOARD_InitPins(), PORT_STATUS_SUCCESS);
+
+    /* Same global stores, per port and register, as the runtime plan */
+    for (port = 0U; port < PORT_NUMS; port++)
+    {
+        for (r = 0U; r < TEST_GLOBAL_REGS; r++)
+        {
+            expected = 0U;
+            for (i = 0U; i < planned; i++)
+            {
+                expected += ((s_test_writes[i].port == port) && (s_test_writes[i].reg == s_test_regs[r])) ? 1U : 0U;
+            }
+            HOSTTEST_ACCESS(TEST_PORT(port) + (uint32_t)s_test_regs[r], 0U, expected);
+        }
+
+        for (i = 0U; i < 32U; i++)
+        {
+            HOSTSIM_TraceGet(TEST_PORT(port) + offsetof(PORT_Type, PCR) + (4U * i), &trace);
+            pcr_stores += trace.stores;
+        }
+
+        HOSTTEST_EQ(*HOSTSIM_Reg(IP_PCC_BASE + PCC_PORTA + (4U * port)) & PCC_PCCn_CGC_MASK,
+                    ((BOARD_PORTS_USED & (1UL << port)) != 0U) ? PCC_PCCn_CGC_MASK : 0U);
+        HOSTTEST_EQ(s_test_gpio[port]->PDDR, BOARD_GPIO_OUT_MASK(port));
+        HOSTTEST_EQ(s_test_gpio[port]->PDOR & BOARD_GPIO_OUT_MASK(port), BOARD_GPIO_HIGH_MASK(port));
+    }
+    HOSTTEST_EQ(pcr_stores, 0U);
+
+    /* Every pin of the map holds its table value */
+    for (i = 0U; i < BOARD_PIN_COUNT; i++)
+    {
+        HOSTTEST_EQ(PORT_GetValue(s_test_table[i].pin)->PCR[Pin_GetValue(s_test_table[i].pin)],
+                    PORT_PinValue(&s_test_table[i]));
+    }
+
+    return HOSTTEST_Done("board");
+}
@@ -0,0 +1,196 @@
+/**
+ * @file test_boot.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: A/B image CRC, post-link stamp against the selector.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * A synthetic slot image in memory mapped at the slot B address is stamped
+ * by the post-link tool (tools/image_crc/image_crc.py --bin) and checked with
+ * BOOT_ComputeImageCrc() and BOOT_CheckSlot() through the CRC model: same CRC
+ * for the same bytes, the crc word itself excluded, any other byte covered,
+ * and the confirmation mark skipping the CRC unless asked for.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/boot_image.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#ifndef HOST_IMAGE_CRC
+#define HOST_IMAGE_CRC              "python3 ../tools/image_crc/image_crc.py"
+#endif
+
+#define TEST_IMAGE_LENGTH           0x1238U
+#define TEST_IMAGE_VERSION          3U
+#define TEST_CRC_OFFSET             (BOOT_HEADER_OFFSET + 12U)
+#define TEST_ENTRY                  (BOOT_SLOT_B_BASE + 0x500U + 1U)
+#define TEST_STACK_TOP              0x20007000U
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void test_build_image(uint8_t *slot)
+{
+    boot_image_header_t header = { BOOT_IMAGE_MAGIC, TEST_IMAGE_VERSION, TEST_IMAGE_LENGTH, 0xFFFFFFFFU };
+    uint32_t vectors[2] = { TEST_STACK_TOP, TEST_ENTRY };
+    uint32_t i;
+
+    memset(slot, 0xFF, BOOT_SLOT_SIZE);
+    for (i = 0U; i < TEST_IMAGE_LENGTH; i++)
+    {
+        slot[i] = (uint8_t)((i * 31U) ^ (i >> 8U));
+    }
+    memcpy(slot, vectors, sizeof(vectors));
+    memcpy(&slot[BOOT_HEADER_OFFSET], &header, sizeof(header));
+}
+
+/* Run the tool on a copy of [0, length) of the slot, read the result back into stamped; exit status */
+static int test_run_tool(const uint8_t *slot, uint32_t length, const char *options, uint8_t *stamped)
+{
+    char path[] = "/tmp/test_boot_XXXXXX";
+    char command[512];
+    FILE *file;
+    int fd = mkstemp(path);
+    int status = -1;
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    file = fdopen(fd, "w+b");
+    if ((file != NULL) && (fwrite(slot, 1U, length, file) == length) && (fflush(file) == 0))
+    {
+        (void)snprintf(command, sizeof(command), "%s --bin %s %s >/dev/null 2>&1", HOST_IMAGE_CRC, options, path);
+        status = system(command);
+        rewind(file);
+        if ((stamped != NULL) && (fread(stamped, 1U, length, file) != length))
+        {
+            status = -1;
+        }
+    }
+
+    if (file != NULL)
+    {
+        (void)fclose(file);
+    }
+    else
+    {
+        (void)close(fd);
+    }
+    (void)unlink(path);
+
+    return status;
+}
+
+int main(void)
+{
+    static uint8_t stamped[TEST_IMAGE_LENGTH];
+    const uint32_t mark[2] = { BOOT_CONFIRM_MAGIC, ~BOOT_CONFIRM_MAGIC };
+    uint8_t *slot;
+    uint32_t crc = 0U;
+    uint32_t tool_crc;
+    uint32_t base = BOOT_SLOT_B_BASE;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* BOOT_ComputeImageCrc() takes 32-bit flash addresses: slot B where it is on the target */
+    slot = mmap((void *)(uintptr_t)BOOT_SLOT_B_BASE, BOOT_SLOT_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    HOSTTEST_CHECK(slot == (uint8_t *)(uintptr_t)BOOT_SLOT_B_BASE);
+    if (slot != (uint8_t *)(uintptr_t)BOOT_SLOT_B_BASE)
+    {
+        return HOSTTEST_Done("boot");
+    }
+
+    /* As linked: header and vectors pass, the erased crc does not */
+    test_build_image(slot);
+    HOSTTEST_CHECK(!BOOT_IsConfirmed(BOOT_SLOT_B));
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_B, false));
+
+    /* The tool patches the crc word and nothing else */
+    HOSTTEST_EQ(test_run_tool(slot, TEST_IMAGE_LENGTH, "", stamped), 0);
+    memcpy(&tool_crc, &stamped[TEST_CRC_OFFSET], sizeof(tool_crc));
+    HOSTTEST_CHECK(tool_crc != 0xFFFFFFFFU);
+    HOSTTEST_EQ(memcmp(stamped, slot, TEST_CRC_OFFSET), 0);
+    HOSTTEST_EQ(memcmp(&stamped[TEST_CRC_OFFSET + 4U], &slot[TEST_CRC_OFFSET + 4U],
+                       TEST_IMAGE_LENGTH - TEST_CRC_OFFSET - 4U), 0);
+
+    /* Same CRC from the CRC module, whatever the crc word holds */
+    HOSTTEST_EQ(BOOT_ComputeImageCrc(base, TEST_IMAGE_LENGTH, &crc), CRC_STATUS_SUCCESS);
+    HOSTTEST_EQ(crc, tool_crc);
+    memcpy(&slot[TEST_CRC_OFFSET], &tool_crc, sizeof(tool_crc));
+    HOSTTEST_EQ(BOOT_ComputeImageCrc(base, TEST_IMAGE_LENGTH, &crc), CRC_STATUS_SUCCESS);
+    HOSTTEST_EQ(crc, tool_crc);
+    HOSTTEST_CHECK(BOOT_CheckSlot(BOOT_SLOT_B, false));
+    HOSTTEST_CHECK(BOOT_CheckSlot(BOOT_SLOT_B, true));
+    HOSTTEST_EQ(test_run_tool(slot, TEST_IMAGE_LENGTH, "--check", NULL), 0);
+
+    /* Every other byte is covered: first vector byte, header, last image byte */
+    slot[0] ^= 0x08U;
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_B, false));
+    HOSTTEST_CHECK(test_run_tool(slot, TEST_IMAGE_LENGTH, "--check", NULL) != 0);
+    slot[0] ^= 0x08U;
+    slot[BOOT_HEADER_OFFSET + 4U] ^= 0x01U;
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_B, false));
+    slot[BOOT_HEADER_OFFSET + 4U] ^= 0x01U;
+    slot[TEST_IMAGE_LENGTH - 1U] ^= 0x80U;
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_B, false));
+    slot[TEST_IMAGE_LENGTH - 1U] ^= 0x80U;
+    HOSTTEST_CHECK(BOOT_CheckSlot(BOOT_SLOT_B, false));
+
+    /* Bytes past the length are not part of the image */
+    slot[TEST_IMAGE_LENGTH] = 0x00U;
+    HOSTTEST_CHECK(BOOT_CheckSlot(BOOT_SLOT_B, false));
+
+    /* Confirmed: the CRC is skipped unless asked for */
+    memcpy(&slot[BOOT_CONFIRM_OFFSET], mark, sizeof(mark));
+    HOSTTEST_CHECK(BOOT_IsConfirmed(BOOT_SLOT_B));
+    slot[0x800U] ^= 0x01U;
+    HOSTTEST_CHECK(BOOT_CheckSlot(BOOT_SLOT_B, false));
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_B, true));
+    slot[0x800U] ^= 0x01U;
+
+    /* Header checks come first, confirmed or not */
+    slot[BOOT_HEADER_OFFSET] ^= 0x01U;
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_B, false));
+    HOSTTEST_CHECK(test_run_tool(slot, TEST_IMAGE_LENGTH, "", NULL) != 0);
+    slot[BOOT_HEADER_OFFSET] ^= 0x01U;
+
+    /* Parameter checks */
+    HOSTTEST_EQ(BOOT_ComputeImageCrc(base, TEST_IMAGE_LENGTH, NULL), CRC_STATUS_ERROR);
+    HOSTTEST_EQ(BOOT_ComputeImageCrc(base, BOOT_HEADER_OFFSET + BOOT_HEADER_SIZE, &crc), CRC_STATUS_ERROR);
+    HOSTTEST_CHECK(!BOOT_CheckSlot(BOOT_SLOT_NONE, true));
+    HOSTTEST_CHECK(!BOOT_IsConfirmed(BOOT_SLOT_NONE));
+    HOSTTEST_CHECK(test_run_tool(slot, BOOT_HEADER_OFFSET, "", NULL) != 0);
+
+    /* An erased tail may be left out of the file (objcopy -O binary) */
+    memset(&slot[TEST_IMAGE_LENGTH - 16U], 0xFF, 16U);
+    HOSTTEST_EQ(test_run_tool(slot, TEST_IMAGE_LENGTH - 16U, "", stamped), 0);
+    memcpy(&tool_crc, &stamped[TEST_CRC_OFFSET], sizeof(tool_crc));
+    HOSTTEST_EQ(BOOT_ComputeImageCrc(base, TEST_IMAGE_LENGTH, &crc), CRC_STATUS_SUCCESS);
+    HOSTTEST_EQ(crc, tool_crc);
+
+    (void)munmap(slot, BOOT_SLOT_SIZE);
+
+    return HOSTTEST_Done("boot");
+}
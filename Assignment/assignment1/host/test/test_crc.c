@@ -0,0 +1,242 @@
+/**
+ * @file test_crc.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: software CRC tables and the CRC module driver.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * The slice-by-4 and slice-by-8 software CRCs against the catalogue check
+ * values ("123456789") and a bitwise reference on random buffers split at
+ * random points, then CRC_Compute()/CRC_Update() on the CRC module model
+ * against the software result for every head/tail alignment, and the
+ * software fallback while the module is owned.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_CRC.h"
+#include "../driver/inc/crc_sw.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_CONFIGS                3U
+#define TEST_BUFFER_LEN             300U
+#define TEST_RANDOM_RUNS            200U
+
+#define TEST_CRC_DATA               (IP_CRC_BASE + offsetof(CRC_Type, DATAu))
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const crc_config_t s_test_configs[TEST_CONFIGS] =
+{
+    CRC_CONFIG_CRC32,
+    CRC_CONFIG_CCITT_FALSE,
+    CRC_CONFIG_CCITT_KERMIT
+};
+
+/* Catalogue check values: CRC of the ASCII string "123456789" */
+static const uint32_t s_test_check[TEST_CONFIGS] = { 0xCBF43926U, 0x29B1U, 0x2189U };
+
+static uint32_t s_test_table4[TEST_CONFIGS][CRC_SW_TABLE_WORDS(4U) / 256U][256];
+static uint32_t s_test_table8[TEST_CONFIGS][CRC_SW_TABLE_WORDS(8U) / 256U][256];
+static crc_sw_table_t s_test_sw4[TEST_CONFIGS];
+static crc_sw_table_t s_test_sw8[TEST_CONFIGS];
+
+static uint8_t s_test_buffer[TEST_BUFFER_LEN + 4U] __attribute__((aligned(8)));
+static uint32_t s_test_seed = 0x0C2C3DB5U;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_random(void)
+{
+    s_test_seed = (s_test_seed * 1103515245U) + 12345U;
+    return s_test_seed >> 8U;
+}
+
+static uint32_t test_reflect(uint32_t value, uint32_t bits)
+{
+    uint32_t out = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < bits; i++)
+    {
+        out |= ((value >> i) & 1U) << (bits - 1U - i);
+    }
+
+    return out;
+}
+
+/* One bit at a time, straight from the algorithm parameters */
+static uint32_t test_bitwise(const crc_config_t *config, const uint8_t *data, uint32_t len)
+{
+    uint32_t bits = (config->width == CRC_WIDTH_32) ? 32U : 16U;
+    uint32_t top = 1UL << (bits - 1U);
+    uint32_t mask = (bits == 32U) ? 0xFFFFFFFFU : 0xFFFFU;
+    uint32_t reg = config->seed & mask;
+    uint32_t byte;
+    uint32_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < len; i++)
+    {
+        byte = config->reflect_in ? test_reflect(data[i], 8U) : data[i];
+        reg ^= byte << (bits - 8U);
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            reg = ((reg & top) != 0U) ? ((reg << 1U) ^ config->polynomial) : (reg << 1U);
+            reg &= mask;
+        }
+    }
+
+    if (config->reflect_out)
+    {
+        reg = test_reflect(reg, bits);
+    }
+
+    return (reg ^ config->xor_out) & mask;
+}
+
+int main(void)
+{
+    const uint8_t check[] = "123456789";
+    uint32_t result;
+    uint32_t expected;
+    uint32_t reg4;
+    uint32_t reg8;
+    uint32_t offset;
+    uint32_t len;
+    uint32_t split;
+    uint32_t c;
+    uint32_t i;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    for (i = 0U; i < sizeof(s_test_buffer); i++)
+    {
+        s_test_buffer[i] = (uint8_t)test_random();
+    }
+
+    for (c = 0U; c < TEST_CONFIGS; c++)
+    {
+        s_test_sw4[c].config = s_test_configs[c];
+        s_test_sw4[c].slices = 4U;
+        s_test_sw4[c].table = s_test_table4[c];
+        HOSTTEST_CHECK(CRC_SwInitTable(&s_test_sw4[c]));
+
+        s_test_sw8[c].config = s_test_configs[c];
+        s_test_sw8[c].slices = 8U;
+        s_test_sw8[c].table = s_test_table8[c];
+        HOSTTEST_CHECK(CRC_SwInitTable(&s_test_sw8[c]));
+
+        /* Check values, one-shot and through the bitwise reference */
+        HOSTTEST_EQ(test_bitwise(&s_test_configs[c], check, 9U), s_test_check[c]);
+        HOSTTEST_EQ(CRC_SwCompute(&s_test_sw4[c], check, 9U), s_test_check[c]);
+        HOSTTEST_EQ(CRC_SwCompute(&s_test_sw8[c], check, 9U), s_test_check[c]);
+    }
+
+    /* Bad slice count or missing table */
+    s_test_sw4[0].slices = 2U;
+    HOSTTEST_CHECK(!CRC_SwInitTable(&s_test_sw4[0]));
+    s_test_sw4[0].slices = 4U;
+    HOSTTEST_CHECK(!CRC_SwInitTable(NULL));
+
+    /* Random buffers and alignments, fed in two pieces */
+    for (i = 0U; i < TEST_RANDOM_RUNS; i++)
+    {
+        c = i % TEST_CONFIGS;
+        offset = test_random() & 3U;
+        len = test_random() % (TEST_BUFFER_LEN + 1U);
+        split = (len > 0U) ? (test_random() % len) : 0U;
+        expected = test_bitwise(&s_test_configs[c], &s_test_buffer[offset], len);
+
+        reg4 = CRC_SwUpdate(&s_test_sw4[c], CRC_SwStart(&s_test_sw4[c]), &s_test_buffer[offset], split);
+        reg4 = CRC_SwUpdate(&s_test_sw4[c], reg4, &s_test_buffer[offset + split], len - split);
+        reg8 = CRC_SwUpdate(&s_test_sw8[c], CRC_SwStart(&s_test_sw8[c]), &s_test_buffer[offset], split);
+        reg8 = CRC_SwUpdate(&s_test_sw8[c], reg8, &s_test_buffer[offset + split], len - split);
+
+        HOSTTEST_EQ(CRC_SwFinish(&s_test_sw4[c], reg4), expected);
+        HOSTTEST_EQ(CRC_SwFinish(&s_test_sw8[c], reg8), expected);
+    }
+
+    /* Module: check values, then every alignment and length 0..15 plus long runs */
+    for (c = 0U; c < TEST_CONFIGS; c++)
+    {
+        HOSTTEST_EQ(CRC_Compute(&s_test_configs[c], NULL, check, 9U, &result), CRC_STATUS_SUCCESS);
+        HOSTTEST_EQ(result, s_test_check[c]);
+
+        for (offset = 0U; offset < 4U; offset++)
+        {
+            for (len = 0U; len < 16U; len++)
+            {
+                HOSTTEST_EQ(CRC_Compute(&s_test_configs[c], NULL, &s_test_buffer[offset], len, &result),
+                            CRC_STATUS_SUCCESS);
+                HOSTTEST_EQ(result, CRC_SwCompute(&s_test_sw4[c], &s_test_buffer[offset], len));
+            }
+
+            HOSTTEST_EQ(CRC_Compute(&s_test_configs[c], NULL, &s_test_buffer[offset], TEST_BUFFER_LEN, &result),
+                        CRC_STATUS_SUCCESS);
+            HOSTTEST_EQ(result, CRC_SwCompute(&s_test_sw8[c], &s_test_buffer[offset], TEST_BUFFER_LEN));
+        }
+        HOSTTEST_CHECK(!CRC_IsBusy());
+    }
+
+    /* Streaming in random pieces gives the one-shot result */
+    for (i = 0U; i < TEST_RANDOM_RUNS; i++)
+    {
+        c = i % TEST_CONFIGS;
+        len = 0U;
+        HOSTTEST_EQ(CRC_Init(&s_test_configs[c]), CRC_STATUS_SUCCESS);
+
+        while (len < TEST_BUFFER_LEN)
+        {
+            split = (test_random() % 23U) + 1U;
+            split = ((len + split) > TEST_BUFFER_LEN) ? (TEST_BUFFER_LEN - len) : split;
+            HOSTTEST_EQ(CRC_Update(&s_test_buffer[len], split), CRC_STATUS_SUCCESS);
+            len += split;
+        }
+
+        HOSTTEST_EQ(CRC_GetResult(), CRC_SwCompute(&s_test_sw8[c], s_test_buffer, TEST_BUFFER_LEN));
+        CRC_Release();
+    }
+
+    /* Aligned bulk is one 32-bit store per word, head and tail one per byte */
+    HOSTTEST_EQ(CRC_Init(&s_test_configs[0]), CRC_STATUS_SUCCESS);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(CRC_Update(s_test_buffer, 64U), CRC_STATUS_SUCCESS);
+    HOSTTEST_ACCESS(TEST_CRC_DATA, 0U, 16U);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(CRC_Update(&s_test_buffer[1], 10U), CRC_STATUS_SUCCESS);
+    HOSTTEST_ACCESS(TEST_CRC_DATA, 0U, 7U);
+    reg4 = CRC_SwUpdate(&s_test_sw4[0], CRC_SwStart(&s_test_sw4[0]), s_test_buffer, 64U);
+    reg4 = CRC_SwUpdate(&s_test_sw4[0], reg4, &s_test_buffer[1], 10U);
+    HOSTTEST_EQ(CRC_GetResult(), CRC_SwFinish(&s_test_sw4[0], reg4));
+
+    /* Owned: software fallback, or BUSY without tables */
+    HOSTTEST_EQ(CRC_Compute(&s_test_configs[1], &s_test_sw8[1], check, 9U, &result), CRC_STATUS_SUCCESS);
+    HOSTTEST_EQ(result, s_test_check[1]);
+    HOSTTEST_EQ(CRC_Compute(&s_test_configs[1], NULL, check, 9U, &result), CRC_STATUS_BUSY);
+    HOSTTEST_EQ(CRC_Init(&s_test_configs[1]), CRC_STATUS_BUSY);
+    CRC_Release();
+    HOSTTEST_CHECK(!CRC_IsBusy());
+    HOSTTEST_EQ(CRC_Update(check, 9U), CRC_STATUS_ERROR);
+    HOSTTEST_EQ(CRC_GetResult(), 0U);
+
+    return HOSTTEST_Done("crc");
+}
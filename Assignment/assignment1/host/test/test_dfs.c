@@ -0,0 +1,170 @@
+/**
+ * @file test_dfs.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: DFS level switches, per-level SPLLCFG and the run mode
+ *        clock limits, against the SCG and SMC models.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * The levels of dfs_governor.h: FIRC48, SPLL80 (160 MHz SPLL / 2) and
+ * SPLL112 (112 MHz SPLL in HSRUN). Every switch must land on the core clock
+ * of its level, restart the SPLL only when SPLLCFG changes, and do so from
+ * FIRC. A level that would exceed its mode limit (the HSRUN preset on a
+ * 160 MHz SPLL) must fail, at DFS_Init() and at a switch, and leave the core
+ * within the limit.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/dfs_governor.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_SCG_REG(r)             (IP_SCG_BASE + offsetof(SCG_Type, r))
+#define TEST_SMC_REG(r)             (IP_SMC_BASE + offsetof(SMC_Type, r))
+
+/* SPLL_CLK = 8 MHz / (PREDIV + 1) * (MULT + 16) / 2: 160 and 112 MHz */
+#define TEST_SPLL80_CFG             SCG_SPLLCFG_MULT(24U)
+#define TEST_SPLL112_CFG            SCG_SPLLCFG_MULT(12U)
+
+#define TEST_PMSTAT_RUN             0x01U
+#define TEST_PMSTAT_HSRUN           0x80U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const dfs_config_t s_test_config = { 700U, 300U, 1U, 4U };
+
+static const dfs_level_t s_test_levels[] =
+{
+    { "FIRC48",  SCG_FIRC_SlowRun_48Mhz,   SCG_RUN_MODE,   0U },
+    { "SPLL80",  SCG_SPLL_NormalRun_80Mhz, SCG_RUN_MODE,   TEST_SPLL80_CFG },
+    { "SPLL112", SCG_SPLL_HSRun_112Mhz,    SCG_HSRUN_MODE, TEST_SPLL112_CFG }
+};
+
+/* The HSRUN preset left on the 160 MHz SPLL */
+static const dfs_level_t s_test_bad_levels[] =
+{
+    { "FIRC48",  SCG_FIRC_SlowRun_48Mhz,   SCG_RUN_MODE,   0U },
+    { "SPLL80",  SCG_SPLL_NormalRun_80Mhz, SCG_RUN_MODE,   TEST_SPLL80_CFG },
+    { "SPLL160", SCG_SPLL_HSRun_112Mhz,    SCG_HSRUN_MODE, TEST_SPLL80_CFG }
+};
+
+static uint32_t s_test_post_hz;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void test_notify(const dfs_change_t *change, void *ctx)
+{
+    (void)ctx;
+
+    if (change->event == DFS_EVENT_POST)
+    {
+        s_test_post_hz = change->core_hz;
+    }
+}
+
+static dfs_notifier_t s_test_notifier = { test_notify, NULL, NULL };
+
+/* Clock getters read SPLLCFG too: only the stores tell a restart */
+static uint32_t test_stores(uint32_t address)
+{
+    hostsim_trace_t trace;
+
+    HOSTSIM_TraceGet(address, &trace);
+
+    return trace.stores;
+}
+
+/* Level in use, its core clock and SMC mode, CSR on the active CCR */
+static void test_check_level(uint8_t level, uint32_t core_hz, uint32_t pmstat)
+{
+    HOSTTEST_EQ(DFS_GetLevel(), level);
+    HOSTTEST_EQ(SCG_GetCoreClock(), core_hz);
+    HOSTTEST_EQ(s_test_post_hz, core_hz);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SMC_REG(PMSTAT)), pmstat);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(CSR)),
+                *HOSTSIM_Reg((pmstat == TEST_PMSTAT_HSRUN) ? TEST_SCG_REG(HCCR) : TEST_SCG_REG(RCCR)));
+}
+
+int main(void)
+{
+    dfs_stats_t stats;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* As tools/dfs_trace: SPLL at 160 MHz, RUN on SPLL80 */
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SOSC_CLK), SCG_STATUS_SUCCESS);
+    *HOSTSIM_Reg(TEST_SCG_REG(SPLLCFG)) = TEST_SPLL80_CFG;
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SPLL_CLK), SCG_STATUS_SUCCESS);
+    HOSTTEST_EQ(SCG_SPLL_NormalRun_80Mhz(), SCG_STATUS_SUCCESS);
+
+    /* A start level above the HSRUN limit is refused, the core drops to FIRC48 */
+    HOSTTEST_EQ(DFS_Init(s_test_bad_levels, 3U, &s_test_config, 2U), DFS_STATUS_ERROR);
+    HOSTTEST_EQ(SCG_GetCoreClock(), 48000000U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SMC_REG(PMSTAT)), TEST_PMSTAT_RUN);
+    HOSTTEST_EQ(DFS_SetLevel(1U), DFS_STATUS_ERROR);
+
+    /* Same SPLLCFG: SPLL80 starts without touching the SPLL */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(DFS_Init(s_test_levels, 3U, &s_test_config, 1U), DFS_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_stores(TEST_SCG_REG(SPLLCFG)), 0U);
+    HOSTTEST_EQ(DFS_RegisterNotifier(&s_test_notifier), DFS_STATUS_SUCCESS);
+    s_test_post_hz = SCG_GetCoreClock();
+    test_check_level(1U, 80000000U, TEST_PMSTAT_RUN);
+
+    /* Up to HSRUN: SPLL restarted at 112 MHz while RUN runs from FIRC */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(DFS_SetLevel(2U), DFS_STATUS_SUCCESS);
+    test_check_level(2U, 112000000U, TEST_PMSTAT_HSRUN);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(SPLLCFG)), TEST_SPLL112_CFG);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(RCCR)) & SCG_RCCR_SCS_MASK, SCG_RCCR_SCS(SCG_FIRC_CLK));
+    HOSTTEST_EQ(test_stores(TEST_SCG_REG(SPLLCFG)), 1U);
+
+    /* Back down: leave HSRUN, FIRC again, SPLL at 160 MHz */
+    HOSTTEST_EQ(DFS_SetLevel(1U), DFS_STATUS_SUCCESS);
+    test_check_level(1U, 80000000U, TEST_PMSTAT_RUN);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(SPLLCFG)), TEST_SPLL80_CFG);
+
+    /* FIRC48 keeps the SPLL as it is */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(DFS_SetLevel(0U), DFS_STATUS_SUCCESS);
+    test_check_level(0U, 48000000U, TEST_PMSTAT_RUN);
+    HOSTTEST_EQ(test_stores(TEST_SCG_REG(SPLLCSR)), 0U);
+    HOSTTEST_EQ(test_stores(TEST_SCG_REG(SPLLCFG)), 0U);
+
+    /* Straight from FIRC48 to SPLL112 */
+    HOSTTEST_EQ(DFS_SetLevel(2U), DFS_STATUS_SUCCESS);
+    test_check_level(2U, 112000000U, TEST_PMSTAT_HSRUN);
+
+    DFS_GetStats(&stats);
+    HOSTTEST_EQ(stats.ups, 2U);
+    HOSTTEST_EQ(stats.downs, 2U);
+    HOSTTEST_EQ(stats.failures, 0U);
+
+    /* A switch above the HSRUN limit fails and backs out to SPLL80 */
+    HOSTTEST_EQ(DFS_Init(s_test_bad_levels, 3U, &s_test_config, 1U), DFS_STATUS_SUCCESS);
+    s_test_post_hz = SCG_GetCoreClock();
+    test_check_level(1U, 80000000U, TEST_PMSTAT_RUN);
+    HOSTTEST_EQ(DFS_SetLevel(2U), DFS_STATUS_ERROR);
+    test_check_level(1U, 80000000U, TEST_PMSTAT_RUN);
+    DFS_GetStats(&stats);
+    HOSTTEST_EQ(stats.failures, 1U);
+
+    return HOSTTEST_Done("dfs");
+}
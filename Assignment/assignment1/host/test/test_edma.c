@@ -0,0 +1,175 @@
+/**
+ * @file test_edma.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: eDMA channel routing and TCD programming.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * DMAMUX routing (detach first, DMAMUX clock gate), every TCD field written
+ * by EDMA_ConfigTransfer() with one store per field and nothing read back,
+ * the SERQ/CERQ/SSRT/CDNE byte registers, the DONE check and the parameter
+ * checks, which must not touch a register.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_EDMA.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_CHANNEL                3U
+#define TEST_SOURCE                 14U
+
+#define TEST_DMA_REG(r)             (IP_DMA_BASE + offsetof(DMA_Type, r))
+/* Word of TCD[TEST_CHANNEL] at a byte offset (0x00..0x1C) */
+#define TEST_TCD_WORD(off)          (IP_DMA_BASE + offsetof(DMA_Type, TCD) + (TEST_CHANNEL * 0x20U) + (off))
+/* CERQ/SERQ share the word at 0x18, CDNE/SSRT the word at 0x1C */
+#define TEST_DMA_CERQ_WORD          TEST_DMA_REG(CEEI)
+#define TEST_DMA_CDNE_WORD          TEST_DMA_REG(CDNE)
+#define TEST_DMAMUX_WORD            (IP_DMAMUX_BASE + (TEST_CHANNEL & ~3U))
+#define TEST_PCC_DMAMUX             (IP_PCC_BASE + (PCC_DMAMUX_INDEX * 4U))
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_byte(uint32_t address, uint32_t lane)
+{
+    return (*HOSTSIM_Reg(address) >> (lane * 8U)) & 0xFFU;
+}
+
+static uint32_t test_accesses(void)
+{
+    hostsim_trace_t total;
+
+    HOSTSIM_TraceTotal(&total);
+
+    return total.loads + total.stores;
+}
+
+int main(void)
+{
+    edma_transfer_config_t config =
+    {
+        .src_addr = 0x20001000U,
+        .dst_addr = 0x4006A004U,
+        .src_offset = 1,
+        .dst_offset = -4,
+        .src_size = EDMA_SIZE_1_BYTE,
+        .dst_size = EDMA_SIZE_4_BYTES,
+        .minor_bytes = 4U,
+        .major_count = 300U,
+        .src_last = -300,
+        .dst_last = 8,
+        .int_major = true,
+        .int_half = false,
+        .loop = false
+    };
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Routing: DMAMUX clocked, CHCFG cleared, then source + ENBL, one byte each */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EDMA_SetChannelSource(TEST_CHANNEL, TEST_SOURCE), EDMA_STATUS_SUCCESS);
+    HOSTTEST_CHECK((*HOSTSIM_Reg(TEST_PCC_DMAMUX) & PCC_PCCn_CGC_MASK) != 0U);
+    HOSTTEST_EQ(test_byte(TEST_DMAMUX_WORD, TEST_CHANNEL & 3U),
+                DMAMUX_CHCFG_SOURCE(TEST_SOURCE) | DMAMUX_CHCFG_ENBL_MASK);
+    HOSTTEST_ACCESS(TEST_DMAMUX_WORD, 0U, 2U);
+
+    /* Source 0 detaches only */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EDMA_SetChannelSource(TEST_CHANNEL, 0U), EDMA_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_byte(TEST_DMAMUX_WORD, TEST_CHANNEL & 3U), 0U);
+    HOSTTEST_ACCESS(TEST_DMAMUX_WORD, 0U, 1U);
+
+    /* TCD: requests off, CSR cleared, every field once, CSR last */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EDMA_ConfigTransfer(TEST_CHANNEL, &config), EDMA_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_byte(TEST_DMA_CERQ_WORD, 2U), TEST_CHANNEL);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x00U)), 0x20001000U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x04U)),
+                ((DMA_TCD_ATTR_SSIZE(EDMA_SIZE_1_BYTE) | DMA_TCD_ATTR_DSIZE(EDMA_SIZE_4_BYTES)) << 16U) | 1U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x08U)), 4U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x0CU)), (uint32_t)-300);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x10U)), 0x4006A004U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x14U)), (300U << 16U) | 0xFFFCU);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x18U)), 8U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x1CU)),
+                (300U << 16U) | DMA_TCD_CSR_INTMAJOR_MASK | DMA_TCD_CSR_DREQ_MASK);
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x00U), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x04U), 0U, 2U);
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x14U), 0U, 2U);
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x1CU), 0U, 3U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads, 0U);
+    HOSTTEST_EQ(total.stores, 13U);
+
+    /* Looping channel: DREQ clear, half interrupt */
+    config.loop = true;
+    config.int_major = false;
+    config.int_half = true;
+    HOSTTEST_EQ(EDMA_ConfigTransfer(TEST_CHANNEL, &config), EDMA_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_TCD_WORD(0x1CU)) & 0xFFFFU, DMA_TCD_CSR_INTHALF_MASK);
+
+    /* Parameter checks before any register access */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EDMA_SetChannelSource(EDMA_CHANNEL_NUMS, TEST_SOURCE), EDMA_STATUS_ERROR);
+    HOSTTEST_EQ(EDMA_ConfigTransfer(EDMA_CHANNEL_NUMS, &config), EDMA_STATUS_ERROR);
+    HOSTTEST_EQ(EDMA_ConfigTransfer(TEST_CHANNEL, NULL), EDMA_STATUS_ERROR);
+    config.major_count = 0U;
+    HOSTTEST_EQ(EDMA_ConfigTransfer(TEST_CHANNEL, &config), EDMA_STATUS_ERROR);
+    config.major_count = 0x8000U;
+    HOSTTEST_EQ(EDMA_ConfigTransfer(TEST_CHANNEL, &config), EDMA_STATUS_ERROR);
+    EDMA_StartChannel(EDMA_CHANNEL_NUMS);
+    EDMA_StopChannel(EDMA_CHANNEL_NUMS);
+    EDMA_TriggerChannel(EDMA_CHANNEL_NUMS);
+    HOSTTEST_CHECK(!EDMA_IsChannelDone(EDMA_CHANNEL_NUMS));
+    HOSTTEST_EQ(EDMA_GetDestAddress(EDMA_CHANNEL_NUMS), 0U);
+    HOSTTEST_EQ(EDMA_GetRemainingMajorCount(EDMA_CHANNEL_NUMS), 0U);
+    HOSTTEST_EQ(test_accesses(), 0U);
+
+    /* Request control: one byte store each */
+    HOSTSIM_TraceReset();
+    EDMA_StartChannel(TEST_CHANNEL);
+    HOSTTEST_EQ(test_byte(TEST_DMA_CERQ_WORD, 3U), TEST_CHANNEL);
+    EDMA_StopChannel(7U);
+    HOSTTEST_EQ(test_byte(TEST_DMA_CERQ_WORD, 2U), 7U);
+    HOSTTEST_ACCESS(TEST_DMA_CERQ_WORD, 0U, 2U);
+    EDMA_TriggerChannel(TEST_CHANNEL);
+    HOSTTEST_EQ(test_byte(TEST_DMA_CDNE_WORD, 1U), TEST_CHANNEL);
+    HOSTTEST_ACCESS(TEST_DMA_CDNE_WORD, 0U, 1U);
+
+    /* DONE: read once, cleared through CDNE only when set */
+    HOSTSIM_TraceReset();
+    HOSTTEST_CHECK(!EDMA_IsChannelDone(TEST_CHANNEL));
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x1CU), 1U, 0U);
+    HOSTTEST_ACCESS(TEST_DMA_CDNE_WORD, 0U, 0U);
+    *HOSTSIM_Reg(TEST_TCD_WORD(0x1CU)) |= DMA_TCD_CSR_DONE_MASK;
+    *HOSTSIM_Reg(TEST_DMA_CDNE_WORD) = 0U;
+    HOSTTEST_CHECK(EDMA_IsChannelDone(TEST_CHANNEL));
+    HOSTTEST_EQ(test_byte(TEST_DMA_CDNE_WORD, 0U), TEST_CHANNEL);
+    HOSTTEST_ACCESS(TEST_DMA_CDNE_WORD, 0U, 1U);
+
+    /* Live TCD fields */
+    *HOSTSIM_Reg(TEST_TCD_WORD(0x10U)) = 0x4006A010U;
+    *HOSTSIM_Reg(TEST_TCD_WORD(0x14U)) = (0x8000U | 123U) << 16U;
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EDMA_GetDestAddress(TEST_CHANNEL), 0x4006A010U);
+    HOSTTEST_EQ(EDMA_GetRemainingMajorCount(TEST_CHANNEL), 123U);
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x10U), 1U, 0U);
+    HOSTTEST_ACCESS(TEST_TCD_WORD(0x14U), 1U, 0U);
+
+    return HOSTTEST_Done("edma");
+}
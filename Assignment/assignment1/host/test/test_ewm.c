@@ -0,0 +1,111 @@
+/**
+ * @file test_ewm.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: EWM one-time configuration and service sequence.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * The clock gate and the register order of EWM_Init() (CTRL last), the
+ * second-call and configuration checks, the two SERV byte stores of
+ * EWM_Refresh() with nothing read, and the interrupt enable.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_EWM.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* CTRL, SERV, CMPL and CMPH share the first word, CLKPRESCALER the second */
+#define TEST_EWM_WORD0              IP_EWM_BASE
+#define TEST_EWM_WORD1              (IP_EWM_BASE + 4U)
+#define TEST_PCC_EWM                (IP_PCC_BASE + (PCC_EWM_INDEX * 4U))
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_byte(uint32_t address, uint32_t lane)
+{
+    return (*HOSTSIM_Reg(address) >> (lane * 8U)) & 0xFFU;
+}
+
+int main(void)
+{
+    ewm_config_t config =
+    {
+        .prescaler = 127U,
+        .compare_low = 0x10U,
+        .compare_high = 0xF0U,
+        .in_enable = false,
+        .in_active_high = false,
+        .interrupt = false
+    };
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Bad configurations: nothing clocked, nothing written */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EWM_Init(NULL), EWM_STATUS_ERROR);
+    config.compare_low = 0xF0U;
+    HOSTTEST_EQ(EWM_Init(&config), EWM_STATUS_ERROR);
+    config.compare_low = 0x10U;
+    config.compare_high = EWM_COMPARE_HIGH_MAX + 1U;
+    HOSTTEST_EQ(EWM_Init(&config), EWM_STATUS_ERROR);
+    config.compare_high = 0xF0U;
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+    HOSTTEST_CHECK(!EWM_IsEnabled());
+
+    /* Clock gate, then one byte store per register, CTRL last */
+    config.in_enable = true;
+    config.in_active_high = true;
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EWM_Init(&config), EWM_STATUS_SUCCESS);
+    HOSTTEST_CHECK((*HOSTSIM_Reg(TEST_PCC_EWM) & PCC_PCCn_CGC_MASK) != 0U);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD1, 1U), 127U);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 2U), 0x10U);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 3U), 0xF0U);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 0U), EWM_CTRL_EWMEN_MASK | EWM_CTRL_INEN_MASK | EWM_CTRL_ASSIN_MASK);
+    HOSTTEST_ACCESS(TEST_EWM_WORD0, 1U, 3U);
+    HOSTTEST_ACCESS(TEST_EWM_WORD1, 0U, 1U);
+    HOSTTEST_CHECK(EWM_IsEnabled());
+
+    /* CTRL is write-once: a second call is refused */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(EWM_Init(&config), EWM_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_EWM_WORD0, 1U, 0U);
+    HOSTTEST_ACCESS(TEST_EWM_WORD1, 0U, 0U);
+
+    /* Service: the two keys back to back, nothing read */
+    HOSTSIM_TraceReset();
+    EWM_Refresh();
+    HOSTTEST_ACCESS(TEST_EWM_WORD0, 0U, 2U);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 1U), 0x2CU);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 2U), 0x10U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads, 0U);
+    HOSTTEST_EQ(total.stores, 2U);
+
+    /* Interrupt enable, other CTRL bits kept */
+    EWM_SetInterrupt(true);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 0U),
+                EWM_CTRL_EWMEN_MASK | EWM_CTRL_INEN_MASK | EWM_CTRL_ASSIN_MASK | EWM_CTRL_INTEN_MASK);
+    EWM_SetInterrupt(false);
+    HOSTTEST_EQ(test_byte(TEST_EWM_WORD0, 0U), EWM_CTRL_EWMEN_MASK | EWM_CTRL_INEN_MASK | EWM_CTRL_ASSIN_MASK);
+    HOSTTEST_CHECK(EWM_IsEnabled());
+
+    return HOSTTEST_Done("ewm");
+}
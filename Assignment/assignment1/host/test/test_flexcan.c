@@ -0,0 +1,344 @@
+/**
+ * @file test_flexcan.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: FlexCAN acceptance filtering, RX FIFO, RX mailboxes and
+ *        TX priority under synthetic bus load, against the FlexCAN model.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * FLEXCAN0 runs with an RX FIFO of two filters (standard 0x100..0x10F and
+ * one extended diagnostic ID) and an RX mailbox for the OBD broadcast 0x7DF.
+ * A pseudo-random stream of frames, about one second of a 500 kbit/s bus at
+ * 90 % load, is put on the bus; an "ISR" reads the mailbox as soon as its
+ * IFLAG1 bit is up and drains the FIFO every TEST_ISR_EVERY frames. The test
+ * checks that only accepted frames ever reach software, none is lost, and the
+ * driver cost per frame in register accesses. FLEXCAN1 is then initialised
+ * to check that only its 16 mailboxes and their masks are cleared.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_FLEXCAN.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_CAN                    FLEXCAN_0
+#define TEST_CAN_REG(r)             (IP_FLEXCAN0_BASE + offsetof(FLEXCAN_Type, r))
+#define TEST_CAN_RAM(w)             (IP_FLEXCAN0_BASE + offsetof(FLEXCAN_Type, RAMn) + ((w) * 4U))
+#define TEST_CAN_RXIMR(n)           (IP_FLEXCAN0_BASE + offsetof(FLEXCAN_Type, RXIMR) + ((n) * 4U))
+#define TEST_CAN1_RAM(w)            (IP_FLEXCAN1_BASE + offsetof(FLEXCAN_Type, RAMn) + ((w) * 4U))
+#define TEST_CAN1_RXIMR(n)          (IP_FLEXCAN1_BASE + offsetof(FLEXCAN_Type, RXIMR) + ((n) * 4U))
+
+/* 8-byte standard frames of ~112 bits: 4000 frames ~ 1 s at 90 % of 500 kbit/s */
+#define TEST_FRAMES                 4000U
+/* Frames between two ISR runs, below the FIFO depth of 6 */
+#define TEST_ISR_EVERY              4U
+
+#define TEST_RX_MB                  8U
+#define TEST_TX_POOL                ((1UL << 12U) | (1UL << 13U) | (1UL << 14U))
+
+#define TEST_DIAG_ID                0x18DAF110U
+#define TEST_OBD_ID                 0x7DFU
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const flexcan_id_filter_t s_test_fifo_filters[] =
+{
+    { 0x100U, 0x7F0U, FLEXCAN_ID_STD },
+    { TEST_DIAG_ID, 0x1FFFFFFFU, FLEXCAN_ID_EXT }
+};
+
+static uint32_t s_test_seed = 12345U;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_random(void)
+{
+    s_test_seed = (s_test_seed * 1103515245U) + 12345U;
+
+    return s_test_seed >> 8;
+}
+
+static void test_config(flexcan_config_t *config)
+{
+    memset(config, 0, sizeof(*config));
+
+    /* 8 MHz SOSCDIV2, 500 kbit/s: 16 quanta, 1 + 7 + 4 + 4, sample point 75 % */
+    config->clk_src = FLEXCAN_CLK_SOSCDIV2;
+    config->timing.presdiv = 0U;
+    config->timing.propseg = 6U;
+    config->timing.pseg1 = 3U;
+    config->timing.pseg2 = 3U;
+    config->timing.rjw = 3U;
+    config->max_mb = 16U;
+    config->rx_fifo = true;
+    config->fifo_filters = s_test_fifo_filters;
+    config->fifo_filter_count = 2U;
+    config->local_priority = true;
+}
+
+/* Next frame on the bus: mostly unrelated traffic, every 8th a wanted ID */
+static void test_next_frame(hostsim_can_frame_t *frame)
+{
+    uint32_t r = test_random();
+    uint32_t i;
+
+    memset(frame, 0, sizeof(*frame));
+    frame->dlc = 8U;
+    for (i = 0U; i < 8U; i++)
+    {
+        frame->data[i] = (uint8_t)(r >> i);
+    }
+
+    switch (r % 8U)
+    {
+        case 0U:
+            frame->id = 0x100U | ((r >> 4) & 0xFU);
+            break;
+        case 1U:
+            frame->ext = true;
+            frame->id = ((r & 0x10U) != 0U) ? TEST_DIAG_ID : (TEST_DIAG_ID ^ ((r >> 5) & 0xFFU) ^ 1U);
+            break;
+        case 2U:
+            frame->id = ((r & 0x10U) != 0U) ? TEST_OBD_ID : 0x7DEU;
+            break;
+        default:
+            frame->ext = ((r & 0x20U) != 0U);
+            frame->id = frame->ext ? ((r >> 3) & 0x1FFFFFFFU) : ((r >> 3) & 0x7FFU);
+            break;
+    }
+}
+
+static bool test_wanted(const hostsim_can_frame_t *frame)
+{
+    return frame->ext ? (frame->id == TEST_DIAG_ID) :
+                        (((frame->id & 0x7F0U) == 0x100U) || (frame->id == TEST_OBD_ID));
+}
+
+int main(void)
+{
+    flexcan_config_t config;
+    flexcan_id_filter_t obd = { TEST_OBD_ID, 0x7FFU, FLEXCAN_ID_STD };
+    hostsim_can_frame_t frame;
+    flexcan_frame_t rx;
+    flexcan_frame_t tx;
+    hostsim_trace_t total;
+    uint32_t wanted = 0U;
+    uint32_t fifo_read = 0U;
+    uint32_t mb_read = 0U;
+    uint32_t fifo = 0U;
+    uint32_t mailbox = 0U;
+    uint32_t lost = 0U;
+    uint32_t unwanted = 0U;
+    uint32_t since_isr = 0U;
+    uint32_t flags;
+    uint8_t used_mb;
+    uint32_t n;
+    uint32_t i;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Init: out of freeze, FIFO and filter table set up, RAM cleared once */
+    test_config(&config);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FLEXCAN_Init(TEST_CAN, &config), FLEXCAN_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(MCR)) & (FLEXCAN_MCR_MDIS_MASK | FLEXCAN_MCR_FRZ_MASK |
+                                                  FLEXCAN_MCR_HALT_MASK | FLEXCAN_MCR_FRZACK_MASK), 0U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(MCR)) & (FLEXCAN_MCR_RFEN_MASK | FLEXCAN_MCR_IRMQ_MASK |
+                                                  FLEXCAN_MCR_LPRIOEN_MASK | FLEXCAN_MCR_MAXMB_MASK),
+                FLEXCAN_MCR_RFEN_MASK | FLEXCAN_MCR_IRMQ_MASK | FLEXCAN_MCR_LPRIOEN_MASK | 15U);
+    HOSTTEST_EQ(FLEXCAN_GetFirstFreeMb(TEST_CAN), 8U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_RAM(24U)), 0x100UL << 19U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_RAM(25U)), 0x40000000UL | (TEST_DIAG_ID << 1U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_RAM(31U)), *HOSTSIM_Reg(TEST_CAN_RAM(25U)));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_RXIMR(0U)), 0xC0000000UL | (0x7F0UL << 19U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(IP_PCC_BASE + PCC_FLEXCAN0) & PCC_PCCn_CGC_MASK, PCC_PCCn_CGC_MASK);
+    HOSTTEST_ACCESS(TEST_CAN_RAM(100U), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_CAN_RAM(24U), 0U, 2U);
+
+    /* RX mailbox for 0x7DF: the mask compares ID, IDE and RTR, nothing else */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FLEXCAN_ConfigRxMb(TEST_CAN, TEST_RX_MB, &obd), FLEXCAN_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_RXIMR(TEST_RX_MB)), 0xC0000000UL | (0x7FFUL << 18U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_RAM(TEST_RX_MB * 4U)), 0x04000000U);
+    HOSTTEST_ACCESS(TEST_CAN_RAM(TEST_RX_MB * 4U), 0U, 2U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(MCR)) & FLEXCAN_MCR_FRZACK_MASK, 0U);
+
+    /* Irrelevant traffic only: filtered in hardware, the driver is never run */
+    HOSTSIM_TraceReset();
+    for (n = 0U; n < TEST_FRAMES; n++)
+    {
+        test_next_frame(&frame);
+        if (test_wanted(&frame))
+        {
+            continue;
+        }
+        HOSTTEST_EQ(HOSTSIM_CanReceive(0U, &frame), HOSTSIM_CAN_REJECTED);
+    }
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(IFLAG1)), 0U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+
+    /*
+     * Mixed traffic. The mailbox has no queue, so its ISR runs before the next
+     * frame; the FIFO is drained once TEST_ISR_EVERY frames have passed.
+     */
+    HOSTSIM_TraceReset();
+    for (n = 0U; n < TEST_FRAMES; n++)
+    {
+        test_next_frame(&frame);
+        wanted += test_wanted(&frame) ? 1U : 0U;
+
+        switch (HOSTSIM_CanReceive(0U, &frame))
+        {
+            case HOSTSIM_CAN_FIFO:
+                fifo++;
+                break;
+            case HOSTSIM_CAN_MAILBOX:
+                mailbox++;
+                break;
+            case HOSTSIM_CAN_LOST:
+                lost++;
+                break;
+            default:
+                break;
+        }
+
+        flags = *HOSTSIM_Reg(TEST_CAN_REG(IFLAG1));
+        if ((flags & (1UL << TEST_RX_MB)) != 0U)
+        {
+            HOSTTEST_EQ(FLEXCAN_ReadRxMb(TEST_CAN, TEST_RX_MB, &rx), FLEXCAN_STATUS_SUCCESS);
+            mb_read++;
+            unwanted += ((rx.id_type != FLEXCAN_ID_STD) || (rx.id != TEST_OBD_ID)) ? 1U : 0U;
+        }
+
+        since_isr++;
+        if ((since_isr < TEST_ISR_EVERY) || ((flags & FLEXCAN_IFLAG1_BUF5I_MASK) == 0U))
+        {
+            continue;
+        }
+        since_isr = 0U;
+
+        while (FLEXCAN_ReadRxFifo(TEST_CAN, &rx) == FLEXCAN_STATUS_SUCCESS)
+        {
+            fifo_read++;
+            unwanted += ((rx.id_type == FLEXCAN_ID_EXT) ? (rx.id != TEST_DIAG_ID) :
+                                                         ((rx.id & 0x7F0U) != 0x100U)) ? 1U : 0U;
+        }
+    }
+
+    printf("flexcan: %lu frames, %lu wanted, %lu via FIFO, %lu via mailbox, %lu lost\n",
+           (unsigned long)TEST_FRAMES, (unsigned long)wanted, (unsigned long)fifo,
+           (unsigned long)mailbox, (unsigned long)lost);
+
+    HOSTTEST_CHECK(wanted > (TEST_FRAMES / 8U));
+    HOSTTEST_EQ(fifo + mailbox, wanted);
+    HOSTTEST_EQ(lost, 0U);
+    HOSTTEST_EQ(unwanted, 0U);
+    HOSTTEST_EQ(mb_read, mailbox);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(IFLAG1)) & FLEXCAN_IFLAG1_BUF7I_MASK, 0U);
+
+    /* Per frame: output C/S and ID read once each, popped by one IFLAG1 store */
+    HOSTTEST_ACCESS(TEST_CAN_RAM(0U), fifo_read, 0U);
+    HOSTTEST_ACCESS(TEST_CAN_RAM(1U), fifo_read, 0U);
+    HOSTTEST_ACCESS(TEST_CAN_RAM(TEST_RX_MB * 4U), mb_read, 0U);
+    HOSTSIM_TraceGet(TEST_CAN_REG(IFLAG1), &total);
+    HOSTTEST_EQ(total.stores, fifo_read + mb_read);
+
+    /* Drain what the last frames left behind */
+    while (FLEXCAN_ReadRxFifo(TEST_CAN, &rx) == FLEXCAN_STATUS_SUCCESS)
+    {
+        fifo_read++;
+    }
+    HOSTTEST_EQ(fifo_read, fifo);
+
+    /* Burst with the ISR held off: 6 in the FIFO, warning at 5, the 7th lost */
+    memset(&frame, 0, sizeof(frame));
+    frame.id = 0x105U;
+    frame.dlc = 2U;
+    for (i = 0U; i < 7U; i++)
+    {
+        frame.data[0] = (uint8_t)i;
+        HOSTTEST_EQ(HOSTSIM_CanReceive(0U, &frame), (i < 6U) ? HOSTSIM_CAN_FIFO : HOSTSIM_CAN_LOST);
+    }
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(IFLAG1)) &
+                (FLEXCAN_IFLAG1_BUF5I_MASK | FLEXCAN_IFLAG1_BUF6I_MASK | FLEXCAN_IFLAG1_BUF7I_MASK),
+                FLEXCAN_IFLAG1_BUF5I_MASK | FLEXCAN_IFLAG1_BUF6I_MASK | FLEXCAN_IFLAG1_BUF7I_MASK);
+    for (i = 0U; i < 6U; i++)
+    {
+        HOSTTEST_EQ(FLEXCAN_ReadRxFifo(TEST_CAN, &rx), FLEXCAN_STATUS_SUCCESS);
+        HOSTTEST_EQ(rx.data[0], i);
+        HOSTTEST_EQ(rx.dlc, 2U);
+    }
+    HOSTTEST_EQ(FLEXCAN_ReadRxFifo(TEST_CAN, &rx), FLEXCAN_STATUS_NO_DATA);
+
+    /* TX: local priority ahead of the ID, whatever the mailbox order */
+    memset(&tx, 0, sizeof(tx));
+    tx.dlc = 8U;
+    tx.data[0] = 0xA5U;
+    tx.id = 0x300U;
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FLEXCAN_Send(TEST_CAN, 12U, &tx, 3U), FLEXCAN_STATUS_SUCCESS);
+    HOSTTEST_ACCESS(TEST_CAN_RAM(12U * 4U), 1U, 2U);
+    HOSTTEST_ACCESS(TEST_CAN_RAM((12U * 4U) + 1U), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_CAN_RAM((12U * 4U) + 2U), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_CAN_REG(IFLAG1), 0U, 1U);
+    tx.id = 0x700U;
+    HOSTTEST_EQ(FLEXCAN_Send(TEST_CAN, 13U, &tx, 1U), FLEXCAN_STATUS_SUCCESS);
+    tx.id = 0x200U;
+    HOSTTEST_EQ(FLEXCAN_SendFromPool(TEST_CAN, TEST_TX_POOL, &tx, 1U, &used_mb), FLEXCAN_STATUS_SUCCESS);
+    HOSTTEST_EQ(used_mb, 14U);
+    HOSTTEST_EQ(FLEXCAN_SendFromPool(TEST_CAN, TEST_TX_POOL, &tx, 0U, &used_mb), FLEXCAN_STATUS_BUSY);
+    HOSTTEST_EQ(FLEXCAN_Send(TEST_CAN, 12U, &tx, 0U), FLEXCAN_STATUS_BUSY);
+
+    HOSTTEST_EQ(HOSTSIM_CanTransmit(0U, &frame), 14);
+    HOSTTEST_EQ(frame.id, 0x200U);
+    HOSTTEST_EQ(frame.data[0], 0xA5U);
+    HOSTTEST_EQ(HOSTSIM_CanTransmit(0U, &frame), 13);
+    HOSTTEST_EQ(frame.id, 0x700U);
+    HOSTTEST_EQ(HOSTSIM_CanTransmit(0U, &frame), 12);
+    HOSTTEST_EQ(HOSTSIM_CanTransmit(0U, &frame), -1);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_CAN_REG(IFLAG1)) & TEST_TX_POOL, TEST_TX_POOL);
+    HOSTTEST_EQ((*HOSTSIM_Reg(TEST_CAN_RAM(12U * 4U)) >> 24U) & 0xFU, 0x8U);
+
+    /* Sent mailboxes are free again */
+    HOSTTEST_EQ(FLEXCAN_SendFromPool(TEST_CAN, TEST_TX_POOL, &tx, 0U, &used_mb), FLEXCAN_STATUS_SUCCESS);
+    HOSTTEST_EQ(used_mb, 12U);
+
+    /* Frozen or disabled, the module takes no traffic */
+    HOSTTEST_EQ(FLEXCAN_Deinit(TEST_CAN), FLEXCAN_STATUS_SUCCESS);
+    frame.id = 0x105U;
+    frame.ext = false;
+    HOSTTEST_EQ(HOSTSIM_CanReceive(0U, &frame), HOSTSIM_CAN_REJECTED);
+    HOSTTEST_EQ(HOSTSIM_CanTransmit(0U, &frame), -1);
+
+    /* FLEXCAN1 implements 16 mailboxes: nothing past them is cleared */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FLEXCAN_Init(FLEXCAN_1, &config), FLEXCAN_STATUS_SUCCESS);
+    HOSTTEST_ACCESS(TEST_CAN1_RAM(63U), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_CAN1_RAM(64U), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_CAN1_RAM(127U), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_CAN1_RXIMR(15U), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_CAN1_RXIMR(16U), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_CAN1_RXIMR(31U), 0U, 0U);
+    HOSTTEST_EQ(FLEXCAN_Deinit(FLEXCAN_1), FLEXCAN_STATUS_SUCCESS);
+
+    return HOSTTEST_Done("flexcan");
+}
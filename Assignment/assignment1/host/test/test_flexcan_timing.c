@@ -0,0 +1,130 @@
+/**
+ * @file test_flexcan_timing.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: CAN FD nominal/data bit timing solver.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Known CiA 601-3 style operating points on an 80 MHz and a 40 MHz protocol
+ * engine clock, unreachable bit rates, and the fallback taken when no
+ * nominal/data candidate pair shares a prescaler. The solver is pure
+ * arithmetic: no register is touched.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_FLEXCAN.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_PE_80MHZ               80000000U
+#define TEST_PE_40MHZ               40000000U
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* Bit time in quanta of a solver result must give the bit rate exactly */
+static uint32_t test_bitrate(uint32_t clk_hz, const flexcan_bit_timing_t *t)
+{
+    return clk_hz / ((uint32_t)t->presdiv * (1U + t->propseg + t->pseg1 + t->pseg2));
+}
+
+static void test_expect(const flexcan_bit_timing_t *t, uint16_t presdiv, uint8_t propseg, uint8_t pseg1,
+                        uint8_t pseg2, uint16_t sample_point)
+{
+    HOSTTEST_EQ(t->presdiv, presdiv);
+    HOSTTEST_EQ(t->propseg, propseg);
+    HOSTTEST_EQ(t->pseg1, pseg1);
+    HOSTTEST_EQ(t->pseg2, pseg2);
+    HOSTTEST_EQ(t->rjw, (pseg1 < pseg2) ? pseg1 : pseg2);
+    HOSTTEST_EQ(t->sample_point, sample_point);
+}
+
+int main(void)
+{
+    flexcan_bit_timing_t nominal;
+    flexcan_bit_timing_t data;
+    flexcan_bit_timing_t nomCand[8];
+    flexcan_bit_timing_t dataCand[8];
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    HOSTSIM_TraceReset();
+
+    /* 500 kbit/s / 2 Mbit/s at 80 %, 80 MHz: shared 40 MHz quantum, 80 + 20 tq */
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 500000U, 800U, 2000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_SUCCESS);
+    test_expect(&nominal, 2U, 47U, 16U, 16U, 800U);
+    test_expect(&data, 2U, 11U, 4U, 4U, 800U);
+    HOSTTEST_EQ(test_bitrate(TEST_PE_80MHZ, &nominal), 500000U);
+    HOSTTEST_EQ(test_bitrate(TEST_PE_80MHZ, &data), 2000000U);
+
+    /* Same point on 40 MHz: prescaler 1 for both phases */
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_40MHZ, 500000U, 800U, 2000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_SUCCESS);
+    test_expect(&nominal, 1U, 47U, 16U, 16U, 800U);
+    test_expect(&data, 1U, 11U, 4U, 4U, 800U);
+
+    /* 1 Mbit/s / 5 Mbit/s, 80 % / 75 %, 80 MHz: 80 + 16 tq of 12.5 ns */
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 1000000U, 800U, 5000000U, 750U, &nominal, &data),
+                FLEXCAN_STATUS_SUCCESS);
+    test_expect(&nominal, 1U, 47U, 16U, 16U, 800U);
+    test_expect(&data, 1U, 7U, 4U, 4U, 750U);
+    HOSTTEST_EQ(test_bitrate(TEST_PE_80MHZ, &nominal), 1000000U);
+    HOSTTEST_EQ(test_bitrate(TEST_PE_80MHZ, &data), 5000000U);
+
+    /* Unreachable: no integer quanta for 333 kbit/s or 7 Mbit/s on 80 MHz */
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 333000U, 800U, 2000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_ERROR);
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 500000U, 800U, 7000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_ERROR);
+    /* 10 Mbit/s on 40 MHz is 4 quanta, below the FDCBT minimum of 5 */
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_40MHZ, 500000U, 800U, 10000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_ERROR);
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 0U, 800U, 2000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_ERROR);
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 500000U, 1000U, 2000000U, 800U, &nominal, &data),
+                FLEXCAN_STATUS_ERROR);
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 500000U, 800U, 2000000U, 800U, NULL, &data),
+                FLEXCAN_STATUS_ERROR);
+    HOSTTEST_EQ(FLEXCAN_SolveBitTiming(FLEXCAN_PHASE_DATA, TEST_PE_80MHZ, 7000000U, 800U, dataCand, 8U), 0U);
+
+    /*
+     * No shared prescaler: 250 kbit/s needs a prescaler of 4 or more on
+     * 80 MHz (at most 129 CBT quanta), 5 Mbit/s at most 2 (at least 5 FDCBT
+     * quanta). Each phase then falls back to its own best solution.
+     */
+    HOSTTEST_EQ(FLEXCAN_SolveBitTiming(FLEXCAN_PHASE_NOMINAL, TEST_PE_80MHZ, 250000U, 800U, nomCand, 8U), 8U);
+    HOSTTEST_EQ(FLEXCAN_SolveBitTiming(FLEXCAN_PHASE_DATA, TEST_PE_80MHZ, 5000000U, 750U, dataCand, 8U), 2U);
+    HOSTTEST_EQ(FLEXCAN_SolveFdTiming(TEST_PE_80MHZ, 250000U, 800U, 5000000U, 750U, &nominal, &data),
+                FLEXCAN_STATUS_SUCCESS);
+    test_expect(&nominal, nomCand[0].presdiv, nomCand[0].propseg, nomCand[0].pseg1, nomCand[0].pseg2,
+                nomCand[0].sample_point);
+    test_expect(&data, dataCand[0].presdiv, dataCand[0].propseg, dataCand[0].pseg1, dataCand[0].pseg2,
+                dataCand[0].sample_point);
+    test_expect(&nominal, 4U, 47U, 16U, 16U, 800U);
+    test_expect(&data, 1U, 7U, 4U, 4U, 750U);
+    HOSTTEST_CHECK(nominal.presdiv != data.presdiv);
+
+    /* Ranking: sample-point error first, then the smaller prescaler */
+    HOSTTEST_EQ(nomCand[1].presdiv, 8U);
+    HOSTTEST_EQ(nomCand[4].sample_point, 797U);
+
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+
+    return HOSTTEST_Done("flexcan_timing");
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test_ftfc.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: FTFC erase/program commands, errors and async jobs.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Runs against the FTFC model's simulated P-Flash and FlexNVM: FCCOB layout
+ * of Erase Sector and Program Phrase (FlexNVM with bit 23 set), the FSTAT
+ * accesses of one command, parameter checks without a register access, the
+ * ACCERR/FPVIOL/MGSTAT0 statuses, Program Partition and Set FlexRAM, an
+ * async job driven through FTFC_IRQHandler() and the LMEM invalidate at the
+ * end of a job. FlexRAM is not modelled, so Program Section and EEE writes
+ * are not exercised.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_FTFC.h"
+#include "../driver/inc/Driver_LMEM.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* FSTAT, FCNFG, FSEC and FOPT share the first word */
+#define TEST_FTFC_FSTAT_WORD        IP_FTFC_BASE
+#define TEST_FTFC_FCCOB_WORD(n)     (IP_FTFC_BASE + offsetof(FTFC_Type, FCCOB) + ((n) * 4U))
+#define TEST_FTFC_FPROT             (IP_FTFC_BASE + offsetof(FTFC_Type, FPROT))
+#define TEST_FTFC_FCNFG_SHIFT       8U
+
+#define TEST_PFLASH_SECTOR          0x00040000U
+#define TEST_DFLASH_SECTOR          (FTFC_DFLASH_BASE + 0x800U)
+/* P-Flash region 31, the last 16 KB */
+#define TEST_PFLASH_PROTECTED       0x0007C000U
+
+#define TEST_DATA_SIZE              64U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static uint8_t s_test_data[TEST_DATA_SIZE];
+
+static uint32_t s_test_callbacks;
+static FTFC_STATUS_t s_test_status;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void test_callback(FTFC_STATUS_t status, void *user)
+{
+    s_test_callbacks++;
+    s_test_status = status;
+    *(uint32_t *)user += 1U;
+}
+
+static bool test_flash_equals(uint32_t address, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0U; i < len; i++)
+    {
+        if (*HOSTSIM_FtfcFlash(address + i) != data[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool test_flash_erased(uint32_t address, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0U; i < len; i++)
+    {
+        if (*HOSTSIM_FtfcFlash(address + i) != 0xFFU)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void test_flash_fill(uint32_t address, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0U; i < len; i++)
+    {
+        *HOSTSIM_FtfcFlash(address + i) = (uint8_t)i;
+    }
+}
+
+int main(void)
+{
+    uint32_t i;
+    uint32_t user = 0U;
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    for (i = 0U; i < TEST_DATA_SIZE; i++)
+    {
+        s_test_data[i] = (uint8_t)(0xA5U ^ (i * 7U));
+    }
+
+    HOSTTEST_CHECK(HOSTSIM_FtfcFlash(FTFC_PFLASH_SIZE) == NULL);
+    HOSTTEST_CHECK(HOSTSIM_FtfcFlash(FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE) == NULL);
+    HOSTTEST_CHECK(!FTFC_IsBusy());
+
+    /* One sector: FCCOB0 = 0x09 and the address, FSTAT cleared then launched */
+    test_flash_fill(TEST_PFLASH_SECTOR - 8U, FTFC_PFLASH_SECTOR_SIZE + 16U);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FTFC_Erase(TEST_PFLASH_SECTOR, FTFC_PFLASH_SECTOR_SIZE), FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(0U)), 0x09040000U);
+    HOSTTEST_ACCESS(TEST_FTFC_FCCOB_WORD(0U), 0U, 4U);
+    HOSTTEST_ACCESS(TEST_FTFC_FSTAT_WORD, 3U, 2U);
+    HOSTTEST_CHECK(test_flash_erased(TEST_PFLASH_SECTOR, FTFC_PFLASH_SECTOR_SIZE));
+    HOSTTEST_EQ(*HOSTSIM_FtfcFlash(TEST_PFLASH_SECTOR - 1U), 0x07U);
+    HOSTTEST_EQ(*HOSTSIM_FtfcFlash(TEST_PFLASH_SECTOR + FTFC_PFLASH_SECTOR_SIZE), 0x08U);
+
+    /* Phrases: FCCOB4..B in memory order, one command per phrase */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 0x100U, s_test_data, 16U), FTFC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(test_flash_equals(TEST_PFLASH_SECTOR + 0x100U, s_test_data, 16U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(0U)), 0x07040108U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(1U)),
+                (uint32_t)s_test_data[8] | ((uint32_t)s_test_data[9] << 8U) |
+                ((uint32_t)s_test_data[10] << 16U) | ((uint32_t)s_test_data[11] << 24U));
+    HOSTTEST_ACCESS(TEST_FTFC_FCCOB_WORD(1U), 0U, 8U);
+    HOSTTEST_ACCESS(TEST_FTFC_FCCOB_WORD(2U), 0U, 8U);
+    /* Busy check, then per phrase: clear, FCNFG, launch, poll, result */
+    HOSTTEST_ACCESS(TEST_FTFC_FSTAT_WORD, 7U, 4U);
+    HOSTTEST_CHECK(test_flash_erased(TEST_PFLASH_SECTOR + 0x110U, 8U));
+
+    /* FlexNVM: 2 KB sectors, bit 23 in FCCOB */
+    HOSTTEST_EQ(FTFC_Erase(TEST_DFLASH_SECTOR, FTFC_DFLASH_SECTOR_SIZE), FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(0U)), 0x09800800U);
+    HOSTTEST_EQ(FTFC_Program(TEST_DFLASH_SECTOR + FTFC_DFLASH_SECTOR_SIZE - 8U, s_test_data, 8U),
+                FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(0U)), 0x07800FF8U);
+    HOSTTEST_CHECK(test_flash_equals(TEST_DFLASH_SECTOR + FTFC_DFLASH_SECTOR_SIZE - 8U, s_test_data, 8U));
+
+    /* Parameters are checked before any register access */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FTFC_Erase(TEST_PFLASH_SECTOR + FTFC_DFLASH_SECTOR_SIZE, FTFC_PFLASH_SECTOR_SIZE),
+                FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Erase(TEST_DFLASH_SECTOR, FTFC_DFLASH_SECTOR_SIZE / 2U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Erase(TEST_PFLASH_SECTOR, 0U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Erase(FTFC_PFLASH_SIZE - FTFC_PFLASH_SECTOR_SIZE, 2U * FTFC_PFLASH_SECTOR_SIZE),
+                FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 4U, s_test_data, 8U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR, s_test_data, 12U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR, NULL, 8U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_Program(FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE - 8U, s_test_data, 16U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_ProgramAsync(FTFC_FLEXRAM_BASE, s_test_data, 8U, test_callback, &user), FTFC_STATUS_ERROR);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+
+    /* A 0 bit cannot be programmed back to 1: MGSTAT0, cleared by the next command */
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 0x100U, &s_test_data[8], 8U), FTFC_STATUS_VERIFY);
+    HOSTTEST_CHECK((*HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) & FTFC_FSTAT_MGSTAT0_MASK) != 0U);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 0x200U, s_test_data, 8U), FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) & 0xFFU, FTFC_FSTAT_CCIF_MASK);
+
+    /* FPROT bit clear: region protected, FPVIOL; flash untouched */
+    *HOSTSIM_Reg(TEST_FTFC_FPROT) = ~(1U << (TEST_PFLASH_PROTECTED / 0x4000U));
+    HOSTTEST_EQ(FTFC_Erase(TEST_PFLASH_PROTECTED, FTFC_PFLASH_SECTOR_SIZE), FTFC_STATUS_PROTECTION);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_PROTECTED + 0x3FF8U, s_test_data, 8U), FTFC_STATUS_PROTECTION);
+    HOSTTEST_CHECK(test_flash_erased(TEST_PFLASH_PROTECTED + 0x3FF8U, 8U));
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_PROTECTED - 8U, s_test_data, 8U), FTFC_STATUS_SUCCESS);
+    *HOSTSIM_Reg(TEST_FTFC_FPROT) = 0xFFFFFFFFU;
+
+    /* A stale ACCERR blocks the launch until the next command clears it */
+    *HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) |= FTFC_FSTAT_ACCERR_MASK;
+    HOSTTEST_EQ(FTFC_Erase(TEST_PFLASH_SECTOR, FTFC_PFLASH_SECTOR_SIZE), FTFC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(test_flash_erased(TEST_PFLASH_SECTOR, FTFC_PFLASH_SECTOR_SIZE));
+
+    /* Partition is one-time; EEE only after it, RAM at any time */
+    HOSTTEST_EQ(FTFC_SetFlexRam(FTFC_FLEXRAM_EEE), FTFC_STATUS_ACCESS);
+    HOSTTEST_EQ(FTFC_ProgramPartition(FTFC_EEE_SIZE_4K, FTFC_DEPART_DFLASH_32K), FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(0U)), 0x80000000U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(1U)) >> 16U,
+                ((uint32_t)FTFC_EEE_SIZE_4K << 8U) | FTFC_DEPART_DFLASH_32K);
+    HOSTTEST_EQ(FTFC_ProgramPartition(FTFC_EEE_SIZE_4K, FTFC_DEPART_DFLASH_32K), FTFC_STATUS_ACCESS);
+    HOSTTEST_EQ(FTFC_SetFlexRam(FTFC_FLEXRAM_EEE), FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTFC_FCCOB_WORD(0U)) >> 16U, 0x8100U);
+    HOSTTEST_EQ((*HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) >> TEST_FTFC_FCNFG_SHIFT) &
+                (FTFC_FCNFG_EEERDY_MASK | FTFC_FCNFG_RAMRDY_MASK), FTFC_FCNFG_EEERDY_MASK);
+    HOSTTEST_EQ(FTFC_EeeWrite(FTFC_PFLASH_SIZE, s_test_data, 1U), FTFC_STATUS_ERROR);
+    HOSTTEST_EQ(FTFC_EeeWrite(0U, NULL, 1U), FTFC_STATUS_ERROR);
+
+    /* EEERDY clear: EEE writes are refused before FlexRAM is touched */
+    *HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) &= ~((uint32_t)FTFC_FCNFG_EEERDY_MASK << TEST_FTFC_FCNFG_SHIFT);
+    HOSTTEST_EQ(FTFC_EeeWrite(0U, s_test_data, 1U), FTFC_STATUS_ERROR);
+
+    /* Async program: one phrase per interrupt, callback once, CCIE cleared */
+    s_test_callbacks = 0U;
+    HOSTTEST_EQ(FTFC_ProgramAsync(TEST_DFLASH_SECTOR, s_test_data, 24U, test_callback, &user), FTFC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(FTFC_IsBusy());
+    HOSTTEST_CHECK(((*HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) >> TEST_FTFC_FCNFG_SHIFT) & FTFC_FCNFG_CCIE_MASK) != 0U);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR, s_test_data, 8U), FTFC_STATUS_BUSY);
+    HOSTTEST_EQ(FTFC_SetFlexRam(FTFC_FLEXRAM_RAM), FTFC_STATUS_BUSY);
+    HOSTTEST_CHECK(test_flash_equals(TEST_DFLASH_SECTOR, s_test_data, 8U));
+    HOSTTEST_CHECK(test_flash_erased(TEST_DFLASH_SECTOR + 8U, 16U));
+    FTFC_IRQHandler();
+    FTFC_IRQHandler();
+    HOSTTEST_EQ(s_test_callbacks, 0U);
+    HOSTTEST_CHECK(test_flash_equals(TEST_DFLASH_SECTOR, s_test_data, 24U));
+    FTFC_IRQHandler();
+    HOSTTEST_EQ(s_test_callbacks, 1U);
+    HOSTTEST_EQ(s_test_status, FTFC_STATUS_SUCCESS);
+    HOSTTEST_EQ(user, 1U);
+    HOSTTEST_CHECK(!FTFC_IsBusy());
+    HOSTTEST_CHECK(((*HOSTSIM_Reg(TEST_FTFC_FSTAT_WORD) >> TEST_FTFC_FCNFG_SHIFT) & FTFC_FCNFG_CCIE_MASK) == 0U);
+
+    /* Async erase stops at the first failing sector and reports it */
+    *HOSTSIM_Reg(TEST_FTFC_FPROT) = ~(1U << ((TEST_PFLASH_SECTOR + 0x4000U) / 0x4000U));
+    HOSTTEST_EQ(FTFC_EraseAsync(TEST_PFLASH_SECTOR + 0x3000U, 3U * FTFC_PFLASH_SECTOR_SIZE, test_callback, &user),
+                FTFC_STATUS_SUCCESS);
+    FTFC_IRQHandler();
+    HOSTTEST_EQ(s_test_callbacks, 1U);
+    FTFC_IRQHandler();
+    HOSTTEST_EQ(s_test_callbacks, 2U);
+    HOSTTEST_EQ(s_test_status, FTFC_STATUS_PROTECTION);
+    HOSTTEST_CHECK(!FTFC_IsBusy());
+    *HOSTSIM_Reg(TEST_FTFC_FPROT) = 0xFFFFFFFFU;
+
+    /* End of a job: the rewritten lines are dropped from the code cache */
+    LMEM_Enable();
+    HOSTSIM_LmemFetch(TEST_PFLASH_SECTOR + 0x300U);
+    HOSTSIM_LmemFetch(TEST_PFLASH_SECTOR + 0x310U);
+    HOSTSIM_LmemFetch(TEST_PFLASH_SECTOR + 0x320U);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 0x300U, s_test_data, 32U), FTFC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_PFLASH_SECTOR + 0x300U));
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_PFLASH_SECTOR + 0x310U));
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_PFLASH_SECTOR + 0x320U));
+
+    /* Also for a failed job */
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 0x320U, s_test_data, 8U), FTFC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_PFLASH_SECTOR + 0x320U));
+    HOSTSIM_LmemFetch(TEST_PFLASH_SECTOR + 0x300U);
+    HOSTTEST_EQ(FTFC_Program(TEST_PFLASH_SECTOR + 0x300U, &s_test_data[8], 8U), FTFC_STATUS_VERIFY);
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_PFLASH_SECTOR + 0x300U));
+
+    return HOSTTEST_Done("ftfc");
+}
@@ -0,0 +1,323 @@
+/**
+ * @file test_ftm.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: FTM input capture, pulse width and quadrature decoding by
+ *        replaying input edges into the FTM model.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Edges are placed at known counter times and the driver results compared
+ * with them:
+ * - FTM1 CH0 captures both edges of a signal whose edges are up to several
+ *   counter periods apart. The overflow "ISR" runs late, so reads also see
+ *   a wrap still pending in TOF.
+ * - FTM1 pair 1 (CH2/CH3) measures high pulses and periods, one-shot and
+ *   continuous.
+ * - FTM2 decodes a phase A/B signal that changes direction, also right at
+ *   the MOD/CNTIN wrap, and a count/direction signal.
+ * - FTM0 edge-aligned PWM at 100 % duty around the 16-bit MOD limit.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_FTM.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_FTM0_REG(r)            (IP_FTM0_BASE + offsetof(FTM_Type, r))
+#define TEST_FTM0_CNV(ch)           (IP_FTM0_BASE + offsetof(FTM_Type, CONTROLS) + ((ch) * 8U) + 4U)
+#define TEST_FTM1_REG(r)            (IP_FTM1_BASE + offsetof(FTM_Type, r))
+#define TEST_FTM1_CNSC(ch)          (IP_FTM1_BASE + offsetof(FTM_Type, CONTROLS) + ((ch) * 8U))
+#define TEST_FTM1_CNV(ch)           (TEST_FTM1_CNSC(ch) + 4U)
+#define TEST_FTM2_REG(r)            (IP_FTM2_BASE + offsetof(FTM_Type, r))
+
+/* Free-running capture counter 0..0xFFFF */
+#define TEST_COUNTER_PERIOD         0x10000U
+/* Latest overflow service the driver copes with: before the counter is half way */
+#define TEST_LATENCY_MAX            0x7FFFU
+
+#define TEST_EDGES                  2000U
+#define TEST_PULSES                 500U
+#define TEST_QUAD_RUNS              60U
+#define TEST_QUAD_COUNTS            400U
+
+/* Edge aligned PWM frequency; the clock sets the ticks per period */
+#define TEST_PWM_HZ                 1000U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static uint32_t s_test_seed = 2025U;
+/* Quadrature phase state: 0 = A0 B0, 1 = A1 B0, 2 = A1 B1, 3 = A0 B1 */
+static uint32_t s_test_quad_phase;
+/* Steps since the pending FTM2 overflow was raised */
+static uint32_t s_test_quad_pending;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_random(void)
+{
+    s_test_seed = (s_test_seed * 1103515245U) + 12345U;
+
+    return s_test_seed >> 8;
+}
+
+/* Run FTM1 for counts; a pending overflow is serviced latency counts after the wrap */
+static void test_run(uint32_t counts, uint32_t latency)
+{
+    uint32_t cnt;
+    uint32_t step;
+
+    while (counts != 0U)
+    {
+        cnt = *HOSTSIM_Reg(TEST_FTM1_REG(CNT));
+        if ((*HOSTSIM_Reg(TEST_FTM1_REG(SC)) & FTM_SC_TOF_MASK) != 0U)
+        {
+            if (cnt >= latency)
+            {
+                FTM_OverflowIRQHandler(FTM_1);
+                continue;
+            }
+            step = latency - cnt;
+        }
+        else
+        {
+            step = TEST_COUNTER_PERIOD - cnt;
+        }
+
+        if (step > counts)
+        {
+            step = counts;
+        }
+        HOSTSIM_FtmAdvance(1U, step);
+        counts -= step;
+    }
+}
+
+/* One pulse on FTM1 CH2: low for low counts, then high for high counts */
+static void test_pulse(uint32_t low, uint32_t high)
+{
+    test_run(low, 0U);
+    (void)HOSTSIM_FtmSetInput(1U, 2U, true);
+    test_run(high, 0U);
+    (void)HOSTSIM_FtmSetInput(1U, 2U, false);
+}
+
+/* One x4 quadrature step on FTM2; the overflow is serviced before a second wrap */
+static void test_quad_step(bool up, uint32_t latency)
+{
+    uint32_t cnt = *HOSTSIM_Reg(TEST_FTM2_REG(CNT));
+    uint32_t mod = *HOSTSIM_Reg(TEST_FTM2_REG(MOD));
+    uint32_t next;
+
+    if ((*HOSTSIM_Reg(TEST_FTM2_REG(SC)) & FTM_SC_TOF_MASK) != 0U)
+    {
+        s_test_quad_pending++;
+        if ((s_test_quad_pending > latency) || (up && (cnt == mod)) || ((!up) && (cnt == 0U)))
+        {
+            FTM_OverflowIRQHandler(FTM_2);
+            s_test_quad_pending = 0U;
+        }
+    }
+
+    next = (s_test_quad_phase + (up ? 1U : 3U)) % 4U;
+    if (((s_test_quad_phase == 0U) || (s_test_quad_phase == 3U)) != ((next == 0U) || (next == 3U)))
+    {
+        (void)HOSTSIM_FtmSetInput(2U, 0U, (next == 1U) || (next == 2U));
+    }
+    else
+    {
+        (void)HOSTSIM_FtmSetInput(2U, 1U, (next == 2U) || (next == 3U));
+    }
+    s_test_quad_phase = next;
+}
+
+int main(void)
+{
+    static const ftm_capture_channel_config_t channels[] = { { 0U, FTM_EDGE_BOTH, 0U, false } };
+    static const ftm_pwm_channel_config_t pwm_channels[] = { { 0U, FTM_POLARITY_HIGH, FTM_DUTY_MAX, false } };
+    ftm_pwm_config_t pwm = { FTM_CLK_SYSTEM, 0U, TEST_PWM_HZ, FTM_ALIGN_EDGE, 0U, pwm_channels, 1U };
+    const ftm_capture_config_t capture = { FTM_CLK_SYSTEM, 0U, true, channels, 1U };
+    ftm_quad_config_t quad = { FTM_QUAD_PHASE_AB, TEST_QUAD_COUNTS, 0U, 0U, false, false };
+    uint64_t now = 0U;
+    uint64_t edge;
+    uint64_t timestamp;
+    uint32_t gap;
+    uint32_t latency;
+    uint32_t width;
+    uint32_t widths[2];
+    uint32_t ticks;
+    uint32_t run;
+    uint32_t i;
+    int64_t position = 0;
+    bool level = false;
+    bool up = true;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Capture: every edge read back at its counter time, across overflows */
+    HOSTTEST_EQ(FTM_CaptureInit(FTM_1, &capture), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(FTM_ReadCapture(FTM_1, 0U, &timestamp), FTM_STATUS_NO_DATA);
+
+    for (i = 0U; i < TEST_EDGES; i++)
+    {
+        latency = ((i % 3U) == 0U) ? 0U : (test_random() % TEST_LATENCY_MAX);
+        gap = 1U + (test_random() % (3U * TEST_COUNTER_PERIOD));
+        test_run(gap, latency);
+        now += gap;
+
+        edge = now;
+        level = !level;
+        (void)HOSTSIM_FtmSetInput(1U, 0U, level);
+
+        /* Read within half a counter period of the edge */
+        gap = test_random() % TEST_LATENCY_MAX;
+        test_run(gap, latency);
+        now += gap;
+
+        HOSTTEST_EQ(FTM_ReadCapture(FTM_1, 0U, &timestamp), FTM_STATUS_SUCCESS);
+        HOSTTEST_EQ(timestamp, edge);
+        HOSTTEST_EQ(FTM_GetTimestamp(FTM_1), now);
+    }
+    HOSTTEST_EQ(FTM_ReadCapture(FTM_1, 0U, &timestamp), FTM_STATUS_NO_DATA);
+
+    /* Edge at 0xFFF0, read at 0x0010 with the wrap still pending in TOF */
+    test_run((0xFFF0U - *HOSTSIM_Reg(TEST_FTM1_REG(CNT))) % TEST_COUNTER_PERIOD, 0U);
+    now = FTM_GetTimestamp(FTM_1);
+    level = !level;
+    (void)HOSTSIM_FtmSetInput(1U, 0U, level);
+    test_run(0x20U, TEST_LATENCY_MAX);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM1_REG(SC)) & FTM_SC_TOF_MASK, FTM_SC_TOF_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM1_REG(CNT)), 0x10U);
+
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(FTM_ReadCapture(FTM_1, 0U, &timestamp), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(timestamp, now);
+    HOSTTEST_ACCESS(TEST_FTM1_CNSC(0U), 2U, 1U);
+    HOSTTEST_ACCESS(TEST_FTM1_CNV(0U), 1U, 0U);
+    HOSTTEST_ACCESS(TEST_FTM1_REG(CNT), 1U, 0U);
+    HOSTTEST_ACCESS(TEST_FTM1_REG(SC), 1U, 0U);
+
+    FTM_OverflowIRQHandler(FTM_1);
+    HOSTTEST_EQ(FTM_GetTimestamp(FTM_1), now + 0x20U);
+
+    /* Pulse width, one-shot: each read returns the first pulse since the last read */
+    HOSTTEST_EQ(FTM_ConfigPulseMeasure(FTM_1, 1U, FTM_PULSE_HIGH, false), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_NO_DATA);
+
+    for (i = 0U; i < TEST_PULSES; i++)
+    {
+        width = 1U + (test_random() % (TEST_COUNTER_PERIOD - 1U));
+        test_pulse(1U + (test_random() % 50000U), width);
+        HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_SUCCESS);
+        HOSTTEST_EQ(ticks, width);
+        HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_NO_DATA);
+    }
+
+    widths[0] = 1234U;
+    widths[1] = 40000U;
+    test_pulse(100U, widths[0]);
+    test_pulse(100U, widths[1]);
+    HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(ticks, widths[0]);
+    test_pulse(100U, 777U);
+    HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(ticks, 777U);
+
+    /* Continuous: the registers hold the latest pulse */
+    HOSTTEST_EQ(FTM_ConfigPulseMeasure(FTM_1, 1U, FTM_PULSE_HIGH, true), FTM_STATUS_SUCCESS);
+    test_pulse(100U, widths[0]);
+    test_pulse(100U, widths[1]);
+    HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(ticks, widths[1]);
+
+    /* Period: rising to rising edge */
+    HOSTTEST_EQ(FTM_ConfigPulseMeasure(FTM_1, 1U, FTM_PULSE_PERIOD, false), FTM_STATUS_SUCCESS);
+    test_pulse(500U, 300U);
+    test_pulse(2000U, 300U);
+    HOSTTEST_EQ(FTM_ReadPulseWidth(FTM_1, 1U, &ticks), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(ticks, 2300U);
+
+    /* The capture channel is not disturbed by the pair's input */
+    HOSTTEST_EQ(FTM_ReadCapture(FTM_1, 0U, &timestamp), FTM_STATUS_NO_DATA);
+
+    /* Quadrature: runs up and down, reversing anywhere including at the wrap */
+    HOSTTEST_EQ(FTM_QuadInit(FTM_2, &quad), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(FTM_QuadInit(FTM_0, &quad), FTM_STATUS_ERROR);
+    HOSTTEST_EQ(FTM_QuadGetPosition(FTM_2), 0);
+
+    for (run = 0U; run < TEST_QUAD_RUNS; run++)
+    {
+        /* Every 4th run ends just past the wrap, so the next one reverses there */
+        gap = 1U + (test_random() % (3U * TEST_QUAD_COUNTS));
+        if ((run % 4U) == 3U)
+        {
+            ticks = *HOSTSIM_Reg(TEST_FTM2_REG(CNT));
+            gap = up ? (TEST_QUAD_COUNTS - ticks) : (ticks + 1U);
+        }
+        latency = test_random() % (TEST_QUAD_COUNTS / 4U);
+
+        for (i = 0U; i < gap; i++)
+        {
+            test_quad_step(up, latency);
+            position += up ? 1 : -1;
+            HOSTTEST_EQ(FTM_QuadGetPosition(FTM_2), position);
+            HOSTTEST_EQ(FTM_QuadIsCountingUp(FTM_2), up);
+        }
+        up = !up;
+    }
+    HOSTTEST_CHECK(position != 0);
+
+    /* Count/direction: phase A pulses counted in the direction of phase B */
+    quad.mode = FTM_QUAD_COUNT_DIR;
+    quad.counts_per_rev = 100U;
+    (void)HOSTSIM_FtmSetInput(2U, 0U, false);
+    (void)HOSTSIM_FtmSetInput(2U, 1U, true);
+    HOSTTEST_EQ(FTM_QuadInit(FTM_2, &quad), FTM_STATUS_SUCCESS);
+    position = 0;
+    for (i = 0U; i < 550U; i++)
+    {
+        if (i == 250U)
+        {
+            (void)HOSTSIM_FtmSetInput(2U, 1U, false);
+        }
+        if ((*HOSTSIM_Reg(TEST_FTM2_REG(SC)) & FTM_SC_TOF_MASK) != 0U)
+        {
+            FTM_OverflowIRQHandler(FTM_2);
+        }
+        (void)HOSTSIM_FtmSetInput(2U, 0U, true);
+        (void)HOSTSIM_FtmSetInput(2U, 0U, false);
+        position += (i < 250U) ? 1 : -1;
+        HOSTTEST_EQ(FTM_QuadGetPosition(FTM_2), position);
+    }
+    HOSTTEST_EQ(position, -50);
+    HOSTTEST_CHECK(!FTM_QuadIsCountingUp(FTM_2));
+
+    /* Edge aligned 100 %: CnV = MOD + 1 must fit CnV, so MOD 0xFFFF is never used */
+    pwm.clk_hz = 0xFFFFU * TEST_PWM_HZ;
+    HOSTTEST_EQ(FTM_PwmInit(FTM_0, &pwm), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM0_REG(MOD)), 0xFFFEU);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM0_CNV(0U)), 0xFFFFU);
+    pwm.clk_hz = 0x10000U * TEST_PWM_HZ;
+    HOSTTEST_EQ(FTM_PwmInit(FTM_0, &pwm), FTM_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM0_REG(SC)) & FTM_SC_PS_MASK, 1U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM0_REG(MOD)), 0x7FFFU);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_FTM0_CNV(0U)), 0x8000U);
+    HOSTTEST_EQ(FTM_PwmDeinit(FTM_0), FTM_STATUS_SUCCESS);
+
+    return HOSTTEST_Done("ftm");
+}
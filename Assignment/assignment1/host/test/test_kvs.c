@@ -0,0 +1,288 @@
+/**
+ * @file test_kvs.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: KVS power-fail safety on a simulated flash array.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * A fixed workload of sets, deletes, commits and compaction steps is run
+ * once to count its flash operations, then again for every cut point: the
+ * power goes off in the middle of operation n, the array keeps the torn
+ * state and the store is remounted (itself cut once more at a varying
+ * point). Each key must then read as its last committed value or one of the
+ * values staged after it, and the store must keep working: more writes, a
+ * commit and a clean remount give exactly the committed values.
+ *
+ * Values carry their key and generation, so a read tells which write it
+ * came from; generations divisible by 5 are deletes.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "host_flash.h"
+#include "../driver/inc/kvs.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_BASE                   0x10000000U
+#define TEST_SECTOR_SIZE            256U
+#define TEST_SECTORS                4U
+#define TEST_KEYS                   8U
+#define TEST_BUFFER_LEN             64U
+#define TEST_VALUE_MIN              4U
+#define TEST_VALUE_SPAN             21U
+#define TEST_DELETE_EVERY           5U
+
+#define TEST_STEPS                  150U
+#define TEST_MORE_STEPS             40U
+#define TEST_WORKLOAD_SEED          0x2545F491U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static uint8_t s_test_mem[TEST_SECTOR_SIZE * TEST_SECTORS];
+static hostflash_t s_test_flash;
+static kvs_flash_t s_test_backend;
+static kvs_t s_test_kvs;
+static uint32_t s_test_index[TEST_KEYS];
+static uint8_t s_test_buffer[TEST_BUFFER_LEN];
+
+/* Generation of the last confirmed commit and of the last staged write */
+static uint32_t s_test_committed[TEST_KEYS];
+static uint32_t s_test_latest[TEST_KEYS];
+
+static uint32_t s_test_seed;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_random(void)
+{
+    s_test_seed = (s_test_seed * 1103515245U) + 12345U;
+    return s_test_seed >> 8U;
+}
+
+static bool test_deleted(uint32_t gen)
+{
+    return (gen % TEST_DELETE_EVERY) == 0U;
+}
+
+/* Value of a key at a generation: key, generation, then a pattern */
+static uint16_t test_value(uint16_t key, uint32_t gen, uint8_t *buf)
+{
+    uint16_t len = (uint16_t)(TEST_VALUE_MIN + (((key * 7U) + (gen * 3U)) % TEST_VALUE_SPAN));
+    uint16_t i;
+
+    buf[0] = (uint8_t)key;
+    buf[1] = (uint8_t)gen;
+    buf[2] = (uint8_t)(gen >> 8U);
+
+    for (i = 3U; i < len; i++)
+    {
+        buf[i] = (uint8_t)((key + gen + i) * 13U);
+    }
+
+    return len;
+}
+
+static KVS_STATUS_t test_mount(void)
+{
+    return KVS_Mount(&s_test_kvs, &s_test_backend, s_test_index, TEST_KEYS, s_test_buffer, TEST_BUFFER_LEN);
+}
+
+/* Run the workload until it ends or the power goes off */
+static void test_workload(uint32_t steps)
+{
+    uint8_t value[TEST_VALUE_MIN + TEST_VALUE_SPAN];
+    KVS_STATUS_t status;
+    uint16_t key;
+    uint16_t len;
+    uint32_t r;
+    uint32_t i;
+
+    for (i = 0U; i < steps; i++)
+    {
+        r = test_random();
+        key = (uint16_t)(r % TEST_KEYS);
+        s_test_latest[key]++;
+
+        if (test_deleted(s_test_latest[key]))
+        {
+            status = KVS_Delete(&s_test_kvs, key);
+        }
+        else
+        {
+            len = test_value(key, s_test_latest[key], value);
+            status = KVS_Set(&s_test_kvs, key, value, len);
+        }
+
+        if (s_test_flash.cut)
+        {
+            return;
+        }
+        HOSTTEST_EQ(status, KVS_STATUS_SUCCESS);
+
+        if (((r >> 8U) % 3U) == 0U)
+        {
+            status = KVS_Commit(&s_test_kvs);
+            if (s_test_flash.cut)
+            {
+                return;
+            }
+            HOSTTEST_EQ(status, KVS_STATUS_SUCCESS);
+
+            for (key = 0U; key < TEST_KEYS; key++)
+            {
+                s_test_committed[key] = s_test_latest[key];
+            }
+        }
+
+        (void)KVS_CompactStep(&s_test_kvs);
+        if (s_test_flash.cut)
+        {
+            return;
+        }
+    }
+}
+
+/*
+ * Every key must read as a generation in [committed, latest]; that
+ * generation becomes both, so the next check starts from what is on flash.
+ */
+static void test_verify(void)
+{
+    uint8_t value[TEST_VALUE_MIN + TEST_VALUE_SPAN];
+    uint8_t expected[TEST_VALUE_MIN + TEST_VALUE_SPAN];
+    KVS_STATUS_t status;
+    uint16_t key;
+    uint16_t len;
+    uint16_t i;
+    uint32_t gen;
+    bool match;
+
+    for (key = 0U; key < TEST_KEYS; key++)
+    {
+        status = KVS_Get(&s_test_kvs, key, value, sizeof(value), &len);
+
+        if (status == KVS_STATUS_NOT_FOUND)
+        {
+            /* Some generation in range must be a delete (or no write at all) */
+            for (gen = s_test_committed[key]; (gen <= s_test_latest[key]) && !test_deleted(gen); gen++)
+            {
+            }
+            HOSTTEST_CHECK(gen <= s_test_latest[key]);
+
+            /* Resume from a delete generation at or after latest */
+            while (!test_deleted(s_test_latest[key]))
+            {
+                s_test_latest[key]++;
+            }
+        }
+        else
+        {
+            HOSTTEST_EQ(status, KVS_STATUS_SUCCESS);
+            gen = (uint32_t)value[1] | ((uint32_t)value[2] << 8U);
+            match = (value[0] == key) && (gen >= s_test_committed[key]) && (gen <= s_test_latest[key]) &&
+                    !test_deleted(gen) && (len == test_value(key, gen, expected));
+
+            for (i = 0U; match && (i < len); i++)
+            {
+                match = (value[i] == expected[i]);
+            }
+            HOSTTEST_CHECK(match);
+            s_test_latest[key] = gen;
+        }
+
+        s_test_committed[key] = s_test_latest[key];
+    }
+}
+
+/*
+ * Fresh store, cut after cut operations (HOSTFLASH_NO_CUT: none), run the
+ * workload; returns the flash operations it started.
+ */
+static uint32_t test_run(uint32_t cut)
+{
+    uint32_t start;
+    uint16_t key;
+
+    HOSTFLASH_Init(&s_test_flash, s_test_mem, TEST_BASE, TEST_SECTOR_SIZE, TEST_SECTORS, &s_test_backend);
+    HOSTTEST_EQ(test_mount(), KVS_STATUS_SUCCESS);
+
+    for (key = 0U; key < TEST_KEYS; key++)
+    {
+        s_test_committed[key] = 0U;
+        s_test_latest[key] = 0U;
+    }
+
+    s_test_seed = TEST_WORKLOAD_SEED;
+    start = s_test_flash.ops;
+    HOSTFLASH_CutAfter(&s_test_flash, cut, cut);
+    test_workload(TEST_STEPS);
+
+    return s_test_flash.ops - start;
+}
+
+int main(void)
+{
+    uint32_t total;
+    uint32_t cut;
+    uint32_t cuts = 0U;
+    uint16_t key;
+
+    /* Reference run: the number of flash operations in the workload */
+    total = test_run(HOSTFLASH_NO_CUT);
+    HOSTTEST_CHECK(!s_test_flash.cut);
+    HOSTTEST_EQ(KVS_Commit(&s_test_kvs), KVS_STATUS_SUCCESS);
+    for (key = 0U; key < TEST_KEYS; key++)
+    {
+        s_test_committed[key] = s_test_latest[key];
+    }
+    HOSTTEST_EQ(test_mount(), KVS_STATUS_SUCCESS);
+    test_verify();
+    HOSTTEST_CHECK(total > 100U);
+
+    for (cut = 0U; cut < total; cut++)
+    {
+        test_run(cut);
+        HOSTTEST_CHECK(s_test_flash.cut);
+        cuts += s_test_flash.cut ? 1U : 0U;
+
+        /* Reboot; the recovery itself may be cut too */
+        HOSTFLASH_PowerOn(&s_test_flash);
+        HOSTFLASH_CutAfter(&s_test_flash, cut % 4U, ~cut);
+        if (test_mount() != KVS_STATUS_SUCCESS)
+        {
+            HOSTTEST_CHECK(s_test_flash.cut);
+            HOSTFLASH_PowerOn(&s_test_flash);
+            HOSTTEST_EQ(test_mount(), KVS_STATUS_SUCCESS);
+        }
+        HOSTFLASH_CutAfter(&s_test_flash, HOSTFLASH_NO_CUT, 0U);
+        test_verify();
+
+        /* Still usable: more writes, commit, clean remount */
+        test_workload(TEST_MORE_STEPS);
+        HOSTTEST_EQ(KVS_Commit(&s_test_kvs), KVS_STATUS_SUCCESS);
+        for (key = 0U; key < TEST_KEYS; key++)
+        {
+            s_test_committed[key] = s_test_latest[key];
+        }
+        HOSTTEST_EQ(test_mount(), KVS_STATUS_SUCCESS);
+        test_verify();
+
+        HOSTTEST_EQ(s_test_flash.overwrites, 0U);
+    }
+
+    HOSTTEST_EQ(cuts, total);
+
+    return HOSTTEST_Done("kvs");
+}
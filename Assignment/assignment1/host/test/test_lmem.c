@@ -0,0 +1,182 @@
+/**
+ * @file test_lmem.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: LMEM code cache commands and region modes.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Lines are allocated with HOSTSIM_LmemFetch() and checked through the
+ * driver's own search and set/way reads: enable, line and range invalidate
+ * (one line command per line, cache-wide from LMEM_LINE_SIZE * LMEM_SETS *
+ * LMEM_WAYS bytes), way commands, region modes with the clear they imply,
+ * and disable.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_LMEM.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_LMEM_REG(r)            (IP_LMEM_BASE + offsetof(LMEM_Type, r))
+
+/* Set 0, ways 0 and 1; set 1; set 0 again (replaces way 0) */
+#define TEST_LINE_A                 0x00001000U
+#define TEST_LINE_B                 0x00001800U
+#define TEST_LINE_C                 0x00001010U
+#define TEST_LINE_D                 0x00002000U
+
+#define TEST_CACHE_SIZE             (LMEM_LINE_SIZE * LMEM_SETS * LMEM_WAYS)
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void test_fill(void)
+{
+    HOSTSIM_LmemFetch(TEST_LINE_A);
+    HOSTSIM_LmemFetch(TEST_LINE_B + 4U);
+    HOSTSIM_LmemFetch(TEST_LINE_C + 15U);
+}
+
+int main(void)
+{
+    uint8_t region;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Off out of reset: fetches do not allocate */
+    HOSTTEST_CHECK(!LMEM_IsEnabled());
+    test_fill();
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+
+    /* Enable: invalidate both ways (GO polled once), then ENCACHE */
+    HOSTSIM_TraceReset();
+    LMEM_Enable();
+    HOSTTEST_CHECK(LMEM_IsEnabled());
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_LMEM_REG(PCCCR)),
+                LMEM_PCCCR_ENCACHE_MASK | LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCCR), 4U, 2U);
+
+    /* Every set and way read once, LGO polled once each */
+    test_fill();
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(LMEM_GetValidLines(), 3U);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCLCR), 2U * LMEM_SETS * LMEM_WAYS, LMEM_SETS * LMEM_WAYS);
+
+    /* Search by address: any byte of the line, nothing else of the set */
+    HOSTSIM_TraceReset();
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_A + 8U));
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCLCR), 2U, 1U);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCSAR), 1U, 1U);
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_B));
+    HOSTTEST_CHECK((*HOSTSIM_Reg(TEST_LMEM_REG(PCCLCR)) & LMEM_PCCLCR_LCWAY_MASK) != 0U);
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_C));
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_D));
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_A + LMEM_LINE_SIZE * 2U));
+
+    /* Line invalidate hits only its line */
+    LMEM_InvalidateLine(TEST_LINE_A + 3U);
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_A));
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_B));
+    HOSTTEST_EQ(LMEM_GetValidLines(), 2U);
+
+    /* A third line of set 0 takes the free way */
+    HOSTSIM_LmemFetch(TEST_LINE_D);
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_D));
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_B));
+
+    /* Both ways taken: the next line of the set replaces way 0 */
+    HOSTSIM_LmemFetch(TEST_LINE_A);
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_A));
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_D));
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_B));
+
+    /* Range: an unaligned 2 bytes over a line boundary is two line commands */
+    LMEM_InvalidateAll();
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+    test_fill();
+    HOSTSIM_TraceReset();
+    LMEM_InvalidateRange(TEST_LINE_C - 1U, 2U);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCSAR), 2U, 2U);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCCR), 0U, 0U);
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_A));
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_C));
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_B));
+
+    /* Nothing for an empty range */
+    HOSTSIM_TraceReset();
+    LMEM_ClearRange(TEST_LINE_B, 0U);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCSAR), 0U, 0U);
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_B));
+
+    /* The size of the cache or more: one cache-wide command */
+    test_fill();
+    HOSTSIM_TraceReset();
+    LMEM_ClearRange(0U, TEST_CACHE_SIZE);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCSAR), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCCR), 2U, 1U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_LMEM_REG(PCCCR)),
+                LMEM_PCCCR_ENCACHE_MASK | LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_PUSHW1_MASK |
+                LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+
+    /* Way commands; the previous way bits are not carried over */
+    test_fill();
+    HOSTTEST_EQ(LMEM_InvalidateWay(1U), LMEM_STATUS_SUCCESS);
+    HOSTTEST_CHECK(!LMEM_IsCached(TEST_LINE_B));
+    HOSTTEST_CHECK(LMEM_IsCached(TEST_LINE_A));
+    HOSTTEST_EQ(LMEM_ClearWay(0U), LMEM_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_LMEM_REG(PCCCR)),
+                LMEM_PCCCR_ENCACHE_MASK | LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_INVW0_MASK);
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(LMEM_InvalidateWay(LMEM_WAYS), LMEM_STATUS_ERROR);
+    HOSTTEST_EQ(LMEM_ClearWay(LMEM_WAYS), LMEM_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCCR), 0U, 0U);
+
+    /* Region modes from the reset PCCRMR; 01 reads as non-cacheable */
+    HOSTTEST_EQ(LMEM_GetRegionMode(LMEM_REGION_PFLASH), LMEM_MODE_WRITE_THROUGH);
+    HOSTTEST_EQ(LMEM_GetRegionMode(4U), LMEM_MODE_NON_CACHEABLE);
+    HOSTTEST_EQ(LMEM_GetRegionMode(6U), LMEM_MODE_WRITE_BACK);
+    HOSTTEST_EQ(LMEM_GetRegionMode(LMEM_REGION_COUNT), LMEM_MODE_NON_CACHEABLE);
+    *HOSTSIM_Reg(TEST_LMEM_REG(PCCRMR)) |= 1UL << 8U;
+    HOSTTEST_EQ(LMEM_GetRegionMode(11U), LMEM_MODE_NON_CACHEABLE);
+
+    /* A mode change with the cache on pushes and invalidates everything */
+    test_fill();
+    HOSTTEST_EQ(LMEM_SetRegionMode(4U, LMEM_MODE_WRITE_BACK), LMEM_STATUS_SUCCESS);
+    HOSTTEST_EQ(LMEM_GetRegionMode(4U), LMEM_MODE_WRITE_BACK);
+    HOSTTEST_EQ(LMEM_GetRegionMode(5U), LMEM_MODE_NON_CACHEABLE);
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+    for (region = 0U; region < LMEM_REGION_COUNT; region++)
+    {
+        HOSTTEST_EQ(LMEM_SetRegionMode(region, LMEM_MODE_NON_CACHEABLE), LMEM_STATUS_SUCCESS);
+    }
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_LMEM_REG(PCCRMR)), 0U);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(LMEM_SetRegionMode(LMEM_REGION_COUNT, LMEM_MODE_WRITE_BACK), LMEM_STATUS_ERROR);
+    HOSTTEST_EQ(LMEM_SetRegionMode(0U, (LMEM_MODE_t)1U), LMEM_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_LMEM_REG(PCCRMR), 0U, 0U);
+
+    /* Disable: clear, then ENCACHE off; nothing allocates afterwards */
+    test_fill();
+    LMEM_Disable();
+    HOSTTEST_CHECK(!LMEM_IsEnabled());
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+    test_fill();
+    HOSTTEST_EQ(LMEM_GetValidLines(), 0U);
+
+    return HOSTTEST_Done("lmem");
+}
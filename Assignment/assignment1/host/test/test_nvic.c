@@ -0,0 +1,236 @@
+/**
+ * @file test_nvic.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: NVIC priorities, enable/pending sets and RAM vectors.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Priority grouping with the AIRCR key, priority bytes of device IRQs and
+ * of the configurable system exceptions for every grouping, enable and
+ * pending through the ISER/ICER and ISPR/ICPR model (one store per
+ * non-empty word for sets), and handler installation in a RAM vector table
+ * mapped at the address of __VECTOR_RAM.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+#include <sys/mman.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_NVIC.h"
+#include "../include/S32K144.h"
+#include "../include/S32K144_features.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_NVIC_BASE              0xE000E100U
+#define TEST_NVIC_ISER(n)           (TEST_NVIC_BASE + ((n) * 4U))
+#define TEST_NVIC_ICER(n)           (TEST_NVIC_BASE + 0x080U + ((n) * 4U))
+#define TEST_NVIC_ISPR(n)           (TEST_NVIC_BASE + 0x100U + ((n) * 4U))
+#define TEST_NVIC_ICPR(n)           (TEST_NVIC_BASE + 0x180U + ((n) * 4U))
+#define TEST_NVIC_IABR(n)           (TEST_NVIC_BASE + 0x200U + ((n) * 4U))
+#define TEST_NVIC_IP(irq)           (TEST_NVIC_BASE + 0x300U + ((uint32_t)(irq) & ~3U))
+
+#define TEST_SCB_REG(r)             (S32_SCB_BASE + offsetof(S32_SCB_Type, r))
+
+/* __VECTOR_RAM of the flash linker scripts */
+#define TEST_VECTOR_RAM             0x1FFF8000U
+#define TEST_VECTOR_RAM_SIZE        0x1000U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const IRQn_Type s_test_irqs[] = { LPUART1_RxTx_IRQn, LPIT0_Ch0_IRQn, CAN0_ORed_IRQn, FTM3_Ovf_Reload_IRQn };
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void test_handler_a(void)
+{
+}
+
+static void test_handler_b(void)
+{
+}
+
+static uint32_t test_byte(uint32_t address)
+{
+    return (*HOSTSIM_Reg(address & ~3U) >> ((address & 3U) * 8U)) & 0xFFU;
+}
+
+static uint32_t test_nvic_stores(void)
+{
+    hostsim_trace_t trace;
+    uint32_t stores = 0U;
+    uint32_t offset;
+
+    for (offset = 0U; offset < 0x200U; offset += 4U)
+    {
+        HOSTSIM_TraceGet(TEST_NVIC_BASE + offset, &trace);
+        stores += trace.stores;
+    }
+
+    return stores;
+}
+
+int main(void)
+{
+    nvic_irq_set_t set;
+    nvic_handler_t *vectors;
+    nvic_handler_t previous = NULL;
+    uint8_t preempt_bits;
+    uint8_t preempt;
+    uint8_t sub;
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Grouping: every AIRCR write carries the key, other fields kept */
+    *HOSTSIM_Reg(TEST_SCB_REG(AIRCR)) = 0xFA050000U | S32_SCB_AIRCR_ENDIANNESS_MASK;
+    HOSTTEST_EQ(NVIC_SetPriorityGrouping(2U), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCB_REG(AIRCR)), S32_SCB_AIRCR_VECTKEY(0x05FAU) | S32_SCB_AIRCR_PRIGROUP(5U) |
+                S32_SCB_AIRCR_ENDIANNESS_MASK);
+    HOSTTEST_EQ(NVIC_GetPriorityGrouping(), 2U);
+    HOSTTEST_EQ(NVIC_SetPriorityGrouping(NVIC_PRIO_BITS + 1U), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_GetPriorityGrouping(), 2U);
+
+    /* PRIGROUP below the implemented bits: all preemption */
+    *HOSTSIM_Reg(TEST_SCB_REG(AIRCR)) = S32_SCB_AIRCR_PRIGROUP(0U);
+    HOSTTEST_EQ(NVIC_GetPriorityGrouping(), NVIC_PRIO_BITS);
+
+    /* Priority bytes: top NVIC_PRIO_BITS, preemption above subpriority */
+    for (preempt_bits = 0U; preempt_bits <= NVIC_PRIO_BITS; preempt_bits++)
+    {
+        uint8_t sub_max = (uint8_t)((1U << (NVIC_PRIO_BITS - preempt_bits)) - 1U);
+        uint8_t preempt_max = (uint8_t)((1U << preempt_bits) - 1U);
+
+        HOSTTEST_EQ(NVIC_SetPriorityGrouping(preempt_bits), NVIC_STATUS_SUCCESS);
+        HOSTTEST_EQ(NVIC_SetPriority(LPIT0_Ch0_IRQn, preempt_max, sub_max), NVIC_STATUS_SUCCESS);
+        HOSTTEST_EQ(test_byte(TEST_NVIC_IP(LPIT0_Ch0_IRQn) + ((uint32_t)LPIT0_Ch0_IRQn & 3U)), 0xF0U);
+        HOSTTEST_EQ(NVIC_GetPriority(LPIT0_Ch0_IRQn, &preempt, &sub), NVIC_STATUS_SUCCESS);
+        HOSTTEST_EQ(preempt, preempt_max);
+        HOSTTEST_EQ(sub, sub_max);
+        HOSTTEST_EQ(NVIC_SetPriority(LPIT0_Ch0_IRQn, (uint8_t)(preempt_max + 1U), 0U), NVIC_STATUS_ERROR);
+        HOSTTEST_EQ(NVIC_SetPriority(LPIT0_Ch0_IRQn, 0U, (uint8_t)(sub_max + 1U)), NVIC_STATUS_ERROR);
+    }
+
+    /* 2 preemption bits: 3.1 is 1101 0000, a single byte store */
+    HOSTTEST_EQ(NVIC_SetPriorityGrouping(2U), NVIC_STATUS_SUCCESS);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(NVIC_SetPriority(LPUART1_RxTx_IRQn, 3U, 1U), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_byte(TEST_NVIC_IP(LPUART1_RxTx_IRQn) + ((uint32_t)LPUART1_RxTx_IRQn & 3U)), 0xD0U);
+    HOSTTEST_ACCESS(TEST_NVIC_IP(LPUART1_RxTx_IRQn), 0U, 1U);
+
+    /* System exceptions through SHPR1..3; NMI, HardFault and reserved slots refused */
+    HOSTTEST_EQ(NVIC_SetPriority(SysTick_IRQn, 1U, 2U), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_byte(TEST_SCB_REG(SHPR3) + 3U), 0x60U);
+    HOSTTEST_EQ(NVIC_SetPriority(MemoryManagement_IRQn, 2U, 0U), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_byte(TEST_SCB_REG(SHPR1)), 0x80U);
+    HOSTTEST_EQ(NVIC_SetPriority(SVCall_IRQn, 0U, 3U), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(test_byte(TEST_SCB_REG(SHPR2) + 3U), 0x30U);
+    HOSTTEST_EQ(NVIC_GetPriority(SysTick_IRQn, &preempt, NULL), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(preempt, 1U);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(NVIC_SetPriority(NonMaskableInt_IRQn, 0U, 0U), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_SetPriority(HardFault_IRQn, 0U, 0U), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_SetPriority((IRQn_Type)-3, 0U, 0U), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_SetPriority((IRQn_Type)NVIC_IRQ_COUNT, 0U, 0U), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_GetPriority(HardFault_IRQn, &preempt, &sub), NVIC_STATUS_ERROR);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.stores, 0U);
+
+    /* Enable/disable: one write-1 store, the other IRQs of the word untouched */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(NVIC_EnableIRQ(LPUART1_RxTx_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(NVIC_EnableIRQ(LPIT0_Ch0_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTTEST_ACCESS(TEST_NVIC_ISER(1U), 0U, 2U);
+    HOSTTEST_CHECK(NVIC_IsEnabled(LPUART1_RxTx_IRQn));
+    HOSTTEST_CHECK(NVIC_IsEnabled(LPIT0_Ch0_IRQn));
+    HOSTTEST_EQ(NVIC_DisableIRQ(LPUART1_RxTx_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_NVIC_ICER(1U)), 1UL << ((uint32_t)LPIT0_Ch0_IRQn & 31U));
+    HOSTTEST_CHECK(!NVIC_IsEnabled(LPUART1_RxTx_IRQn));
+    HOSTTEST_CHECK(NVIC_IsEnabled(LPIT0_Ch0_IRQn));
+    HOSTTEST_EQ(NVIC_EnableIRQ(SysTick_IRQn), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_DisableIRQ((IRQn_Type)NVIC_IRQ_COUNT), NVIC_STATUS_ERROR);
+    HOSTTEST_CHECK(!NVIC_IsEnabled((IRQn_Type)NVIC_IRQ_COUNT));
+
+    /* Sets: one store per non-empty word, words 1, 2 and 3 here */
+    HOSTTEST_EQ(NVIC_DisableIRQ(LPIT0_Ch0_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTSIM_TraceReset();
+    NVIC_EnableIRQs(s_test_irqs, sizeof(s_test_irqs) / sizeof(s_test_irqs[0]));
+    HOSTTEST_EQ(test_nvic_stores(), 3U);
+    HOSTTEST_ACCESS(TEST_NVIC_ISER(1U), 0U, 1U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_NVIC_ISER(1U)),
+                (1UL << ((uint32_t)LPUART1_RxTx_IRQn & 31U)) | (1UL << ((uint32_t)LPIT0_Ch0_IRQn & 31U)));
+    HOSTTEST_CHECK(NVIC_IsEnabled(FTM3_Ovf_Reload_IRQn));
+    HOSTSIM_TraceReset();
+    NVIC_DisableIRQs(&s_test_irqs[2], 2U);
+    HOSTTEST_EQ(test_nvic_stores(), 2U);
+    HOSTTEST_CHECK(!NVIC_IsEnabled(CAN0_ORed_IRQn));
+    HOSTTEST_CHECK(!NVIC_IsEnabled(FTM3_Ovf_Reload_IRQn));
+    HOSTTEST_CHECK(NVIC_IsEnabled(LPIT0_Ch0_IRQn));
+
+    NVIC_SetClear(&set);
+    NVIC_SetAdd(&set, SysTick_IRQn);
+    HOSTSIM_TraceReset();
+    NVIC_EnableSet(&set);
+    NVIC_DisableSet(&set);
+    HOSTTEST_EQ(test_nvic_stores(), 0U);
+
+    /* Pending, and a set clear */
+    HOSTTEST_EQ(NVIC_SetPending(CAN0_ORed_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTTEST_EQ(NVIC_SetPending(LPIT0_Ch0_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(NVIC_IsPending(CAN0_ORed_IRQn));
+    HOSTTEST_EQ(NVIC_ClearPending(CAN0_ORed_IRQn), NVIC_STATUS_SUCCESS);
+    HOSTTEST_CHECK(!NVIC_IsPending(CAN0_ORed_IRQn));
+    HOSTTEST_CHECK(NVIC_IsPending(LPIT0_Ch0_IRQn));
+    NVIC_SetAdd(&set, LPIT0_Ch0_IRQn);
+    HOSTSIM_TraceReset();
+    NVIC_ClearPendingSet(&set);
+    HOSTTEST_ACCESS(TEST_NVIC_ICPR(1U), 0U, 1U);
+    HOSTTEST_CHECK(!NVIC_IsPending(LPIT0_Ch0_IRQn));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_NVIC_ISPR(1U)), 0U);
+    HOSTTEST_EQ(NVIC_SetPending(NonMaskableInt_IRQn), NVIC_STATUS_ERROR);
+    HOSTTEST_EQ(NVIC_ClearPending(NonMaskableInt_IRQn), NVIC_STATUS_ERROR);
+
+    /* Active is read-only status */
+    *HOSTSIM_Reg(TEST_NVIC_IABR(2U)) = 1UL << ((uint32_t)CAN0_ORed_IRQn & 31U);
+    HOSTTEST_CHECK(NVIC_IsActive(CAN0_ORed_IRQn));
+    HOSTTEST_CHECK(!NVIC_IsActive(LPIT0_Ch0_IRQn));
+
+    /* Handlers: refused while VTOR points at flash */
+    HOSTTEST_EQ(NVIC_InstallHandler(LPIT0_Ch0_IRQn, test_handler_a, NULL), NVIC_STATUS_ERROR);
+
+    vectors = mmap((void *)(uintptr_t)TEST_VECTOR_RAM, TEST_VECTOR_RAM_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    HOSTTEST_CHECK(vectors == (nvic_handler_t *)(uintptr_t)TEST_VECTOR_RAM);
+    if (vectors == (nvic_handler_t *)(uintptr_t)TEST_VECTOR_RAM)
+    {
+        *HOSTSIM_Reg(TEST_SCB_REG(VTOR)) = TEST_VECTOR_RAM;
+        vectors[(int32_t)LPIT0_Ch0_IRQn + NVIC_VECTOR_OFFSET] = test_handler_b;
+
+        HOSTTEST_EQ(NVIC_InstallHandler(LPIT0_Ch0_IRQn, test_handler_a, &previous), NVIC_STATUS_SUCCESS);
+        HOSTTEST_CHECK(previous == test_handler_b);
+        HOSTTEST_CHECK(vectors[(int32_t)LPIT0_Ch0_IRQn + NVIC_VECTOR_OFFSET] == test_handler_a);
+        HOSTTEST_CHECK(NVIC_GetHandler(LPIT0_Ch0_IRQn) == test_handler_a);
+        HOSTTEST_EQ(NVIC_InstallHandler(NonMaskableInt_IRQn, test_handler_b, NULL), NVIC_STATUS_SUCCESS);
+        HOSTTEST_CHECK(vectors[2] == test_handler_b);
+        HOSTTEST_EQ(NVIC_InstallHandler(LPIT0_Ch0_IRQn, NULL, NULL), NVIC_STATUS_ERROR);
+        HOSTTEST_EQ(NVIC_InstallHandler((IRQn_Type)-15, test_handler_a, NULL), NVIC_STATUS_ERROR);
+        HOSTTEST_EQ(NVIC_InstallHandler((IRQn_Type)NVIC_IRQ_COUNT, test_handler_a, NULL), NVIC_STATUS_ERROR);
+        HOSTTEST_CHECK(NVIC_GetHandler((IRQn_Type)NVIC_IRQ_COUNT) == NULL);
+        (void)munmap(vectors, TEST_VECTOR_RAM_SIZE);
+    }
+
+    return HOSTTEST_Done("nvic");
+}
@@ -0,0 +1,62 @@
+/**
+ * @file test_pcc.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: PCC clock gate enable/disable against the PCC model.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_PCC_REG(p)             (IP_PCC_BASE + (uint32_t)(p))
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+int main(void)
+{
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Enable: PR check, then one read-modify-write */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PCC_EnableClock(PCC_PORTD), PCC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCC_REG(PCC_PORTD)), PCC_PCCn_PR_MASK | PCC_PCCn_CGC_MASK);
+    HOSTTEST_ACCESS(TEST_PCC_REG(PCC_PORTD), 2U, 1U);
+
+    /* Other slots untouched */
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCC_REG(PCC_PORTC)), PCC_PCCn_PR_MASK);
+    HOSTTEST_ACCESS(TEST_PCC_REG(PCC_PORTC), 0U, 0U);
+
+    /* Disable keeps PR and PCS */
+    *HOSTSIM_Reg(TEST_PCC_REG(PCC_PORTD)) |= PCC_PCCn_PCS(3U);
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PCC_DisableClock(PCC_PORTD), PCC_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCC_REG(PCC_PORTD)), PCC_PCCn_PR_MASK | PCC_PCCn_PCS(3U));
+    HOSTTEST_ACCESS(TEST_PCC_REG(PCC_PORTD), 2U, 1U);
+
+    /* Absent module (SAI0 is not on the S32K144): no store */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PCC_EnableClock(PCC_SAI0), PCC_STATUS_ERROR);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCC_REG(PCC_SAI0)), 0U);
+    HOSTTEST_ACCESS(TEST_PCC_REG(PCC_SAI0), 1U, 0U);
+    HOSTTEST_EQ(PCC_DisableClock(PCC_SAI0), PCC_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_PCC_REG(PCC_SAI0), 2U, 0U);
+
+    return HOSTTEST_Done("pcc");
+}
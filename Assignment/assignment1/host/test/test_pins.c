@@ -0,0 +1,86 @@
+/**
+ * @file test_pins.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: pin name decoding and GPIO set/clear/toggle through the
+ *        decoded instance, against the GPIO model.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/s32k144_pins.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_GPIO(reg)              (IP_PTD_BASE + offsetof(GPIO_Type, reg))
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+int main(void)
+{
+    GPIO_Type *gpio;
+    uint32_t mask;
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Decoding only, no register access */
+    HOSTSIM_TraceReset();
+    HOSTTEST_CHECK(PORT_GetValue(PTD15) == IP_PORTD);
+    HOSTTEST_CHECK(PORT_GetValue(PTA6) == IP_PORTA);
+    HOSTTEST_CHECK(GPIO_GetValue(PTD15) == IP_PTD);
+    HOSTTEST_CHECK(GPIO_GetValue(PTE16) == IP_PTE);
+    HOSTTEST_EQ(Pin_GetValue(PTD15), 15U);
+    HOSTTEST_EQ(Pin_GetValue(PTE16), 16U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+
+    /* PTA0 encodes as 0, the "no pin" value */
+    HOSTTEST_CHECK(PORT_GetValue(PTA0) == NULL);
+    HOSTTEST_CHECK(GPIO_GetValue(PTA0) == NULL);
+
+    /* One store each to PSOR/PCOR/PTOR, never a PDOR read-modify-write */
+    gpio = GPIO_GetValue(PTD15);
+    mask = 1UL << Pin_GetValue(PTD15);
+    HOSTSIM_TraceReset();
+    gpio->PDDR = mask;
+    gpio->PSOR = mask;
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_GPIO(PDOR)), mask);
+    HOSTTEST_EQ(gpio->PDIR & mask, mask);
+    gpio->PTOR = mask;
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_GPIO(PDOR)), 0U);
+    gpio->PSOR = mask;
+    gpio->PCOR = mask;
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_GPIO(PDOR)), 0U);
+    HOSTTEST_ACCESS(TEST_GPIO(PSOR), 0U, 2U);
+    HOSTTEST_ACCESS(TEST_GPIO(PCOR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GPIO(PTOR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GPIO(PDOR), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_GPIO(PDIR), 1U, 0U);
+
+    /* Write-only registers read as 0 */
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_GPIO(PSOR)), 0U);
+
+    /* Input pins read the levels set for the model, output pins PDOR */
+    HOSTTEST_EQ(HOSTSIM_GpioSetInput(PORT_D, 0x00010001U), HOSTSIM_STATUS_SUCCESS);
+    HOSTTEST_EQ(gpio->PDIR, 0x00010001U);
+    gpio->PSOR = mask;
+    HOSTTEST_EQ(gpio->PDIR, 0x00010001U | mask);
+    HOSTTEST_EQ(HOSTSIM_GpioSetInput(PORT_NUMS, 0U), HOSTSIM_STATUS_ERROR);
+
+    return HOSTTEST_Done("pins");
+}
@@ -0,0 +1,239 @@
+/**
+ * @file test_pool.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: fixed-block pools, with the default size classes.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Class choice by size, alignment, spill to the next larger class when a
+ * class is empty, bad and double frees, statistics, then a random
+ * alloc/free run checked against a shadow count per class with every live
+ * block holding its own fill pattern.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/mem_pool.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+/* Default classes of mem_pool.h: 32 x 16, 64 x 8, 256 x 4 */
+#define TEST_BLOCKS                 28U
+#define TEST_RANDOM_STEPS           5000U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const uint32_t s_test_size[POOL_CLASS_COUNT] = { 32U, 64U, 256U };
+static const uint32_t s_test_count[POOL_CLASS_COUNT] = { 16U, 8U, 4U };
+
+static uint8_t *s_test_live[TEST_BLOCKS];
+static uint8_t s_test_fill[TEST_BLOCKS];
+static uint32_t s_test_seed = 0x3C6EF372U;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static uint32_t test_random(void)
+{
+    s_test_seed = (s_test_seed * 1103515245U) + 12345U;
+    return s_test_seed >> 8U;
+}
+
+static uint32_t test_class(const void *block)
+{
+    uint32_t size = POOL_BlockSize(block);
+    uint32_t i;
+
+    for (i = 0U; (i < POOL_CLASS_COUNT) && (s_test_size[i] != size); i++)
+    {
+    }
+
+    return i;
+}
+
+static uint32_t test_used(uint8_t index)
+{
+    pool_stats_t stats;
+
+    HOSTTEST_EQ(POOL_GetStats(index, &stats), POOL_STATUS_SUCCESS);
+
+    return stats.used;
+}
+
+/* Every live block still holds its pattern */
+static bool test_patterns_intact(void)
+{
+    uint32_t i;
+    uint32_t b;
+    uint32_t size;
+
+    for (i = 0U; i < TEST_BLOCKS; i++)
+    {
+        if (s_test_live[i] == NULL)
+        {
+            continue;
+        }
+
+        size = POOL_BlockSize(s_test_live[i]);
+        for (b = 0U; b < size; b++)
+        {
+            if (s_test_live[i][b] != s_test_fill[i])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    pool_stats_t stats;
+    uint32_t expected[POOL_CLASS_COUNT] = { 0U, 0U, 0U };
+    uint32_t size;
+    uint32_t c;
+    uint32_t i;
+    uint8_t *a;
+    uint8_t *b;
+
+    HOSTTEST_EQ(POOL_CLASS_COUNT, 3U);
+    HOSTTEST_EQ(POOL_Init(), POOL_STATUS_SUCCESS);
+
+    for (c = 0U; c < POOL_CLASS_COUNT; c++)
+    {
+        HOSTTEST_EQ(POOL_GetStats((uint8_t)c, &stats), POOL_STATUS_SUCCESS);
+        HOSTTEST_EQ(stats.block_size, s_test_size[c]);
+        HOSTTEST_EQ(stats.blocks, s_test_count[c]);
+        HOSTTEST_EQ(stats.used + stats.high_water + stats.empty, 0U);
+    }
+    HOSTTEST_EQ(POOL_GetStats(POOL_CLASS_COUNT, &stats), POOL_STATUS_ERROR);
+    HOSTTEST_EQ(POOL_GetStats(0U, NULL), POOL_STATUS_ERROR);
+
+    /* Smallest class that fits, aligned; nothing for 0 or above the largest */
+    for (size = 1U; size <= 256U; size++)
+    {
+        a = POOL_Alloc(size);
+        HOSTTEST_CHECK(a != NULL);
+        HOSTTEST_EQ(POOL_BlockSize(a), (size <= 32U) ? 32U : ((size <= 64U) ? 64U : 256U));
+        HOSTTEST_EQ((uint32_t)((uintptr_t)a % POOL_ALIGN), 0U);
+        HOSTTEST_EQ(POOL_Free(a), POOL_STATUS_SUCCESS);
+    }
+    HOSTTEST_CHECK(POOL_Alloc(0U) == NULL);
+    HOSTTEST_CHECK(POOL_Alloc(257U) == NULL);
+
+    /* Spill: the 17th 32-byte request gets a 64-byte block */
+    for (i = 0U; i < s_test_count[0]; i++)
+    {
+        s_test_live[i] = POOL_Alloc(32U);
+        HOSTTEST_EQ(POOL_BlockSize(s_test_live[i]), 32U);
+    }
+    POOL_ResetStats();
+    a = POOL_Alloc(32U);
+    HOSTTEST_EQ(POOL_BlockSize(a), 64U);
+    HOSTTEST_EQ(POOL_GetStats(0U, &stats), POOL_STATUS_SUCCESS);
+    HOSTTEST_EQ(stats.used, 16U);
+    HOSTTEST_EQ(stats.high_water, 16U);
+    HOSTTEST_EQ(stats.empty, 1U);
+    HOSTTEST_EQ(test_used(1U), 1U);
+    HOSTTEST_EQ(POOL_Free(a), POOL_STATUS_SUCCESS);
+
+    /* Bad frees: inside a block, outside the pools */
+    HOSTTEST_EQ(POOL_Free(s_test_live[0] + 8), POOL_STATUS_ERROR);
+    HOSTTEST_EQ(POOL_Free(&stats), POOL_STATUS_ERROR);
+    HOSTTEST_EQ(POOL_Free(NULL), POOL_STATUS_SUCCESS);
+    HOSTTEST_EQ(POOL_BlockSize(&stats), 0U);
+
+    for (i = 0U; i < s_test_count[0]; i++)
+    {
+        HOSTTEST_EQ(POOL_Free(s_test_live[i]), POOL_STATUS_SUCCESS);
+        s_test_live[i] = NULL;
+    }
+    HOSTTEST_EQ(test_used(0U), 0U);
+
+    /* Double frees: the last block freed, and a class with nothing out */
+    a = POOL_Alloc(100U);
+    b = POOL_Alloc(100U);
+    HOSTTEST_EQ(POOL_Free(a), POOL_STATUS_SUCCESS);
+    HOSTTEST_EQ(POOL_Free(a), POOL_STATUS_ERROR);
+    HOSTTEST_EQ(test_used(2U), 1U);
+    HOSTTEST_EQ(POOL_Free(b), POOL_STATUS_SUCCESS);
+    HOSTTEST_EQ(POOL_Free(a), POOL_STATUS_ERROR);
+    HOSTTEST_EQ(POOL_Free(b), POOL_STATUS_ERROR);
+    HOSTTEST_EQ(test_used(2U), 0U);
+
+    /* Lists intact: every block once, then nothing */
+    for (i = 0U; i < TEST_BLOCKS; i++)
+    {
+        s_test_live[i] = POOL_Alloc(1U);
+        HOSTTEST_CHECK(s_test_live[i] != NULL);
+        s_test_fill[i] = (uint8_t)(i + 1U);
+        memset(s_test_live[i], s_test_fill[i], POOL_BlockSize(s_test_live[i]));
+    }
+    HOSTTEST_CHECK(POOL_Alloc(1U) == NULL);
+    HOSTTEST_CHECK(test_patterns_intact());
+    HOSTTEST_EQ(POOL_GetStats(2U, &stats), POOL_STATUS_SUCCESS);
+    HOSTTEST_EQ(stats.used, 4U);
+    HOSTTEST_EQ(stats.high_water, 4U);
+    for (i = 0U; i < TEST_BLOCKS; i++)
+    {
+        HOSTTEST_EQ(POOL_Free(s_test_live[i]), POOL_STATUS_SUCCESS);
+        s_test_live[i] = NULL;
+    }
+
+    /* Random run against a shadow count, patterns checked throughout */
+    for (i = 0U; i < TEST_RANDOM_STEPS; i++)
+    {
+        uint32_t slot = test_random() % TEST_BLOCKS;
+
+        if (s_test_live[slot] != NULL)
+        {
+            expected[test_class(s_test_live[slot])]--;
+            HOSTTEST_EQ(POOL_Free(s_test_live[slot]), POOL_STATUS_SUCCESS);
+            s_test_live[slot] = NULL;
+            continue;
+        }
+
+        size = (test_random() % 256U) + 1U;
+        a = POOL_Alloc(size);
+        if (a == NULL)
+        {
+            /* Only when every class that fits is full */
+            for (c = 0U; c < POOL_CLASS_COUNT; c++)
+            {
+                HOSTTEST_CHECK((s_test_size[c] < size) || (expected[c] == s_test_count[c]));
+            }
+            continue;
+        }
+
+        HOSTTEST_CHECK(POOL_BlockSize(a) >= size);
+        expected[test_class(a)]++;
+        s_test_live[slot] = a;
+        s_test_fill[slot] = (uint8_t)test_random();
+        memset(a, s_test_fill[slot], POOL_BlockSize(a));
+
+        if ((i % 64U) == 0U)
+        {
+            HOSTTEST_CHECK(test_patterns_intact());
+        }
+    }
+
+    HOSTTEST_CHECK(test_patterns_intact());
+    for (c = 0U; c < POOL_CLASS_COUNT; c++)
+    {
+        HOSTTEST_EQ(test_used((uint8_t)c), expected[c]);
+    }
+
+    return HOSTTEST_Done("pool");
+}
@@ -0,0 +1,123 @@
+/**
+ * @file test_port.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: PORT pin table setup through the global pin/interrupt
+ *        control registers, against the PORT and PCC models.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_PCC.h"
+#include "../driver/inc/Driver_PORT.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_PCR(port, pin)         ((port) + offsetof(PORT_Type, PCR) + ((pin) * 4U))
+#define TEST_GLOBAL(port, reg)      ((port) + offsetof(PORT_Type, reg))
+
+#define TEST_PIN_COUNT              (sizeof(s_test_pins) / sizeof(s_test_pins[0]))
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+/* PTD0/PTD15 share a PCR value, PTD16 is in the high half, PTC12 has an IRQ */
+static const port_pin_config_t s_test_pins[] =
+{
+    { PTD0,  PORT_MUX_GPIO, PORT_PULL_NONE, PORT_DRIVE_LOW,  false, PORT_IRQC_DISABLED },
+    { PTD15, PORT_MUX_GPIO, PORT_PULL_NONE, PORT_DRIVE_LOW,  false, PORT_IRQC_DISABLED },
+    { PTD16, PORT_MUX_ALT2, PORT_PULL_NONE, PORT_DRIVE_HIGH, false, PORT_IRQC_DISABLED },
+    { PTC12, PORT_MUX_GPIO, PORT_PULL_UP,   PORT_DRIVE_LOW,  true,  PORT_IRQC_FALLING }
+};
+
+static const port_pin_config_t s_test_duplicate[] =
+{
+    { PTD0, PORT_MUX_GPIO, PORT_PULL_NONE, PORT_DRIVE_LOW, false, PORT_IRQC_DISABLED },
+    { PTD0, PORT_MUX_ALT2, PORT_PULL_NONE, PORT_DRIVE_LOW, false, PORT_IRQC_DISABLED }
+};
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+int main(void)
+{
+    port_global_write_t writes[8];
+    hostsim_trace_t total;
+    uint32_t port;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    HOSTTEST_EQ(PORT_PinValue(&s_test_pins[3]),
+                PORT_PCR_MUX(1U) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK | PORT_PCR_PFE_MASK | PORT_PCR_IRQC(0xAU));
+
+    /* Plan: GPCLR, GPCHR, GICLR, GICHR of PORTC (low half only) and PORTD */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PORT_PlanWrites(s_test_pins, TEST_PIN_COUNT, writes, 8U), 6U);
+    HOSTTEST_EQ(writes[0].port, PORT_C);
+    HOSTTEST_EQ(writes[0].reg, PORT_GLOBAL_GPCLR);
+    HOSTTEST_EQ(writes[0].value, PORT_GPCLR_GPWE(1UL << 12U) | PORT_GPCLR_GPWD(PORT_PinValue(&s_test_pins[3]) & 0xFFFFU));
+    HOSTTEST_EQ(writes[2].port, PORT_D);
+    HOSTTEST_EQ(writes[2].value, PORT_GPCLR_GPWE((1UL << 0U) | (1UL << 15U)) | PORT_GPCLR_GPWD(PORT_PCR_MUX(1U)));
+    HOSTTEST_EQ(PORT_PlanWrites(s_test_pins, TEST_PIN_COUNT, NULL, 0U), 6U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+
+    /* Config: port clocks on, one store per planned write, no PCR access */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PORT_ConfigPins(s_test_pins, TEST_PIN_COUNT), PORT_STATUS_SUCCESS);
+
+    HOSTTEST_EQ(*HOSTSIM_Reg(IP_PCC_BASE + PCC_PORTC) & PCC_PCCn_CGC_MASK, PCC_PCCn_CGC_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(IP_PCC_BASE + PCC_PORTD) & PCC_PCCn_CGC_MASK, PCC_PCCn_CGC_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(IP_PCC_BASE + PCC_PORTA) & PCC_PCCn_CGC_MASK, 0U);
+    HOSTTEST_ACCESS(IP_PCC_BASE + PCC_PORTD, 2U, 1U);
+
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 0U)), PORT_PCR_MUX(1U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 15U)), PORT_PCR_MUX(1U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 16U)), PORT_PCR_MUX(2U) | PORT_PCR_DSE_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 1U)), 0U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTC_BASE, 12U)), PORT_PinValue(&s_test_pins[3]));
+
+    HOSTTEST_ACCESS(TEST_GLOBAL(IP_PORTD_BASE, GPCLR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GLOBAL(IP_PORTD_BASE, GPCHR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GLOBAL(IP_PORTD_BASE, GICLR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GLOBAL(IP_PORTD_BASE, GICHR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GLOBAL(IP_PORTC_BASE, GPCLR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_GLOBAL(IP_PORTC_BASE, GPCHR), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_PCR(IP_PORTD_BASE, 0U), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_PCR(IP_PORTC_BASE, 12U), 0U, 0U);
+
+    for (port = IP_PORTA_BASE; port <= IP_PORTE_BASE; port += IP_PORTB_BASE - IP_PORTA_BASE)
+    {
+        HOSTTEST_EQ(*HOSTSIM_Reg(TEST_GLOBAL(port, GPCLR)), 0U);
+    }
+
+    /* Locked pins keep their PCR through GPCLR */
+    *HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 0U)) = PORT_PCR_LK_MASK;
+    HOSTTEST_EQ(PORT_ConfigPins(s_test_pins, TEST_PIN_COUNT), PORT_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 0U)), PORT_PCR_LK_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_PCR(IP_PORTD_BASE, 15U)), PORT_PCR_MUX(1U));
+
+    /* Rejected tables write nothing */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PORT_ConfigPins(s_test_duplicate, 2U), PORT_STATUS_ERROR);
+    HOSTTEST_EQ(PORT_ConfigPins(NULL, 1U), PORT_STATUS_ERROR);
+    HOSTTEST_EQ(PORT_PlanWrites(s_test_duplicate, 2U, writes, 8U), 0U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.loads + total.stores, 0U);
+
+    return HOSTTEST_Done("port");
+}
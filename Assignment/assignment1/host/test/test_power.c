@@ -0,0 +1,123 @@
+/**
+ * @file test_power.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: power manager clock switches around VLPW/VLPS, read back
+ *        from CSR in the SCG model.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * Idle from the SPLL 80 MHz RUN profile: after VLPW and VLPS the saved RCCR
+ * must be back word for word, CSR must report it and the fast sources must
+ * run again. With SIRC unusable the entry must stop before VLPR and before
+ * any source is turned off. Stop modes are not modelled, so WFI returns at
+ * once.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/power_mgr.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_SCG_REG(r)             (IP_SCG_BASE + offsetof(SCG_Type, r))
+#define TEST_SMC_REG(r)             (IP_SMC_BASE + offsetof(SMC_Type, r))
+
+/* SPLL_CLK = 8 MHz / (PREDIV + 1) * (MULT + 16) / 2 = 160 MHz */
+#define TEST_SPLL_MULT              24U
+
+#define TEST_PMSTAT_RUN             0x01U
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static pwr_constraint_t s_test_constraint = { "test", PWR_MODE_VLPW, 0U, false, NULL };
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* Back in RUN on the saved profile, every fast source enabled and valid */
+static void test_check_restored(uint32_t rccr)
+{
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(RCCR)), rccr);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(CSR)), rccr);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SMC_REG(PMSTAT)), TEST_PMSTAT_RUN);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(SOSCCSR)) & (SCG_SOSCCSR_SOSCEN_MASK | SCG_SOSCCSR_SOSCVLD_MASK),
+                SCG_SOSCCSR_SOSCEN_MASK | SCG_SOSCCSR_SOSCVLD_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(FIRCCSR)) & (SCG_FIRCCSR_FIRCEN_MASK | SCG_FIRCCSR_FIRCVLD_MASK),
+                SCG_FIRCCSR_FIRCEN_MASK | SCG_FIRCCSR_FIRCVLD_MASK);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(SPLLCSR)) & (SCG_SPLLCSR_SPLLEN_MASK | SCG_SPLLCSR_SPLLVLD_MASK),
+                SCG_SPLLCSR_SPLLEN_MASK | SCG_SPLLCSR_SPLLVLD_MASK);
+    HOSTTEST_EQ(SCG_GetCoreClock(), 80000000U);
+}
+
+int main(void)
+{
+    pwr_mode_stats_t stats;
+    uint32_t rccr;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SOSC_CLK), SCG_STATUS_SUCCESS);
+    *HOSTSIM_Reg(TEST_SCG_REG(SPLLCFG)) = SCG_SPLLCFG_MULT(TEST_SPLL_MULT);
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SPLL_CLK), SCG_STATUS_SUCCESS);
+    HOSTTEST_EQ(SCG_SPLL_NormalRun_80Mhz(), SCG_STATUS_SUCCESS);
+    rccr = *HOSTSIM_Reg(TEST_SCG_REG(RCCR));
+
+    HOSTTEST_EQ(PWR_Init(), PWR_STATUS_SUCCESS);
+    HOSTTEST_EQ(PWR_RegisterConstraint(&s_test_constraint), PWR_STATUS_SUCCESS);
+    PWR_SetConstraintActive(&s_test_constraint, true);
+
+    /* VLPW: SIRC in RUN, then VLPR, back to RUN and one RCCR store of the saved word */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PWR_Idle(), PWR_MODE_VLPW);
+    test_check_restored(rccr);
+    HOSTTEST_ACCESS(TEST_SCG_REG(RCCR), 2U, 2U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(VCCR), 1U, 1U);
+    HOSTTEST_ACCESS(TEST_SMC_REG(PMCTRL), 2U, 2U);
+    HOSTTEST_EQ(PWR_GetStats(PWR_MODE_VLPW, &stats), PWR_STATUS_SUCCESS);
+    HOSTTEST_EQ(stats.entries, 1U);
+    HOSTTEST_EQ(stats.failures, 0U);
+
+    /* VLPS: same clock path without VLPR */
+    s_test_constraint.deepest = PWR_MODE_VLPS;
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PWR_Idle(), PWR_MODE_VLPS);
+    test_check_restored(rccr);
+    HOSTTEST_ACCESS(TEST_SCG_REG(RCCR), 2U, 2U);
+    HOSTTEST_EQ(PWR_GetStats(PWR_MODE_VLPS, &stats), PWR_STATUS_SUCCESS);
+    HOSTTEST_EQ(stats.entries, 1U);
+    HOSTTEST_EQ(stats.failures, 0U);
+
+    /*
+     * SIRC off: CSR never shows SIRC, so no source is stopped and VLPR is
+     * not requested. The only SPLLCSR/SOSCCSR store is the enable on the way
+     * out, the only PMCTRL store the RUN request.
+     */
+    *HOSTSIM_Reg(TEST_SCG_REG(SIRCCSR)) = 0U;
+    s_test_constraint.deepest = PWR_MODE_VLPW;
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(PWR_Idle(), PWR_MODE_VLPW);
+    test_check_restored(rccr);
+    HOSTTEST_ACCESS(TEST_SCG_REG(SPLLCSR), 3U, 1U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(SOSCCSR), 3U, 1U);
+    HOSTTEST_ACCESS(TEST_SMC_REG(PMCTRL), 1U, 1U);
+    HOSTTEST_EQ(PWR_GetStats(PWR_MODE_VLPW, &stats), PWR_STATUS_SUCCESS);
+    HOSTTEST_EQ(stats.entries, 2U);
+    HOSTTEST_EQ(stats.failures, 1U);
+
+    return HOSTTEST_Done("power");
+}
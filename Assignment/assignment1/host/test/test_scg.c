@@ -0,0 +1,104 @@
+/**
+ * @file test_scg.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: SCG source enable, presets and clock getters against the
+ *        SCG model.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * The SPLL is set up as in tools/dfs_trace: 8 MHz SOSC, MULT 24, 160 MHz.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_SCG_REG(r)             (IP_SCG_BASE + offsetof(SCG_Type, r))
+
+/* SPLL_CLK = 8 MHz / (PREDIV + 1) * (MULT + 16) / 2 = 160 MHz */
+#define TEST_SPLL_MULT              24U
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+int main(void)
+{
+    scg_config_struct_t config = { SCG_RUN_MODE, SCG_FIRC_CLK, SCG_DIV_CORE_BY_1,
+                                   SCG_DIV_BUS_BY_2, SCG_DIV_SLOW_BY_4 };
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    /* Reset: FIRC runs the core at 48 MHz */
+    HOSTTEST_EQ(SCG_GetCoreClock(), 48000000U);
+
+    /* Source enable: one read-modify-write, then polled until the model's VLD */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SOSC_CLK), SCG_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(SOSCCSR)) & (SCG_SOSCCSR_SOSCEN_MASK | SCG_SOSCCSR_SOSCVLD_MASK),
+                SCG_SOSCCSR_SOSCEN_MASK | SCG_SOSCCSR_SOSCVLD_MASK);
+    HOSTTEST_ACCESS(TEST_SCG_REG(SOSCCSR), 1U + HOSTSIM_SCG_VALID_READS, 1U);
+
+    *HOSTSIM_Reg(TEST_SCG_REG(SPLLCFG)) = SCG_SPLLCFG_MULT(TEST_SPLL_MULT);
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SPLL_CLK), SCG_STATUS_SUCCESS);
+
+    /* Generic config: RCCR read, divided in a copy, written once */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(SCG_SetSystemClockConfig(&config), SCG_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(CSR)),
+                SCG_CSR_SCS(SCG_FIRC_CLK) | SCG_CSR_DIVCORE(0U) | SCG_CSR_DIVBUS(1U) | SCG_CSR_DIVSLOW(3U));
+    HOSTTEST_ACCESS(TEST_SCG_REG(RCCR), 1U, 1U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(FIRCCSR), 1U, 0U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(CSR), 1U, 0U);
+    HOSTTEST_EQ(SCG_GetCoreClock(), 48000000U);
+    HOSTTEST_EQ(SCG_GetBusClock(), 24000000U);
+
+    HOSTTEST_EQ(SCG_SetSystemClockConfig(NULL), SCG_STATUS_ERROR);
+
+    /* Presets: RCCR written in one store, never read */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(SCG_SPLL_NormalRun_80Mhz(), SCG_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(RCCR)),
+                SCG_RCCR_SCS(SCG_SPLL_CLK) | SCG_RCCR_DIVCORE(1U) | SCG_RCCR_DIVBUS(1U) | SCG_RCCR_DIVSLOW(2U));
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(CSR)), *HOSTSIM_Reg(TEST_SCG_REG(RCCR)));
+    HOSTTEST_ACCESS(TEST_SCG_REG(RCCR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(SPLLCSR), 1U, 0U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(CSR), 1U, 0U);
+    HOSTTEST_EQ(SCG_GetCoreClock(), 80000000U);
+    HOSTTEST_EQ(SCG_GetBusClock(), 40000000U);
+
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(SCG_FIRC_SlowRun_48Mhz(), SCG_STATUS_SUCCESS);
+    HOSTTEST_EQ((*HOSTSIM_Reg(TEST_SCG_REG(CSR)) & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT, SCG_FIRC_CLK);
+    HOSTTEST_ACCESS(TEST_SCG_REG(RCCR), 0U, 1U);
+    HOSTTEST_EQ(SCG_GetCoreClock(), 48000000U);
+
+    /* HSRUN preset writes HCCR only, CSR follows it once the SMC is in HSRUN */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(SCG_SPLL_HSRun_80Mhz(), SCG_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_SCG_REG(HCCR), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_SCG_REG(RCCR), 0U, 0U);
+    HOSTTEST_EQ((*HOSTSIM_Reg(TEST_SCG_REG(CSR)) & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT, SCG_FIRC_CLK);
+
+    /* A source that does not come up times out */
+    HOSTSIM_Reset();
+    HOSTSIM_ScgSetValidReads(0xFFFFFFFFU);
+    HOSTTEST_EQ(SCG_SourceInit(SCG_SOSC_CLK), SCG_STATUS_TIMEOUT);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_SCG_REG(SOSCCSR)) & SCG_SOSCCSR_SOSCVLD_MASK, 0U);
+    HOSTSIM_ScgSetValidReads(HOSTSIM_SCG_VALID_READS);
+
+    return HOSTTEST_Done("scg");
+}
@@ -0,0 +1,128 @@
+/**
+ * @file test_wdog.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Host test: WDOG unlock and reconfiguration.
+ * @version 0.1
+ * @date 2025-11-14
+ *
+ * The unlock key, the WIN/TOVAL/CS writes it opens and the RCS confirmation,
+ * a reconfiguration while UPDATE is still set, the refusal once locked, and
+ * the configuration checks, which must not unlock the WDOG.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stddef.h>
+
+#include "host_sim.h"
+#include "host_test.h"
+#include "../driver/inc/Driver_WDOG.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TEST_WDOG_REG(r)            (IP_WDOG_BASE + offsetof(WDOG_Type, r))
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+int main(void)
+{
+    wdog_config_t config =
+    {
+        .clock = WDOG_CLK_LPO,
+        .prescaler = true,
+        .timeout = 500U,
+        .window = 0U,
+        .interrupt = true,
+        .debug = false,
+        .wait = true,
+        .stop = false,
+        .lock = false
+    };
+    hostsim_trace_t total;
+
+    if (HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    HOSTTEST_EQ(WDOG_MsToTicks(1000U, WDOG_LPO_HZ, true), 500U);
+    HOSTTEST_EQ(WDOG_MsToTicks(100U, WDOG_LPO_HZ, false), 12800U);
+
+    /* Bad configurations: refused before the unlock key */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(WDOG_Init(NULL), WDOG_STATUS_ERROR);
+    config.timeout = 0U;
+    HOSTTEST_EQ(WDOG_Init(&config), WDOG_STATUS_ERROR);
+    config.timeout = 500U;
+    config.window = 500U;
+    HOSTTEST_EQ(WDOG_Init(&config), WDOG_STATUS_ERROR);
+    config.window = 0U;
+    config.clock = WDOG_CLK_SOSC;
+    HOSTTEST_EQ(WDOG_Init(&config), WDOG_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(CNT), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(CS), 0U, 0U);
+    config.clock = WDOG_CLK_LPO;
+
+    /* Out of reset: key, dummy read, ULK poll, WIN/TOVAL/CS, RCS poll */
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(WDOG_Init(&config), WDOG_STATUS_SUCCESS);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(CNT), 1U, 1U);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(CS), 3U, 1U);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(TOVAL), 0U, 1U);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(WIN), 0U, 1U);
+    HOSTSIM_TraceTotal(&total);
+    HOSTTEST_EQ(total.stores, 4U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(TOVAL)), 500U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(WIN)), 0U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(CS)),
+                WDOG_CS_EN_MASK | WDOG_CS_CMD32EN_MASK | WDOG_CS_CLK(WDOG_CLK_LPO) | WDOG_CS_PRES_MASK |
+                WDOG_CS_INT_MASK | WDOG_CS_WAIT_MASK | WDOG_CS_UPDATE_MASK | WDOG_CS_RCS_MASK);
+    HOSTTEST_CHECK(WDOG_IsWindowOpen());
+    HOSTTEST_CHECK(!WDOG_IsInterruptPending());
+
+    /* Locked again after the CS write: direct writes are ignored */
+    *(volatile uint32_t *)(uintptr_t)TEST_WDOG_REG(TOVAL) = 0x10U;
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(TOVAL)), 500U);
+
+    /* The refresh key does not unlock */
+    WDOG_Refresh();
+    HOSTTEST_CHECK((*HOSTSIM_Reg(TEST_WDOG_REG(CS)) & WDOG_CS_ULK_MASK) == 0U);
+
+    /* UPDATE was left set: window mode on SIRC, then locked for good */
+    config.clock = WDOG_CLK_SIRC;
+    config.prescaler = false;
+    config.timeout = 0x8000U;
+    config.window = 0x1000U;
+    config.interrupt = false;
+    config.lock = true;
+    HOSTTEST_EQ(WDOG_Init(&config), WDOG_STATUS_SUCCESS);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(TOVAL)), 0x8000U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(WIN)), 0x1000U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(CS)),
+                WDOG_CS_EN_MASK | WDOG_CS_CMD32EN_MASK | WDOG_CS_CLK(WDOG_CLK_SIRC) | WDOG_CS_WIN_MASK |
+                WDOG_CS_WAIT_MASK | WDOG_CS_RCS_MASK);
+
+    /* CNT reads 0 on the host, below WIN: the window is closed */
+    HOSTTEST_CHECK(!WDOG_IsWindowOpen());
+    HOSTTEST_EQ(WDOG_GetCounter(), 0U);
+
+    /* UPDATE clear: refused before the key, nothing changes */
+    config.window = 0U;
+    HOSTSIM_TraceReset();
+    HOSTTEST_EQ(WDOG_Init(&config), WDOG_STATUS_ERROR);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(CNT), 0U, 0U);
+    HOSTTEST_ACCESS(TEST_WDOG_REG(CS), 1U, 0U);
+    HOSTTEST_EQ(*HOSTSIM_Reg(TEST_WDOG_REG(WIN)), 0x1000U);
+
+    /* A raised interrupt flag reads as pending */
+    *HOSTSIM_Reg(TEST_WDOG_REG(CS)) |= WDOG_CS_FLG_MASK;
+    HOSTTEST_CHECK(WDOG_IsInterruptPending());
+
+    return HOSTTEST_Done("wdog");
+}
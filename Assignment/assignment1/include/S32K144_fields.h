@@ -0,0 +1,2909 @@
+/*
+ * Generated by tools/gen_reg_fields.py from S32K144.h. Do not edit.
+ *
+ * Field access classes and W1C masks for the REG_* macros in reg_access.h.
+ */
+
+#ifndef S32K144_FIELDS_H_
+#define S32K144_FIELDS_H_
+
+/* ADC_SC1 */
+#define ADC_SC1_W1C_MASK                                 (0x0U)
+#define ADC_SC1_ADCH_ACCESS                              RW
+#define ADC_SC1_AIEN_ACCESS                              RW
+#define ADC_SC1_COCO_ACCESS                              RO
+
+/* ADC_CFG1 */
+#define ADC_CFG1_W1C_MASK                                (0x0U)
+#define ADC_CFG1_ADICLK_ACCESS                           RW
+#define ADC_CFG1_MODE_ACCESS                             RW
+#define ADC_CFG1_ADIV_ACCESS                             RW
+#define ADC_CFG1_CLRLTRG_ACCESS                          RW
+
+/* ADC_CFG2 */
+#define ADC_CFG2_W1C_MASK                                (0x0U)
+#define ADC_CFG2_SMPLTS_ACCESS                           RW
+
+/* ADC_R */
+#define ADC_R_W1C_MASK                                   (0x0U)
+#define ADC_R_D_ACCESS                                   RO
+
+/* ADC_CV */
+#define ADC_CV_W1C_MASK                                  (0x0U)
+#define ADC_CV_CV_ACCESS                                 RW
+
+/* ADC_SC2 */
+#define ADC_SC2_W1C_MASK                                 (0x0U)
+#define ADC_SC2_REFSEL_ACCESS                            RW
+#define ADC_SC2_DMAEN_ACCESS                             RW
+#define ADC_SC2_ACREN_ACCESS                             RW
+#define ADC_SC2_ACFGT_ACCESS                             RW
+#define ADC_SC2_ACFE_ACCESS                              RW
+#define ADC_SC2_ADTRG_ACCESS                             RW
+#define ADC_SC2_ADACT_ACCESS                             RO
+#define ADC_SC2_TRGPRNUM_ACCESS                          RW
+#define ADC_SC2_TRGSTLAT_ACCESS                          RW
+#define ADC_SC2_TRGSTERR_ACCESS                          RW
+
+/* ADC_SC3 */
+#define ADC_SC3_W1C_MASK                                 (0x0U)
+#define ADC_SC3_AVGS_ACCESS                              RW
+#define ADC_SC3_AVGE_ACCESS                              RW
+#define ADC_SC3_ADCO_ACCESS                              RW
+#define ADC_SC3_CAL_ACCESS                               RW
+
+/* ADC_BASE_OFS */
+#define ADC_BASE_OFS_W1C_MASK                            (0x0U)
+#define ADC_BASE_OFS_BA_OFS_ACCESS                       RW
+
+/* ADC_OFS */
+#define ADC_OFS_W1C_MASK                                 (0x0U)
+#define ADC_OFS_OFS_ACCESS                               RW
+
+/* ADC_USR_OFS */
+#define ADC_USR_OFS_W1C_MASK                             (0x0U)
+#define ADC_USR_OFS_USR_OFS_ACCESS                       RW
+
+/* ADC_XOFS */
+#define ADC_XOFS_W1C_MASK                                (0x0U)
+#define ADC_XOFS_XOFS_ACCESS                             RW
+
+/* ADC_YOFS */
+#define ADC_YOFS_W1C_MASK                                (0x0U)
+#define ADC_YOFS_YOFS_ACCESS                             RW
+
+/* ADC_G */
+#define ADC_G_W1C_MASK                                   (0x0U)
+#define ADC_G_G_ACCESS                                   RW
+
+/* ADC_UG */
+#define ADC_UG_W1C_MASK                                  (0x0U)
+#define ADC_UG_UG_ACCESS                                 RW
+
+/* ADC_CLPS */
+#define ADC_CLPS_W1C_MASK                                (0x0U)
+#define ADC_CLPS_CLPS_ACCESS                             RW
+
+/* ADC_CLP3 */
+#define ADC_CLP3_W1C_MASK                                (0x0U)
+#define ADC_CLP3_CLP3_ACCESS                             RW
+
+/* ADC_CLP2 */
+#define ADC_CLP2_W1C_MASK                                (0x0U)
+#define ADC_CLP2_CLP2_ACCESS                             RW
+
+/* ADC_CLP1 */
+#define ADC_CLP1_W1C_MASK                                (0x0U)
+#define ADC_CLP1_CLP1_ACCESS                             RW
+
+/* ADC_CLP0 */
+#define ADC_CLP0_W1C_MASK                                (0x0U)
+#define ADC_CLP0_CLP0_ACCESS                             RW
+
+/* ADC_CLPX */
+#define ADC_CLPX_W1C_MASK                                (0x0U)
+#define ADC_CLPX_CLPX_ACCESS                             RW
+
+/* ADC_CLP9 */
+#define ADC_CLP9_W1C_MASK                                (0x0U)
+#define ADC_CLP9_CLP9_ACCESS                             RW
+
+/* ADC_CLPS_OFS */
+#define ADC_CLPS_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLPS_OFS_CLPS_OFS_ACCESS                     RW
+
+/* ADC_CLP3_OFS */
+#define ADC_CLP3_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLP3_OFS_CLP3_OFS_ACCESS                     RW
+
+/* ADC_CLP2_OFS */
+#define ADC_CLP2_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLP2_OFS_CLP2_OFS_ACCESS                     RW
+
+/* ADC_CLP1_OFS */
+#define ADC_CLP1_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLP1_OFS_CLP1_OFS_ACCESS                     RW
+
+/* ADC_CLP0_OFS */
+#define ADC_CLP0_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLP0_OFS_CLP0_OFS_ACCESS                     RW
+
+/* ADC_CLPX_OFS */
+#define ADC_CLPX_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLPX_OFS_CLPX_OFS_ACCESS                     RW
+
+/* ADC_CLP9_OFS */
+#define ADC_CLP9_OFS_W1C_MASK                            (0x0U)
+#define ADC_CLP9_OFS_CLP9_OFS_ACCESS                     RW
+
+/* AIPS_MPRA */
+#define AIPS_MPRA_W1C_MASK                               (0x0U)
+#define AIPS_MPRA_MPL2_ACCESS                            RW
+#define AIPS_MPRA_MTW2_ACCESS                            RW
+#define AIPS_MPRA_MTR2_ACCESS                            RW
+#define AIPS_MPRA_MPL1_ACCESS                            RW
+#define AIPS_MPRA_MTW1_ACCESS                            RW
+#define AIPS_MPRA_MTR1_ACCESS                            RW
+#define AIPS_MPRA_MPL0_ACCESS                            RW
+#define AIPS_MPRA_MTW0_ACCESS                            RW
+#define AIPS_MPRA_MTR0_ACCESS                            RW
+
+/* AIPS_PACRA */
+#define AIPS_PACRA_W1C_MASK                              (0x0U)
+#define AIPS_PACRA_TP1_ACCESS                            RW
+#define AIPS_PACRA_WP1_ACCESS                            RW
+#define AIPS_PACRA_SP1_ACCESS                            RW
+#define AIPS_PACRA_TP0_ACCESS                            RW
+#define AIPS_PACRA_WP0_ACCESS                            RW
+#define AIPS_PACRA_SP0_ACCESS                            RW
+
+/* AIPS_PACRB */
+#define AIPS_PACRB_W1C_MASK                              (0x0U)
+#define AIPS_PACRB_TP5_ACCESS                            RW
+#define AIPS_PACRB_WP5_ACCESS                            RW
+#define AIPS_PACRB_SP5_ACCESS                            RW
+#define AIPS_PACRB_TP1_ACCESS                            RW
+#define AIPS_PACRB_WP1_ACCESS                            RW
+#define AIPS_PACRB_SP1_ACCESS                            RW
+#define AIPS_PACRB_TP0_ACCESS                            RW
+#define AIPS_PACRB_WP0_ACCESS                            RW
+#define AIPS_PACRB_SP0_ACCESS                            RW
+
+/* AIPS_PACRD */
+#define AIPS_PACRD_W1C_MASK                              (0x0U)
+#define AIPS_PACRD_TP1_ACCESS                            RW
+#define AIPS_PACRD_WP1_ACCESS                            RW
+#define AIPS_PACRD_SP1_ACCESS                            RW
+#define AIPS_PACRD_TP0_ACCESS                            RW
+#define AIPS_PACRD_WP0_ACCESS                            RW
+#define AIPS_PACRD_SP0_ACCESS                            RW
+
+/* AIPS_OPACR */
+#define AIPS_OPACR_W1C_MASK                              (0x0U)
+#define AIPS_OPACR_TP7_ACCESS                            RW
+#define AIPS_OPACR_WP7_ACCESS                            RW
+#define AIPS_OPACR_SP7_ACCESS                            RW
+#define AIPS_OPACR_TP6_ACCESS                            RW
+#define AIPS_OPACR_WP6_ACCESS                            RW
+#define AIPS_OPACR_SP6_ACCESS                            RW
+#define AIPS_OPACR_TP5_ACCESS                            RW
+#define AIPS_OPACR_WP5_ACCESS                            RW
+#define AIPS_OPACR_SP5_ACCESS                            RW
+#define AIPS_OPACR_TP4_ACCESS                            RW
+#define AIPS_OPACR_WP4_ACCESS                            RW
+#define AIPS_OPACR_SP4_ACCESS                            RW
+#define AIPS_OPACR_TP3_ACCESS                            RW
+#define AIPS_OPACR_WP3_ACCESS                            RW
+#define AIPS_OPACR_SP3_ACCESS                            RW
+#define AIPS_OPACR_TP2_ACCESS                            RW
+#define AIPS_OPACR_WP2_ACCESS                            RW
+#define AIPS_OPACR_SP2_ACCESS                            RW
+#define AIPS_OPACR_TP1_ACCESS                            RW
+#define AIPS_OPACR_WP1_ACCESS                            RW
+#define AIPS_OPACR_SP1_ACCESS                            RW
+#define AIPS_OPACR_TP0_ACCESS                            RW
+#define AIPS_OPACR_WP0_ACCESS                            RW
+#define AIPS_OPACR_SP0_ACCESS                            RW
+
+/* CMP_C0 */
+#define CMP_C0_W1C_MASK                                  (0x0U)
+#define CMP_C0_HYSTCTR_ACCESS                            RW
+#define CMP_C0_OFFSET_ACCESS                             RW
+#define CMP_C0_FILTER_CNT_ACCESS                         RW
+#define CMP_C0_EN_ACCESS                                 RW
+#define CMP_C0_OPE_ACCESS                                RW
+#define CMP_C0_COS_ACCESS                                RW
+#define CMP_C0_INVT_ACCESS                               RW
+#define CMP_C0_PMODE_ACCESS                              RW
+#define CMP_C0_WE_ACCESS                                 RW
+#define CMP_C0_SE_ACCESS                                 RW
+#define CMP_C0_FPR_ACCESS                                RW
+#define CMP_C0_COUT_ACCESS                               RW
+#define CMP_C0_CFF_ACCESS                                RW
+#define CMP_C0_CFR_ACCESS                                RW
+#define CMP_C0_IEF_ACCESS                                RW
+#define CMP_C0_IER_ACCESS                                RW
+#define CMP_C0_DMAEN_ACCESS                              RW
+
+/* CMP_C1 */
+#define CMP_C1_W1C_MASK                                  (0x0U)
+#define CMP_C1_VOSEL_ACCESS                              RW
+#define CMP_C1_MSEL_ACCESS                               RW
+#define CMP_C1_PSEL_ACCESS                               RW
+#define CMP_C1_VRSEL_ACCESS                              RW
+#define CMP_C1_DACEN_ACCESS                              RW
+#define CMP_C1_CHN0_ACCESS                               RW
+#define CMP_C1_CHN1_ACCESS                               RW
+#define CMP_C1_CHN2_ACCESS                               RW
+#define CMP_C1_CHN3_ACCESS                               RW
+#define CMP_C1_CHN4_ACCESS                               RW
+#define CMP_C1_CHN5_ACCESS                               RW
+#define CMP_C1_CHN6_ACCESS                               RW
+#define CMP_C1_CHN7_ACCESS                               RW
+#define CMP_C1_INNSEL_ACCESS                             RW
+#define CMP_C1_INPSEL_ACCESS                             RW
+
+/* CMP_C2 */
+#define CMP_C2_W1C_MASK                                  (0x0U)
+#define CMP_C2_ACOn_ACCESS                               RW
+#define CMP_C2_INITMOD_ACCESS                            RW
+#define CMP_C2_NSAM_ACCESS                               RW
+#define CMP_C2_CH0F_ACCESS                               RW
+#define CMP_C2_CH1F_ACCESS                               RW
+#define CMP_C2_CH2F_ACCESS                               RW
+#define CMP_C2_CH3F_ACCESS                               RW
+#define CMP_C2_CH4F_ACCESS                               RW
+#define CMP_C2_CH5F_ACCESS                               RW
+#define CMP_C2_CH6F_ACCESS                               RW
+#define CMP_C2_CH7F_ACCESS                               RW
+#define CMP_C2_FXMXCH_ACCESS                             RW
+#define CMP_C2_FXMP_ACCESS                               RW
+#define CMP_C2_RRIE_ACCESS                               RW
+#define CMP_C2_RRE_ACCESS                                RW
+
+/* CRC_DATAu_DATA_8_LL */
+#define CRC_DATAu_DATA_8_LL_W1C_MASK                     (0x0U)
+#define CRC_DATAu_DATA_8_LL_DATALL_ACCESS                RW
+
+/* CRC_DATAu_DATA_8_LU */
+#define CRC_DATAu_DATA_8_LU_W1C_MASK                     (0x0U)
+#define CRC_DATAu_DATA_8_LU_DATALU_ACCESS                RW
+
+/* CRC_DATAu_DATA_8_HL */
+#define CRC_DATAu_DATA_8_HL_W1C_MASK                     (0x0U)
+#define CRC_DATAu_DATA_8_HL_DATAHL_ACCESS                RW
+
+/* CRC_DATAu_DATA_8_HU */
+#define CRC_DATAu_DATA_8_HU_W1C_MASK                     (0x0U)
+#define CRC_DATAu_DATA_8_HU_DATAHU_ACCESS                RW
+
+/* CRC_DATAu_DATA_16_L */
+#define CRC_DATAu_DATA_16_L_W1C_MASK                     (0x0U)
+#define CRC_DATAu_DATA_16_L_DATAL_ACCESS                 RW
+
+/* CRC_DATAu_DATA_16_H */
+#define CRC_DATAu_DATA_16_H_W1C_MASK                     (0x0U)
+#define CRC_DATAu_DATA_16_H_DATAH_ACCESS                 RW
+
+/* CRC_DATAu_DATA */
+#define CRC_DATAu_DATA_W1C_MASK                          (0x0U)
+#define CRC_DATAu_DATA_LL_ACCESS                         RW
+#define CRC_DATAu_DATA_LU_ACCESS                         RW
+#define CRC_DATAu_DATA_HL_ACCESS                         RW
+#define CRC_DATAu_DATA_HU_ACCESS                         RW
+
+/* CRC_GPOLY */
+#define CRC_GPOLY_W1C_MASK                               (0x0U)
+#define CRC_GPOLY_LOW_ACCESS                             RW
+#define CRC_GPOLY_HIGH_ACCESS                            RW
+
+/* CRC_CTRL */
+#define CRC_CTRL_W1C_MASK                                (0x0U)
+#define CRC_CTRL_TCRC_ACCESS                             RW
+#define CRC_CTRL_WAS_ACCESS                              RW
+#define CRC_CTRL_FXOR_ACCESS                             RW
+#define CRC_CTRL_TOTR_ACCESS                             RW
+#define CRC_CTRL_TOT_ACCESS                              RW
+
+/* DMA_CR */
+#define DMA_CR_W1C_MASK                                  (0x0U)
+#define DMA_CR_EDBG_ACCESS                               RW
+#define DMA_CR_ERCA_ACCESS                               RW
+#define DMA_CR_HOE_ACCESS                                RW
+#define DMA_CR_HALT_ACCESS                               RW
+#define DMA_CR_CLM_ACCESS                                RW
+#define DMA_CR_EMLM_ACCESS                               RW
+#define DMA_CR_ECX_ACCESS                                RW
+#define DMA_CR_CX_ACCESS                                 RW
+#define DMA_CR_ACTIVE_ACCESS                             RW
+
+/* DMA_ES */
+#define DMA_ES_W1C_MASK                                  (0x0U)
+#define DMA_ES_DBE_ACCESS                                RO
+#define DMA_ES_SBE_ACCESS                                RO
+#define DMA_ES_SGE_ACCESS                                RO
+#define DMA_ES_NCE_ACCESS                                RO
+#define DMA_ES_DOE_ACCESS                                RO
+#define DMA_ES_DAE_ACCESS                                RO
+#define DMA_ES_SOE_ACCESS                                RO
+#define DMA_ES_SAE_ACCESS                                RO
+#define DMA_ES_ERRCHN_ACCESS                             RO
+#define DMA_ES_CPE_ACCESS                                RO
+#define DMA_ES_ECX_ACCESS                                RO
+#define DMA_ES_VLD_ACCESS                                RO
+
+/* DMA_ERQ */
+#define DMA_ERQ_W1C_MASK                                 (0x0U)
+#define DMA_ERQ_ERQ0_ACCESS                              RW
+#define DMA_ERQ_ERQ1_ACCESS                              RW
+#define DMA_ERQ_ERQ2_ACCESS                              RW
+#define DMA_ERQ_ERQ3_ACCESS                              RW
+#define DMA_ERQ_ERQ4_ACCESS                              RW
+#define DMA_ERQ_ERQ5_ACCESS                              RW
+#define DMA_ERQ_ERQ6_ACCESS                              RW
+#define DMA_ERQ_ERQ7_ACCESS                              RW
+#define DMA_ERQ_ERQ8_ACCESS                              RW
+#define DMA_ERQ_ERQ9_ACCESS                              RW
+#define DMA_ERQ_ERQ10_ACCESS                             RW
+#define DMA_ERQ_ERQ11_ACCESS                             RW
+#define DMA_ERQ_ERQ12_ACCESS                             RW
+#define DMA_ERQ_ERQ13_ACCESS                             RW
+#define DMA_ERQ_ERQ14_ACCESS                             RW
+#define DMA_ERQ_ERQ15_ACCESS                             RW
+
+/* DMA_EEI */
+#define DMA_EEI_W1C_MASK                                 (0x0U)
+#define DMA_EEI_EEI0_ACCESS                              RW
+#define DMA_EEI_EEI1_ACCESS                              RW
+#define DMA_EEI_EEI2_ACCESS                              RW
+#define DMA_EEI_EEI3_ACCESS                              RW
+#define DMA_EEI_EEI4_ACCESS                              RW
+#define DMA_EEI_EEI5_ACCESS                              RW
+#define DMA_EEI_EEI6_ACCESS                              RW
+#define DMA_EEI_EEI7_ACCESS                              RW
+#define DMA_EEI_EEI8_ACCESS                              RW
+#define DMA_EEI_EEI9_ACCESS                              RW
+#define DMA_EEI_EEI10_ACCESS                             RW
+#define DMA_EEI_EEI11_ACCESS                             RW
+#define DMA_EEI_EEI12_ACCESS                             RW
+#define DMA_EEI_EEI13_ACCESS                             RW
+#define DMA_EEI_EEI14_ACCESS                             RW
+#define DMA_EEI_EEI15_ACCESS                             RW
+
+/* DMA_CEEI */
+#define DMA_CEEI_W1C_MASK                                (0x0U)
+#define DMA_CEEI_CEEI_ACCESS                             WO
+#define DMA_CEEI_CAEE_ACCESS                             WO
+#define DMA_CEEI_NOP_ACCESS                              WO
+
+/* DMA_SEEI */
+#define DMA_SEEI_W1C_MASK                                (0x0U)
+#define DMA_SEEI_SEEI_ACCESS                             WO
+#define DMA_SEEI_SAEE_ACCESS                             WO
+#define DMA_SEEI_NOP_ACCESS                              WO
+
+/* DMA_CERQ */
+#define DMA_CERQ_W1C_MASK                                (0x0U)
+#define DMA_CERQ_CERQ_ACCESS                             WO
+#define DMA_CERQ_CAER_ACCESS                             WO
+#define DMA_CERQ_NOP_ACCESS                              WO
+
+/* DMA_SERQ */
+#define DMA_SERQ_W1C_MASK                                (0x0U)
+#define DMA_SERQ_SERQ_ACCESS                             WO
+#define DMA_SERQ_SAER_ACCESS                             WO
+#define DMA_SERQ_NOP_ACCESS                              WO
+
+/* DMA_CDNE */
+#define DMA_CDNE_W1C_MASK                                (0x0U)
+#define DMA_CDNE_CDNE_ACCESS                             WO
+#define DMA_CDNE_CADN_ACCESS                             WO
+#define DMA_CDNE_NOP_ACCESS                              WO
+
+/* DMA_SSRT */
+#define DMA_SSRT_W1C_MASK                                (0x0U)
+#define DMA_SSRT_SSRT_ACCESS                             WO
+#define DMA_SSRT_SAST_ACCESS                             WO
+#define DMA_SSRT_NOP_ACCESS                              WO
+
+/* DMA_CERR */
+#define DMA_CERR_W1C_MASK                                (0x0U)
+#define DMA_CERR_CERR_ACCESS                             WO
+#define DMA_CERR_CAEI_ACCESS                             WO
+#define DMA_CERR_NOP_ACCESS                              WO
+
+/* DMA_CINT */
+#define DMA_CINT_W1C_MASK                                (0x0U)
+#define DMA_CINT_CINT_ACCESS                             WO
+#define DMA_CINT_CAIR_ACCESS                             WO
+#define DMA_CINT_NOP_ACCESS                              WO
+
+/* DMA_INT */
+#define DMA_INT_W1C_MASK                                 (0x0U)
+#define DMA_INT_INT0_ACCESS                              RW
+#define DMA_INT_INT1_ACCESS                              RW
+#define DMA_INT_INT2_ACCESS                              RW
+#define DMA_INT_INT3_ACCESS                              RW
+#define DMA_INT_INT4_ACCESS                              RW
+#define DMA_INT_INT5_ACCESS                              RW
+#define DMA_INT_INT6_ACCESS                              RW
+#define DMA_INT_INT7_ACCESS                              RW
+#define DMA_INT_INT8_ACCESS                              RW
+#define DMA_INT_INT9_ACCESS                              RW
+#define DMA_INT_INT10_ACCESS                             RW
+#define DMA_INT_INT11_ACCESS                             RW
+#define DMA_INT_INT12_ACCESS                             RW
+#define DMA_INT_INT13_ACCESS                             RW
+#define DMA_INT_INT14_ACCESS                             RW
+#define DMA_INT_INT15_ACCESS                             RW
+
+/* DMA_ERR */
+#define DMA_ERR_W1C_MASK                                 (0x0U)
+#define DMA_ERR_ERR0_ACCESS                              RW
+#define DMA_ERR_ERR1_ACCESS                              RW
+#define DMA_ERR_ERR2_ACCESS                              RW
+#define DMA_ERR_ERR3_ACCESS                              RW
+#define DMA_ERR_ERR4_ACCESS                              RW
+#define DMA_ERR_ERR5_ACCESS                              RW
+#define DMA_ERR_ERR6_ACCESS                              RW
+#define DMA_ERR_ERR7_ACCESS                              RW
+#define DMA_ERR_ERR8_ACCESS                              RW
+#define DMA_ERR_ERR9_ACCESS                              RW
+#define DMA_ERR_ERR10_ACCESS                             RW
+#define DMA_ERR_ERR11_ACCESS                             RW
+#define DMA_ERR_ERR12_ACCESS                             RW
+#define DMA_ERR_ERR13_ACCESS                             RW
+#define DMA_ERR_ERR14_ACCESS                             RW
+#define DMA_ERR_ERR15_ACCESS                             RW
+
+/* DMA_HRS */
+#define DMA_HRS_W1C_MASK                                 (0x0U)
+#define DMA_HRS_HRS0_ACCESS                              RO
+#define DMA_HRS_HRS1_ACCESS                              RO
+#define DMA_HRS_HRS2_ACCESS                              RO
+#define DMA_HRS_HRS3_ACCESS                              RO
+#define DMA_HRS_HRS4_ACCESS                              RO
+#define DMA_HRS_HRS5_ACCESS                              RO
+#define DMA_HRS_HRS6_ACCESS                              RO
+#define DMA_HRS_HRS7_ACCESS                              RO
+#define DMA_HRS_HRS8_ACCESS                              RO
+#define DMA_HRS_HRS9_ACCESS                              RO
+#define DMA_HRS_HRS10_ACCESS                             RO
+#define DMA_HRS_HRS11_ACCESS                             RO
+#define DMA_HRS_HRS12_ACCESS                             RO
+#define DMA_HRS_HRS13_ACCESS                             RO
+#define DMA_HRS_HRS14_ACCESS                             RO
+#define DMA_HRS_HRS15_ACCESS                             RO
+
+/* DMA_EARS */
+#define DMA_EARS_W1C_MASK                                (0x0U)
+#define DMA_EARS_EDREQ_0_ACCESS                          RW
+#define DMA_EARS_EDREQ_1_ACCESS                          RW
+#define DMA_EARS_EDREQ_2_ACCESS                          RW
+#define DMA_EARS_EDREQ_3_ACCESS                          RW
+#define DMA_EARS_EDREQ_4_ACCESS                          RW
+#define DMA_EARS_EDREQ_5_ACCESS                          RW
+#define DMA_EARS_EDREQ_6_ACCESS                          RW
+#define DMA_EARS_EDREQ_7_ACCESS                          RW
+#define DMA_EARS_EDREQ_8_ACCESS                          RW
+#define DMA_EARS_EDREQ_9_ACCESS                          RW
+#define DMA_EARS_EDREQ_10_ACCESS                         RW
+#define DMA_EARS_EDREQ_11_ACCESS                         RW
+#define DMA_EARS_EDREQ_12_ACCESS                         RW
+#define DMA_EARS_EDREQ_13_ACCESS                         RW
+#define DMA_EARS_EDREQ_14_ACCESS                         RW
+#define DMA_EARS_EDREQ_15_ACCESS                         RW
+
+/* DMA_DCHPRI */
+#define DMA_DCHPRI_W1C_MASK                              (0x0U)
+#define DMA_DCHPRI_CHPRI_ACCESS                          RW
+#define DMA_DCHPRI_DPA_ACCESS                            RW
+#define DMA_DCHPRI_ECP_ACCESS                            RW
+
+/* DMA_TCD_SADDR */
+#define DMA_TCD_SADDR_W1C_MASK                           (0x0U)
+#define DMA_TCD_SADDR_SADDR_ACCESS                       RW
+
+/* DMA_TCD_SOFF */
+#define DMA_TCD_SOFF_W1C_MASK                            (0x0U)
+#define DMA_TCD_SOFF_SOFF_ACCESS                         RW
+
+/* DMA_TCD_ATTR */
+#define DMA_TCD_ATTR_W1C_MASK                            (0x0U)
+#define DMA_TCD_ATTR_DSIZE_ACCESS                        RW
+#define DMA_TCD_ATTR_DMOD_ACCESS                         RW
+#define DMA_TCD_ATTR_SSIZE_ACCESS                        RW
+#define DMA_TCD_ATTR_SMOD_ACCESS                         RW
+
+/* DMA_TCD_NBYTES_MLNO */
+#define DMA_TCD_NBYTES_MLNO_W1C_MASK                     (0x0U)
+#define DMA_TCD_NBYTES_MLNO_NBYTES_ACCESS                RW
+
+/* DMA_TCD_NBYTES_MLOFFNO */
+#define DMA_TCD_NBYTES_MLOFFNO_W1C_MASK                  (0x0U)
+#define DMA_TCD_NBYTES_MLOFFNO_NBYTES_ACCESS             RW
+#define DMA_TCD_NBYTES_MLOFFNO_DMLOE_ACCESS              RW
+#define DMA_TCD_NBYTES_MLOFFNO_SMLOE_ACCESS              RW
+
+/* DMA_TCD_NBYTES_MLOFFYES */
+#define DMA_TCD_NBYTES_MLOFFYES_W1C_MASK                 (0x0U)
+#define DMA_TCD_NBYTES_MLOFFYES_NBYTES_ACCESS            RW
+#define DMA_TCD_NBYTES_MLOFFYES_MLOFF_ACCESS             RW
+#define DMA_TCD_NBYTES_MLOFFYES_DMLOE_ACCESS             RW
+#define DMA_TCD_NBYTES_MLOFFYES_SMLOE_ACCESS             RW
+
+/* DMA_TCD_SLAST */
+#define DMA_TCD_SLAST_W1C_MASK                           (0x0U)
+#define DMA_TCD_SLAST_SLAST_ACCESS                       RW
+
+/* DMA_TCD_DADDR */
+#define DMA_TCD_DADDR_W1C_MASK                           (0x0U)
+#define DMA_TCD_DADDR_DADDR_ACCESS                       RW
+
+/* DMA_TCD_DOFF */
+#define DMA_TCD_DOFF_W1C_MASK                            (0x0U)
+#define DMA_TCD_DOFF_DOFF_ACCESS                         RW
+
+/* DMA_TCD_CITER_ELINKNO */
+#define DMA_TCD_CITER_ELINKNO_W1C_MASK                   (0x0U)
+#define DMA_TCD_CITER_ELINKNO_CITER_ACCESS               RW
+#define DMA_TCD_CITER_ELINKNO_ELINK_ACCESS               RW
+
+/* DMA_TCD_CITER_ELINKYES */
+#define DMA_TCD_CITER_ELINKYES_W1C_MASK                  (0x0U)
+#define DMA_TCD_CITER_ELINKYES_CITER_ACCESS              RW
+#define DMA_TCD_CITER_ELINKYES_LINKCH_ACCESS             RW
+#define DMA_TCD_CITER_ELINKYES_ELINK_ACCESS              RW
+
+/* DMA_TCD_DLASTSGA */
+#define DMA_TCD_DLASTSGA_W1C_MASK                        (0x0U)
+#define DMA_TCD_DLASTSGA_DLASTSGA_ACCESS                 RW
+
+/* DMA_TCD_CSR */
+#define DMA_TCD_CSR_W1C_MASK                             (0x0U)
+#define DMA_TCD_CSR_START_ACCESS                         RW
+#define DMA_TCD_CSR_INTMAJOR_ACCESS                      RW
+#define DMA_TCD_CSR_INTHALF_ACCESS                       RW
+#define DMA_TCD_CSR_DREQ_ACCESS                          RW
+#define DMA_TCD_CSR_ESG_ACCESS                           RW
+#define DMA_TCD_CSR_MAJORELINK_ACCESS                    RW
+#define DMA_TCD_CSR_ACTIVE_ACCESS                        RO
+#define DMA_TCD_CSR_DONE_ACCESS                          RO
+#define DMA_TCD_CSR_MAJORLINKCH_ACCESS                   RW
+#define DMA_TCD_CSR_BWC_ACCESS                           RW
+
+/* DMA_TCD_BITER_ELINKNO */
+#define DMA_TCD_BITER_ELINKNO_W1C_MASK                   (0x0U)
+#define DMA_TCD_BITER_ELINKNO_BITER_ACCESS               RW
+#define DMA_TCD_BITER_ELINKNO_ELINK_ACCESS               RW
+
+/* DMA_TCD_BITER_ELINKYES */
+#define DMA_TCD_BITER_ELINKYES_W1C_MASK                  (0x0U)
+#define DMA_TCD_BITER_ELINKYES_BITER_ACCESS              RW
+#define DMA_TCD_BITER_ELINKYES_LINKCH_ACCESS             RW
+#define DMA_TCD_BITER_ELINKYES_ELINK_ACCESS              RW
+
+/* DMAMUX_CHCFG */
+#define DMAMUX_CHCFG_W1C_MASK                            (0x0U)
+#define DMAMUX_CHCFG_SOURCE_ACCESS                       RW
+#define DMAMUX_CHCFG_TRIG_ACCESS                         RW
+#define DMAMUX_CHCFG_ENBL_ACCESS                         RW
+
+/* EIM_EIMCR */
+#define EIM_EIMCR_W1C_MASK                               (0x0U)
+#define EIM_EIMCR_GEIEN_ACCESS                           RW
+
+/* EIM_EICHEN */
+#define EIM_EICHEN_W1C_MASK                              (0x0U)
+#define EIM_EICHEN_EICH1EN_ACCESS                        RW
+#define EIM_EICHEN_EICH0EN_ACCESS                        RW
+
+/* EIM_EICHDn_WORD0 */
+#define EIM_EICHDn_WORD0_W1C_MASK                        (0x0U)
+#define EIM_EICHDn_WORD0_CHKBIT_MASK_ACCESS              RW
+
+/* EIM_EICHDn_WORD1 */
+#define EIM_EICHDn_WORD1_W1C_MASK                        (0x0U)
+#define EIM_EICHDn_WORD1_B0_3DATA_MASK_ACCESS            RW
+
+/* ERM_CR0 */
+#define ERM_CR0_W1C_MASK                                 (0x0U)
+#define ERM_CR0_ENCIE1_ACCESS                            RW
+#define ERM_CR0_ESCIE1_ACCESS                            RW
+#define ERM_CR0_ENCIE0_ACCESS                            RW
+#define ERM_CR0_ESCIE0_ACCESS                            RW
+
+/* ERM_SR0 */
+#define ERM_SR0_W1C_MASK                                 (0xCC000000U)
+#define ERM_SR0_W1C_BASE(reg)                            0U
+#define ERM_SR0_NCE1_ACCESS                              W1C
+#define ERM_SR0_SBC1_ACCESS                              W1C
+#define ERM_SR0_NCE0_ACCESS                              W1C
+#define ERM_SR0_SBC0_ACCESS                              W1C
+
+/* ERM_EAR */
+#define ERM_EAR_W1C_MASK                                 (0x0U)
+#define ERM_EAR_EAR_ACCESS                               RO
+
+/* EWM_CTRL */
+#define EWM_CTRL_W1C_MASK                                (0x0U)
+#define EWM_CTRL_EWMEN_ACCESS                            RW
+#define EWM_CTRL_ASSIN_ACCESS                            RW
+#define EWM_CTRL_INEN_ACCESS                             RW
+#define EWM_CTRL_INTEN_ACCESS                            RW
+
+/* EWM_SERV */
+#define EWM_SERV_W1C_MASK                                (0x0U)
+#define EWM_SERV_SERVICE_ACCESS                          WO
+
+/* EWM_CMPL */
+#define EWM_CMPL_W1C_MASK                                (0x0U)
+#define EWM_CMPL_COMPAREL_ACCESS                         RW
+
+/* EWM_CMPH */
+#define EWM_CMPH_W1C_MASK                                (0x0U)
+#define EWM_CMPH_COMPAREH_ACCESS                         RW
+
+/* EWM_CLKPRESCALER */
+#define EWM_CLKPRESCALER_W1C_MASK                        (0x0U)
+#define EWM_CLKPRESCALER_CLK_DIV_ACCESS                  RW
+
+/* FLEXCAN_MCR */
+#define FLEXCAN_MCR_W1C_MASK                             (0x0U)
+#define FLEXCAN_MCR_MAXMB_ACCESS                         RW
+#define FLEXCAN_MCR_IDAM_ACCESS                          RW
+#define FLEXCAN_MCR_FDEN_ACCESS                          RW
+#define FLEXCAN_MCR_AEN_ACCESS                           RW
+#define FLEXCAN_MCR_LPRIOEN_ACCESS                       RW
+#define FLEXCAN_MCR_PNET_EN_ACCESS                       RW
+#define FLEXCAN_MCR_DMA_ACCESS                           RW
+#define FLEXCAN_MCR_IRMQ_ACCESS                          RW
+#define FLEXCAN_MCR_SRXDIS_ACCESS                        RW
+#define FLEXCAN_MCR_LPMACK_ACCESS                        RW
+#define FLEXCAN_MCR_WRNEN_ACCESS                         RW
+#define FLEXCAN_MCR_SUPV_ACCESS                          RW
+#define FLEXCAN_MCR_FRZACK_ACCESS                        RW
+#define FLEXCAN_MCR_SOFTRST_ACCESS                       RW
+#define FLEXCAN_MCR_NOTRDY_ACCESS                        RW
+#define FLEXCAN_MCR_HALT_ACCESS                          RW
+#define FLEXCAN_MCR_RFEN_ACCESS                          RW
+#define FLEXCAN_MCR_FRZ_ACCESS                           RW
+#define FLEXCAN_MCR_MDIS_ACCESS                          RW
+
+/* FLEXCAN_CTRL1 */
+#define FLEXCAN_CTRL1_W1C_MASK                           (0x0U)
+#define FLEXCAN_CTRL1_PROPSEG_ACCESS                     RW
+#define FLEXCAN_CTRL1_LOM_ACCESS                         RW
+#define FLEXCAN_CTRL1_LBUF_ACCESS                        RW
+#define FLEXCAN_CTRL1_TSYN_ACCESS                        RW
+#define FLEXCAN_CTRL1_BOFFREC_ACCESS                     RW
+#define FLEXCAN_CTRL1_SMP_ACCESS                         RW
+#define FLEXCAN_CTRL1_RWRNMSK_ACCESS                     RW
+#define FLEXCAN_CTRL1_TWRNMSK_ACCESS                     RW
+#define FLEXCAN_CTRL1_LPB_ACCESS                         RW
+#define FLEXCAN_CTRL1_CLKSRC_ACCESS                      RW
+#define FLEXCAN_CTRL1_ERRMSK_ACCESS                      RW
+#define FLEXCAN_CTRL1_BOFFMSK_ACCESS                     RW
+#define FLEXCAN_CTRL1_PSEG2_ACCESS                       RW
+#define FLEXCAN_CTRL1_PSEG1_ACCESS                       RW
+#define FLEXCAN_CTRL1_RJW_ACCESS                         RW
+#define FLEXCAN_CTRL1_PRESDIV_ACCESS                     RW
+
+/* FLEXCAN_TIMER */
+#define FLEXCAN_TIMER_W1C_MASK                           (0x0U)
+#define FLEXCAN_TIMER_TIMER_ACCESS                       RW
+
+/* FLEXCAN_RXMGMASK */
+#define FLEXCAN_RXMGMASK_W1C_MASK                        (0x0U)
+#define FLEXCAN_RXMGMASK_MG_ACCESS                       RW
+
+/* FLEXCAN_RX14MASK */
+#define FLEXCAN_RX14MASK_W1C_MASK                        (0x0U)
+#define FLEXCAN_RX14MASK_RX14M_ACCESS                    RW
+
+/* FLEXCAN_RX15MASK */
+#define FLEXCAN_RX15MASK_W1C_MASK                        (0x0U)
+#define FLEXCAN_RX15MASK_RX15M_ACCESS                    RW
+
+/* FLEXCAN_ECR */
+#define FLEXCAN_ECR_W1C_MASK                             (0x0U)
+#define FLEXCAN_ECR_TXERRCNT_ACCESS                      RW
+#define FLEXCAN_ECR_RXERRCNT_ACCESS                      RW
+#define FLEXCAN_ECR_TXERRCNT_FAST_ACCESS                 RW
+#define FLEXCAN_ECR_RXERRCNT_FAST_ACCESS                 RW
+
+/* FLEXCAN_ESR1 */
+#define FLEXCAN_ESR1_W1C_MASK                            (0x1B0006U)
+#define FLEXCAN_ESR1_W1C_BASE(reg)                       ((reg) & ~FLEXCAN_ESR1_W1C_MASK)
+#define FLEXCAN_ESR1_ERRINT_ACCESS                       W1C
+#define FLEXCAN_ESR1_BOFFINT_ACCESS                      W1C
+#define FLEXCAN_ESR1_RX_ACCESS                           RW
+#define FLEXCAN_ESR1_FLTCONF_ACCESS                      RW
+#define FLEXCAN_ESR1_TX_ACCESS                           RW
+#define FLEXCAN_ESR1_IDLE_ACCESS                         RW
+#define FLEXCAN_ESR1_RXWRN_ACCESS                        RW
+#define FLEXCAN_ESR1_TXWRN_ACCESS                        RW
+#define FLEXCAN_ESR1_STFERR_ACCESS                       RW
+#define FLEXCAN_ESR1_FRMERR_ACCESS                       RW
+#define FLEXCAN_ESR1_CRCERR_ACCESS                       RW
+#define FLEXCAN_ESR1_ACKERR_ACCESS                       RW
+#define FLEXCAN_ESR1_BIT0ERR_ACCESS                      RW
+#define FLEXCAN_ESR1_BIT1ERR_ACCESS                      RW
+#define FLEXCAN_ESR1_RWRNINT_ACCESS                      W1C
+#define FLEXCAN_ESR1_TWRNINT_ACCESS                      W1C
+#define FLEXCAN_ESR1_SYNCH_ACCESS                        RW
+#define FLEXCAN_ESR1_BOFFDONEINT_ACCESS                  W1C
+#define FLEXCAN_ESR1_ERRINT_FAST_ACCESS                  W1C
+#define FLEXCAN_ESR1_ERROVR_ACCESS                       RW
+#define FLEXCAN_ESR1_STFERR_FAST_ACCESS                  RW
+#define FLEXCAN_ESR1_FRMERR_FAST_ACCESS                  RW
+#define FLEXCAN_ESR1_CRCERR_FAST_ACCESS                  RW
+#define FLEXCAN_ESR1_BIT0ERR_FAST_ACCESS                 RW
+#define FLEXCAN_ESR1_BIT1ERR_FAST_ACCESS                 RW
+
+/* FLEXCAN_IMASK1 */
+#define FLEXCAN_IMASK1_W1C_MASK                          (0x0U)
+#define FLEXCAN_IMASK1_BUF15TO0M_ACCESS                  RW
+#define FLEXCAN_IMASK1_BUF31TO0M_ACCESS                  RW
+
+/* FLEXCAN_IFLAG1 */
+#define FLEXCAN_IFLAG1_W1C_MASK                          (0xFFFFFFFFU)
+#define FLEXCAN_IFLAG1_W1C_BASE(reg)                     ((reg) & ~FLEXCAN_IFLAG1_W1C_MASK)
+#define FLEXCAN_IFLAG1_BUF0I_ACCESS                      W1C
+#define FLEXCAN_IFLAG1_BUF4TO1I_ACCESS                   W1C
+#define FLEXCAN_IFLAG1_BUF5I_ACCESS                      W1C
+#define FLEXCAN_IFLAG1_BUF6I_ACCESS                      W1C
+#define FLEXCAN_IFLAG1_BUF7I_ACCESS                      W1C
+#define FLEXCAN_IFLAG1_BUF15TO8I_ACCESS                  RW
+#define FLEXCAN_IFLAG1_BUF31TO8I_ACCESS                  W1C
+
+/* FLEXCAN_CTRL2 */
+#define FLEXCAN_CTRL2_W1C_MASK                           (0x0U)
+#define FLEXCAN_CTRL2_EDFLTDIS_ACCESS                    RW
+#define FLEXCAN_CTRL2_ISOCANFDEN_ACCESS                  RW
+#define FLEXCAN_CTRL2_PREXCEN_ACCESS                     RW
+#define FLEXCAN_CTRL2_TIMER_SRC_ACCESS                   RW
+#define FLEXCAN_CTRL2_EACEN_ACCESS                       RW
+#define FLEXCAN_CTRL2_RRS_ACCESS                         RW
+#define FLEXCAN_CTRL2_MRP_ACCESS                         RW
+#define FLEXCAN_CTRL2_TASD_ACCESS                        RW
+#define FLEXCAN_CTRL2_RFFN_ACCESS                        RW
+#define FLEXCAN_CTRL2_BOFFDONEMSK_ACCESS                 RW
+#define FLEXCAN_CTRL2_ERRMSK_FAST_ACCESS                 RW
+
+/* FLEXCAN_ESR2 */
+#define FLEXCAN_ESR2_W1C_MASK                            (0x0U)
+#define FLEXCAN_ESR2_IMB_ACCESS                          RO
+#define FLEXCAN_ESR2_VPS_ACCESS                          RO
+#define FLEXCAN_ESR2_LPTM_ACCESS                         RO
+
+/* FLEXCAN_CRCR */
+#define FLEXCAN_CRCR_W1C_MASK                            (0x0U)
+#define FLEXCAN_CRCR_TXCRC_ACCESS                        RO
+#define FLEXCAN_CRCR_MBCRC_ACCESS                        RO
+
+/* FLEXCAN_RXFGMASK */
+#define FLEXCAN_RXFGMASK_W1C_MASK                        (0x0U)
+#define FLEXCAN_RXFGMASK_FGM_ACCESS                      RW
+
+/* FLEXCAN_RXFIR */
+#define FLEXCAN_RXFIR_W1C_MASK                           (0x0U)
+#define FLEXCAN_RXFIR_IDHIT_ACCESS                       RO
+
+/* FLEXCAN_CBT */
+#define FLEXCAN_CBT_W1C_MASK                             (0x0U)
+#define FLEXCAN_CBT_EPSEG2_ACCESS                        RW
+#define FLEXCAN_CBT_EPSEG1_ACCESS                        RW
+#define FLEXCAN_CBT_EPROPSEG_ACCESS                      RW
+#define FLEXCAN_CBT_ERJW_ACCESS                          RW
+#define FLEXCAN_CBT_EPRESDIV_ACCESS                      RW
+#define FLEXCAN_CBT_BTF_ACCESS                           RW
+
+/* FLEXCAN_RAMn */
+#define FLEXCAN_RAMn_W1C_MASK                            (0x0U)
+#define FLEXCAN_RAMn_DATA_BYTE_3_ACCESS                  RW
+#define FLEXCAN_RAMn_DATA_BYTE_2_ACCESS                  RW
+#define FLEXCAN_RAMn_DATA_BYTE_1_ACCESS                  RW
+#define FLEXCAN_RAMn_DATA_BYTE_0_ACCESS                  RW
+
+/* FLEXCAN_RXIMR */
+#define FLEXCAN_RXIMR_W1C_MASK                           (0x0U)
+#define FLEXCAN_RXIMR_MI_ACCESS                          RW
+
+/* FLEXCAN_CTRL1_PN */
+#define FLEXCAN_CTRL1_PN_W1C_MASK                        (0x0U)
+#define FLEXCAN_CTRL1_PN_FCS_ACCESS                      RW
+#define FLEXCAN_CTRL1_PN_IDFS_ACCESS                     RW
+#define FLEXCAN_CTRL1_PN_PLFS_ACCESS                     RW
+#define FLEXCAN_CTRL1_PN_NMATCH_ACCESS                   RW
+#define FLEXCAN_CTRL1_PN_WUMF_MSK_ACCESS                 RW
+#define FLEXCAN_CTRL1_PN_WTOF_MSK_ACCESS                 RW
+
+/* FLEXCAN_CTRL2_PN */
+#define FLEXCAN_CTRL2_PN_W1C_MASK                        (0x0U)
+#define FLEXCAN_CTRL2_PN_MATCHTO_ACCESS                  RW
+
+/* FLEXCAN_WU_MTC */
+#define FLEXCAN_WU_MTC_W1C_MASK                          (0x0U)
+#define FLEXCAN_WU_MTC_MCOUNTER_ACCESS                   RW
+#define FLEXCAN_WU_MTC_WUMF_ACCESS                       RW
+#define FLEXCAN_WU_MTC_WTOF_ACCESS                       RW
+
+/* FLEXCAN_FLT_ID1 */
+#define FLEXCAN_FLT_ID1_W1C_MASK                         (0x0U)
+#define FLEXCAN_FLT_ID1_FLT_ID1_ACCESS                   RW
+#define FLEXCAN_FLT_ID1_FLT_RTR_ACCESS                   RW
+#define FLEXCAN_FLT_ID1_FLT_IDE_ACCESS                   RW
+
+/* FLEXCAN_FLT_DLC */
+#define FLEXCAN_FLT_DLC_W1C_MASK                         (0x0U)
+#define FLEXCAN_FLT_DLC_FLT_DLC_HI_ACCESS                RW
+#define FLEXCAN_FLT_DLC_FLT_DLC_LO_ACCESS                RW
+
+/* FLEXCAN_PL1_LO */
+#define FLEXCAN_PL1_LO_W1C_MASK                          (0x0U)
+#define FLEXCAN_PL1_LO_Data_byte_3_ACCESS                RW
+#define FLEXCAN_PL1_LO_Data_byte_2_ACCESS                RW
+#define FLEXCAN_PL1_LO_Data_byte_1_ACCESS                RW
+#define FLEXCAN_PL1_LO_Data_byte_0_ACCESS                RW
+
+/* FLEXCAN_PL1_HI */
+#define FLEXCAN_PL1_HI_W1C_MASK                          (0x0U)
+#define FLEXCAN_PL1_HI_Data_byte_7_ACCESS                RW
+#define FLEXCAN_PL1_HI_Data_byte_6_ACCESS                RW
+#define FLEXCAN_PL1_HI_Data_byte_5_ACCESS                RW
+#define FLEXCAN_PL1_HI_Data_byte_4_ACCESS                RW
+
+/* FLEXCAN_FLT_ID2_IDMASK */
+#define FLEXCAN_FLT_ID2_IDMASK_W1C_MASK                  (0x0U)
+#define FLEXCAN_FLT_ID2_IDMASK_FLT_ID2_IDMASK_ACCESS     RW
+#define FLEXCAN_FLT_ID2_IDMASK_RTR_MSK_ACCESS            RW
+#define FLEXCAN_FLT_ID2_IDMASK_IDE_MSK_ACCESS            RW
+
+/* FLEXCAN_PL2_PLMASK_LO */
+#define FLEXCAN_PL2_PLMASK_LO_W1C_MASK                   (0x0U)
+#define FLEXCAN_PL2_PLMASK_LO_Data_byte_3_ACCESS         RW
+#define FLEXCAN_PL2_PLMASK_LO_Data_byte_2_ACCESS         RW
+#define FLEXCAN_PL2_PLMASK_LO_Data_byte_1_ACCESS         RW
+#define FLEXCAN_PL2_PLMASK_LO_Data_byte_0_ACCESS         RW
+
+/* FLEXCAN_PL2_PLMASK_HI */
+#define FLEXCAN_PL2_PLMASK_HI_W1C_MASK                   (0x0U)
+#define FLEXCAN_PL2_PLMASK_HI_Data_byte_7_ACCESS         RW
+#define FLEXCAN_PL2_PLMASK_HI_Data_byte_6_ACCESS         RW
+#define FLEXCAN_PL2_PLMASK_HI_Data_byte_5_ACCESS         RW
+#define FLEXCAN_PL2_PLMASK_HI_Data_byte_4_ACCESS         RW
+
+/* FLEXCAN_WMBn_CS */
+#define FLEXCAN_WMBn_CS_W1C_MASK                         (0x0U)
+#define FLEXCAN_WMBn_CS_DLC_ACCESS                       RO
+#define FLEXCAN_WMBn_CS_RTR_ACCESS                       RO
+#define FLEXCAN_WMBn_CS_IDE_ACCESS                       RO
+#define FLEXCAN_WMBn_CS_SRR_ACCESS                       RO
+
+/* FLEXCAN_WMBn_ID */
+#define FLEXCAN_WMBn_ID_W1C_MASK                         (0x0U)
+#define FLEXCAN_WMBn_ID_ID_ACCESS                        RO
+
+/* FLEXCAN_WMBn_D03 */
+#define FLEXCAN_WMBn_D03_W1C_MASK                        (0x0U)
+#define FLEXCAN_WMBn_D03_Data_byte_3_ACCESS              RO
+#define FLEXCAN_WMBn_D03_Data_byte_2_ACCESS              RO
+#define FLEXCAN_WMBn_D03_Data_byte_1_ACCESS              RO
+#define FLEXCAN_WMBn_D03_Data_byte_0_ACCESS              RO
+
+/* FLEXCAN_WMBn_D47 */
+#define FLEXCAN_WMBn_D47_W1C_MASK                        (0x0U)
+#define FLEXCAN_WMBn_D47_Data_byte_7_ACCESS              RO
+#define FLEXCAN_WMBn_D47_Data_byte_6_ACCESS              RO
+#define FLEXCAN_WMBn_D47_Data_byte_5_ACCESS              RO
+#define FLEXCAN_WMBn_D47_Data_byte_4_ACCESS              RO
+
+/* FLEXCAN_FDCTRL */
+#define FLEXCAN_FDCTRL_W1C_MASK                          (0x0U)
+#define FLEXCAN_FDCTRL_TDCVAL_ACCESS                     RW
+#define FLEXCAN_FDCTRL_TDCOFF_ACCESS                     RW
+#define FLEXCAN_FDCTRL_TDCFAIL_ACCESS                    RW
+#define FLEXCAN_FDCTRL_TDCEN_ACCESS                      RW
+#define FLEXCAN_FDCTRL_MBDSR0_ACCESS                     RW
+#define FLEXCAN_FDCTRL_FDRATE_ACCESS                     RW
+
+/* FLEXCAN_FDCBT */
+#define FLEXCAN_FDCBT_W1C_MASK                           (0x0U)
+#define FLEXCAN_FDCBT_FPSEG2_ACCESS                      RW
+#define FLEXCAN_FDCBT_FPSEG1_ACCESS                      RW
+#define FLEXCAN_FDCBT_FPROPSEG_ACCESS                    RW
+#define FLEXCAN_FDCBT_FRJW_ACCESS                        RW
+#define FLEXCAN_FDCBT_FPRESDIV_ACCESS                    RW
+
+/* FLEXCAN_FDCRC */
+#define FLEXCAN_FDCRC_W1C_MASK                           (0x0U)
+#define FLEXCAN_FDCRC_FD_TXCRC_ACCESS                    RO
+#define FLEXCAN_FDCRC_FD_MBCRC_ACCESS                    RO
+
+/* FLEXIO_VERID */
+#define FLEXIO_VERID_W1C_MASK                            (0x0U)
+#define FLEXIO_VERID_FEATURE_ACCESS                      RO
+#define FLEXIO_VERID_MINOR_ACCESS                        RO
+#define FLEXIO_VERID_MAJOR_ACCESS                        RO
+
+/* FLEXIO_PARAM */
+#define FLEXIO_PARAM_W1C_MASK                            (0x0U)
+#define FLEXIO_PARAM_SHIFTER_ACCESS                      RO
+#define FLEXIO_PARAM_TIMER_ACCESS                        RO
+#define FLEXIO_PARAM_PIN_ACCESS                          RO
+#define FLEXIO_PARAM_TRIGGER_ACCESS                      RO
+
+/* FLEXIO_CTRL */
+#define FLEXIO_CTRL_W1C_MASK                             (0x0U)
+#define FLEXIO_CTRL_FLEXEN_ACCESS                        RW
+#define FLEXIO_CTRL_SWRST_ACCESS                         RW
+#define FLEXIO_CTRL_FASTACC_ACCESS                       RW
+#define FLEXIO_CTRL_DBGE_ACCESS                          RW
+#define FLEXIO_CTRL_DOZEN_ACCESS                         RW
+
+/* FLEXIO_PIN */
+#define FLEXIO_PIN_W1C_MASK                              (0x0U)
+#define FLEXIO_PIN_PDI_ACCESS                            RO
+
+/* FLEXIO_SHIFTSTAT */
+#define FLEXIO_SHIFTSTAT_W1C_MASK                        (0x0U)
+#define FLEXIO_SHIFTSTAT_SSF_ACCESS                      RW
+
+/* FLEXIO_SHIFTERR */
+#define FLEXIO_SHIFTERR_W1C_MASK                         (0x0U)
+#define FLEXIO_SHIFTERR_SEF_ACCESS                       RW
+
+/* FLEXIO_TIMSTAT */
+#define FLEXIO_TIMSTAT_W1C_MASK                          (0x0U)
+#define FLEXIO_TIMSTAT_TSF_ACCESS                        RW
+
+/* FLEXIO_SHIFTSIEN */
+#define FLEXIO_SHIFTSIEN_W1C_MASK                        (0x0U)
+#define FLEXIO_SHIFTSIEN_SSIE_ACCESS                     RW
+
+/* FLEXIO_SHIFTEIEN */
+#define FLEXIO_SHIFTEIEN_W1C_MASK                        (0x0U)
+#define FLEXIO_SHIFTEIEN_SEIE_ACCESS                     RW
+
+/* FLEXIO_TIMIEN */
+#define FLEXIO_TIMIEN_W1C_MASK                           (0x0U)
+#define FLEXIO_TIMIEN_TEIE_ACCESS                        RW
+
+/* FLEXIO_SHIFTSDEN */
+#define FLEXIO_SHIFTSDEN_W1C_MASK                        (0x0U)
+#define FLEXIO_SHIFTSDEN_SSDE_ACCESS                     RW
+
+/* FLEXIO_SHIFTCTL */
+#define FLEXIO_SHIFTCTL_W1C_MASK                         (0x0U)
+#define FLEXIO_SHIFTCTL_SMOD_ACCESS                      RW
+#define FLEXIO_SHIFTCTL_PINPOL_ACCESS                    RW
+#define FLEXIO_SHIFTCTL_PINSEL_ACCESS                    RW
+#define FLEXIO_SHIFTCTL_PINCFG_ACCESS                    RW
+#define FLEXIO_SHIFTCTL_TIMPOL_ACCESS                    RW
+#define FLEXIO_SHIFTCTL_TIMSEL_ACCESS                    RW
+
+/* FLEXIO_SHIFTCFG */
+#define FLEXIO_SHIFTCFG_W1C_MASK                         (0x0U)
+#define FLEXIO_SHIFTCFG_SSTART_ACCESS                    RW
+#define FLEXIO_SHIFTCFG_SSTOP_ACCESS                     RW
+#define FLEXIO_SHIFTCFG_INSRC_ACCESS                     RW
+
+/* FLEXIO_SHIFTBUF */
+#define FLEXIO_SHIFTBUF_W1C_MASK                         (0x0U)
+#define FLEXIO_SHIFTBUF_SHIFTBUF_ACCESS                  RW
+
+/* FLEXIO_SHIFTBUFBIS */
+#define FLEXIO_SHIFTBUFBIS_W1C_MASK                      (0x0U)
+#define FLEXIO_SHIFTBUFBIS_SHIFTBUFBIS_ACCESS            RW
+
+/* FLEXIO_SHIFTBUFBYS */
+#define FLEXIO_SHIFTBUFBYS_W1C_MASK                      (0x0U)
+#define FLEXIO_SHIFTBUFBYS_SHIFTBUFBYS_ACCESS            RW
+
+/* FLEXIO_SHIFTBUFBBS */
+#define FLEXIO_SHIFTBUFBBS_W1C_MASK                      (0x0U)
+#define FLEXIO_SHIFTBUFBBS_SHIFTBUFBBS_ACCESS            RW
+
+/* FLEXIO_TIMCTL */
+#define FLEXIO_TIMCTL_W1C_MASK                           (0x0U)
+#define FLEXIO_TIMCTL_TIMOD_ACCESS                       RW
+#define FLEXIO_TIMCTL_PINPOL_ACCESS                      RW
+#define FLEXIO_TIMCTL_PINSEL_ACCESS                      RW
+#define FLEXIO_TIMCTL_PINCFG_ACCESS                      RW
+#define FLEXIO_TIMCTL_TRGSRC_ACCESS                      RW
+#define FLEXIO_TIMCTL_TRGPOL_ACCESS                      RW
+#define FLEXIO_TIMCTL_TRGSEL_ACCESS                      RW
+
+/* FLEXIO_TIMCFG */
+#define FLEXIO_TIMCFG_W1C_MASK                           (0x0U)
+#define FLEXIO_TIMCFG_TSTART_ACCESS                      RW
+#define FLEXIO_TIMCFG_TSTOP_ACCESS                       RW
+#define FLEXIO_TIMCFG_TIMENA_ACCESS                      RW
+#define FLEXIO_TIMCFG_TIMDIS_ACCESS                      RW
+#define FLEXIO_TIMCFG_TIMRST_ACCESS                      RW
+#define FLEXIO_TIMCFG_TIMDEC_ACCESS                      RW
+#define FLEXIO_TIMCFG_TIMOUT_ACCESS                      RW
+
+/* FLEXIO_TIMCMP */
+#define FLEXIO_TIMCMP_W1C_MASK                           (0x0U)
+#define FLEXIO_TIMCMP_CMP_ACCESS                         RW
+
+/* FTFC_FSTAT */
+#define FTFC_FSTAT_W1C_MASK                              (0xF0U)
+#define FTFC_FSTAT_W1C_BASE(reg)                         0U
+#define FTFC_FSTAT_MGSTAT0_ACCESS                        RO
+#define FTFC_FSTAT_FPVIOL_ACCESS                         W1C
+#define FTFC_FSTAT_ACCERR_ACCESS                         W1C
+#define FTFC_FSTAT_RDCOLERR_ACCESS                       W1C
+#define FTFC_FSTAT_CCIF_ACCESS                           W1C
+
+/* FTFC_FCNFG */
+#define FTFC_FCNFG_W1C_MASK                              (0x0U)
+#define FTFC_FCNFG_EEERDY_ACCESS                         RO
+#define FTFC_FCNFG_RAMRDY_ACCESS                         RO
+#define FTFC_FCNFG_ERSSUSP_ACCESS                        RW
+#define FTFC_FCNFG_ERSAREQ_ACCESS                        RW
+#define FTFC_FCNFG_RDCOLLIE_ACCESS                       RW
+#define FTFC_FCNFG_CCIE_ACCESS                           RW
+
+/* FTFC_FSEC */
+#define FTFC_FSEC_W1C_MASK                               (0x0U)
+#define FTFC_FSEC_SEC_ACCESS                             RO
+#define FTFC_FSEC_FSLACC_ACCESS                          RO
+#define FTFC_FSEC_MEEN_ACCESS                            RO
+#define FTFC_FSEC_KEYEN_ACCESS                           RO
+
+/* FTFC_FOPT */
+#define FTFC_FOPT_W1C_MASK                               (0x0U)
+#define FTFC_FOPT_OPT_ACCESS                             RO
+
+/* FTFC_FCCOB */
+#define FTFC_FCCOB_W1C_MASK                              (0x0U)
+#define FTFC_FCCOB_CCOBn_ACCESS                          RW
+
+/* FTFC_FPROT */
+#define FTFC_FPROT_W1C_MASK                              (0x0U)
+#define FTFC_FPROT_PROT_ACCESS                           RW
+
+/* FTFC_FEPROT */
+#define FTFC_FEPROT_W1C_MASK                             (0x0U)
+#define FTFC_FEPROT_EPROT_ACCESS                         RW
+
+/* FTFC_FDPROT */
+#define FTFC_FDPROT_W1C_MASK                             (0x0U)
+#define FTFC_FDPROT_DPROT_ACCESS                         RW
+
+/* FTFC_FCSESTAT */
+#define FTFC_FCSESTAT_W1C_MASK                           (0x0U)
+#define FTFC_FCSESTAT_BSY_ACCESS                         RO
+#define FTFC_FCSESTAT_SB_ACCESS                          RO
+#define FTFC_FCSESTAT_BIN_ACCESS                         RO
+#define FTFC_FCSESTAT_BFN_ACCESS                         RO
+#define FTFC_FCSESTAT_BOK_ACCESS                         RO
+#define FTFC_FCSESTAT_RIN_ACCESS                         RO
+#define FTFC_FCSESTAT_EDB_ACCESS                         RO
+#define FTFC_FCSESTAT_IDB_ACCESS                         RO
+
+/* FTFC_FERSTAT */
+#define FTFC_FERSTAT_W1C_MASK                            (0x0U)
+#define FTFC_FERSTAT_DFDIF_ACCESS                        RW
+
+/* FTFC_FERCNFG */
+#define FTFC_FERCNFG_W1C_MASK                            (0x0U)
+#define FTFC_FERCNFG_DFDIE_ACCESS                        RW
+#define FTFC_FERCNFG_FDFD_ACCESS                         RW
+
+/* FTM_SC */
+#define FTM_SC_W1C_MASK                                  (0x0U)
+#define FTM_SC_PS_ACCESS                                 RW
+#define FTM_SC_CLKS_ACCESS                               RW
+#define FTM_SC_CPWMS_ACCESS                              RW
+#define FTM_SC_RIE_ACCESS                                RW
+#define FTM_SC_RF_ACCESS                                 RW
+#define FTM_SC_TOIE_ACCESS                               RW
+#define FTM_SC_TOF_ACCESS                                RW
+#define FTM_SC_PWMEN0_ACCESS                             RW
+#define FTM_SC_PWMEN1_ACCESS                             RW
+#define FTM_SC_PWMEN2_ACCESS                             RW
+#define FTM_SC_PWMEN3_ACCESS                             RW
+#define FTM_SC_PWMEN4_ACCESS                             RW
+#define FTM_SC_PWMEN5_ACCESS                             RW
+#define FTM_SC_PWMEN6_ACCESS                             RW
+#define FTM_SC_PWMEN7_ACCESS                             RW
+#define FTM_SC_FLTPS_ACCESS                              RW
+
+/* FTM_CNT */
+#define FTM_CNT_W1C_MASK                                 (0x0U)
+#define FTM_CNT_COUNT_ACCESS                             RW
+
+/* FTM_MOD */
+#define FTM_MOD_W1C_MASK                                 (0x0U)
+#define FTM_MOD_MOD_ACCESS                               RW
+
+/* FTM_CnSC */
+#define FTM_CnSC_W1C_MASK                                (0x0U)
+#define FTM_CnSC_DMA_ACCESS                              RW
+#define FTM_CnSC_ICRST_ACCESS                            RW
+#define FTM_CnSC_ELSA_ACCESS                             RW
+#define FTM_CnSC_ELSB_ACCESS                             RW
+#define FTM_CnSC_MSA_ACCESS                              RW
+#define FTM_CnSC_MSB_ACCESS                              RW
+#define FTM_CnSC_CHIE_ACCESS                             RW
+#define FTM_CnSC_CHF_ACCESS                              RW
+#define FTM_CnSC_TRIGMODE_ACCESS                         RW
+#define FTM_CnSC_CHIS_ACCESS                             RW
+#define FTM_CnSC_CHOV_ACCESS                             RW
+
+/* FTM_CnV */
+#define FTM_CnV_W1C_MASK                                 (0x0U)
+#define FTM_CnV_VAL_ACCESS                               RW
+
+/* FTM_CNTIN */
+#define FTM_CNTIN_W1C_MASK                               (0x0U)
+#define FTM_CNTIN_INIT_ACCESS                            RW
+
+/* FTM_STATUS */
+#define FTM_STATUS_W1C_MASK                              (0x0U)
+#define FTM_STATUS_CH0F_ACCESS                           RW
+#define FTM_STATUS_CH1F_ACCESS                           RW
+#define FTM_STATUS_CH2F_ACCESS                           RW
+#define FTM_STATUS_CH3F_ACCESS                           RW
+#define FTM_STATUS_CH4F_ACCESS                           RW
+#define FTM_STATUS_CH5F_ACCESS                           RW
+#define FTM_STATUS_CH6F_ACCESS                           RW
+#define FTM_STATUS_CH7F_ACCESS                           RW
+
+/* FTM_MODE */
+#define FTM_MODE_W1C_MASK                                (0x0U)
+#define FTM_MODE_FTMEN_ACCESS                            RW
+#define FTM_MODE_INIT_ACCESS                             RW
+#define FTM_MODE_WPDIS_ACCESS                            RW
+#define FTM_MODE_PWMSYNC_ACCESS                          RW
+#define FTM_MODE_CAPTEST_ACCESS                          RW
+#define FTM_MODE_FAULTM_ACCESS                           RW
+#define FTM_MODE_FAULTIE_ACCESS                          RW
+
+/* FTM_SYNC */
+#define FTM_SYNC_W1C_MASK                                (0x0U)
+#define FTM_SYNC_CNTMIN_ACCESS                           RW
+#define FTM_SYNC_CNTMAX_ACCESS                           RW
+#define FTM_SYNC_REINIT_ACCESS                           RW
+#define FTM_SYNC_SYNCHOM_ACCESS                          RW
+#define FTM_SYNC_TRIG0_ACCESS                            RW
+#define FTM_SYNC_TRIG1_ACCESS                            RW
+#define FTM_SYNC_TRIG2_ACCESS                            RW
+#define FTM_SYNC_SWSYNC_ACCESS                           RW
+
+/* FTM_OUTINIT */
+#define FTM_OUTINIT_W1C_MASK                             (0x0U)
+#define FTM_OUTINIT_CH0OI_ACCESS                         RW
+#define FTM_OUTINIT_CH1OI_ACCESS                         RW
+#define FTM_OUTINIT_CH2OI_ACCESS                         RW
+#define FTM_OUTINIT_CH3OI_ACCESS                         RW
+#define FTM_OUTINIT_CH4OI_ACCESS                         RW
+#define FTM_OUTINIT_CH5OI_ACCESS                         RW
+#define FTM_OUTINIT_CH6OI_ACCESS                         RW
+#define FTM_OUTINIT_CH7OI_ACCESS                         RW
+
+/* FTM_OUTMASK */
+#define FTM_OUTMASK_W1C_MASK                             (0x0U)
+#define FTM_OUTMASK_CH0OM_ACCESS                         RW
+#define FTM_OUTMASK_CH1OM_ACCESS                         RW
+#define FTM_OUTMASK_CH2OM_ACCESS                         RW
+#define FTM_OUTMASK_CH3OM_ACCESS                         RW
+#define FTM_OUTMASK_CH4OM_ACCESS                         RW
+#define FTM_OUTMASK_CH5OM_ACCESS                         RW
+#define FTM_OUTMASK_CH6OM_ACCESS                         RW
+#define FTM_OUTMASK_CH7OM_ACCESS                         RW
+
+/* FTM_COMBINE */
+#define FTM_COMBINE_W1C_MASK                             (0x0U)
+#define FTM_COMBINE_COMBINE0_ACCESS                      RW
+#define FTM_COMBINE_COMP0_ACCESS                         RW
+#define FTM_COMBINE_DECAPEN0_ACCESS                      RW
+#define FTM_COMBINE_DECAP0_ACCESS                        RW
+#define FTM_COMBINE_DTEN0_ACCESS                         RW
+#define FTM_COMBINE_SYNCEN0_ACCESS                       RW
+#define FTM_COMBINE_FAULTEN0_ACCESS                      RW
+#define FTM_COMBINE_MCOMBINE0_ACCESS                     RW
+#define FTM_COMBINE_COMBINE1_ACCESS                      RW
+#define FTM_COMBINE_COMP1_ACCESS                         RW
+#define FTM_COMBINE_DECAPEN1_ACCESS                      RW
+#define FTM_COMBINE_DECAP1_ACCESS                        RW
+#define FTM_COMBINE_DTEN1_ACCESS                         RW
+#define FTM_COMBINE_SYNCEN1_ACCESS                       RW
+#define FTM_COMBINE_FAULTEN1_ACCESS                      RW
+#define FTM_COMBINE_MCOMBINE1_ACCESS                     RW
+#define FTM_COMBINE_COMBINE2_ACCESS                      RW
+#define FTM_COMBINE_COMP2_ACCESS                         RW
+#define FTM_COMBINE_DECAPEN2_ACCESS                      RW
+#define FTM_COMBINE_DECAP2_ACCESS                        RW
+#define FTM_COMBINE_DTEN2_ACCESS                         RW
+#define FTM_COMBINE_SYNCEN2_ACCESS                       RW
+#define FTM_COMBINE_FAULTEN2_ACCESS                      RW
+#define FTM_COMBINE_MCOMBINE2_ACCESS                     RW
+#define FTM_COMBINE_COMBINE3_ACCESS                      RW
+#define FTM_COMBINE_COMP3_ACCESS                         RW
+#define FTM_COMBINE_DECAPEN3_ACCESS                      RW
+#define FTM_COMBINE_DECAP3_ACCESS                        RW
+#define FTM_COMBINE_DTEN3_ACCESS                         RW
+#define FTM_COMBINE_SYNCEN3_ACCESS                       RW
+#define FTM_COMBINE_FAULTEN3_ACCESS                      RW
+#define FTM_COMBINE_MCOMBINE3_ACCESS                     RW
+
+/* FTM_DEADTIME */
+#define FTM_DEADTIME_W1C_MASK                            (0x0U)
+#define FTM_DEADTIME_DTVAL_ACCESS                        RW
+#define FTM_DEADTIME_DTPS_ACCESS                         RW
+#define FTM_DEADTIME_DTVALEX_ACCESS                      RW
+
+/* FTM_EXTTRIG */
+#define FTM_EXTTRIG_W1C_MASK                             (0x0U)
+#define FTM_EXTTRIG_CH2TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_CH3TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_CH4TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_CH5TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_CH0TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_CH1TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_INITTRIGEN_ACCESS                    RW
+#define FTM_EXTTRIG_TRIGF_ACCESS                         RW
+#define FTM_EXTTRIG_CH6TRIG_ACCESS                       RW
+#define FTM_EXTTRIG_CH7TRIG_ACCESS                       RW
+
+/* FTM_POL */
+#define FTM_POL_W1C_MASK                                 (0x0U)
+#define FTM_POL_POL0_ACCESS                              RW
+#define FTM_POL_POL1_ACCESS                              RW
+#define FTM_POL_POL2_ACCESS                              RW
+#define FTM_POL_POL3_ACCESS                              RW
+#define FTM_POL_POL4_ACCESS                              RW
+#define FTM_POL_POL5_ACCESS                              RW
+#define FTM_POL_POL6_ACCESS                              RW
+#define FTM_POL_POL7_ACCESS                              RW
+
+/* FTM_FMS */
+#define FTM_FMS_W1C_MASK                                 (0x0U)
+#define FTM_FMS_FAULTF0_ACCESS                           RW
+#define FTM_FMS_FAULTF1_ACCESS                           RW
+#define FTM_FMS_FAULTF2_ACCESS                           RW
+#define FTM_FMS_FAULTF3_ACCESS                           RW
+#define FTM_FMS_FAULTIN_ACCESS                           RW
+#define FTM_FMS_WPEN_ACCESS                              RW
+#define FTM_FMS_FAULTF_ACCESS                            RW
+
+/* FTM_FILTER */
+#define FTM_FILTER_W1C_MASK                              (0x0U)
+#define FTM_FILTER_CH0FVAL_ACCESS                        RW
+#define FTM_FILTER_CH1FVAL_ACCESS                        RW
+#define FTM_FILTER_CH2FVAL_ACCESS                        RW
+#define FTM_FILTER_CH3FVAL_ACCESS                        RW
+
+/* FTM_FLTCTRL */
+#define FTM_FLTCTRL_W1C_MASK                             (0x0U)
+#define FTM_FLTCTRL_FAULT0EN_ACCESS                      RW
+#define FTM_FLTCTRL_FAULT1EN_ACCESS                      RW
+#define FTM_FLTCTRL_FAULT2EN_ACCESS                      RW
+#define FTM_FLTCTRL_FAULT3EN_ACCESS                      RW
+#define FTM_FLTCTRL_FFLTR0EN_ACCESS                      RW
+#define FTM_FLTCTRL_FFLTR1EN_ACCESS                      RW
+#define FTM_FLTCTRL_FFLTR2EN_ACCESS                      RW
+#define FTM_FLTCTRL_FFLTR3EN_ACCESS                      RW
+#define FTM_FLTCTRL_FFVAL_ACCESS                         RW
+#define FTM_FLTCTRL_FSTATE_ACCESS                        RW
+
+/* FTM_QDCTRL */
+#define FTM_QDCTRL_W1C_MASK                              (0x0U)
+#define FTM_QDCTRL_QUADEN_ACCESS                         RW
+#define FTM_QDCTRL_TOFDIR_ACCESS                         RW
+#define FTM_QDCTRL_QUADIR_ACCESS                         RW
+#define FTM_QDCTRL_QUADMODE_ACCESS                       RW
+#define FTM_QDCTRL_PHBPOL_ACCESS                         RW
+#define FTM_QDCTRL_PHAPOL_ACCESS                         RW
+#define FTM_QDCTRL_PHBFLTREN_ACCESS                      RW
+#define FTM_QDCTRL_PHAFLTREN_ACCESS                      RW
+
+/* FTM_CONF */
+#define FTM_CONF_W1C_MASK                                (0x0U)
+#define FTM_CONF_LDFQ_ACCESS                             RW
+#define FTM_CONF_BDMMODE_ACCESS                          RW
+#define FTM_CONF_GTBEEN_ACCESS                           RW
+#define FTM_CONF_GTBEOUT_ACCESS                          RW
+#define FTM_CONF_ITRIGR_ACCESS                           RW
+
+/* FTM_FLTPOL */
+#define FTM_FLTPOL_W1C_MASK                              (0x0U)
+#define FTM_FLTPOL_FLT0POL_ACCESS                        RW
+#define FTM_FLTPOL_FLT1POL_ACCESS                        RW
+#define FTM_FLTPOL_FLT2POL_ACCESS                        RW
+#define FTM_FLTPOL_FLT3POL_ACCESS                        RW
+
+/* FTM_SYNCONF */
+#define FTM_SYNCONF_W1C_MASK                             (0x0U)
+#define FTM_SYNCONF_HWTRIGMODE_ACCESS                    RW
+#define FTM_SYNCONF_CNTINC_ACCESS                        RW
+#define FTM_SYNCONF_INVC_ACCESS                          RW
+#define FTM_SYNCONF_SWOC_ACCESS                          RW
+#define FTM_SYNCONF_SYNCMODE_ACCESS                      RW
+#define FTM_SYNCONF_SWRSTCNT_ACCESS                      RW
+#define FTM_SYNCONF_SWWRBUF_ACCESS                       RW
+#define FTM_SYNCONF_SWOM_ACCESS                          RW
+#define FTM_SYNCONF_SWINVC_ACCESS                        RW
+#define FTM_SYNCONF_SWSOC_ACCESS                         RW
+#define FTM_SYNCONF_HWRSTCNT_ACCESS                      RW
+#define FTM_SYNCONF_HWWRBUF_ACCESS                       RW
+#define FTM_SYNCONF_HWOM_ACCESS                          RW
+#define FTM_SYNCONF_HWINVC_ACCESS                        RW
+#define FTM_SYNCONF_HWSOC_ACCESS                         RW
+
+/* FTM_INVCTRL */
+#define FTM_INVCTRL_W1C_MASK                             (0x0U)
+#define FTM_INVCTRL_INV0EN_ACCESS                        RW
+#define FTM_INVCTRL_INV1EN_ACCESS                        RW
+#define FTM_INVCTRL_INV2EN_ACCESS                        RW
+#define FTM_INVCTRL_INV3EN_ACCESS                        RW
+
+/* FTM_SWOCTRL */
+#define FTM_SWOCTRL_W1C_MASK                             (0x0U)
+#define FTM_SWOCTRL_CH0OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH1OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH2OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH3OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH4OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH5OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH6OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH7OC_ACCESS                         RW
+#define FTM_SWOCTRL_CH0OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH1OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH2OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH3OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH4OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH5OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH6OCV_ACCESS                        RW
+#define FTM_SWOCTRL_CH7OCV_ACCESS                        RW
+
+/* FTM_PWMLOAD */
+#define FTM_PWMLOAD_W1C_MASK                             (0x0U)
+#define FTM_PWMLOAD_CH0SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH1SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH2SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH3SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH4SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH5SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH6SEL_ACCESS                        RW
+#define FTM_PWMLOAD_CH7SEL_ACCESS                        RW
+#define FTM_PWMLOAD_HCSEL_ACCESS                         RW
+#define FTM_PWMLOAD_LDOK_ACCESS                          RW
+#define FTM_PWMLOAD_GLEN_ACCESS                          RW
+#define FTM_PWMLOAD_GLDOK_ACCESS                         RW
+
+/* FTM_HCR */
+#define FTM_HCR_W1C_MASK                                 (0x0U)
+#define FTM_HCR_HCVAL_ACCESS                             RW
+
+/* FTM_PAIR0DEADTIME */
+#define FTM_PAIR0DEADTIME_W1C_MASK                       (0x0U)
+#define FTM_PAIR0DEADTIME_DTVAL_ACCESS                   RW
+#define FTM_PAIR0DEADTIME_DTPS_ACCESS                    RW
+#define FTM_PAIR0DEADTIME_DTVALEX_ACCESS                 RW
+
+/* FTM_PAIR1DEADTIME */
+#define FTM_PAIR1DEADTIME_W1C_MASK                       (0x0U)
+#define FTM_PAIR1DEADTIME_DTVAL_ACCESS                   RW
+#define FTM_PAIR1DEADTIME_DTPS_ACCESS                    RW
+#define FTM_PAIR1DEADTIME_DTVALEX_ACCESS                 RW
+
+/* FTM_PAIR2DEADTIME */
+#define FTM_PAIR2DEADTIME_W1C_MASK                       (0x0U)
+#define FTM_PAIR2DEADTIME_DTVAL_ACCESS                   RW
+#define FTM_PAIR2DEADTIME_DTPS_ACCESS                    RW
+#define FTM_PAIR2DEADTIME_DTVALEX_ACCESS                 RW
+
+/* FTM_PAIR3DEADTIME */
+#define FTM_PAIR3DEADTIME_W1C_MASK                       (0x0U)
+#define FTM_PAIR3DEADTIME_DTVAL_ACCESS                   RW
+#define FTM_PAIR3DEADTIME_DTPS_ACCESS                    RW
+#define FTM_PAIR3DEADTIME_DTVALEX_ACCESS                 RW
+
+/* GPIO_PDOR */
+#define GPIO_PDOR_W1C_MASK                               (0x0U)
+#define GPIO_PDOR_PDO_ACCESS                             RW
+
+/* GPIO_PSOR */
+#define GPIO_PSOR_W1C_MASK                               (0x0U)
+#define GPIO_PSOR_PTSO_ACCESS                            WO
+
+/* GPIO_PCOR */
+#define GPIO_PCOR_W1C_MASK                               (0x0U)
+#define GPIO_PCOR_PTCO_ACCESS                            WO
+
+/* GPIO_PTOR */
+#define GPIO_PTOR_W1C_MASK                               (0x0U)
+#define GPIO_PTOR_PTTO_ACCESS                            WO
+
+/* GPIO_PDIR */
+#define GPIO_PDIR_W1C_MASK                               (0x0U)
+#define GPIO_PDIR_PDI_ACCESS                             RO
+
+/* GPIO_PDDR */
+#define GPIO_PDDR_W1C_MASK                               (0x0U)
+#define GPIO_PDDR_PDD_ACCESS                             RW
+
+/* GPIO_PIDR */
+#define GPIO_PIDR_W1C_MASK                               (0x0U)
+#define GPIO_PIDR_PID_ACCESS                             RW
+
+/* LMEM_PCCCR */
+#define LMEM_PCCCR_W1C_MASK                              (0x0U)
+#define LMEM_PCCCR_ENCACHE_ACCESS                        RW
+#define LMEM_PCCCR_PCCR2_ACCESS                          RW
+#define LMEM_PCCCR_PCCR3_ACCESS                          RW
+#define LMEM_PCCCR_INVW0_ACCESS                          RW
+#define LMEM_PCCCR_PUSHW0_ACCESS                         RW
+#define LMEM_PCCCR_INVW1_ACCESS                          RW
+#define LMEM_PCCCR_PUSHW1_ACCESS                         RW
+#define LMEM_PCCCR_GO_ACCESS                             RW
+
+/* LMEM_PCCLCR */
+#define LMEM_PCCLCR_W1C_MASK                             (0x0U)
+#define LMEM_PCCLCR_LGO_ACCESS                           RW
+#define LMEM_PCCLCR_CACHEADDR_ACCESS                     RW
+#define LMEM_PCCLCR_WSEL_ACCESS                          RW
+#define LMEM_PCCLCR_TDSEL_ACCESS                         RW
+#define LMEM_PCCLCR_LCIVB_ACCESS                         RW
+#define LMEM_PCCLCR_LCIMB_ACCESS                         RW
+#define LMEM_PCCLCR_LCWAY_ACCESS                         RW
+#define LMEM_PCCLCR_LCMD_ACCESS                          RW
+#define LMEM_PCCLCR_LADSEL_ACCESS                        RW
+#define LMEM_PCCLCR_LACC_ACCESS                          RW
+
+/* LMEM_PCCSAR */
+#define LMEM_PCCSAR_W1C_MASK                             (0x0U)
+#define LMEM_PCCSAR_LGO_ACCESS                           RW
+#define LMEM_PCCSAR_PHYADDR_ACCESS                       RW
+
+/* LMEM_PCCCVR */
+#define LMEM_PCCCVR_W1C_MASK                             (0x0U)
+#define LMEM_PCCCVR_DATA_ACCESS                          RW
+
+/* LMEM_PCCRMR */
+#define LMEM_PCCRMR_W1C_MASK                             (0x0U)
+#define LMEM_PCCRMR_R15_ACCESS                           RW
+#define LMEM_PCCRMR_R14_ACCESS                           RW
+#define LMEM_PCCRMR_R13_ACCESS                           RW
+#define LMEM_PCCRMR_R12_ACCESS                           RW
+#define LMEM_PCCRMR_R11_ACCESS                           RW
+#define LMEM_PCCRMR_R10_ACCESS                           RW
+#define LMEM_PCCRMR_R9_ACCESS                            RW
+#define LMEM_PCCRMR_R8_ACCESS                            RW
+#define LMEM_PCCRMR_R7_ACCESS                            RW
+#define LMEM_PCCRMR_R6_ACCESS                            RW
+#define LMEM_PCCRMR_R5_ACCESS                            RW
+#define LMEM_PCCRMR_R4_ACCESS                            RW
+#define LMEM_PCCRMR_R3_ACCESS                            RW
+#define LMEM_PCCRMR_R2_ACCESS                            RW
+#define LMEM_PCCRMR_R1_ACCESS                            RW
+#define LMEM_PCCRMR_R0_ACCESS                            RW
+
+/* LPI2C_VERID */
+#define LPI2C_VERID_W1C_MASK                             (0x0U)
+#define LPI2C_VERID_FEATURE_ACCESS                       RO
+#define LPI2C_VERID_MINOR_ACCESS                         RO
+#define LPI2C_VERID_MAJOR_ACCESS                         RO
+
+/* LPI2C_PARAM */
+#define LPI2C_PARAM_W1C_MASK                             (0x0U)
+#define LPI2C_PARAM_MTXFIFO_ACCESS                       RO
+#define LPI2C_PARAM_MRXFIFO_ACCESS                       RO
+
+/* LPI2C_MCR */
+#define LPI2C_MCR_W1C_MASK                               (0x0U)
+#define LPI2C_MCR_MEN_ACCESS                             RW
+#define LPI2C_MCR_RST_ACCESS                             RW
+#define LPI2C_MCR_DOZEN_ACCESS                           RW
+#define LPI2C_MCR_DBGEN_ACCESS                           RW
+#define LPI2C_MCR_RTF_ACCESS                             RW
+#define LPI2C_MCR_RRF_ACCESS                             RW
+
+/* LPI2C_MSR */
+#define LPI2C_MSR_W1C_MASK                               (0x7F00U)
+#define LPI2C_MSR_W1C_BASE(reg)                          0U
+#define LPI2C_MSR_TDF_ACCESS                             RO
+#define LPI2C_MSR_RDF_ACCESS                             RO
+#define LPI2C_MSR_EPF_ACCESS                             W1C
+#define LPI2C_MSR_SDF_ACCESS                             W1C
+#define LPI2C_MSR_NDF_ACCESS                             W1C
+#define LPI2C_MSR_ALF_ACCESS                             W1C
+#define LPI2C_MSR_FEF_ACCESS                             W1C
+#define LPI2C_MSR_PLTF_ACCESS                            W1C
+#define LPI2C_MSR_DMF_ACCESS                             W1C
+#define LPI2C_MSR_MBF_ACCESS                             RO
+#define LPI2C_MSR_BBF_ACCESS                             RO
+
+/* LPI2C_MIER */
+#define LPI2C_MIER_W1C_MASK                              (0x0U)
+#define LPI2C_MIER_TDIE_ACCESS                           RW
+#define LPI2C_MIER_RDIE_ACCESS                           RW
+#define LPI2C_MIER_EPIE_ACCESS                           RW
+#define LPI2C_MIER_SDIE_ACCESS                           RW
+#define LPI2C_MIER_NDIE_ACCESS                           RW
+#define LPI2C_MIER_ALIE_ACCESS                           RW
+#define LPI2C_MIER_FEIE_ACCESS                           RW
+#define LPI2C_MIER_PLTIE_ACCESS                          RW
+#define LPI2C_MIER_DMIE_ACCESS                           RW
+
+/* LPI2C_MDER */
+#define LPI2C_MDER_W1C_MASK                              (0x0U)
+#define LPI2C_MDER_TDDE_ACCESS                           RW
+#define LPI2C_MDER_RDDE_ACCESS                           RW
+
+/* LPI2C_MCFGR0 */
+#define LPI2C_MCFGR0_W1C_MASK                            (0x0U)
+#define LPI2C_MCFGR0_HREN_ACCESS                         RW
+#define LPI2C_MCFGR0_HRPOL_ACCESS                        RW
+#define LPI2C_MCFGR0_HRSEL_ACCESS                        RW
+#define LPI2C_MCFGR0_CIRFIFO_ACCESS                      RW
+#define LPI2C_MCFGR0_RDMO_ACCESS                         RW
+
+/* LPI2C_MCFGR1 */
+#define LPI2C_MCFGR1_W1C_MASK                            (0x0U)
+#define LPI2C_MCFGR1_PRESCALE_ACCESS                     RW
+#define LPI2C_MCFGR1_AUTOSTOP_ACCESS                     RW
+#define LPI2C_MCFGR1_IGNACK_ACCESS                       RW
+#define LPI2C_MCFGR1_TIMECFG_ACCESS                      RW
+#define LPI2C_MCFGR1_MATCFG_ACCESS                       RW
+#define LPI2C_MCFGR1_PINCFG_ACCESS                       RW
+
+/* LPI2C_MCFGR2 */
+#define LPI2C_MCFGR2_W1C_MASK                            (0x0U)
+#define LPI2C_MCFGR2_BUSIDLE_ACCESS                      RW
+#define LPI2C_MCFGR2_FILTSCL_ACCESS                      RW
+#define LPI2C_MCFGR2_FILTSDA_ACCESS                      RW
+
+/* LPI2C_MCFGR3 */
+#define LPI2C_MCFGR3_W1C_MASK                            (0x0U)
+#define LPI2C_MCFGR3_PINLOW_ACCESS                       RW
+
+/* LPI2C_MDMR */
+#define LPI2C_MDMR_W1C_MASK                              (0x0U)
+#define LPI2C_MDMR_MATCH0_ACCESS                         RW
+#define LPI2C_MDMR_MATCH1_ACCESS                         RW
+
+/* LPI2C_MCCR0 */
+#define LPI2C_MCCR0_W1C_MASK                             (0x0U)
+#define LPI2C_MCCR0_CLKLO_ACCESS                         RW
+#define LPI2C_MCCR0_CLKHI_ACCESS                         RW
+#define LPI2C_MCCR0_SETHOLD_ACCESS                       RW
+#define LPI2C_MCCR0_DATAVD_ACCESS                        RW
+
+/* LPI2C_MCCR1 */
+#define LPI2C_MCCR1_W1C_MASK                             (0x0U)
+#define LPI2C_MCCR1_CLKLO_ACCESS                         RW
+#define LPI2C_MCCR1_CLKHI_ACCESS                         RW
+#define LPI2C_MCCR1_SETHOLD_ACCESS                       RW
+#define LPI2C_MCCR1_DATAVD_ACCESS                        RW
+
+/* LPI2C_MFCR */
+#define LPI2C_MFCR_W1C_MASK                              (0x0U)
+#define LPI2C_MFCR_TXWATER_ACCESS                        RW
+#define LPI2C_MFCR_RXWATER_ACCESS                        RW
+
+/* LPI2C_MFSR */
+#define LPI2C_MFSR_W1C_MASK                              (0x0U)
+#define LPI2C_MFSR_TXCOUNT_ACCESS                        RO
+#define LPI2C_MFSR_RXCOUNT_ACCESS                        RO
+
+/* LPI2C_MTDR */
+#define LPI2C_MTDR_W1C_MASK                              (0x0U)
+#define LPI2C_MTDR_DATA_ACCESS                           WO
+#define LPI2C_MTDR_CMD_ACCESS                            WO
+
+/* LPI2C_MRDR */
+#define LPI2C_MRDR_W1C_MASK                              (0x0U)
+#define LPI2C_MRDR_DATA_ACCESS                           RO
+#define LPI2C_MRDR_RXEMPTY_ACCESS                        RO
+
+/* LPI2C_SCR */
+#define LPI2C_SCR_W1C_MASK                               (0x0U)
+#define LPI2C_SCR_SEN_ACCESS                             RW
+#define LPI2C_SCR_RST_ACCESS                             RW
+#define LPI2C_SCR_FILTEN_ACCESS                          RW
+#define LPI2C_SCR_FILTDZ_ACCESS                          RW
+#define LPI2C_SCR_RTF_ACCESS                             RW
+#define LPI2C_SCR_RRF_ACCESS                             RW
+
+/* LPI2C_SSR */
+#define LPI2C_SSR_W1C_MASK                               (0x0U)
+#define LPI2C_SSR_TDF_ACCESS                             RW
+#define LPI2C_SSR_RDF_ACCESS                             RW
+#define LPI2C_SSR_AVF_ACCESS                             RW
+#define LPI2C_SSR_TAF_ACCESS                             RW
+#define LPI2C_SSR_RSF_ACCESS                             RW
+#define LPI2C_SSR_SDF_ACCESS                             RW
+#define LPI2C_SSR_BEF_ACCESS                             RW
+#define LPI2C_SSR_FEF_ACCESS                             RW
+#define LPI2C_SSR_AM0F_ACCESS                            RW
+#define LPI2C_SSR_AM1F_ACCESS                            RW
+#define LPI2C_SSR_GCF_ACCESS                             RW
+#define LPI2C_SSR_SARF_ACCESS                            RW
+#define LPI2C_SSR_SBF_ACCESS                             RW
+#define LPI2C_SSR_BBF_ACCESS                             RW
+
+/* LPI2C_SIER */
+#define LPI2C_SIER_W1C_MASK                              (0x0U)
+#define LPI2C_SIER_TDIE_ACCESS                           RW
+#define LPI2C_SIER_RDIE_ACCESS                           RW
+#define LPI2C_SIER_AVIE_ACCESS                           RW
+#define LPI2C_SIER_TAIE_ACCESS                           RW
+#define LPI2C_SIER_RSIE_ACCESS                           RW
+#define LPI2C_SIER_SDIE_ACCESS                           RW
+#define LPI2C_SIER_BEIE_ACCESS                           RW
+#define LPI2C_SIER_FEIE_ACCESS                           RW
+#define LPI2C_SIER_AM0IE_ACCESS                          RW
+#define LPI2C_SIER_AM1F_ACCESS                           RW
+#define LPI2C_SIER_GCIE_ACCESS                           RW
+#define LPI2C_SIER_SARIE_ACCESS                          RW
+
+/* LPI2C_SDER */
+#define LPI2C_SDER_W1C_MASK                              (0x0U)
+#define LPI2C_SDER_TDDE_ACCESS                           RW
+#define LPI2C_SDER_RDDE_ACCESS                           RW
+#define LPI2C_SDER_AVDE_ACCESS                           RW
+
+/* LPI2C_SCFGR1 */
+#define LPI2C_SCFGR1_W1C_MASK                            (0x0U)
+#define LPI2C_SCFGR1_ADRSTALL_ACCESS                     RW
+#define LPI2C_SCFGR1_RXSTALL_ACCESS                      RW
+#define LPI2C_SCFGR1_TXDSTALL_ACCESS                     RW
+#define LPI2C_SCFGR1_ACKSTALL_ACCESS                     RW
+#define LPI2C_SCFGR1_GCEN_ACCESS                         RW
+#define LPI2C_SCFGR1_SAEN_ACCESS                         RW
+#define LPI2C_SCFGR1_TXCFG_ACCESS                        RW
+#define LPI2C_SCFGR1_RXCFG_ACCESS                        RW
+#define LPI2C_SCFGR1_IGNACK_ACCESS                       RW
+#define LPI2C_SCFGR1_HSMEN_ACCESS                        RW
+#define LPI2C_SCFGR1_ADDRCFG_ACCESS                      RW
+
+/* LPI2C_SCFGR2 */
+#define LPI2C_SCFGR2_W1C_MASK                            (0x0U)
+#define LPI2C_SCFGR2_CLKHOLD_ACCESS                      RW
+#define LPI2C_SCFGR2_DATAVD_ACCESS                       RW
+#define LPI2C_SCFGR2_FILTSCL_ACCESS                      RW
+#define LPI2C_SCFGR2_FILTSDA_ACCESS                      RW
+
+/* LPI2C_SAMR */
+#define LPI2C_SAMR_W1C_MASK                              (0x0U)
+#define LPI2C_SAMR_ADDR0_ACCESS                          RW
+#define LPI2C_SAMR_ADDR1_ACCESS                          RW
+
+/* LPI2C_SASR */
+#define LPI2C_SASR_W1C_MASK                              (0x0U)
+#define LPI2C_SASR_RADDR_ACCESS                          RO
+#define LPI2C_SASR_ANV_ACCESS                            RO
+
+/* LPI2C_STAR */
+#define LPI2C_STAR_W1C_MASK                              (0x0U)
+#define LPI2C_STAR_TXNACK_ACCESS                         RW
+
+/* LPI2C_STDR */
+#define LPI2C_STDR_W1C_MASK                              (0x0U)
+#define LPI2C_STDR_DATA_ACCESS                           WO
+
+/* LPI2C_SRDR */
+#define LPI2C_SRDR_W1C_MASK                              (0x0U)
+#define LPI2C_SRDR_DATA_ACCESS                           RO
+#define LPI2C_SRDR_RXEMPTY_ACCESS                        RO
+#define LPI2C_SRDR_SOF_ACCESS                            RO
+
+/* LPIT_VERID */
+#define LPIT_VERID_W1C_MASK                              (0x0U)
+#define LPIT_VERID_FEATURE_ACCESS                        RO
+#define LPIT_VERID_MINOR_ACCESS                          RO
+#define LPIT_VERID_MAJOR_ACCESS                          RO
+
+/* LPIT_PARAM */
+#define LPIT_PARAM_W1C_MASK                              (0x0U)
+#define LPIT_PARAM_CHANNEL_ACCESS                        RO
+#define LPIT_PARAM_EXT_TRIG_ACCESS                       RO
+
+/* LPIT_MCR */
+#define LPIT_MCR_W1C_MASK                                (0x0U)
+#define LPIT_MCR_M_CEN_ACCESS                            RW
+#define LPIT_MCR_SW_RST_ACCESS                           RW
+#define LPIT_MCR_DOZE_EN_ACCESS                          RW
+#define LPIT_MCR_DBG_EN_ACCESS                           RW
+
+/* LPIT_MSR */
+#define LPIT_MSR_W1C_MASK                                (0xFU)
+#define LPIT_MSR_W1C_BASE(reg)                           0U
+#define LPIT_MSR_TIF0_ACCESS                             W1C
+#define LPIT_MSR_TIF1_ACCESS                             W1C
+#define LPIT_MSR_TIF2_ACCESS                             W1C
+#define LPIT_MSR_TIF3_ACCESS                             W1C
+
+/* LPIT_MIER */
+#define LPIT_MIER_W1C_MASK                               (0x0U)
+#define LPIT_MIER_TIE0_ACCESS                            RW
+#define LPIT_MIER_TIE1_ACCESS                            RW
+#define LPIT_MIER_TIE2_ACCESS                            RW
+#define LPIT_MIER_TIE3_ACCESS                            RW
+
+/* LPIT_SETTEN */
+#define LPIT_SETTEN_W1C_MASK                             (0x0U)
+#define LPIT_SETTEN_SET_T_EN_0_ACCESS                    RW
+#define LPIT_SETTEN_SET_T_EN_1_ACCESS                    RW
+#define LPIT_SETTEN_SET_T_EN_2_ACCESS                    RW
+#define LPIT_SETTEN_SET_T_EN_3_ACCESS                    RW
+
+/* LPIT_CLRTEN */
+#define LPIT_CLRTEN_W1C_MASK                             (0x0U)
+#define LPIT_CLRTEN_CLR_T_EN_0_ACCESS                    WO
+#define LPIT_CLRTEN_CLR_T_EN_1_ACCESS                    WO
+#define LPIT_CLRTEN_CLR_T_EN_2_ACCESS                    WO
+#define LPIT_CLRTEN_CLR_T_EN_3_ACCESS                    WO
+
+/* LPIT_TMR_TVAL */
+#define LPIT_TMR_TVAL_W1C_MASK                           (0x0U)
+#define LPIT_TMR_TVAL_TMR_VAL_ACCESS                     RW
+
+/* LPIT_TMR_CVAL */
+#define LPIT_TMR_CVAL_W1C_MASK                           (0x0U)
+#define LPIT_TMR_CVAL_TMR_CUR_VAL_ACCESS                 RO
+
+/* LPIT_TMR_TCTRL */
+#define LPIT_TMR_TCTRL_W1C_MASK                          (0x0U)
+#define LPIT_TMR_TCTRL_T_EN_ACCESS                       RW
+#define LPIT_TMR_TCTRL_CHAIN_ACCESS                      RW
+#define LPIT_TMR_TCTRL_MODE_ACCESS                       RW
+#define LPIT_TMR_TCTRL_TSOT_ACCESS                       RW
+#define LPIT_TMR_TCTRL_TSOI_ACCESS                       RW
+#define LPIT_TMR_TCTRL_TROT_ACCESS                       RW
+#define LPIT_TMR_TCTRL_TRG_SRC_ACCESS                    RW
+#define LPIT_TMR_TCTRL_TRG_SEL_ACCESS                    RW
+
+/* LPSPI_VERID */
+#define LPSPI_VERID_W1C_MASK                             (0x0U)
+#define LPSPI_VERID_FEATURE_ACCESS                       RO
+#define LPSPI_VERID_MINOR_ACCESS                         RO
+#define LPSPI_VERID_MAJOR_ACCESS                         RO
+
+/* LPSPI_PARAM */
+#define LPSPI_PARAM_W1C_MASK                             (0x0U)
+#define LPSPI_PARAM_TXFIFO_ACCESS                        RO
+#define LPSPI_PARAM_RXFIFO_ACCESS                        RO
+
+/* LPSPI_CR */
+#define LPSPI_CR_W1C_MASK                                (0x0U)
+#define LPSPI_CR_MEN_ACCESS                              RW
+#define LPSPI_CR_RST_ACCESS                              RW
+#define LPSPI_CR_DOZEN_ACCESS                            RW
+#define LPSPI_CR_DBGEN_ACCESS                            RW
+#define LPSPI_CR_RTF_ACCESS                              RW
+#define LPSPI_CR_RRF_ACCESS                              RW
+
+/* LPSPI_SR */
+#define LPSPI_SR_W1C_MASK                                (0x3F00U)
+#define LPSPI_SR_W1C_BASE(reg)                           0U
+#define LPSPI_SR_TDF_ACCESS                              RO
+#define LPSPI_SR_RDF_ACCESS                              RO
+#define LPSPI_SR_WCF_ACCESS                              W1C
+#define LPSPI_SR_FCF_ACCESS                              W1C
+#define LPSPI_SR_TCF_ACCESS                              W1C
+#define LPSPI_SR_TEF_ACCESS                              W1C
+#define LPSPI_SR_REF_ACCESS                              W1C
+#define LPSPI_SR_DMF_ACCESS                              W1C
+#define LPSPI_SR_MBF_ACCESS                              RO
+
+/* LPSPI_IER */
+#define LPSPI_IER_W1C_MASK                               (0x0U)
+#define LPSPI_IER_TDIE_ACCESS                            RW
+#define LPSPI_IER_RDIE_ACCESS                            RW
+#define LPSPI_IER_WCIE_ACCESS                            RW
+#define LPSPI_IER_FCIE_ACCESS                            RW
+#define LPSPI_IER_TCIE_ACCESS                            RW
+#define LPSPI_IER_TEIE_ACCESS                            RW
+#define LPSPI_IER_REIE_ACCESS                            RW
+#define LPSPI_IER_DMIE_ACCESS                            RW
+
+/* LPSPI_DER */
+#define LPSPI_DER_W1C_MASK                               (0x0U)
+#define LPSPI_DER_TDDE_ACCESS                            RW
+#define LPSPI_DER_RDDE_ACCESS                            RW
+
+/* LPSPI_CFGR0 */
+#define LPSPI_CFGR0_W1C_MASK                             (0x0U)
+#define LPSPI_CFGR0_HREN_ACCESS                          RW
+#define LPSPI_CFGR0_HRPOL_ACCESS                         RW
+#define LPSPI_CFGR0_HRSEL_ACCESS                         RW
+#define LPSPI_CFGR0_CIRFIFO_ACCESS                       RW
+#define LPSPI_CFGR0_RDMO_ACCESS                          RW
+
+/* LPSPI_CFGR1 */
+#define LPSPI_CFGR1_W1C_MASK                             (0x0U)
+#define LPSPI_CFGR1_MASTER_ACCESS                        RW
+#define LPSPI_CFGR1_SAMPLE_ACCESS                        RW
+#define LPSPI_CFGR1_AUTOPCS_ACCESS                       RW
+#define LPSPI_CFGR1_NOSTALL_ACCESS                       RW
+#define LPSPI_CFGR1_PCSPOL_ACCESS                        RW
+#define LPSPI_CFGR1_MATCFG_ACCESS                        RW
+#define LPSPI_CFGR1_PINCFG_ACCESS                        RW
+#define LPSPI_CFGR1_OUTCFG_ACCESS                        RW
+#define LPSPI_CFGR1_PCSCFG_ACCESS                        RW
+
+/* LPSPI_DMR0 */
+#define LPSPI_DMR0_W1C_MASK                              (0x0U)
+#define LPSPI_DMR0_MATCH0_ACCESS                         RW
+
+/* LPSPI_DMR1 */
+#define LPSPI_DMR1_W1C_MASK                              (0x0U)
+#define LPSPI_DMR1_MATCH1_ACCESS                         RW
+
+/* LPSPI_CCR */
+#define LPSPI_CCR_W1C_MASK                               (0x0U)
+#define LPSPI_CCR_SCKDIV_ACCESS                          RW
+#define LPSPI_CCR_DBT_ACCESS                             RW
+#define LPSPI_CCR_PCSSCK_ACCESS                          RW
+#define LPSPI_CCR_SCKPCS_ACCESS                          RW
+
+/* LPSPI_FCR */
+#define LPSPI_FCR_W1C_MASK                               (0x0U)
+#define LPSPI_FCR_TXWATER_ACCESS                         RW
+#define LPSPI_FCR_RXWATER_ACCESS                         RW
+
+/* LPSPI_FSR */
+#define LPSPI_FSR_W1C_MASK                               (0x0U)
+#define LPSPI_FSR_TXCOUNT_ACCESS                         RO
+#define LPSPI_FSR_RXCOUNT_ACCESS                         RO
+
+/* LPSPI_TCR */
+#define LPSPI_TCR_W1C_MASK                               (0x0U)
+#define LPSPI_TCR_FRAMESZ_ACCESS                         RW
+#define LPSPI_TCR_WIDTH_ACCESS                           RW
+#define LPSPI_TCR_TXMSK_ACCESS                           RW
+#define LPSPI_TCR_RXMSK_ACCESS                           RW
+#define LPSPI_TCR_CONTC_ACCESS                           RW
+#define LPSPI_TCR_CONT_ACCESS                            RW
+#define LPSPI_TCR_BYSW_ACCESS                            RW
+#define LPSPI_TCR_LSBF_ACCESS                            RW
+#define LPSPI_TCR_PCS_ACCESS                             RW
+#define LPSPI_TCR_PRESCALE_ACCESS                        RW
+#define LPSPI_TCR_CPHA_ACCESS                            RW
+#define LPSPI_TCR_CPOL_ACCESS                            RW
+
+/* LPSPI_TDR */
+#define LPSPI_TDR_W1C_MASK                               (0x0U)
+#define LPSPI_TDR_DATA_ACCESS                            WO
+
+/* LPSPI_RSR */
+#define LPSPI_RSR_W1C_MASK                               (0x0U)
+#define LPSPI_RSR_SOF_ACCESS                             RO
+#define LPSPI_RSR_RXEMPTY_ACCESS                         RO
+
+/* LPSPI_RDR */
+#define LPSPI_RDR_W1C_MASK                               (0x0U)
+#define LPSPI_RDR_DATA_ACCESS                            RO
+
+/* LPTMR_CSR */
+#define LPTMR_CSR_W1C_MASK                               (0x80U)
+#define LPTMR_CSR_W1C_BASE(reg)                          ((reg) & ~LPTMR_CSR_W1C_MASK)
+#define LPTMR_CSR_TEN_ACCESS                             RW
+#define LPTMR_CSR_TMS_ACCESS                             RW
+#define LPTMR_CSR_TFC_ACCESS                             RW
+#define LPTMR_CSR_TPP_ACCESS                             RW
+#define LPTMR_CSR_TPS_ACCESS                             RW
+#define LPTMR_CSR_TIE_ACCESS                             RW
+#define LPTMR_CSR_TCF_ACCESS                             W1C
+#define LPTMR_CSR_TDRE_ACCESS                            RW
+
+/* LPTMR_PSR */
+#define LPTMR_PSR_W1C_MASK                               (0x0U)
+#define LPTMR_PSR_PCS_ACCESS                             RW
+#define LPTMR_PSR_PBYP_ACCESS                            RW
+#define LPTMR_PSR_PRESCALE_ACCESS                        RW
+
+/* LPTMR_CMR */
+#define LPTMR_CMR_W1C_MASK                               (0x0U)
+#define LPTMR_CMR_COMPARE_ACCESS                         RW
+
+/* LPTMR_CNR */
+#define LPTMR_CNR_W1C_MASK                               (0x0U)
+#define LPTMR_CNR_COUNTER_ACCESS                         RW
+
+/* LPUART_VERID */
+#define LPUART_VERID_W1C_MASK                            (0x0U)
+#define LPUART_VERID_FEATURE_ACCESS                      RO
+#define LPUART_VERID_MINOR_ACCESS                        RO
+#define LPUART_VERID_MAJOR_ACCESS                        RO
+
+/* LPUART_PARAM */
+#define LPUART_PARAM_W1C_MASK                            (0x0U)
+#define LPUART_PARAM_TXFIFO_ACCESS                       RO
+#define LPUART_PARAM_RXFIFO_ACCESS                       RO
+
+/* LPUART_GLOBAL */
+#define LPUART_GLOBAL_W1C_MASK                           (0x0U)
+#define LPUART_GLOBAL_RST_ACCESS                         RW
+
+/* LPUART_PINCFG */
+#define LPUART_PINCFG_W1C_MASK                           (0x0U)
+#define LPUART_PINCFG_TRGSEL_ACCESS                      RW
+
+/* LPUART_BAUD */
+#define LPUART_BAUD_W1C_MASK                             (0x0U)
+#define LPUART_BAUD_SBR_ACCESS                           RW
+#define LPUART_BAUD_SBNS_ACCESS                          RW
+#define LPUART_BAUD_RXEDGIE_ACCESS                       RW
+#define LPUART_BAUD_LBKDIE_ACCESS                        RW
+#define LPUART_BAUD_RESYNCDIS_ACCESS                     RW
+#define LPUART_BAUD_BOTHEDGE_ACCESS                      RW
+#define LPUART_BAUD_MATCFG_ACCESS                        RW
+#define LPUART_BAUD_RIDMAE_ACCESS                        RW
+#define LPUART_BAUD_RDMAE_ACCESS                         RW
+#define LPUART_BAUD_TDMAE_ACCESS                         RW
+#define LPUART_BAUD_OSR_ACCESS                           RW
+#define LPUART_BAUD_M10_ACCESS                           RW
+#define LPUART_BAUD_MAEN2_ACCESS                         RW
+#define LPUART_BAUD_MAEN1_ACCESS                         RW
+
+/* LPUART_STAT */
+#define LPUART_STAT_W1C_MASK                             (0xC01FC000U)
+#define LPUART_STAT_W1C_BASE(reg)                        ((reg) & ~LPUART_STAT_W1C_MASK)
+#define LPUART_STAT_MA2F_ACCESS                          W1C
+#define LPUART_STAT_MA1F_ACCESS                          W1C
+#define LPUART_STAT_PF_ACCESS                            W1C
+#define LPUART_STAT_FE_ACCESS                            W1C
+#define LPUART_STAT_NF_ACCESS                            W1C
+#define LPUART_STAT_OR_ACCESS                            W1C
+#define LPUART_STAT_IDLE_ACCESS                          W1C
+#define LPUART_STAT_RDRF_ACCESS                          RO
+#define LPUART_STAT_TC_ACCESS                            RO
+#define LPUART_STAT_TDRE_ACCESS                          RO
+#define LPUART_STAT_RAF_ACCESS                           RO
+#define LPUART_STAT_LBKDE_ACCESS                         RW
+#define LPUART_STAT_BRK13_ACCESS                         RW
+#define LPUART_STAT_RWUID_ACCESS                         RW
+#define LPUART_STAT_RXINV_ACCESS                         RW
+#define LPUART_STAT_MSBF_ACCESS                          RW
+#define LPUART_STAT_RXEDGIF_ACCESS                       W1C
+#define LPUART_STAT_LBKDIF_ACCESS                        W1C
+
+/* LPUART_CTRL */
+#define LPUART_CTRL_W1C_MASK                             (0x0U)
+#define LPUART_CTRL_PT_ACCESS                            RW
+#define LPUART_CTRL_PE_ACCESS                            RW
+#define LPUART_CTRL_ILT_ACCESS                           RW
+#define LPUART_CTRL_WAKE_ACCESS                          RW
+#define LPUART_CTRL_M_ACCESS                             RW
+#define LPUART_CTRL_RSRC_ACCESS                          RW
+#define LPUART_CTRL_DOZEEN_ACCESS                        RW
+#define LPUART_CTRL_LOOPS_ACCESS                         RW
+#define LPUART_CTRL_IDLECFG_ACCESS                       RW
+#define LPUART_CTRL_M7_ACCESS                            RW
+#define LPUART_CTRL_MA2IE_ACCESS                         RW
+#define LPUART_CTRL_MA1IE_ACCESS                         RW
+#define LPUART_CTRL_SBK_ACCESS                           RW
+#define LPUART_CTRL_RWU_ACCESS                           RW
+#define LPUART_CTRL_RE_ACCESS                            RW
+#define LPUART_CTRL_TE_ACCESS                            RW
+#define LPUART_CTRL_ILIE_ACCESS                          RW
+#define LPUART_CTRL_RIE_ACCESS                           RW
+#define LPUART_CTRL_TCIE_ACCESS                          RW
+#define LPUART_CTRL_TIE_ACCESS                           RW
+#define LPUART_CTRL_PEIE_ACCESS                          RW
+#define LPUART_CTRL_FEIE_ACCESS                          RW
+#define LPUART_CTRL_NEIE_ACCESS                          RW
+#define LPUART_CTRL_ORIE_ACCESS                          RW
+#define LPUART_CTRL_TXINV_ACCESS                         RW
+#define LPUART_CTRL_TXDIR_ACCESS                         RW
+#define LPUART_CTRL_R9T8_ACCESS                          RW
+#define LPUART_CTRL_R8T9_ACCESS                          RW
+
+/* LPUART_DATA */
+#define LPUART_DATA_W1C_MASK                             (0x0U)
+#define LPUART_DATA_R0T0_ACCESS                          RW
+#define LPUART_DATA_R1T1_ACCESS                          RW
+#define LPUART_DATA_R2T2_ACCESS                          RW
+#define LPUART_DATA_R3T3_ACCESS                          RW
+#define LPUART_DATA_R4T4_ACCESS                          RW
+#define LPUART_DATA_R5T5_ACCESS                          RW
+#define LPUART_DATA_R6T6_ACCESS                          RW
+#define LPUART_DATA_R7T7_ACCESS                          RW
+#define LPUART_DATA_R8T8_ACCESS                          RW
+#define LPUART_DATA_R9T9_ACCESS                          RW
+#define LPUART_DATA_IDLINE_ACCESS                        RW
+#define LPUART_DATA_RXEMPT_ACCESS                        RW
+#define LPUART_DATA_FRETSC_ACCESS                        RW
+#define LPUART_DATA_PARITYE_ACCESS                       RW
+#define LPUART_DATA_NOISY_ACCESS                         RW
+
+/* LPUART_MATCH */
+#define LPUART_MATCH_W1C_MASK                            (0x0U)
+#define LPUART_MATCH_MA1_ACCESS                          RW
+#define LPUART_MATCH_MA2_ACCESS                          RW
+
+/* LPUART_MODIR */
+#define LPUART_MODIR_W1C_MASK                            (0x0U)
+#define LPUART_MODIR_TXCTSE_ACCESS                       RW
+#define LPUART_MODIR_TXRTSE_ACCESS                       RW
+#define LPUART_MODIR_TXRTSPOL_ACCESS                     RW
+#define LPUART_MODIR_RXRTSE_ACCESS                       RW
+#define LPUART_MODIR_TXCTSC_ACCESS                       RW
+#define LPUART_MODIR_TXCTSSRC_ACCESS                     RW
+#define LPUART_MODIR_RTSWATER_ACCESS                     RW
+#define LPUART_MODIR_TNP_ACCESS                          RW
+#define LPUART_MODIR_IREN_ACCESS                         RW
+
+/* LPUART_FIFO */
+#define LPUART_FIFO_W1C_MASK                             (0x0U)
+#define LPUART_FIFO_RXFIFOSIZE_ACCESS                    RW
+#define LPUART_FIFO_RXFE_ACCESS                          RW
+#define LPUART_FIFO_TXFIFOSIZE_ACCESS                    RW
+#define LPUART_FIFO_TXFE_ACCESS                          RW
+#define LPUART_FIFO_RXUFE_ACCESS                         RW
+#define LPUART_FIFO_TXOFE_ACCESS                         RW
+#define LPUART_FIFO_RXIDEN_ACCESS                        RW
+#define LPUART_FIFO_RXFLUSH_ACCESS                       RW
+#define LPUART_FIFO_TXFLUSH_ACCESS                       RW
+#define LPUART_FIFO_RXUF_ACCESS                          RW
+#define LPUART_FIFO_TXOF_ACCESS                          RW
+#define LPUART_FIFO_RXEMPT_ACCESS                        RW
+#define LPUART_FIFO_TXEMPT_ACCESS                        RW
+
+/* LPUART_WATER */
+#define LPUART_WATER_W1C_MASK                            (0x0U)
+#define LPUART_WATER_TXWATER_ACCESS                      RW
+#define LPUART_WATER_TXCOUNT_ACCESS                      RW
+#define LPUART_WATER_RXWATER_ACCESS                      RW
+#define LPUART_WATER_RXCOUNT_ACCESS                      RW
+
+/* MCM_PLASC */
+#define MCM_PLASC_W1C_MASK                               (0x0U)
+#define MCM_PLASC_ASC_ACCESS                             RO
+
+/* MCM_PLAMC */
+#define MCM_PLAMC_W1C_MASK                               (0x0U)
+#define MCM_PLAMC_AMC_ACCESS                             RO
+
+/* MCM_CPCR */
+#define MCM_CPCR_W1C_MASK                                (0x0U)
+#define MCM_CPCR_HLT_FSM_ST_ACCESS                       RW
+#define MCM_CPCR_AXBS_HLT_REQ_ACCESS                     RW
+#define MCM_CPCR_AXBS_HLTD_ACCESS                        RW
+#define MCM_CPCR_FMC_PF_IDLE_ACCESS                      RW
+#define MCM_CPCR_PBRIDGE_IDLE_ACCESS                     RW
+#define MCM_CPCR_CBRR_ACCESS                             RW
+#define MCM_CPCR_SRAMUAP_ACCESS                          RW
+#define MCM_CPCR_SRAMUWP_ACCESS                          RW
+#define MCM_CPCR_SRAMLAP_ACCESS                          RW
+#define MCM_CPCR_SRAMLWP_ACCESS                          RW
+
+/* MCM_ISCR */
+#define MCM_ISCR_W1C_MASK                                (0x0U)
+#define MCM_ISCR_FIOC_ACCESS                             RW
+#define MCM_ISCR_FDZC_ACCESS                             RW
+#define MCM_ISCR_FOFC_ACCESS                             RW
+#define MCM_ISCR_FUFC_ACCESS                             RW
+#define MCM_ISCR_FIXC_ACCESS                             RW
+#define MCM_ISCR_FIDC_ACCESS                             RW
+#define MCM_ISCR_FIOCE_ACCESS                            RW
+#define MCM_ISCR_FDZCE_ACCESS                            RW
+#define MCM_ISCR_FOFCE_ACCESS                            RW
+#define MCM_ISCR_FUFCE_ACCESS                            RW
+#define MCM_ISCR_FIXCE_ACCESS                            RW
+#define MCM_ISCR_FIDCE_ACCESS                            RW
+
+/* MCM_PID */
+#define MCM_PID_W1C_MASK                                 (0x0U)
+#define MCM_PID_PID_ACCESS                               RW
+
+/* MCM_CPO */
+#define MCM_CPO_W1C_MASK                                 (0x0U)
+#define MCM_CPO_CPOREQ_ACCESS                            RW
+#define MCM_CPO_CPOACK_ACCESS                            RW
+#define MCM_CPO_CPOWOI_ACCESS                            RW
+
+/* MCM_LMDR */
+#define MCM_LMDR_W1C_MASK                                (0x0U)
+#define MCM_LMDR_CF0_ACCESS                              RW
+#define MCM_LMDR_MT_ACCESS                               RW
+#define MCM_LMDR_LOCK_ACCESS                             RW
+#define MCM_LMDR_DPW_ACCESS                              RW
+#define MCM_LMDR_WY_ACCESS                               RW
+#define MCM_LMDR_LMSZ_ACCESS                             RW
+#define MCM_LMDR_LMSZH_ACCESS                            RW
+#define MCM_LMDR_V_ACCESS                                RW
+
+/* MCM_LMDR2 */
+#define MCM_LMDR2_W1C_MASK                               (0x0U)
+#define MCM_LMDR2_CF1_ACCESS                             RW
+#define MCM_LMDR2_MT_ACCESS                              RW
+#define MCM_LMDR2_LOCK_ACCESS                            RW
+#define MCM_LMDR2_DPW_ACCESS                             RW
+#define MCM_LMDR2_WY_ACCESS                              RW
+#define MCM_LMDR2_LMSZ_ACCESS                            RW
+#define MCM_LMDR2_LMSZH_ACCESS                           RW
+#define MCM_LMDR2_V_ACCESS                               RW
+
+/* MCM_LMPECR */
+#define MCM_LMPECR_W1C_MASK                              (0x0U)
+#define MCM_LMPECR_ERNCR_ACCESS                          RW
+#define MCM_LMPECR_ER1BR_ACCESS                          RW
+#define MCM_LMPECR_ECPR_ACCESS                           RW
+
+/* MCM_LMPEIR */
+#define MCM_LMPEIR_W1C_MASK                              (0x0U)
+#define MCM_LMPEIR_ENC_ACCESS                            RW
+#define MCM_LMPEIR_E1B_ACCESS                            RW
+#define MCM_LMPEIR_PE_ACCESS                             RW
+#define MCM_LMPEIR_PEELOC_ACCESS                         RW
+#define MCM_LMPEIR_V_ACCESS                              RW
+
+/* MCM_LMFAR */
+#define MCM_LMFAR_W1C_MASK                               (0x0U)
+#define MCM_LMFAR_EFADD_ACCESS                           RO
+
+/* MCM_LMFATR */
+#define MCM_LMFATR_W1C_MASK                              (0x0U)
+#define MCM_LMFATR_PEFPRT_ACCESS                         RO
+#define MCM_LMFATR_PEFSIZE_ACCESS                        RO
+#define MCM_LMFATR_PEFW_ACCESS                           RO
+#define MCM_LMFATR_PEFMST_ACCESS                         RO
+#define MCM_LMFATR_OVR_ACCESS                            RO
+
+/* MCM_LMFDHR */
+#define MCM_LMFDHR_W1C_MASK                              (0x0U)
+#define MCM_LMFDHR_PEFDH_ACCESS                          RO
+
+/* MCM_LMFDLR */
+#define MCM_LMFDLR_W1C_MASK                              (0x0U)
+#define MCM_LMFDLR_PEFDL_ACCESS                          RO
+
+/* MPU_CESR */
+#define MPU_CESR_W1C_MASK                                (0xF0000000U)
+#define MPU_CESR_W1C_BASE(reg)                           ((reg) & ~MPU_CESR_W1C_MASK)
+#define MPU_CESR_VLD_ACCESS                              RW
+#define MPU_CESR_NRGD_ACCESS                             RO
+#define MPU_CESR_NSP_ACCESS                              RO
+#define MPU_CESR_HRL_ACCESS                              RO
+#define MPU_CESR_SPERR3_ACCESS                           W1C
+#define MPU_CESR_SPERR2_ACCESS                           W1C
+#define MPU_CESR_SPERR1_ACCESS                           W1C
+#define MPU_CESR_SPERR0_ACCESS                           W1C
+
+/* MPU_EAR */
+#define MPU_EAR_W1C_MASK                                 (0x0U)
+#define MPU_EAR_EADDR_ACCESS                             RO
+
+/* MPU_EDR */
+#define MPU_EDR_W1C_MASK                                 (0x0U)
+#define MPU_EDR_ERW_ACCESS                               RO
+#define MPU_EDR_EATTR_ACCESS                             RO
+#define MPU_EDR_EMN_ACCESS                               RO
+#define MPU_EDR_EPID_ACCESS                              RO
+#define MPU_EDR_EACD_ACCESS                              RO
+
+/* MPU_RGD_WORD0 */
+#define MPU_RGD_WORD0_W1C_MASK                           (0x0U)
+#define MPU_RGD_WORD0_SRTADDR_ACCESS                     RW
+
+/* MPU_RGD_WORD1 */
+#define MPU_RGD_WORD1_W1C_MASK                           (0x0U)
+#define MPU_RGD_WORD1_ENDADDR_ACCESS                     RW
+
+/* MPU_RGD_WORD2 */
+#define MPU_RGD_WORD2_W1C_MASK                           (0x0U)
+#define MPU_RGD_WORD2_M0UM_ACCESS                        RW
+#define MPU_RGD_WORD2_M0SM_ACCESS                        RW
+#define MPU_RGD_WORD2_M0PE_ACCESS                        RW
+#define MPU_RGD_WORD2_M1UM_ACCESS                        RW
+#define MPU_RGD_WORD2_M1SM_ACCESS                        RW
+#define MPU_RGD_WORD2_M1PE_ACCESS                        RW
+#define MPU_RGD_WORD2_M2UM_ACCESS                        RW
+#define MPU_RGD_WORD2_M2SM_ACCESS                        RW
+#define MPU_RGD_WORD2_M3UM_ACCESS                        RW
+#define MPU_RGD_WORD2_M3SM_ACCESS                        RW
+#define MPU_RGD_WORD2_M4WE_ACCESS                        RW
+#define MPU_RGD_WORD2_M4RE_ACCESS                        RW
+#define MPU_RGD_WORD2_M5WE_ACCESS                        RW
+#define MPU_RGD_WORD2_M5RE_ACCESS                        RW
+#define MPU_RGD_WORD2_M6WE_ACCESS                        RW
+#define MPU_RGD_WORD2_M6RE_ACCESS                        RW
+#define MPU_RGD_WORD2_M7WE_ACCESS                        RW
+#define MPU_RGD_WORD2_M7RE_ACCESS                        RW
+
+/* MPU_RGD_WORD3 */
+#define MPU_RGD_WORD3_W1C_MASK                           (0x0U)
+#define MPU_RGD_WORD3_VLD_ACCESS                         RW
+#define MPU_RGD_WORD3_PIDMASK_ACCESS                     RW
+#define MPU_RGD_WORD3_PID_ACCESS                         RW
+
+/* MPU_RGDAAC */
+#define MPU_RGDAAC_W1C_MASK                              (0x0U)
+#define MPU_RGDAAC_M0UM_ACCESS                           RW
+#define MPU_RGDAAC_M0SM_ACCESS                           RW
+#define MPU_RGDAAC_M0PE_ACCESS                           RW
+#define MPU_RGDAAC_M1UM_ACCESS                           RW
+#define MPU_RGDAAC_M1SM_ACCESS                           RW
+#define MPU_RGDAAC_M1PE_ACCESS                           RW
+#define MPU_RGDAAC_M2UM_ACCESS                           RW
+#define MPU_RGDAAC_M2SM_ACCESS                           RW
+#define MPU_RGDAAC_M3UM_ACCESS                           RW
+#define MPU_RGDAAC_M3SM_ACCESS                           RW
+#define MPU_RGDAAC_M4WE_ACCESS                           RW
+#define MPU_RGDAAC_M4RE_ACCESS                           RW
+#define MPU_RGDAAC_M5WE_ACCESS                           RW
+#define MPU_RGDAAC_M5RE_ACCESS                           RW
+#define MPU_RGDAAC_M6WE_ACCESS                           RW
+#define MPU_RGDAAC_M6RE_ACCESS                           RW
+#define MPU_RGDAAC_M7WE_ACCESS                           RW
+#define MPU_RGDAAC_M7RE_ACCESS                           RW
+
+/* MSCM_CPxTYPE */
+#define MSCM_CPxTYPE_W1C_MASK                            (0x0U)
+#define MSCM_CPxTYPE_RYPZ_ACCESS                         RO
+#define MSCM_CPxTYPE_PERSONALITY_ACCESS                  RO
+
+/* MSCM_CPxNUM */
+#define MSCM_CPxNUM_W1C_MASK                             (0x0U)
+#define MSCM_CPxNUM_CPN_ACCESS                           RO
+
+/* MSCM_CPxMASTER */
+#define MSCM_CPxMASTER_W1C_MASK                          (0x0U)
+#define MSCM_CPxMASTER_PPMN_ACCESS                       RO
+
+/* MSCM_CPxCOUNT */
+#define MSCM_CPxCOUNT_W1C_MASK                           (0x0U)
+#define MSCM_CPxCOUNT_PCNT_ACCESS                        RO
+
+/* MSCM_CPxCFG0 */
+#define MSCM_CPxCFG0_W1C_MASK                            (0x0U)
+#define MSCM_CPxCFG0_DCWY_ACCESS                         RO
+#define MSCM_CPxCFG0_DCSZ_ACCESS                         RO
+#define MSCM_CPxCFG0_ICWY_ACCESS                         RO
+#define MSCM_CPxCFG0_ICSZ_ACCESS                         RO
+
+/* MSCM_CPxCFG1 */
+#define MSCM_CPxCFG1_W1C_MASK                            (0x0U)
+#define MSCM_CPxCFG1_L2WY_ACCESS                         RO
+#define MSCM_CPxCFG1_L2SZ_ACCESS                         RO
+
+/* MSCM_CPxCFG2 */
+#define MSCM_CPxCFG2_W1C_MASK                            (0x0U)
+#define MSCM_CPxCFG2_TMUSZ_ACCESS                        RO
+#define MSCM_CPxCFG2_TMLSZ_ACCESS                        RO
+
+/* MSCM_CPxCFG3 */
+#define MSCM_CPxCFG3_W1C_MASK                            (0x0U)
+#define MSCM_CPxCFG3_FPU_ACCESS                          RO
+#define MSCM_CPxCFG3_SIMD_ACCESS                         RO
+#define MSCM_CPxCFG3_JAZ_ACCESS                          RO
+#define MSCM_CPxCFG3_MMU_ACCESS                          RO
+#define MSCM_CPxCFG3_TZ_ACCESS                           RO
+#define MSCM_CPxCFG3_CMP_ACCESS                          RO
+#define MSCM_CPxCFG3_BB_ACCESS                           RO
+#define MSCM_CPxCFG3_SBP_ACCESS                          RO
+
+/* MSCM_CP0TYPE */
+#define MSCM_CP0TYPE_W1C_MASK                            (0x0U)
+#define MSCM_CP0TYPE_RYPZ_ACCESS                         RO
+#define MSCM_CP0TYPE_PERSONALITY_ACCESS                  RO
+
+/* MSCM_CP0NUM */
+#define MSCM_CP0NUM_W1C_MASK                             (0x0U)
+#define MSCM_CP0NUM_CPN_ACCESS                           RO
+
+/* MSCM_CP0MASTER */
+#define MSCM_CP0MASTER_W1C_MASK                          (0x0U)
+#define MSCM_CP0MASTER_PPMN_ACCESS                       RO
+
+/* MSCM_CP0COUNT */
+#define MSCM_CP0COUNT_W1C_MASK                           (0x0U)
+#define MSCM_CP0COUNT_PCNT_ACCESS                        RO
+
+/* MSCM_CP0CFG0 */
+#define MSCM_CP0CFG0_W1C_MASK                            (0x0U)
+#define MSCM_CP0CFG0_DCWY_ACCESS                         RO
+#define MSCM_CP0CFG0_DCSZ_ACCESS                         RO
+#define MSCM_CP0CFG0_ICWY_ACCESS                         RO
+#define MSCM_CP0CFG0_ICSZ_ACCESS                         RO
+
+/* MSCM_CP0CFG1 */
+#define MSCM_CP0CFG1_W1C_MASK                            (0x0U)
+#define MSCM_CP0CFG1_L2WY_ACCESS                         RO
+#define MSCM_CP0CFG1_L2SZ_ACCESS                         RO
+
+/* MSCM_CP0CFG2 */
+#define MSCM_CP0CFG2_W1C_MASK                            (0x0U)
+#define MSCM_CP0CFG2_TMUSZ_ACCESS                        RO
+#define MSCM_CP0CFG2_TMLSZ_ACCESS                        RO
+
+/* MSCM_CP0CFG3 */
+#define MSCM_CP0CFG3_W1C_MASK                            (0x0U)
+#define MSCM_CP0CFG3_FPU_ACCESS                          RO
+#define MSCM_CP0CFG3_SIMD_ACCESS                         RO
+#define MSCM_CP0CFG3_JAZ_ACCESS                          RO
+#define MSCM_CP0CFG3_MMU_ACCESS                          RO
+#define MSCM_CP0CFG3_TZ_ACCESS                           RO
+#define MSCM_CP0CFG3_CMP_ACCESS                          RO
+#define MSCM_CP0CFG3_BB_ACCESS                           RO
+#define MSCM_CP0CFG3_SBP_ACCESS                          RO
+
+/* MSCM_OCMDR */
+#define MSCM_OCMDR_W1C_MASK                              (0x0U)
+#define MSCM_OCMDR_OCM1_ACCESS                           RW
+#define MSCM_OCMDR_OCMPU_ACCESS                          RW
+#define MSCM_OCMDR_OCMT_ACCESS                           RW
+#define MSCM_OCMDR_RO_ACCESS                             RW
+#define MSCM_OCMDR_OCMW_ACCESS                           RW
+#define MSCM_OCMDR_OCMSZ_ACCESS                          RW
+#define MSCM_OCMDR_OCMSZH_ACCESS                         RW
+#define MSCM_OCMDR_V_ACCESS                              RW
+
+/* PCC_PCCn */
+#define PCC_PCCn_W1C_MASK                                (0x0U)
+#define PCC_PCCn_PCD_ACCESS                              RW
+#define PCC_PCCn_FRAC_ACCESS                             RW
+#define PCC_PCCn_PCS_ACCESS                              RW
+#define PCC_PCCn_CGC_ACCESS                              RW
+#define PCC_PCCn_PR_ACCESS                               RO
+
+/* PDB_SC */
+#define PDB_SC_W1C_MASK                                  (0x0U)
+#define PDB_SC_LDOK_ACCESS                               RW
+#define PDB_SC_CONT_ACCESS                               RW
+#define PDB_SC_MULT_ACCESS                               RW
+#define PDB_SC_PDBIE_ACCESS                              RW
+#define PDB_SC_PDBIF_ACCESS                              RW
+#define PDB_SC_PDBEN_ACCESS                              RW
+#define PDB_SC_TRGSEL_ACCESS                             RW
+#define PDB_SC_PRESCALER_ACCESS                          RW
+#define PDB_SC_DMAEN_ACCESS                              RW
+#define PDB_SC_SWTRIG_ACCESS                             RW
+#define PDB_SC_PDBEIE_ACCESS                             RW
+#define PDB_SC_LDMOD_ACCESS                              RW
+
+/* PDB_MOD */
+#define PDB_MOD_W1C_MASK                                 (0x0U)
+#define PDB_MOD_MOD_ACCESS                               RW
+
+/* PDB_CNT */
+#define PDB_CNT_W1C_MASK                                 (0x0U)
+#define PDB_CNT_CNT_ACCESS                               RO
+
+/* PDB_IDLY */
+#define PDB_IDLY_W1C_MASK                                (0x0U)
+#define PDB_IDLY_IDLY_ACCESS                             RW
+
+/* PDB_C1 */
+#define PDB_C1_W1C_MASK                                  (0x0U)
+#define PDB_C1_EN_ACCESS                                 RW
+#define PDB_C1_TOS_ACCESS                                RW
+#define PDB_C1_BB_ACCESS                                 RW
+
+/* PDB_S */
+#define PDB_S_W1C_MASK                                   (0x0U)
+#define PDB_S_ERR_ACCESS                                 RW
+#define PDB_S_CF_ACCESS                                  RW
+
+/* PDB_DLY */
+#define PDB_DLY_W1C_MASK                                 (0x0U)
+#define PDB_DLY_DLY_ACCESS                               RW
+
+/* PDB_POEN */
+#define PDB_POEN_W1C_MASK                                (0x0U)
+#define PDB_POEN_POEN_ACCESS                             RW
+
+/* PDB_POnDLY_PODLY */
+#define PDB_POnDLY_PODLY_W1C_MASK                        (0x0U)
+#define PDB_POnDLY_PODLY_DLY2_ACCESS                     RW
+#define PDB_POnDLY_PODLY_DLY1_ACCESS                     RW
+
+/* PDB_POnDLY_ACCESS16BIT_DLY2 */
+#define PDB_POnDLY_ACCESS16BIT_DLY2_W1C_MASK             (0x0U)
+#define PDB_POnDLY_ACCESS16BIT_DLY2_DLY2_ACCESS          RW
+
+/* PDB_POnDLY_ACCESS16BIT_DLY1 */
+#define PDB_POnDLY_ACCESS16BIT_DLY1_W1C_MASK             (0x0U)
+#define PDB_POnDLY_ACCESS16BIT_DLY1_DLY1_ACCESS          RW
+
+/* PMC_LVDSC1 */
+#define PMC_LVDSC1_W1C_MASK                              (0x0U)
+#define PMC_LVDSC1_LVDRE_ACCESS                          RW
+#define PMC_LVDSC1_LVDIE_ACCESS                          RW
+#define PMC_LVDSC1_LVDACK_ACCESS                         WO
+#define PMC_LVDSC1_LVDF_ACCESS                           RO
+
+/* PMC_LVDSC2 */
+#define PMC_LVDSC2_W1C_MASK                              (0x0U)
+#define PMC_LVDSC2_LVWIE_ACCESS                          RW
+#define PMC_LVDSC2_LVWACK_ACCESS                         WO
+#define PMC_LVDSC2_LVWF_ACCESS                           RO
+
+/* PMC_REGSC */
+#define PMC_REGSC_W1C_MASK                               (0x0U)
+#define PMC_REGSC_BIASEN_ACCESS                          RW
+#define PMC_REGSC_CLKBIASDIS_ACCESS                      RW
+#define PMC_REGSC_REGFPM_ACCESS                          RW
+#define PMC_REGSC_LPOSTAT_ACCESS                         RW
+#define PMC_REGSC_LPODIS_ACCESS                          RW
+
+/* PMC_LPOTRIM */
+#define PMC_LPOTRIM_W1C_MASK                             (0x0U)
+#define PMC_LPOTRIM_LPOTRIM_ACCESS                       RW
+
+/* PORT_PCR */
+#define PORT_PCR_W1C_MASK                                (0x1000000U)
+#define PORT_PCR_W1C_BASE(reg)                           ((reg) & ~PORT_PCR_W1C_MASK)
+#define PORT_PCR_PS_ACCESS                               RW
+#define PORT_PCR_PE_ACCESS                               RW
+#define PORT_PCR_PFE_ACCESS                              RW
+#define PORT_PCR_DSE_ACCESS                              RW
+#define PORT_PCR_MUX_ACCESS                              RW
+#define PORT_PCR_LK_ACCESS                               RW
+#define PORT_PCR_IRQC_ACCESS                             RW
+#define PORT_PCR_ISF_ACCESS                              W1C
+
+/* PORT_GPCLR */
+#define PORT_GPCLR_W1C_MASK                              (0x0U)
+#define PORT_GPCLR_GPWD_ACCESS                           WO
+#define PORT_GPCLR_GPWE_ACCESS                           WO
+
+/* PORT_GPCHR */
+#define PORT_GPCHR_W1C_MASK                              (0x0U)
+#define PORT_GPCHR_GPWD_ACCESS                           WO
+#define PORT_GPCHR_GPWE_ACCESS                           WO
+
+/* PORT_GICLR */
+#define PORT_GICLR_W1C_MASK                              (0x0U)
+#define PORT_GICLR_GIWE_ACCESS                           WO
+#define PORT_GICLR_GIWD_ACCESS                           WO
+
+/* PORT_GICHR */
+#define PORT_GICHR_W1C_MASK                              (0x0U)
+#define PORT_GICHR_GIWE_ACCESS                           WO
+#define PORT_GICHR_GIWD_ACCESS                           WO
+
+/* PORT_ISFR */
+#define PORT_ISFR_W1C_MASK                               (0xFFFFFFFFU)
+#define PORT_ISFR_W1C_BASE(reg)                          0U
+#define PORT_ISFR_ISF_ACCESS                             W1C
+
+/* PORT_DFER */
+#define PORT_DFER_W1C_MASK                               (0x0U)
+#define PORT_DFER_DFE_ACCESS                             RW
+
+/* PORT_DFCR */
+#define PORT_DFCR_W1C_MASK                               (0x0U)
+#define PORT_DFCR_CS_ACCESS                              RW
+
+/* PORT_DFWR */
+#define PORT_DFWR_W1C_MASK                               (0x0U)
+#define PORT_DFWR_FILT_ACCESS                            RW
+
+/* RCM_VERID */
+#define RCM_VERID_W1C_MASK                               (0x0U)
+#define RCM_VERID_FEATURE_ACCESS                         RO
+#define RCM_VERID_MINOR_ACCESS                           RO
+#define RCM_VERID_MAJOR_ACCESS                           RO
+
+/* RCM_PARAM */
+#define RCM_PARAM_W1C_MASK                               (0x0U)
+#define RCM_PARAM_EWAKEUP_ACCESS                         RO
+#define RCM_PARAM_ELVD_ACCESS                            RO
+#define RCM_PARAM_ELOC_ACCESS                            RO
+#define RCM_PARAM_ELOL_ACCESS                            RO
+#define RCM_PARAM_ECMU_LOC_ACCESS                        RO
+#define RCM_PARAM_EWDOG_ACCESS                           RO
+#define RCM_PARAM_EPIN_ACCESS                            RO
+#define RCM_PARAM_EPOR_ACCESS                            RO
+#define RCM_PARAM_EJTAG_ACCESS                           RO
+#define RCM_PARAM_ELOCKUP_ACCESS                         RO
+#define RCM_PARAM_ESW_ACCESS                             RO
+#define RCM_PARAM_EMDM_AP_ACCESS                         RO
+#define RCM_PARAM_ESACKERR_ACCESS                        RO
+#define RCM_PARAM_ETAMPER_ACCESS                         RO
+#define RCM_PARAM_ECORE1_ACCESS                          RO
+
+/* RCM_SRS */
+#define RCM_SRS_W1C_MASK                                 (0x0U)
+#define RCM_SRS_LVD_ACCESS                               RO
+#define RCM_SRS_LOC_ACCESS                               RO
+#define RCM_SRS_LOL_ACCESS                               RO
+#define RCM_SRS_WDOG_ACCESS                              RO
+#define RCM_SRS_PIN_ACCESS                               RO
+#define RCM_SRS_POR_ACCESS                               RO
+#define RCM_SRS_JTAG_ACCESS                              RO
+#define RCM_SRS_LOCKUP_ACCESS                            RO
+#define RCM_SRS_SW_ACCESS                                RO
+#define RCM_SRS_MDM_AP_ACCESS                            RO
+#define RCM_SRS_SACKERR_ACCESS                           RO
+
+/* RCM_RPC */
+#define RCM_RPC_W1C_MASK                                 (0x0U)
+#define RCM_RPC_RSTFLTSRW_ACCESS                         RW
+#define RCM_RPC_RSTFLTSS_ACCESS                          RW
+#define RCM_RPC_RSTFLTSEL_ACCESS                         RW
+
+/* RCM_SSRS */
+#define RCM_SSRS_W1C_MASK                                (0x0U)
+#define RCM_SSRS_SLVD_ACCESS                             RW
+#define RCM_SSRS_SLOC_ACCESS                             RW
+#define RCM_SSRS_SLOL_ACCESS                             RW
+#define RCM_SSRS_SWDOG_ACCESS                            RW
+#define RCM_SSRS_SPIN_ACCESS                             RW
+#define RCM_SSRS_SPOR_ACCESS                             RW
+#define RCM_SSRS_SJTAG_ACCESS                            RW
+#define RCM_SSRS_SLOCKUP_ACCESS                          RW
+#define RCM_SSRS_SSW_ACCESS                              RW
+#define RCM_SSRS_SMDM_AP_ACCESS                          RW
+#define RCM_SSRS_SSACKERR_ACCESS                         RW
+
+/* RCM_SRIE */
+#define RCM_SRIE_W1C_MASK                                (0x0U)
+#define RCM_SRIE_DELAY_ACCESS                            RW
+#define RCM_SRIE_LOC_ACCESS                              RW
+#define RCM_SRIE_LOL_ACCESS                              RW
+#define RCM_SRIE_WDOG_ACCESS                             RW
+#define RCM_SRIE_PIN_ACCESS                              RW
+#define RCM_SRIE_GIE_ACCESS                              RW
+#define RCM_SRIE_JTAG_ACCESS                             RW
+#define RCM_SRIE_LOCKUP_ACCESS                           RW
+#define RCM_SRIE_SW_ACCESS                               RW
+#define RCM_SRIE_MDM_AP_ACCESS                           RW
+#define RCM_SRIE_SACKERR_ACCESS                          RW
+
+/* RTC_TSR */
+#define RTC_TSR_W1C_MASK                                 (0x0U)
+#define RTC_TSR_TSR_ACCESS                               RW
+
+/* RTC_TPR */
+#define RTC_TPR_W1C_MASK                                 (0x0U)
+#define RTC_TPR_TPR_ACCESS                               RW
+
+/* RTC_TAR */
+#define RTC_TAR_W1C_MASK                                 (0x0U)
+#define RTC_TAR_TAR_ACCESS                               RW
+
+/* RTC_TCR */
+#define RTC_TCR_W1C_MASK                                 (0x0U)
+#define RTC_TCR_TCR_ACCESS                               RW
+#define RTC_TCR_CIR_ACCESS                               RW
+#define RTC_TCR_TCV_ACCESS                               RW
+#define RTC_TCR_CIC_ACCESS                               RW
+
+/* RTC_CR */
+#define RTC_CR_W1C_MASK                                  (0x0U)
+#define RTC_CR_SWR_ACCESS                                RW
+#define RTC_CR_SUP_ACCESS                                RW
+#define RTC_CR_UM_ACCESS                                 RW
+#define RTC_CR_CPS_ACCESS                                RW
+#define RTC_CR_LPOS_ACCESS                               RW
+#define RTC_CR_CLKO_ACCESS                               RW
+#define RTC_CR_CPE_ACCESS                                RW
+
+/* RTC_SR */
+#define RTC_SR_W1C_MASK                                  (0x0U)
+#define RTC_SR_TIF_ACCESS                                RO
+#define RTC_SR_TOF_ACCESS                                RO
+#define RTC_SR_TAF_ACCESS                                RO
+#define RTC_SR_TCE_ACCESS                                RW
+
+/* RTC_LR */
+#define RTC_LR_W1C_MASK                                  (0x0U)
+#define RTC_LR_TCL_ACCESS                                RW
+#define RTC_LR_CRL_ACCESS                                RW
+#define RTC_LR_SRL_ACCESS                                RW
+#define RTC_LR_LRL_ACCESS                                RW
+
+/* RTC_IER */
+#define RTC_IER_W1C_MASK                                 (0x0U)
+#define RTC_IER_TIIE_ACCESS                              RW
+#define RTC_IER_TOIE_ACCESS                              RW
+#define RTC_IER_TAIE_ACCESS                              RW
+#define RTC_IER_TSIE_ACCESS                              RW
+#define RTC_IER_TSIC_ACCESS                              RW
+
+/* SCG_VERID */
+#define SCG_VERID_W1C_MASK                               (0x0U)
+#define SCG_VERID_VERSION_ACCESS                         RO
+
+/* SCG_PARAM */
+#define SCG_PARAM_W1C_MASK                               (0x0U)
+#define SCG_PARAM_CLKPRES_ACCESS                         RO
+#define SCG_PARAM_DIVPRES_ACCESS                         RO
+
+/* SCG_CSR */
+#define SCG_CSR_W1C_MASK                                 (0x0U)
+#define SCG_CSR_DIVSLOW_ACCESS                           RO
+#define SCG_CSR_DIVBUS_ACCESS                            RO
+#define SCG_CSR_DIVCORE_ACCESS                           RO
+#define SCG_CSR_SCS_ACCESS                               RO
+
+/* SCG_RCCR */
+#define SCG_RCCR_W1C_MASK                                (0x0U)
+#define SCG_RCCR_DIVSLOW_ACCESS                          RW
+#define SCG_RCCR_DIVBUS_ACCESS                           RW
+#define SCG_RCCR_DIVCORE_ACCESS                          RW
+#define SCG_RCCR_SCS_ACCESS                              RW
+
+/* SCG_VCCR */
+#define SCG_VCCR_W1C_MASK                                (0x0U)
+#define SCG_VCCR_DIVSLOW_ACCESS                          RW
+#define SCG_VCCR_DIVBUS_ACCESS                           RW
+#define SCG_VCCR_DIVCORE_ACCESS                          RW
+#define SCG_VCCR_SCS_ACCESS                              RW
+
+/* SCG_HCCR */
+#define SCG_HCCR_W1C_MASK                                (0x0U)
+#define SCG_HCCR_DIVSLOW_ACCESS                          RW
+#define SCG_HCCR_DIVBUS_ACCESS                           RW
+#define SCG_HCCR_DIVCORE_ACCESS                          RW
+#define SCG_HCCR_SCS_ACCESS                              RW
+
+/* SCG_CLKOUTCNFG */
+#define SCG_CLKOUTCNFG_W1C_MASK                          (0x0U)
+#define SCG_CLKOUTCNFG_CLKOUTSEL_ACCESS                  RW
+
+/* SCG_SOSCCSR */
+#define SCG_SOSCCSR_W1C_MASK                             (0x4000000U)
+#define SCG_SOSCCSR_W1C_BASE(reg)                        ((reg) & ~SCG_SOSCCSR_W1C_MASK)
+#define SCG_SOSCCSR_SOSCEN_ACCESS                        RW
+#define SCG_SOSCCSR_SOSCCM_ACCESS                        RW
+#define SCG_SOSCCSR_SOSCCMRE_ACCESS                      RW
+#define SCG_SOSCCSR_LK_ACCESS                            RW
+#define SCG_SOSCCSR_SOSCVLD_ACCESS                       RO
+#define SCG_SOSCCSR_SOSCSEL_ACCESS                       RO
+#define SCG_SOSCCSR_SOSCERR_ACCESS                       W1C
+
+/* SCG_SOSCDIV */
+#define SCG_SOSCDIV_W1C_MASK                             (0x0U)
+#define SCG_SOSCDIV_SOSCDIV1_ACCESS                      RW
+#define SCG_SOSCDIV_SOSCDIV2_ACCESS                      RW
+
+/* SCG_SOSCCFG */
+#define SCG_SOSCCFG_W1C_MASK                             (0x0U)
+#define SCG_SOSCCFG_EREFS_ACCESS                         RW
+#define SCG_SOSCCFG_HGO_ACCESS                           RW
+#define SCG_SOSCCFG_RANGE_ACCESS                         RW
+
+/* SCG_SIRCCSR */
+#define SCG_SIRCCSR_W1C_MASK                             (0x0U)
+#define SCG_SIRCCSR_SIRCEN_ACCESS                        RW
+#define SCG_SIRCCSR_SIRCSTEN_ACCESS                      RW
+#define SCG_SIRCCSR_SIRCLPEN_ACCESS                      RW
+#define SCG_SIRCCSR_LK_ACCESS                            RW
+#define SCG_SIRCCSR_SIRCVLD_ACCESS                       RO
+#define SCG_SIRCCSR_SIRCSEL_ACCESS                       RO
+
+/* SCG_SIRCDIV */
+#define SCG_SIRCDIV_W1C_MASK                             (0x0U)
+#define SCG_SIRCDIV_SIRCDIV1_ACCESS                      RW
+#define SCG_SIRCDIV_SIRCDIV2_ACCESS                      RW
+
+/* SCG_SIRCCFG */
+#define SCG_SIRCCFG_W1C_MASK                             (0x0U)
+#define SCG_SIRCCFG_RANGE_ACCESS                         RW
+
+/* SCG_FIRCCSR */
+#define SCG_FIRCCSR_W1C_MASK                             (0x0U)
+#define SCG_FIRCCSR_FIRCEN_ACCESS                        RW
+#define SCG_FIRCCSR_FIRCREGOFF_ACCESS                    RW
+#define SCG_FIRCCSR_LK_ACCESS                            RW
+#define SCG_FIRCCSR_FIRCVLD_ACCESS                       RO
+#define SCG_FIRCCSR_FIRCSEL_ACCESS                       RO
+
+/* SCG_FIRCDIV */
+#define SCG_FIRCDIV_W1C_MASK                             (0x0U)
+#define SCG_FIRCDIV_FIRCDIV1_ACCESS                      RW
+#define SCG_FIRCDIV_FIRCDIV2_ACCESS                      RW
+
+/* SCG_FIRCCFG */
+#define SCG_FIRCCFG_W1C_MASK                             (0x0U)
+#define SCG_FIRCCFG_RANGE_ACCESS                         RW
+
+/* SCG_SPLLCSR */
+#define SCG_SPLLCSR_W1C_MASK                             (0x4000000U)
+#define SCG_SPLLCSR_W1C_BASE(reg)                        ((reg) & ~SCG_SPLLCSR_W1C_MASK)
+#define SCG_SPLLCSR_SPLLEN_ACCESS                        RW
+#define SCG_SPLLCSR_SPLLCM_ACCESS                        RW
+#define SCG_SPLLCSR_SPLLCMRE_ACCESS                      RW
+#define SCG_SPLLCSR_LK_ACCESS                            RW
+#define SCG_SPLLCSR_SPLLVLD_ACCESS                       RO
+#define SCG_SPLLCSR_SPLLSEL_ACCESS                       RO
+#define SCG_SPLLCSR_SPLLERR_ACCESS                       W1C
+
+/* SCG_SPLLDIV */
+#define SCG_SPLLDIV_W1C_MASK                             (0x0U)
+#define SCG_SPLLDIV_SPLLDIV1_ACCESS                      RW
+#define SCG_SPLLDIV_SPLLDIV2_ACCESS                      RW
+
+/* SCG_SPLLCFG */
+#define SCG_SPLLCFG_W1C_MASK                             (0x0U)
+#define SCG_SPLLCFG_PREDIV_ACCESS                        RW
+#define SCG_SPLLCFG_MULT_ACCESS                          RW
+
+/* SIM_CHIPCTL */
+#define SIM_CHIPCTL_W1C_MASK                             (0x0U)
+#define SIM_CHIPCTL_ADC_INTERLEAVE_EN_ACCESS             RW
+#define SIM_CHIPCTL_CLKOUTSEL_ACCESS                     RW
+#define SIM_CHIPCTL_CLKOUTDIV_ACCESS                     RW
+#define SIM_CHIPCTL_CLKOUTEN_ACCESS                      RW
+#define SIM_CHIPCTL_TRACECLK_SEL_ACCESS                  RW
+#define SIM_CHIPCTL_PDB_BB_SEL_ACCESS                    RW
+#define SIM_CHIPCTL_ADC_SUPPLY_ACCESS                    RW
+#define SIM_CHIPCTL_ADC_SUPPLYEN_ACCESS                  RW
+#define SIM_CHIPCTL_SRAMU_RETEN_ACCESS                   RW
+#define SIM_CHIPCTL_SRAML_RETEN_ACCESS                   RW
+
+/* SIM_FTMOPT0 */
+#define SIM_FTMOPT0_W1C_MASK                             (0x0U)
+#define SIM_FTMOPT0_FTM0FLTxSEL_ACCESS                   RW
+#define SIM_FTMOPT0_FTM1FLTxSEL_ACCESS                   RW
+#define SIM_FTMOPT0_FTM2FLTxSEL_ACCESS                   RW
+#define SIM_FTMOPT0_FTM3FLTxSEL_ACCESS                   RW
+#define SIM_FTMOPT0_FTM0CLKSEL_ACCESS                    RW
+#define SIM_FTMOPT0_FTM1CLKSEL_ACCESS                    RW
+#define SIM_FTMOPT0_FTM2CLKSEL_ACCESS                    RW
+#define SIM_FTMOPT0_FTM3CLKSEL_ACCESS                    RW
+
+/* SIM_LPOCLKS */
+#define SIM_LPOCLKS_W1C_MASK                             (0x0U)
+#define SIM_LPOCLKS_LPO1KCLKEN_ACCESS                    RW
+#define SIM_LPOCLKS_LPO32KCLKEN_ACCESS                   RW
+#define SIM_LPOCLKS_LPOCLKSEL_ACCESS                     RW
+#define SIM_LPOCLKS_RTCCLKSEL_ACCESS                     RW
+
+/* SIM_ADCOPT */
+#define SIM_ADCOPT_W1C_MASK                              (0x0U)
+#define SIM_ADCOPT_ADC0TRGSEL_ACCESS                     RW
+#define SIM_ADCOPT_ADC0SWPRETRG_ACCESS                   RW
+#define SIM_ADCOPT_ADC0PRETRGSEL_ACCESS                  RW
+#define SIM_ADCOPT_ADC1TRGSEL_ACCESS                     RW
+#define SIM_ADCOPT_ADC1SWPRETRG_ACCESS                   RW
+#define SIM_ADCOPT_ADC1PRETRGSEL_ACCESS                  RW
+
+/* SIM_FTMOPT1 */
+#define SIM_FTMOPT1_W1C_MASK                             (0x0U)
+#define SIM_FTMOPT1_FTM0SYNCBIT_ACCESS                   RW
+#define SIM_FTMOPT1_FTM1SYNCBIT_ACCESS                   RW
+#define SIM_FTMOPT1_FTM2SYNCBIT_ACCESS                   RW
+#define SIM_FTMOPT1_FTM3SYNCBIT_ACCESS                   RW
+#define SIM_FTMOPT1_FTM1CH0SEL_ACCESS                    RW
+#define SIM_FTMOPT1_FTM2CH0SEL_ACCESS                    RW
+#define SIM_FTMOPT1_FTM2CH1SEL_ACCESS                    RW
+#define SIM_FTMOPT1_FTMGLDOK_ACCESS                      RW
+#define SIM_FTMOPT1_FTM0_OUTSEL_ACCESS                   RW
+#define SIM_FTMOPT1_FTM3_OUTSEL_ACCESS                   RW
+
+/* SIM_MISCTRL0 */
+#define SIM_MISCTRL0_W1C_MASK                            (0x0U)
+#define SIM_MISCTRL0_STOP1_MONITOR_ACCESS                RW
+#define SIM_MISCTRL0_STOP2_MONITOR_ACCESS                RW
+#define SIM_MISCTRL0_FTM0_OBE_CTRL_ACCESS                RW
+#define SIM_MISCTRL0_FTM1_OBE_CTRL_ACCESS                RW
+#define SIM_MISCTRL0_FTM2_OBE_CTRL_ACCESS                RW
+#define SIM_MISCTRL0_FTM3_OBE_CTRL_ACCESS                RW
+
+/* SIM_SDID */
+#define SIM_SDID_W1C_MASK                                (0x0U)
+#define SIM_SDID_FEATURES_ACCESS                         RO
+#define SIM_SDID_PACKAGE_ACCESS                          RO
+#define SIM_SDID_REVID_ACCESS                            RO
+#define SIM_SDID_RAMSIZE_ACCESS                          RO
+#define SIM_SDID_DERIVATE_ACCESS                         RO
+#define SIM_SDID_SUBSERIES_ACCESS                        RO
+#define SIM_SDID_GENERATION_ACCESS                       RO
+
+/* SIM_PLATCGC */
+#define SIM_PLATCGC_W1C_MASK                             (0x0U)
+#define SIM_PLATCGC_CGCMSCM_ACCESS                       RW
+#define SIM_PLATCGC_CGCMPU_ACCESS                        RW
+#define SIM_PLATCGC_CGCDMA_ACCESS                        RW
+#define SIM_PLATCGC_CGCERM_ACCESS                        RW
+#define SIM_PLATCGC_CGCEIM_ACCESS                        RW
+
+/* SIM_FCFG1 */
+#define SIM_FCFG1_W1C_MASK                               (0x0U)
+#define SIM_FCFG1_DEPART_ACCESS                          RO
+#define SIM_FCFG1_EEERAMSIZE_ACCESS                      RO
+
+/* SIM_UIDH */
+#define SIM_UIDH_W1C_MASK                                (0x0U)
+#define SIM_UIDH_UID127_96_ACCESS                        RO
+
+/* SIM_UIDMH */
+#define SIM_UIDMH_W1C_MASK                               (0x0U)
+#define SIM_UIDMH_UID95_64_ACCESS                        RO
+
+/* SIM_UIDML */
+#define SIM_UIDML_W1C_MASK                               (0x0U)
+#define SIM_UIDML_UID63_32_ACCESS                        RO
+
+/* SIM_UIDL */
+#define SIM_UIDL_W1C_MASK                                (0x0U)
+#define SIM_UIDL_UID31_0_ACCESS                          RO
+
+/* SIM_CLKDIV4 */
+#define SIM_CLKDIV4_W1C_MASK                             (0x0U)
+#define SIM_CLKDIV4_TRACEFRAC_ACCESS                     RW
+#define SIM_CLKDIV4_TRACEDIV_ACCESS                      RW
+#define SIM_CLKDIV4_TRACEDIVEN_ACCESS                    RW
+
+/* SIM_MISCTRL1 */
+#define SIM_MISCTRL1_W1C_MASK                            (0x0U)
+#define SIM_MISCTRL1_SW_TRG_ACCESS                       RW
+
+/* SMC_VERID */
+#define SMC_VERID_W1C_MASK                               (0x0U)
+#define SMC_VERID_FEATURE_ACCESS                         RO
+#define SMC_VERID_MINOR_ACCESS                           RO
+#define SMC_VERID_MAJOR_ACCESS                           RO
+
+/* SMC_PARAM */
+#define SMC_PARAM_W1C_MASK                               (0x0U)
+#define SMC_PARAM_EHSRUN_ACCESS                          RO
+#define SMC_PARAM_ELLS_ACCESS                            RO
+#define SMC_PARAM_ELLS2_ACCESS                           RO
+#define SMC_PARAM_EVLLS0_ACCESS                          RO
+
+/* SMC_PMPROT */
+#define SMC_PMPROT_W1C_MASK                              (0x0U)
+#define SMC_PMPROT_AVLP_ACCESS                           RW
+#define SMC_PMPROT_AHSRUN_ACCESS                         RW
+
+/* SMC_PMCTRL */
+#define SMC_PMCTRL_W1C_MASK                              (0x0U)
+#define SMC_PMCTRL_STOPM_ACCESS                          RW
+#define SMC_PMCTRL_VLPSA_ACCESS                          RW
+#define SMC_PMCTRL_RUNM_ACCESS                           RW
+
+/* SMC_STOPCTRL */
+#define SMC_STOPCTRL_W1C_MASK                            (0x0U)
+#define SMC_STOPCTRL_STOPO_ACCESS                        RW
+
+/* SMC_PMSTAT */
+#define SMC_PMSTAT_W1C_MASK                              (0x0U)
+#define SMC_PMSTAT_PMSTAT_ACCESS                         RO
+
+/* TRGMUX_TRGMUXn */
+#define TRGMUX_TRGMUXn_W1C_MASK                          (0x0U)
+#define TRGMUX_TRGMUXn_SEL0_ACCESS                       RW
+#define TRGMUX_TRGMUXn_SEL1_ACCESS                       RW
+#define TRGMUX_TRGMUXn_SEL2_ACCESS                       RW
+#define TRGMUX_TRGMUXn_SEL3_ACCESS                       RW
+#define TRGMUX_TRGMUXn_LK_ACCESS                         RW
+
+/* WDOG_CS */
+#define WDOG_CS_W1C_MASK                                 (0x4000U)
+#define WDOG_CS_W1C_BASE(reg)                            ((reg) & ~WDOG_CS_W1C_MASK)
+#define WDOG_CS_STOP_ACCESS                              RW
+#define WDOG_CS_WAIT_ACCESS                              RW
+#define WDOG_CS_DBG_ACCESS                               RW
+#define WDOG_CS_TST_ACCESS                               RW
+#define WDOG_CS_UPDATE_ACCESS                            RW
+#define WDOG_CS_INT_ACCESS                               RW
+#define WDOG_CS_EN_ACCESS                                RW
+#define WDOG_CS_CLK_ACCESS                               RW
+#define WDOG_CS_RCS_ACCESS                               RO
+#define WDOG_CS_ULK_ACCESS                               RO
+#define WDOG_CS_PRES_ACCESS                              RW
+#define WDOG_CS_CMD32EN_ACCESS                           RW
+#define WDOG_CS_FLG_ACCESS                               W1C
+#define WDOG_CS_WIN_ACCESS                               RW
+
+/* WDOG_CNT */
+#define WDOG_CNT_W1C_MASK                                (0x0U)
+#define WDOG_CNT_CNTLOW_ACCESS                           RW
+#define WDOG_CNT_CNTHIGH_ACCESS                          RW
+
+/* WDOG_TOVAL */
+#define WDOG_TOVAL_W1C_MASK                              (0x0U)
+#define WDOG_TOVAL_TOVALLOW_ACCESS                       RW
+#define WDOG_TOVAL_TOVALHIGH_ACCESS                      RW
+
+/* WDOG_WIN */
+#define WDOG_WIN_W1C_MASK                                (0x0U)
+#define WDOG_WIN_WINLOW_ACCESS                           RW
+#define WDOG_WIN_WINHIGH_ACCESS                          RW
+
+#endif /* S32K144_FIELDS_H_ */
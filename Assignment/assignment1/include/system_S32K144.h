@@ -29,7 +29,7 @@ extern "C" {
  * CPU Settings.
  *****************************************************************************/
 
-/* Watchdog disable */
+/* Watchdog disable: production builds pass -DDISABLE_WDOG=0 and call WDOG_Init() */
 #ifndef DISABLE_WDOG
   #define DISABLE_WDOG                 1
 #endif
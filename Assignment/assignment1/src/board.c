@@ -0,0 +1,109 @@
+/**
+ * @file board.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Pin bring-up of the board described in board.h.
+ * @version 0.1
+ * @date 2025-11-04
+ *
+ * All masks are compile-time constants: ports the map does not use drop out
+ * at preprocessing, each used port gets only the GPCLR/GPCHR/GICLR/GICHR
+ * stores its pins need (the same groups PORT_PlanWrites() finds for
+ * BOARD_PORT_TABLE), and ports without GPIO outputs drop out of
+ * board_gpio_init() entirely. The map is checked when board.h is compiled,
+ * so nothing is validated here at run time.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "board.h"
+#include "../driver/inc/Driver_PCC.h"
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static inline bool board_port_clock(uint32_t port);
+static inline void board_gpio_init(GPIO_Type *gpio, uint32_t out_mask, uint32_t high_mask);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* PCC slots of PORTA..PORTE are consecutive */
+static inline bool board_port_clock(uint32_t port)
+{
+    return PCC_EnableClock((PCC_PERIPHERALS_t)((uint32_t)PCC_PORTA + (4U * port))) == PCC_STATUS_SUCCESS;
+}
+
+static inline void board_gpio_init(GPIO_Type *gpio, uint32_t out_mask, uint32_t high_mask)
+{
+    if (out_mask == 0U)
+    {
+        return;
+    }
+
+    /* Levels before direction, so outputs start at their reset level */
+    gpio->PSOR = high_mask;
+    gpio->PCOR = out_mask & ~high_mask;
+    gpio->PDDR |= out_mask;
+}
+
+PORT_STATUS_t BOARD_InitPins(void)
+{
+    /* Clocks of all used ports first, then pin control before interrupt control */
+#if (BOARD_PORTS_USED & (1UL << PORT_A)) != 0
+    if (!board_port_clock(PORT_A))
+    {
+        return PORT_STATUS_ERROR;
+    }
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_B)) != 0
+    if (!board_port_clock(PORT_B))
+    {
+        return PORT_STATUS_ERROR;
+    }
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_C)) != 0
+    if (!board_port_clock(PORT_C))
+    {
+        return PORT_STATUS_ERROR;
+    }
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_D)) != 0
+    if (!board_port_clock(PORT_D))
+    {
+        return PORT_STATUS_ERROR;
+    }
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_E)) != 0
+    if (!board_port_clock(PORT_E))
+    {
+        return PORT_STATUS_ERROR;
+    }
+#endif
+
+#if (BOARD_PORTS_USED & (1UL << PORT_A)) != 0
+    BOARD_PORT_INIT(PORT_A)
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_B)) != 0
+    BOARD_PORT_INIT(PORT_B)
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_C)) != 0
+    BOARD_PORT_INIT(PORT_C)
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_D)) != 0
+    BOARD_PORT_INIT(PORT_D)
+#endif
+#if (BOARD_PORTS_USED & (1UL << PORT_E)) != 0
+    BOARD_PORT_INIT(PORT_E)
+#endif
+
+    board_gpio_init(IP_PTA, BOARD_GPIO_OUT_MASK(PORT_A), BOARD_GPIO_HIGH_MASK(PORT_A));
+    board_gpio_init(IP_PTB, BOARD_GPIO_OUT_MASK(PORT_B), BOARD_GPIO_HIGH_MASK(PORT_B));
+    board_gpio_init(IP_PTC, BOARD_GPIO_OUT_MASK(PORT_C), BOARD_GPIO_HIGH_MASK(PORT_C));
+    board_gpio_init(IP_PTD, BOARD_GPIO_OUT_MASK(PORT_D), BOARD_GPIO_HIGH_MASK(PORT_D));
+    board_gpio_init(IP_PTE, BOARD_GPIO_OUT_MASK(PORT_E), BOARD_GPIO_HIGH_MASK(PORT_E));
+
+    return PORT_STATUS_SUCCESS;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file board.h
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Pin map of the S32K144EVB as wired in the exercises.
+ * @version 0.1
+ * @date 2025-11-04
+ *
+ * RGB LED on PTD0/PTD15/PTD16 (active low, start off), potentiometer on PTA6,
+ * SW2/SW3 on PTC12/PTC13. See board_pins.h for the fields and for what the
+ * map generates.
+ */
+
+#ifndef BOARD_H_
+#define BOARD_H_
+
+/*     name       port pin  mux     signal    pull  drive filter irqc      dir */
+#define BOARD_PINS(X, a) \
+    X(a, LED_BLUE,  D,  0, GPIO,   PTD0,     NONE, LOW,  false, DISABLED, OUT_HIGH) \
+    X(a, LED_RED,   D, 15, GPIO,   PTD15,    NONE, LOW,  false, DISABLED, OUT_HIGH) \
+    X(a, LED_GREEN, D, 16, GPIO,   PTD16,    NONE, LOW,  false, DISABLED, OUT_HIGH) \
+    X(a, POT,       A,  6, ANALOG, ADC0_SE2, NONE, LOW,  false, DISABLED, NONE)     \
+    X(a, SW2,       C, 12, GPIO,   PTC12,    NONE, LOW,  true,  DISABLED, IN)       \
+    X(a, SW3,       C, 13, GPIO,   PTC13,    NONE, LOW,  true,  DISABLED, IN)
+
+#include "../driver/inc/board_pins.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ *                                      API
+ ******************************************************************************/
+
+/**
+ * @brief Configure every pin of the map: PORT table, then GPIO levels and
+ *        directions.
+ *
+ * @return PORT_STATUS_t SUCCESS, or ERROR if a port clock is missing.
+ */
+PORT_STATUS_t BOARD_InitPins(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOARD_H_ */
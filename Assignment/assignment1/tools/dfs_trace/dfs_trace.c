@@ -0,0 +1,155 @@
+/**
+ * @file dfs_trace.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Replay a CPU load trace through the DFS governor on the host.
+ * @version 0.1
+ * @date 2025-11-06
+ *
+ * Usage: dfs_trace TRACE [UP DOWN UP_WINDOWS DOWN_WINDOWS]
+ *
+ * TRACE has one window per line, "idle window" in any one time unit, #
+ * starts a comment. Each window goes through DFS_Sample() with the drivers
+ * running against host_sim, and one line per window is printed:
+ *
+ *   <window> <load per mille> <level name>
+ *
+ * followed by "pre"/"post" lines from a notifier on every switch and the
+ * switch counts at the end. Thresholds default to 700/300 per mille, 1 and
+ * 4 windows.
+ *
+ * The levels are those of dfs_governor.h: the SPLL runs at 160 MHz for
+ * SPLL80 (core /2) and is restarted at 112 MHz for SPLL112 (core /1), so
+ * the HSRUN level reports 112 MHz and never exceeds the HSRUN limit.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_sim.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/dfs_governor.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define TRACE_LINE_LEN              128U
+
+/* SPLL_CLK = 8 MHz / (PREDIV + 1) * (MULT + 16) / 2: 160 and 112 MHz */
+#define TRACE_SPLL80_MULT           24U
+#define TRACE_SPLL112_MULT          12U
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static void trace_notify(const dfs_change_t *change, void *ctx);
+static int trace_clocks_init(void);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static const dfs_level_t s_trace_levels[] =
+{
+    { "FIRC48",  SCG_FIRC_SlowRun_48Mhz,   SCG_RUN_MODE,   0U },
+    { "SPLL80",  SCG_SPLL_NormalRun_80Mhz, SCG_RUN_MODE,   SCG_SPLLCFG_MULT(TRACE_SPLL80_MULT) },
+    { "SPLL112", SCG_SPLL_HSRun_112Mhz,    SCG_HSRUN_MODE, SCG_SPLLCFG_MULT(TRACE_SPLL112_MULT) }
+};
+
+static dfs_notifier_t s_trace_notifier = { trace_notify, NULL, NULL };
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static void trace_notify(const dfs_change_t *change, void *ctx)
+{
+    (void)ctx;
+
+    printf("  %s %s -> %s core %lu bus %lu\n", (change->event == DFS_EVENT_PRE) ? "pre " : "post",
+           s_trace_levels[change->from].name, s_trace_levels[change->to].name,
+           (unsigned long)change->core_hz, (unsigned long)change->bus_hz);
+}
+
+static int trace_clocks_init(void)
+{
+    HOSTSIM_ScgSetValidReads(0U);
+
+    IP_SCG->SPLLCFG = SCG_SPLLCFG_MULT(TRACE_SPLL80_MULT);
+    if ((SCG_SourceInit(SCG_SOSC_CLK) != SCG_STATUS_SUCCESS) ||
+        (SCG_SourceInit(SCG_SPLL_CLK) != SCG_STATUS_SUCCESS))
+    {
+        return -1;
+    }
+
+    /* RCCR and HCCR hold a valid profile of their mode before the first switch */
+    return (SCG_SPLL_NormalRun_80Mhz() == SCG_STATUS_SUCCESS) ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    dfs_config_t config = { 700U, 300U, 1U, 4U };
+    dfs_stats_t stats;
+    char line[TRACE_LINE_LEN];
+    unsigned long idle;
+    unsigned long window;
+    uint32_t n = 0U;
+    uint8_t level;
+    FILE *in;
+
+    if ((argc != 2) && (argc != 6))
+    {
+        fprintf(stderr, "usage: %s TRACE [UP DOWN UP_WINDOWS DOWN_WINDOWS]\n", argv[0]);
+        return 2;
+    }
+
+    if (argc == 6)
+    {
+        config.up_permille = (uint16_t)strtoul(argv[2], NULL, 0);
+        config.down_permille = (uint16_t)strtoul(argv[3], NULL, 0);
+        config.up_windows = (uint8_t)strtoul(argv[4], NULL, 0);
+        config.down_windows = (uint8_t)strtoul(argv[5], NULL, 0);
+    }
+
+    in = fopen(argv[1], "r");
+    if (in == NULL)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+
+    if ((HOSTSIM_Init() != HOSTSIM_STATUS_SUCCESS) || (trace_clocks_init() != 0) ||
+        (DFS_Init(s_trace_levels, (uint8_t)(sizeof(s_trace_levels) / sizeof(s_trace_levels[0])),
+                  &config, 1U) != DFS_STATUS_SUCCESS) ||
+        (DFS_RegisterNotifier(&s_trace_notifier) != DFS_STATUS_SUCCESS))
+    {
+        fprintf(stderr, "governor setup failed\n");
+        fclose(in);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        if (sscanf(line, " %lu %lu", &idle, &window) != 2)
+        {
+            continue;
+        }
+
+        level = DFS_Sample((uint32_t)idle, (uint32_t)window);
+        printf("%lu %u %s\n", (unsigned long)n, (unsigned)DFS_GetLoad(), s_trace_levels[level].name);
+        n++;
+    }
+
+    fclose(in);
+
+    DFS_GetStats(&stats);
+    printf("windows %lu ups %lu downs %lu failures %lu\n", (unsigned long)stats.windows,
+           (unsigned long)stats.ups, (unsigned long)stats.downs, (unsigned long)stats.failures);
+
+    return (stats.failures == 0U) ? 0 : 1;
+}
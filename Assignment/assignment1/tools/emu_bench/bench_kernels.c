@@ -0,0 +1,237 @@
+/**
+ * @file bench_kernels.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief Driver hot path kernels for the emulator instruction count benchmark.
+ * @version 0.1
+ * @date 2025-11-01
+ *
+ * Every void bench_<name>(void) is one kernel. emu_bench.py runs each in a
+ * fresh emulator: bench_setup() first, uncounted, then the kernel with every
+ * executed instruction counted, until it returns to bench_halt().
+ *
+ * Peripheral space is plain memory in the emulator (PCC slots read as
+ * present), so kernels must not poll for a hardware status change.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <string.h>
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_CRC.h"
+#include "../driver/inc/Driver_MPU.h"
+#include "../driver/inc/crc_sw.h"
+#include "../driver/inc/kvs.h"
+
+/*******************************************************************************
+ *                                  Definitions
+ ******************************************************************************/
+
+#define BENCH_DATA_LEN              1024U
+#define BENCH_CRC_SLICES            4U
+#define BENCH_CRC_SLICES_WIDE       8U
+
+#define BENCH_KVS_SECTOR_SIZE       1024U
+#define BENCH_KVS_SECTORS           2U
+#define BENCH_KVS_KEYS              16U
+#define BENCH_KVS_VALUE_LEN         16U
+
+/* The store lives in a RAM array with flash program/erase semantics */
+#define BENCH_KVS_BASE              ((uint32_t)s_bench_kvs_flash)
+
+#define BENCH_MPU_STACK_SIZE        256U
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+static int32_t bench_kvs_read(void *ctx, uint32_t address, uint8_t *buf, uint32_t len);
+static int32_t bench_kvs_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len);
+static int32_t bench_kvs_erase(void *ctx, uint32_t address);
+
+/*******************************************************************************
+ *                                  Variables
+ ******************************************************************************/
+
+static uint8_t s_bench_data[BENCH_DATA_LEN] __attribute__((aligned(32)));
+
+static uint32_t s_bench_crc_table[BENCH_CRC_SLICES][256];
+static crc_sw_table_t s_bench_crc_sw;
+static uint32_t s_bench_crc_table8[BENCH_CRC_SLICES_WIDE][256];
+static crc_sw_table_t s_bench_crc_sw8;
+
+static uint8_t s_bench_kvs_flash[BENCH_KVS_SECTOR_SIZE * BENCH_KVS_SECTORS];
+static uint32_t s_bench_kvs_index[BENCH_KVS_KEYS];
+static uint8_t s_bench_kvs_buffer[64];
+static kvs_flash_t s_bench_kvs_backend;
+static kvs_t s_bench_kvs;
+
+static uint8_t s_bench_mpu_stack[2][BENCH_MPU_STACK_SIZE] __attribute__((aligned(32)));
+static mpu_task_set_t s_bench_mpu_set[2];
+
+/* Results are kept so the kernels are not optimised away */
+volatile uint32_t g_bench_sink;
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+static int32_t bench_kvs_read(void *ctx, uint32_t address, uint8_t *buf, uint32_t len)
+{
+    (void)ctx;
+    memcpy(buf, (const uint8_t *)address, len);
+
+    return 0;
+}
+
+static int32_t bench_kvs_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t len)
+{
+    uint8_t *dst = (uint8_t *)address;
+    uint32_t i;
+
+    (void)ctx;
+
+    /* Flash semantics: programming only clears bits */
+    for (i = 0U; i < len; i++)
+    {
+        dst[i] &= data[i];
+    }
+
+    return 0;
+}
+
+static int32_t bench_kvs_erase(void *ctx, uint32_t address)
+{
+    (void)ctx;
+    memset((uint8_t *)address, 0xFF, BENCH_KVS_SECTOR_SIZE);
+
+    return 0;
+}
+
+/**
+ * @brief Return target of every kernel; the emulator stops here.
+ */
+void bench_halt(void)
+{
+    for (;;)
+    {
+    }
+}
+
+/**
+ * @brief Uncounted setup run before each kernel.
+ */
+void bench_setup(void)
+{
+    const crc_config_t crc32 = CRC_CONFIG_CRC32;
+    const mpu_region_t regions0[] =
+    {
+        MPU_REGION(s_bench_mpu_stack[0], BENCH_MPU_STACK_SIZE, MPU_ACCESS_R | MPU_ACCESS_W),
+        MPU_REGION(s_bench_data, BENCH_DATA_LEN, MPU_ACCESS_R)
+    };
+    const mpu_region_t regions1[] =
+    {
+        MPU_REGION(s_bench_mpu_stack[1], BENCH_MPU_STACK_SIZE, MPU_ACCESS_R | MPU_ACCESS_W),
+        MPU_REGION(s_bench_data, BENCH_DATA_LEN, MPU_ACCESS_R | MPU_ACCESS_W)
+    };
+    const uint32_t periph0[] = { IP_FLEXCAN0_BASE };
+    const uint32_t periph1[] = { IP_LPUART1_BASE, IP_LPSPI0_BASE };
+    uint8_t value[BENCH_KVS_VALUE_LEN];
+    uint32_t i;
+
+    for (i = 0U; i < BENCH_DATA_LEN; i++)
+    {
+        s_bench_data[i] = (uint8_t)((i * 7U) + 3U);
+    }
+
+    s_bench_crc_sw.config = crc32;
+    s_bench_crc_sw.slices = BENCH_CRC_SLICES;
+    s_bench_crc_sw.table = s_bench_crc_table;
+    (void)CRC_SwInitTable(&s_bench_crc_sw);
+    s_bench_crc_sw8.config = crc32;
+    s_bench_crc_sw8.slices = BENCH_CRC_SLICES_WIDE;
+    s_bench_crc_sw8.table = s_bench_crc_table8;
+    (void)CRC_SwInitTable(&s_bench_crc_sw8);
+
+    memset(s_bench_kvs_flash, 0xFF, sizeof(s_bench_kvs_flash));
+    s_bench_kvs_backend.base = BENCH_KVS_BASE;
+    s_bench_kvs_backend.sector_size = BENCH_KVS_SECTOR_SIZE;
+    s_bench_kvs_backend.sector_count = BENCH_KVS_SECTORS;
+    s_bench_kvs_backend.read = bench_kvs_read;
+    s_bench_kvs_backend.program = bench_kvs_program;
+    s_bench_kvs_backend.erase = bench_kvs_erase;
+    s_bench_kvs_backend.ctx = NULL;
+    (void)KVS_Mount(&s_bench_kvs, &s_bench_kvs_backend, s_bench_kvs_index, BENCH_KVS_KEYS,
+                    s_bench_kvs_buffer, sizeof(s_bench_kvs_buffer));
+
+    /* Key 1 is present for the lookup kernel */
+    memset(value, 0x5A, sizeof(value));
+    (void)KVS_Set(&s_bench_kvs, 1U, value, sizeof(value));
+    (void)KVS_Commit(&s_bench_kvs);
+
+    /* Two tasks, each with its own stack, the data and some peripherals */
+    (void)MPU_Init(NULL, 0U);
+    (void)MPU_BuildTaskSet(&s_bench_mpu_set[0], regions0, 2U, periph0, 1U);
+    (void)MPU_BuildTaskSet(&s_bench_mpu_set[1], regions1, 2U, periph1, 2U);
+    MPU_SwitchTaskSet(&s_bench_mpu_set[0]);
+}
+
+/**
+ * @brief Software CRC-32, slice-by-4, over 1 KiB.
+ */
+void bench_crc_sw_1k(void)
+{
+    g_bench_sink = CRC_SwCompute(&s_bench_crc_sw, s_bench_data, BENCH_DATA_LEN);
+}
+
+/**
+ * @brief Software CRC-32, slice-by-8, over 1 KiB: 8 table loads per 8 bytes
+ *        against slice-by-4's 4 per 4, but half the loop overhead.
+ */
+void bench_crc_sw8_1k(void)
+{
+    g_bench_sink = CRC_SwCompute(&s_bench_crc_sw8, s_bench_data, BENCH_DATA_LEN);
+}
+
+/**
+ * @brief CRC module CRC-32 over 1 KiB, CPU feeding DATA.
+ */
+void bench_crc_hw_1k(void)
+{
+    const crc_config_t crc32 = CRC_CONFIG_CRC32;
+
+    (void)CRC_Init(&crc32);
+    (void)CRC_Update(s_bench_data, BENCH_DATA_LEN);
+    g_bench_sink = CRC_GetResult();
+    CRC_Release();
+}
+
+/**
+ * @brief KVS write and commit of one 16-byte value.
+ */
+void bench_kvs_set(void)
+{
+    (void)KVS_Set(&s_bench_kvs, 2U, s_bench_data, BENCH_KVS_VALUE_LEN);
+    (void)KVS_Commit(&s_bench_kvs);
+}
+
+/**
+ * @brief KVS lookup of one 16-byte value.
+ */
+void bench_kvs_get(void)
+{
+    uint8_t value[BENCH_KVS_VALUE_LEN];
+    uint16_t len = 0U;
+
+    (void)KVS_Get(&s_bench_kvs, 1U, value, sizeof(value), &len);
+    g_bench_sink = len;
+}
+
+/**
+ * @brief MPU task set switch, as done in the context switch.
+ */
+void bench_mpu_switch(void)
+{
+    MPU_SwitchTaskSet(&s_bench_mpu_set[1]);
+}
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""Count instructions of benchmark kernels under an Armv7-M emulator.
+
+Runs every bench_<name> function of an image linked with bench.ld in a fresh
+Unicorn (Cortex-M4, Thumb) instance: bench_setup() first, uncounted, then
+the kernel, counting every executed instruction until it returns to
+bench_halt(). Peripheral space (0x40000000 and 0xE0000000, 1 MB each) is
+plain memory; PCC slots read as present.
+
+Counts are compared to a baseline file ("name instructions" per line, #
+comments). A kernel more than --threshold percent above its baseline, one
+with no baseline entry or one that does not return makes the exit status 1.
+--update rewrites the baseline with the counts of this run and exits 0.
+A baseline with no rows at all (a fresh checkout) is seeded the same way on
+the first run, which passes if every kernel returned; commit the file it
+writes.
+
+Usage: emu_bench.py ELF [--baseline FILE] [--threshold PCT] [--update]
+Needs the unicorn Python package (pip install unicorn).
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+FLASH = (0x00000000, 0x00080000)
+RAM = (0x1FFF8000, 0x0000F000)
+PERIPHERALS = [(0x40000000, 0x00100000), (0xE0000000, 0x00100000)]
+
+PCC_BASE = 0x40065000
+PCC_SLOTS = 128
+PCC_PR = 0x80000000
+
+PT_LOAD = 1
+SHT_SYMTAB = 2
+STT_FUNC = 2
+
+KERNEL_PREFIX = "bench_"
+NOT_KERNELS = ("bench_setup", "bench_halt")
+
+DEFAULT_LIMIT = 50000000
+
+
+def load_elf(path):
+    """Return ([(vaddr, bytes)], {function name: address}) of a 32-bit LE ELF."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+        raise ValueError("%s: not a 32-bit little-endian ELF" % path)
+
+    e_phoff, e_shoff = struct.unpack_from("<II", data, 0x1C)
+    e_phentsize, e_phnum, e_shentsize, e_shnum = struct.unpack_from("<HHHH", data, 0x2A)
+
+    segments = []
+    for i in range(e_phnum):
+        p_type, p_offset, p_vaddr, _, p_filesz, _, _, _ = \
+            struct.unpack_from("<8I", data, e_phoff + i * e_phentsize)
+        if p_type == PT_LOAD and p_filesz:
+            segments.append((p_vaddr, data[p_offset:p_offset + p_filesz]))
+
+    sections = [struct.unpack_from("<10I", data, e_shoff + i * e_shentsize) for i in range(e_shnum)]
+
+    functions = {}
+    for sh in sections:
+        if sh[1] != SHT_SYMTAB:
+            continue
+        strtab = sections[sh[6]]
+        for offset in range(sh[4], sh[4] + sh[5], 16):
+            st_name, st_value, _, st_info, _, _ = struct.unpack_from("<IIIBBH", data, offset)
+            if (st_info & 0xF) != STT_FUNC:
+                continue
+            start = strtab[4] + st_name
+            name = data[start:data.index(b"\0", start)].decode()
+            functions[name] = st_value & ~1
+
+    return segments, functions
+
+
+def run_kernel(segments, functions, kernel, limit):
+    """Instructions executed by one kernel, or None if it did not return."""
+    from unicorn import Uc, UcError, UC_ARCH_ARM, UC_MODE_THUMB, UC_MODE_MCLASS, UC_HOOK_CODE
+    from unicorn import arm_const
+
+    uc = Uc(UC_ARCH_ARM, UC_MODE_THUMB | UC_MODE_MCLASS)
+    if hasattr(uc, "ctl_set_cpu_model") and hasattr(arm_const, "UC_CPU_ARM_CORTEX_M4"):
+        uc.ctl_set_cpu_model(arm_const.UC_CPU_ARM_CORTEX_M4)
+
+    for base, size in [FLASH, RAM] + PERIPHERALS:
+        uc.mem_map(base, size)
+    for vaddr, blob in segments:
+        uc.mem_write(vaddr, blob)
+    uc.mem_write(PCC_BASE, struct.pack("<I", PCC_PR) * PCC_SLOTS)
+
+    halt = functions["bench_halt"]
+    counter = {"enabled": False, "count": 0}
+
+    def on_code(uc_, address, size, user):
+        if counter["enabled"]:
+            counter["count"] += 1
+
+    uc.hook_add(UC_HOOK_CODE, on_code)
+
+    def call(address):
+        uc.reg_write(arm_const.UC_ARM_REG_SP, RAM[0] + RAM[1])
+        uc.reg_write(arm_const.UC_ARM_REG_LR, halt | 1)
+        try:
+            uc.emu_start(address | 1, halt, count=limit)
+        except UcError as e:
+            sys.stderr.write("%s: %s at 0x%08X\n" % (kernel, e, uc.reg_read(arm_const.UC_ARM_REG_PC)))
+            return False
+        return uc.reg_read(arm_const.UC_ARM_REG_PC) == halt
+
+    if "bench_setup" in functions and not call(functions["bench_setup"]):
+        return None
+
+    counter["enabled"] = True
+    if not call(functions[KERNEL_PREFIX + kernel]):
+        return None
+
+    return counter["count"]
+
+
+def read_baseline(path):
+    baseline = {}
+    if path and os.path.exists(path):
+        with open(path) as f:
+            for line in f:
+                fields = line.split("#", 1)[0].split()
+                if len(fields) >= 2:
+                    baseline[fields[0]] = int(fields[1])
+    return baseline
+
+
+def write_baseline(path, results):
+    header = []
+    if os.path.exists(path):
+        with open(path) as f:
+            # "#!" lines note a missing baseline; these counts replace them
+            header = [line for line in f if line.startswith("#") and not line.startswith("#!")]
+    with open(path, "w") as f:
+        f.writelines(header)
+        for name in sorted(results):
+            if results[name] is not None:
+                f.write("%-24s %d\n" % (name, results[name]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("elf")
+    parser.add_argument("--baseline", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "baseline.txt"))
+    parser.add_argument("--threshold", type=float, default=2.0, help="allowed increase in percent")
+    parser.add_argument("--limit", type=int, default=DEFAULT_LIMIT, help="instruction limit per call")
+    parser.add_argument("--update", action="store_true", help="rewrite the baseline with these counts")
+    args = parser.parse_args()
+
+    segments, functions = load_elf(args.elf)
+    if "bench_halt" not in functions:
+        sys.stderr.write("%s: no bench_halt, not linked from bench_kernels.c?\n" % args.elf)
+        return 2
+
+    kernels = sorted(name[len(KERNEL_PREFIX):] for name in functions
+                     if name.startswith(KERNEL_PREFIX) and name not in NOT_KERNELS)
+    baseline = read_baseline(args.baseline)
+    # Nothing recorded yet: this run is the reference, not a regression
+    seeding = not baseline and not args.update
+    update = args.update or seeding
+    results = {}
+    failed = False
+
+    print("%-24s %12s %12s %8s" % ("kernel", "instructions", "baseline", "change"))
+    for kernel in kernels:
+        count = run_kernel(segments, functions, kernel, args.limit)
+        results[kernel] = count
+        base = baseline.get(kernel)
+
+        if count is None:
+            print("%-24s %12s" % (kernel, "did not return"))
+            failed = True
+            continue
+        if base is None:
+            print("%-24s %12d %12s %8s%s" % (kernel, count, "-", "new", "" if update else "  NO BASELINE"))
+            if not update:
+                failed = True
+            continue
+
+        change = 100.0 * (count - base) / base if base else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = "  REGRESSION"
+            failed = True
+        print("%-24s %12d %12d %+7.1f%%%s" % (kernel, count, base, change, mark))
+
+    for kernel in sorted(set(baseline) - set(kernels)):
+        print("%-24s %12s %12d %8s" % (kernel, "-", baseline[kernel], "removed"))
+
+    if args.update:
+        write_baseline(args.baseline, results)
+        return 0
+
+    if seeding:
+        write_baseline(args.baseline, results)
+        sys.stderr.write("%s: no counts recorded yet, seeded from this run; review and commit it\n"
+                         % args.baseline)
+        return 1 if failed else 0
+
+    if failed and any(kernel not in baseline for kernel in kernels):
+        sys.stderr.write("%s: kernels without a baseline, review the counts and rerun with --update\n"
+                         % args.baseline)
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
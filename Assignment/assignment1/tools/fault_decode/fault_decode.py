@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""Decode a fault record left by driver/src/fault_capture.c.
+
+CAPTURE holds the fault_record_t bytes as the target sent them, or any dump
+containing them (e.g. a debugger dump of the whole .noinit section): the
+record is found by its magic. Binary files and hex text (whitespace and
+0x prefixes ignored) are both accepted.
+
+The registers are printed with pc, lr and the stacked lr symbolised against
+the ELF (nm, plus file:line from addr2line when it is available), the fault
+status registers are split into their flags, and the ISR ring is printed
+oldest first with IRQ names from S32K144.h.
+
+Usage: fault_decode.py ELF CAPTURE [--nm TOOL] [--addr2line TOOL] [--header S32K144.h]
+"""
+
+import argparse
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+
+MAGIC = 0x544C4146          # FAULT_RECORD_MAGIC, "FALT"
+MAGIC_OFFSET = 32           # after r4_r11
+ISR_RING = 8                # FAULT_ISR_RING
+RECORD_WORDS = 8 + 6 + 8 + 6 + 2 * ISR_RING
+
+FLAG_FRAME_VALID = 0x01
+FLAG_PSP = 0x02
+FLAG_FPU_FRAME = 0x04
+
+EXCEPTIONS = {
+    2: "NMI", 3: "HardFault", 4: "MemManage", 5: "BusFault", 6: "UsageFault",
+    11: "SVCall", 12: "DebugMonitor", 14: "PendSV", 15: "SysTick",
+}
+
+CFSR_BITS = [
+    (0, "IACCVIOL"), (1, "DACCVIOL"), (3, "MUNSTKERR"), (4, "MSTKERR"), (5, "MLSPERR"),
+    (7, "MMARVALID"),
+    (8, "IBUSERR"), (9, "PRECISERR"), (10, "IMPRECISERR"), (11, "UNSTKERR"), (12, "STKERR"),
+    (13, "LSPERR"), (15, "BFARVALID"),
+    (16, "UNDEFINSTR"), (17, "INVSTATE"), (18, "INVPC"), (19, "NOCP"), (24, "UNALIGNED"),
+    (25, "DIVBYZERO"),
+]
+
+HFSR_BITS = [(1, "VECTTBL"), (30, "FORCED"), (31, "DEBUGEVT")]
+
+MMARVALID = 1 << 7
+BFARVALID = 1 << 15
+
+
+def read_capture(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        text = data.decode("ascii")
+    except UnicodeDecodeError:
+        return data
+    digits = re.sub(r"0x|\s|,", "", text)
+    if digits and re.fullmatch(r"[0-9a-fA-F]+", digits) and len(digits) % 2 == 0:
+        return bytes.fromhex(digits)
+    return data
+
+
+def find_record(data):
+    """Words of the first record whose magic sits at a word boundary."""
+    size = RECORD_WORDS * 4
+    for start in range(0, len(data) - size + 1, 4):
+        if struct.unpack_from("<I", data, start + MAGIC_OFFSET)[0] == MAGIC:
+            return struct.unpack_from("<%dI" % RECORD_WORDS, data, start)
+    return None
+
+
+def parse_record(words):
+    it = iter(words)
+
+    def take(n):
+        return [next(it) for _ in range(n)]
+
+    rec = {"r4_r11": take(8)}
+    (rec["magic"], rec["count"], rec["exception"], rec["flags"], rec["exc_return"],
+     rec["sp"]) = take(6)
+    rec["frame"] = take(8)
+    rec["cfsr"], rec["hfsr"], rec["mmfar"], rec["bfar"], rec["cycles"], rec["isr_count"] = take(6)
+    rec["isr"] = [tuple(take(2)) for _ in range(ISR_RING)]
+    return rec
+
+
+class Symbols:
+    def __init__(self, elf, nm, addr2line):
+        self.elf = elf
+        self.addr2line = addr2line if shutil.which(addr2line) else None
+        self.funcs = []
+        out = subprocess.run([nm, "-n", "--defined-only", elf], check=True,
+                             stdout=subprocess.PIPE, universal_newlines=True).stdout
+        for line in out.splitlines():
+            parts = line.split()
+            if len(parts) == 3 and parts[1] in "TtWw":
+                self.funcs.append((int(parts[0], 16), parts[2]))
+
+    def name(self, addr):
+        addr &= ~1
+        best = None
+        for start, name in self.funcs:
+            if start > addr:
+                break
+            best = (start, name)
+        if best is None:
+            return "?"
+        return "%s+0x%x" % (best[1], addr - best[0])
+
+    def line(self, addr):
+        if self.addr2line is None:
+            return ""
+        out = subprocess.run([self.addr2line, "-e", self.elf, "0x%x" % (addr & ~1)],
+                             stdout=subprocess.PIPE, universal_newlines=True).stdout.strip()
+        return "" if out.startswith("??") else out
+
+    def describe(self, addr):
+        text = self.name(addr)
+        where = self.line(addr)
+        return "%s  %s" % (text, where) if where else text
+
+
+def irq_names(header):
+    names = dict(EXCEPTIONS)
+    if header and os.path.exists(header):
+        with open(header) as f:
+            for m in re.finditer(r"^\s*(\w+)_IRQn\s*=\s*(-?\d+)", f.read(), re.M):
+                irq = int(m.group(2))
+                if irq >= 0:
+                    names[irq + 16] = m.group(1)
+    return names
+
+
+def flags(value, bits):
+    return " ".join(name for bit, name in bits if value & (1 << bit)) or "-"
+
+
+def report(rec, syms, names):
+    frame = rec["frame"]
+    out = []
+    out.append("fault %d since power-on: %s (exception %d) at cycle %d"
+               % (rec["count"], names.get(rec["exception"], "?"), rec["exception"], rec["cycles"]))
+
+    stack = "PSP" if rec["flags"] & FLAG_PSP else "MSP"
+    fpu = ", FPU frame" if rec["flags"] & FLAG_FPU_FRAME else ""
+    out.append("  sp   0x%08x (%s%s)  exc_return 0x%08x" % (rec["sp"], stack, fpu, rec["exc_return"]))
+
+    if rec["flags"] & FLAG_FRAME_VALID:
+        out.append("  pc   0x%08x  %s" % (frame[6], syms.describe(frame[6])))
+        out.append("  lr   0x%08x  %s" % (frame[5], syms.describe(frame[5])))
+        out.append("  xpsr 0x%08x  (exception %d active)" % (frame[7], frame[7] & 0x1FF))
+        out.append("  r0   0x%08x  r1  0x%08x  r2  0x%08x  r3  0x%08x  r12 0x%08x"
+                   % (frame[0], frame[1], frame[2], frame[3], frame[4]))
+    else:
+        out.append("  no exception frame (stacking failed or sp outside SRAM)")
+
+    r = rec["r4_r11"]
+    out.append("  r4   0x%08x  r5  0x%08x  r6  0x%08x  r7  0x%08x" % tuple(r[0:4]))
+    out.append("  r8   0x%08x  r9  0x%08x  r10 0x%08x  r11 0x%08x" % tuple(r[4:8]))
+
+    out.append("  CFSR 0x%08x  %s" % (rec["cfsr"], flags(rec["cfsr"], CFSR_BITS)))
+    out.append("  HFSR 0x%08x  %s" % (rec["hfsr"], flags(rec["hfsr"], HFSR_BITS)))
+    if rec["cfsr"] & MMARVALID:
+        out.append("  MMFAR 0x%08x" % rec["mmfar"])
+    if rec["cfsr"] & BFARVALID:
+        out.append("  BFAR  0x%08x" % rec["bfar"])
+
+    traced = rec["isr_count"]
+    out.append("ISR entries (%d traced, last %d, oldest first):" % (traced, min(traced, ISR_RING)))
+    entries = rec["isr"][ISR_RING - min(traced, ISR_RING):]
+    for exception, cycles in entries:
+        before = (rec["cycles"] - cycles) & 0xFFFFFFFF
+        out.append("  %10d  -%-10d %s" % (cycles, before, names.get(exception, "exception %d" % exception)))
+
+    return "\n".join(out)
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+    parser = argparse.ArgumentParser(description="Decode a fault_capture record.")
+    parser.add_argument("elf")
+    parser.add_argument("capture")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--addr2line", default="arm-none-eabi-addr2line")
+    parser.add_argument("--header", default=os.path.join(root, "include", "S32K144.h"))
+    args = parser.parse_args()
+
+    words = find_record(read_capture(args.capture))
+    if words is None:
+        sys.stderr.write("%s: no fault record\n" % args.capture)
+        return 1
+
+    print(report(parse_record(words), Symbols(args.elf, args.nm, args.addr2line), irq_names(args.header)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
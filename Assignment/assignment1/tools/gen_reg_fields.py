@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+"""Generate include/S32K144_fields.h from include/S32K144.h.
+
+For every bitfield <PERIPH>_<REG>_<FIELD> that S32K144.h describes with
+_MASK, _SHIFT and a value macro, emit its access class
+
+    #define <PERIPH>_<REG>_<FIELD>_ACCESS   RW | RO | WO | W1C
+
+and for every register
+
+    #define <PERIPH>_<REG>_W1C_MASK          mask of its W1C fields, 0U if none
+    #define <PERIPH>_<REG>_W1C_BASE(reg)     what a flag clear writes back
+                                             (only with W1C fields)
+
+reg_access.h pastes these into its REG_* macros to reject writes to RO and
+W1C fields at compile time. Register-level access comes from the __I/__O/__IO
+qualifier in the layout typedef; field-level exceptions, which the header
+does not describe, come from FIELD_ACCESS below (reference manual).
+
+Usage: tools/gen_reg_fields.py [include/S32K144.h] [include/S32K144_fields.h]
+"""
+
+import os
+import re
+import sys
+
+# Field exceptions inside RW registers: "PERIPH_REG_FIELD": "RO" | "W1C"
+FIELD_ACCESS = {
+    # PORT
+    "PORT_PCR_ISF": "W1C",
+    "PORT_ISFR_ISF": "W1C",
+    # FTFC
+    "FTFC_FSTAT_CCIF": "W1C",
+    "FTFC_FSTAT_RDCOLERR": "W1C",
+    "FTFC_FSTAT_ACCERR": "W1C",
+    "FTFC_FSTAT_FPVIOL": "W1C",
+    "FTFC_FSTAT_MGSTAT0": "RO",
+    "FTFC_FCNFG_RAMRDY": "RO",
+    "FTFC_FCNFG_EEERDY": "RO",
+    # SCG clock source status
+    "SCG_SOSCCSR_SOSCVLD": "RO",
+    "SCG_SOSCCSR_SOSCSEL": "RO",
+    "SCG_SOSCCSR_SOSCERR": "W1C",
+    "SCG_SIRCCSR_SIRCVLD": "RO",
+    "SCG_SIRCCSR_SIRCSEL": "RO",
+    "SCG_FIRCCSR_FIRCVLD": "RO",
+    "SCG_FIRCCSR_FIRCSEL": "RO",
+    "SCG_SPLLCSR_SPLLVLD": "RO",
+    "SCG_SPLLCSR_SPLLSEL": "RO",
+    "SCG_SPLLCSR_SPLLERR": "W1C",
+    # PCC
+    "PCC_PCCn_PR": "RO",
+    # LPIT
+    "LPIT_MSR_TIF0": "W1C",
+    "LPIT_MSR_TIF1": "W1C",
+    "LPIT_MSR_TIF2": "W1C",
+    "LPIT_MSR_TIF3": "W1C",
+    # LPUART
+    "LPUART_STAT_LBKDIF": "W1C",
+    "LPUART_STAT_RXEDGIF": "W1C",
+    "LPUART_STAT_IDLE": "W1C",
+    "LPUART_STAT_OR": "W1C",
+    "LPUART_STAT_NF": "W1C",
+    "LPUART_STAT_FE": "W1C",
+    "LPUART_STAT_PF": "W1C",
+    "LPUART_STAT_MA1F": "W1C",
+    "LPUART_STAT_MA2F": "W1C",
+    "LPUART_STAT_TDRE": "RO",
+    "LPUART_STAT_TC": "RO",
+    "LPUART_STAT_RDRF": "RO",
+    "LPUART_STAT_RAF": "RO",
+    # LPSPI
+    "LPSPI_SR_WCF": "W1C",
+    "LPSPI_SR_FCF": "W1C",
+    "LPSPI_SR_TCF": "W1C",
+    "LPSPI_SR_TEF": "W1C",
+    "LPSPI_SR_REF": "W1C",
+    "LPSPI_SR_DMF": "W1C",
+    "LPSPI_SR_TDF": "RO",
+    "LPSPI_SR_RDF": "RO",
+    "LPSPI_SR_MBF": "RO",
+    # LPI2C master
+    "LPI2C_MSR_EPF": "W1C",
+    "LPI2C_MSR_SDF": "W1C",
+    "LPI2C_MSR_NDF": "W1C",
+    "LPI2C_MSR_ALF": "W1C",
+    "LPI2C_MSR_FEF": "W1C",
+    "LPI2C_MSR_PLTF": "W1C",
+    "LPI2C_MSR_DMF": "W1C",
+    "LPI2C_MSR_TDF": "RO",
+    "LPI2C_MSR_RDF": "RO",
+    "LPI2C_MSR_MBF": "RO",
+    "LPI2C_MSR_BBF": "RO",
+    # LPTMR
+    "LPTMR_CSR_TCF": "W1C",
+    # ADC
+    "ADC_SC1_COCO": "RO",
+    "ADC_SC2_ADACT": "RO",
+    # FlexCAN
+    "FLEXCAN_ESR1_ERRINT": "W1C",
+    "FLEXCAN_ESR1_BOFFINT": "W1C",
+    "FLEXCAN_ESR1_RWRNINT": "W1C",
+    "FLEXCAN_ESR1_TWRNINT": "W1C",
+    "FLEXCAN_ESR1_BOFFDONEINT": "W1C",
+    "FLEXCAN_ESR1_ERRINT_FAST": "W1C",
+    "FLEXCAN_IFLAG1_BUF0I": "W1C",
+    "FLEXCAN_IFLAG1_BUF4TO1I": "W1C",
+    "FLEXCAN_IFLAG1_BUF5I": "W1C",
+    "FLEXCAN_IFLAG1_BUF6I": "W1C",
+    "FLEXCAN_IFLAG1_BUF7I": "W1C",
+    "FLEXCAN_IFLAG1_BUF31TO8I": "W1C",
+    # WDOG
+    "WDOG_CS_FLG": "W1C",
+    "WDOG_CS_ULK": "RO",
+    "WDOG_CS_RCS": "RO",
+    # PMC
+    "PMC_LVDSC1_LVDF": "RO",
+    "PMC_LVDSC1_LVDACK": "WO",
+    "PMC_LVDSC2_LVWF": "RO",
+    "PMC_LVDSC2_LVWACK": "WO",
+    # DMA
+    "DMA_TCD_CSR_DONE": "RO",
+    "DMA_TCD_CSR_ACTIVE": "RO",
+    # RTC
+    "RTC_SR_TIF": "RO",
+    "RTC_SR_TOF": "RO",
+    "RTC_SR_TAF": "RO",
+    # ERM
+    "ERM_SR0_SBC0": "W1C",
+    "ERM_SR0_NCE0": "W1C",
+    "ERM_SR0_SBC1": "W1C",
+    "ERM_SR0_NCE1": "W1C",
+    # MPU
+    "MPU_CESR_SPERR0": "W1C",
+    "MPU_CESR_SPERR1": "W1C",
+    "MPU_CESR_SPERR2": "W1C",
+    "MPU_CESR_SPERR3": "W1C",
+    "MPU_CESR_NRGD": "RO",
+    "MPU_CESR_NSP": "RO",
+    "MPU_CESR_HRL": "RO",
+}
+
+QUALIFIER_ACCESS = {"__IO": "RW", "__I": "RO", "__O": "WO"}
+
+TYPEDEF_START = re.compile(r"^/\*\* (\w+) - Register Layout Typedef \*/")
+MEMBER = re.compile(r"^\s*(__IO|__I|__O)\s+\w+\s+(\w+)")
+MASK = re.compile(r"^#define\s+(\w+)_MASK\s+\((0x[0-9A-Fa-f]+)U\)")
+VALUE = re.compile(r"^#define\s+(\w+)\(x\)")
+NESTED_OPEN = re.compile(r"^\s+(struct|union)\s*\{")
+NESTED_CLOSE = re.compile(r"^\s+\}\s*(\w+)")
+
+
+def parse(lines):
+    """Return {periph: {reg: access}} and [(field_name, mask)].
+
+    Members of nested structs and unions are named after the enclosing
+    member, as most S32K144.h masks are (DMA TCD[n].CSR -> TCD_CSR); some
+    use the bare member (FTM CONTROLS[n].CnSC -> CnSC) or an n suffix
+    (FLEXCAN WMB[n].CS -> WMBn_CS), so those names are added as well.
+    """
+    registers = {}
+    current = None
+    scopes = []
+    masks = []
+    values = set()
+
+    for line in lines:
+        m = TYPEDEF_START.match(line)
+        if m:
+            current = m.group(1)
+            registers.setdefault(current, {})
+            scopes = [{}]
+            continue
+        if current is not None:
+            if NESTED_OPEN.match(line):
+                scopes.append({})
+                continue
+            m = NESTED_CLOSE.match(line)
+            if m and len(scopes) > 1:
+                inner = scopes.pop()
+                for reg, access in inner.items():
+                    scopes[-1][m.group(1) + "_" + reg] = access
+                    scopes[-1][m.group(1) + "n_" + reg] = access
+                    scopes[-1].setdefault(reg, access)
+                continue
+            if line.startswith("}") and "_Type" in line:
+                registers[current].update(scopes[0])
+                current = None
+                continue
+            m = MEMBER.match(line)
+            if m:
+                scopes[-1][m.group(2)] = QUALIFIER_ACCESS[m.group(1)]
+                continue
+        m = MASK.match(line)
+        if m:
+            masks.append((m.group(1), int(m.group(2), 16)))
+            continue
+        m = VALUE.match(line)
+        if m:
+            values.add(m.group(1))
+
+    return registers, [(name, mask) for name, mask in masks if name in values]
+
+
+def split_field(name, registers):
+    """PERIPH_REG_FIELD -> (periph, reg, field) using the longest register match."""
+    for periph in sorted(registers, key=len, reverse=True):
+        if not name.startswith(periph + "_"):
+            continue
+        rest = name[len(periph) + 1:]
+        for reg in sorted(registers[periph], key=len, reverse=True):
+            if rest.startswith(reg + "_") and len(rest) > len(reg) + 1:
+                return periph, reg, rest[len(reg) + 1:]
+    return None
+
+
+def generate(src, dst):
+    with open(src) as f:
+        registers, masks = parse(f.read().splitlines())
+
+    fields = []
+    w1c = {}
+    writable = {}
+    used = set()
+    skipped = 0
+
+    for name, mask in masks:
+        split = split_field(name, registers)
+        if split is None:
+            skipped += 1
+            continue
+        periph, reg, field = split
+        regname = periph + "_" + reg
+        access = registers[periph][reg]
+        if access == "RW" and name in FIELD_ACCESS:
+            access = FIELD_ACCESS[name]
+            used.add(name)
+        fields.append((regname, name, access))
+        if access == "W1C":
+            w1c[regname] = w1c.get(regname, 0) | mask
+        elif access in ("RW", "WO"):
+            writable[regname] = writable.get(regname, 0) | mask
+
+    for name in sorted(set(FIELD_ACCESS) - used):
+        sys.stderr.write("warning: FIELD_ACCESS entry %s not found\n" % name)
+
+    out = []
+    out.append("/*")
+    out.append(" * Generated by tools/gen_reg_fields.py from S32K144.h. Do not edit.")
+    out.append(" *")
+    out.append(" * Field access classes and W1C masks for the REG_* macros in reg_access.h.")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef S32K144_FIELDS_H_")
+    out.append("#define S32K144_FIELDS_H_")
+
+    order = []
+    by_register = {}
+    for regname, name, access in fields:
+        if regname not in by_register:
+            order.append(regname)
+            by_register[regname] = []
+        by_register[regname].append((name, access))
+
+    for regname in order:
+        out.append("")
+        out.append("/* %s */" % regname)
+        out.append("#define %-48s (0x%XU)" % (regname + "_W1C_MASK", w1c.get(regname, 0)))
+        if regname in w1c:
+            if regname in writable:
+                out.append("#define %-48s ((reg) & ~%s_W1C_MASK)" % (regname + "_W1C_BASE(reg)", regname))
+            else:
+                out.append("#define %-48s 0U" % (regname + "_W1C_BASE(reg)"))
+        for name, access in by_register[regname]:
+            out.append("#define %-48s %s" % (name + "_ACCESS", access))
+
+    out.append("")
+    out.append("#endif /* S32K144_FIELDS_H_ */")
+    out.append("")
+
+    with open(dst, "w") as f:
+        f.write("\n".join(out))
+
+    sys.stderr.write("%d fields, %d registers with W1C fields, %d masks without a register\n"
+                     % (len(fields), len(w1c), skipped))
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "include", "S32K144.h")
+    dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "include", "S32K144_fields.h")
+    generate(src, dst)
+
+
+if __name__ == "__main__":
+    main()
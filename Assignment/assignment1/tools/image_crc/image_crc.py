@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Stamp the CRC-32 into the header of an A/B slot image (boot_image.h).
+
+The linker leaves the header crc word erased. This computes CRC_CONFIG_CRC32
+(the zlib CRC-32) over [0, 0x41C) and [0x420, length) of the slot, as
+BOOT_ComputeImageCrc() does on the target, and writes it into the crc word.
+
+IMAGE is the linked ELF of a slot build (S32K144_64_flash_slot_a.ld or _b.ld,
+boot_image.c with -DBOOT_APP_SLOT): the slot base is the address of
+g_boot_image_header minus 0x410, the length is __image_length__, and the
+flash bytes are taken from the load addresses of the PT_LOAD segments, with
+gaps read as erased (0xFF). The crc word is patched in the file in place.
+
+With --bin, IMAGE is the raw slot content from its first byte (objcopy -O
+binary of the ELF, or a test buffer) and the length is taken from the header;
+bytes up to the length missing at the end of the file are read as erased.
+
+Usage: image_crc.py IMAGE [--bin] [--check]
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+HEADER_OFFSET = 0x410       # BOOT_HEADER_OFFSET
+HEADER_SIZE = 16            # BOOT_HEADER_SIZE
+CRC_OFFSET = HEADER_OFFSET + 12
+CODE_OFFSET = HEADER_OFFSET + HEADER_SIZE
+IMAGE_MAGIC = 0x4D494241    # BOOT_IMAGE_MAGIC, "ABIM"
+PHRASE = 8                  # FTFC_PHRASE_SIZE
+
+HEADER_SYMBOL = "g_boot_image_header"
+LENGTH_SYMBOL = "__image_length__"
+
+PT_LOAD = 1
+SHT_SYMTAB = 2
+
+
+class ImageError(Exception):
+    pass
+
+
+def image_crc(image, length):
+    """CRC-32 of a slot as stored in its header: the crc word is skipped."""
+    crc = zlib.crc32(image[:CRC_OFFSET])
+    return zlib.crc32(image[CODE_OFFSET:length], crc) & 0xFFFFFFFF
+
+
+def check_header(image, length):
+    magic, _, header_length, _ = struct.unpack_from("<4I", image, HEADER_OFFSET)
+    if magic != IMAGE_MAGIC:
+        raise ImageError("no image header at 0x%x (magic 0x%08x)" % (HEADER_OFFSET, magic))
+    if header_length != length:
+        raise ImageError("header length 0x%x, expected 0x%x" % (header_length, length))
+    if length <= CODE_OFFSET or length % PHRASE != 0:
+        raise ImageError("bad image length 0x%x" % length)
+
+
+class Elf32:
+    """The little-endian ELF32 parts needed here: segments and symbols."""
+
+    def __init__(self, data):
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ImageError("not a little-endian ELF32 file")
+        self.data = data
+        (phoff, shoff, _, _, phentsize, phnum, shentsize, shnum, _) = struct.unpack_from("<IIIHHHHHH", data, 28)
+        self.segments = [struct.unpack_from("<8I", data, phoff + i * phentsize) for i in range(phnum)]
+        self.sections = [struct.unpack_from("<10I", data, shoff + i * shentsize) for i in range(shnum)]
+
+    def symbol(self, name):
+        """Value of a symbol from .symtab."""
+        for section in self.sections:
+            if section[1] != SHT_SYMTAB:
+                continue
+            strtab = self.sections[section[6]]
+            for offset in range(section[4], section[4] + section[5], section[9]):
+                st_name, st_value = struct.unpack_from("<II", self.data, offset)
+                start = strtab[4] + st_name
+                end = self.data.index(b"\0", start)
+                if self.data[start:end].decode() == name:
+                    return st_value
+        raise ImageError("symbol %s not found (not a slot build?)" % name)
+
+    def flash(self, base, length):
+        """Bytes [base, base + length) by load address, 0xFF where nothing loads."""
+        image = bytearray(b"\xff" * length)
+        for p_type, p_offset, _, p_paddr, p_filesz, _, _, _ in self.segments:
+            start = max(p_paddr, base)
+            end = min(p_paddr + p_filesz, base + length)
+            if p_type != PT_LOAD or start >= end:
+                continue
+            image[start - base:end - base] = self.data[p_offset + start - p_paddr:p_offset + end - p_paddr]
+        return image
+
+    def file_offset(self, address):
+        """File offset of the loaded byte at a load address."""
+        for p_type, p_offset, _, p_paddr, p_filesz, _, _, _ in self.segments:
+            if p_type == PT_LOAD and p_paddr <= address < p_paddr + p_filesz:
+                return p_offset + address - p_paddr
+        raise ImageError("0x%08x is not loaded from the file" % address)
+
+
+def stamp_elf(data):
+    """(patched data, crc, length) of a slot ELF."""
+    elf = Elf32(data)
+    base = elf.symbol(HEADER_SYMBOL) - HEADER_OFFSET
+    length = elf.symbol(LENGTH_SYMBOL)
+    image = elf.flash(base, length)
+    check_header(image, length)
+    crc = image_crc(image, length)
+    offset = elf.file_offset(base + CRC_OFFSET)
+    struct.pack_into("<I", data, offset, crc)
+    return data, crc, length
+
+
+def stamp_bin(data):
+    """(patched data, crc, length) of a raw slot image."""
+    if len(data) < CODE_OFFSET:
+        raise ImageError("image shorter than its header")
+    length = struct.unpack_from("<I", data, HEADER_OFFSET + 8)[0]
+    check_header(data, length)
+    image = data + b"\xff" * max(0, length - len(data))
+    crc = image_crc(image, length)
+    struct.pack_into("<I", data, CRC_OFFSET, crc)
+    return data, crc, length
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Stamp the CRC-32 into an A/B slot image header.")
+    parser.add_argument("image")
+    parser.add_argument("--bin", action="store_true", help="raw slot image instead of an ELF")
+    parser.add_argument("--check", action="store_true", help="only compare with the stored crc")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        data = bytearray(f.read())
+    stored = None
+
+    try:
+        if args.bin:
+            stored = struct.unpack_from("<I", data, CRC_OFFSET)[0] if len(data) >= CODE_OFFSET else None
+            data, crc, length = stamp_bin(data)
+        else:
+            elf = Elf32(data)
+            address = elf.symbol(HEADER_SYMBOL) - HEADER_OFFSET + CRC_OFFSET
+            stored = struct.unpack_from("<I", data, elf.file_offset(address))[0]
+            data, crc, length = stamp_elf(data)
+    except (ImageError, struct.error) as err:
+        sys.stderr.write("%s: %s\n" % (args.image, err))
+        return 1
+
+    if args.check:
+        print("%s: length 0x%x crc 0x%08x, stored 0x%08x" % (args.image, length, crc, stored))
+        return 0 if crc == stored else 1
+
+    with open(args.image, "r+b") as f:
+        f.write(data)
+    print("%s: length 0x%x crc 0x%08x" % (args.image, length, crc))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Check that reg_access.h compiles to the same bytes as hand-written code.
+
+Compiles reg_access_pairs.c once per optimisation level and compares the
+code of every reg_<name> function with its hand_<name> twin, byte for byte
+(symbol size from nm, .text contents from objcopy). Identical code folding
+is turned off so the compiler cannot merge a pair into one body, and so are
+function sections, to keep every function in .text.
+
+The exit status is 1 if any pair differs, and the differing pairs are
+printed with both disassemblies when objdump is available.
+
+Usage: reg_access_check.py [--cc CC] [--nm NM] [--objcopy OBJCOPY]
+                           [--objdump OBJDUMP] [--levels=-O0,-O2,...] [-- CFLAGS ...]
+Host: reg_access_check.py (gcc, nm, objcopy)
+Target: reg_access_check.py --cc arm-none-eabi-gcc --nm arm-none-eabi-nm \\
+        --objcopy arm-none-eabi-objcopy -- -mcpu=cortex-m4 -mthumb
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(HERE, "..", "..")
+
+DEFAULT_LEVELS = "-O0,-O2,-O3,-Os"
+
+
+def run(cmd, **kwargs):
+    return subprocess.run(cmd, check=True, stdout=subprocess.PIPE, universal_newlines=True, **kwargs).stdout
+
+
+def functions(nm, obj):
+    """{name: (offset, size)} of the .text functions of an object."""
+    table = {}
+    for line in run([nm, "-S", "--defined-only", obj]).splitlines():
+        parts = line.split()
+        if len(parts) == 4 and parts[2] in ("T", "t"):
+            table[parts[3]] = (int(parts[0], 16), int(parts[1], 16))
+    return table
+
+
+def disasm(objdump, obj, name):
+    if not objdump:
+        return ""
+    try:
+        return run([objdump, "-d", "--disassemble=" + name, obj])
+    except (OSError, subprocess.CalledProcessError):
+        return ""
+
+
+def check_level(args, level, workdir):
+    obj = os.path.join(workdir, "pairs%s.o" % level)
+    text = os.path.join(workdir, "pairs%s.bin" % level)
+    # After CFLAGS, which may carry their own -O and -ffunction-sections
+    cmd = [args.cc, "-std=gnu99", "-c",
+           "-I" + os.path.join(ROOT, "include"), "-I" + os.path.join(ROOT, "driver", "inc"),
+           "-I" + os.path.join(ROOT, "host"), "-DCPU_S32K144HFT0VLLT"] + args.cflags + \
+          [level, "-fno-ipa-icf", "-fno-function-sections",
+           os.path.join(HERE, "reg_access_pairs.c"), "-o", obj]
+    subprocess.run(cmd, check=True)
+    run([args.objcopy, "-O", "binary", "--only-section=.text", obj, text])
+
+    with open(text, "rb") as f:
+        code = f.read()
+    table = functions(args.nm, obj)
+
+    pairs = sorted(name[len("reg_"):] for name in table if name.startswith("reg_"))
+    failed = 0
+    for pair in pairs:
+        hand = table.get("hand_" + pair)
+        reg = table["reg_" + pair]
+        if hand is None:
+            print("%-4s %-16s no hand_%s" % (level, pair, pair))
+            failed += 1
+            continue
+        same = code[reg[0]:reg[0] + reg[1]] == code[hand[0]:hand[0] + hand[1]]
+        print("%-4s %-16s %3d bytes  %s" % (level, pair, reg[1], "same" if same else "DIFFERENT"))
+        if not same:
+            failed += 1
+            sys.stdout.write(disasm(args.objdump, obj, "reg_" + pair))
+            sys.stdout.write(disasm(args.objdump, obj, "hand_" + pair))
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--cc", default=os.environ.get("CC", "gcc"))
+    parser.add_argument("--nm", default="nm")
+    parser.add_argument("--objcopy", default="objcopy")
+    parser.add_argument("--objdump", default="objdump")
+    parser.add_argument("--levels", default=DEFAULT_LEVELS)
+    parser.add_argument("cflags", nargs="*")
+    args = parser.parse_args()
+
+    failed = 0
+    with tempfile.TemporaryDirectory() as workdir:
+        for level in args.levels.split(","):
+            failed += check_level(args, level, workdir)
+
+    print("%d pair(s) differ" % failed if failed else "all pairs identical")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
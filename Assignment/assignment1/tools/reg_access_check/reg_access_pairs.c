@@ -0,0 +1,119 @@
+/**
+ * @file reg_access_pairs.c
+ * @author Ta Tran Dinh Tien (tatrandinhtien@gmail.com)
+ * @brief reg_access.h accesses next to their hand-written single-store form.
+ * @version 0.1
+ * @date 2025-10-30
+ *
+ * Every reg_<name> function has a hand_<name> twin written with the
+ * S32K144.h mask macros only. reg_access_check.py compiles this file and
+ * fails unless each pair disassembles to the same bytes. Only compiled,
+ * never run: the register addresses are the target's.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "../driver/inc/Driver_Common.h"
+#include "../driver/inc/Driver_SCG.h"
+#include "../driver/inc/reg_access.h"
+#include "../include/S32K144.h"
+
+/*******************************************************************************
+ *                                  Prototypes
+ ******************************************************************************/
+
+void reg_rccr_write(void);
+void hand_rccr_write(void);
+void reg_rccr_write_var(uint32_t src, uint32_t div_core);
+void hand_rccr_write_var(uint32_t src, uint32_t div_core);
+void reg_pcr_modify(uint32_t mux);
+void hand_pcr_modify(uint32_t mux);
+void reg_stat_w1c(void);
+void hand_stat_w1c(void);
+uint32_t reg_adc_read(void);
+uint32_t hand_adc_read(void);
+void reg_div_core(uint32_t *pReg, SCG_DIV_CORE_t div_core);
+void hand_div_core(uint32_t *pReg, SCG_DIV_CORE_t div_core);
+void reg_div_slow(uint32_t *pReg, SCG_DIV_SLOW_t div_slow);
+void hand_div_slow(uint32_t *pReg, SCG_DIV_SLOW_t div_slow);
+
+/*******************************************************************************
+ *                                      Code
+ ******************************************************************************/
+
+/* SCG_SPLL_NormalRun_80Mhz() */
+void reg_rccr_write(void)
+{
+    REG_WRITE(IP_SCG->RCCR, SCG_RCCR, (SCS, SCG_SPLL_CLK), (DIVCORE, SCG_DIV_CORE_BY_2),
+              (DIVBUS, SCG_DIV_BUS_BY_2), (DIVSLOW, SCG_DIV_SLOW_BY_3));
+}
+
+void hand_rccr_write(void)
+{
+    IP_SCG->RCCR = SCG_RCCR_SCS(SCG_SPLL_CLK) | SCG_RCCR_DIVCORE(SCG_DIV_CORE_BY_2) |
+                   SCG_RCCR_DIVBUS(SCG_DIV_BUS_BY_2) | SCG_RCCR_DIVSLOW(SCG_DIV_SLOW_BY_3);
+}
+
+void reg_rccr_write_var(uint32_t src, uint32_t div_core)
+{
+    REG_WRITE(IP_SCG->RCCR, SCG_RCCR, (SCS, src), (DIVCORE, div_core));
+}
+
+void hand_rccr_write_var(uint32_t src, uint32_t div_core)
+{
+    IP_SCG->RCCR = SCG_RCCR_SCS(src) | SCG_RCCR_DIVCORE(div_core);
+}
+
+/* ISF is W1C: a read-modify-write must write it as 0 */
+void reg_pcr_modify(uint32_t mux)
+{
+    REG_MODIFY(IP_PORTC->PCR[12], PORT_PCR, (MUX, mux), (PE, 1U));
+}
+
+void hand_pcr_modify(uint32_t mux)
+{
+    IP_PORTC->PCR[12] = (IP_PORTC->PCR[12] & ~(PORT_PCR_ISF_MASK | PORT_PCR_MUX_MASK | PORT_PCR_PE_MASK)) |
+                        PORT_PCR_MUX(mux) | PORT_PCR_PE(1U);
+}
+
+void reg_stat_w1c(void)
+{
+    REG_W1C(IP_LPUART1->STAT, LPUART_STAT, OR, FE);
+}
+
+void hand_stat_w1c(void)
+{
+    IP_LPUART1->STAT = (IP_LPUART1->STAT & ~LPUART_STAT_W1C_MASK) | LPUART_STAT_OR_MASK | LPUART_STAT_FE_MASK;
+}
+
+uint32_t reg_adc_read(void)
+{
+    return REG_READ(IP_ADC0->R[0], ADC_R, D);
+}
+
+uint32_t hand_adc_read(void)
+{
+    return (IP_ADC0->R[0] & ADC_R_D_MASK) >> ADC_R_D_SHIFT;
+}
+
+/* Driver_SCG.c scg_config_system_div_* on the working copy */
+void reg_div_core(uint32_t *pReg, SCG_DIV_CORE_t div_core)
+{
+    REG_MODIFY(*pReg, SCG_RCCR, (DIVCORE, div_core));
+}
+
+void hand_div_core(uint32_t *pReg, SCG_DIV_CORE_t div_core)
+{
+    *pReg = (*pReg & ~SCG_RCCR_DIVCORE_MASK) | SCG_RCCR_DIVCORE(div_core);
+}
+
+void reg_div_slow(uint32_t *pReg, SCG_DIV_SLOW_t div_slow)
+{
+    REG_MODIFY(*pReg, SCG_RCCR, (DIVSLOW, div_slow));
+}
+
+void hand_div_slow(uint32_t *pReg, SCG_DIV_SLOW_t div_slow)
+{
+    *pReg = (*pReg & ~SCG_RCCR_DIVSLOW_MASK) | SCG_RCCR_DIVSLOW(div_slow);
+}
@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+"""Worst-case stack depth per entry point from -fstack-usage and the ELF.
+
+The call graph comes from the disassembly of the ELF (objdump -d): bl, blx to
+a label, branches to another function (tail calls), and blx rN whose register
+was loaded from a literal pool word pointing at a function (the startup code
+calls SystemInit and init_data_bss that way). Frame sizes come from the .su
+files written by gcc -fstack-usage; functions without one (assembly, newlib)
+get the size of their prologue: push, vpush and sub sp.
+
+Entry points are Reset_Handler (thread mode, through main()) and every vector
+of the startup file's __isr_vector table that is not left on DefaultISR. A
+handler's depth includes the exception frame the core pushes (--fpu-frame
+for the extended FPU frame).
+
+Depths marked with a flag are lower bounds:
+  I  an indirect call (function pointer) that could not be resolved; add the
+     edge with --edge CALLER:CALLEE
+  R  recursion, counted once
+  D  dynamic stack allocation (alloca, VLA) reported by gcc
+  ?  a callee without code in the disassembly
+
+The summary adds the deepest handler (no nesting) and all handlers (every
+handler preempting the next) to the thread depth and compares them with the
+stack reserved by the linker script (__StackTop - __StackLimit). The exit
+status is 1 if the no-nesting figure does not fit.
+
+Usage: stack_usage.py ELF [SU ...] [--startup startup_S32K144.S] [--disasm FILE]
+                      [--edge CALLER:CALLEE ...] [--fpu-frame] [--objdump TOOL] [--nm TOOL]
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# Exception entry: 8 words, plus 4 bytes of alignment padding at most
+EXC_FRAME = 32 + 4
+EXC_FRAME_FPU = 104 + 4
+
+FUNC_RE = re.compile(r"^([0-9a-f]+) <([^>]+)>:$")
+INSN_RE = re.compile(r"^\s*([0-9a-f]+):\s+(?:(?:[0-9a-f]{4}\s|[0-9a-f]{8}\s)+)?\s*(\S+)\s*(.*)$")
+TARGET_RE = re.compile(r"^([0-9a-f]+) <([^>+]+)(\+0x[0-9a-f]+)?>")
+LITERAL_RE = re.compile(r"^(r\d+|ip|lr), \[pc, #-?\d+\].*[;@] \(([0-9a-f]+)")
+REGS_RE = re.compile(r"\{([^}]*)\}")
+SUB_SP_RE = re.compile(r"^sp, (?:sp, )?#(\d+)")
+
+BRANCHES = ("b", "b.n", "b.w", "beq", "bne", "bcs", "bcc", "bhs", "blo", "bmi", "bpl", "bvs",
+            "bvc", "bhi", "bls", "bge", "blt", "bgt", "ble", "bal")
+
+
+def reg_count(text):
+    """Number of registers in a {r4-r7, lr} or {d8-d15} list."""
+    count = 0
+    for part in text.split(","):
+        part = part.strip()
+        m = re.fullmatch(r"[rsd](\d+)-[rsd](\d+)", part)
+        count += int(m.group(2)) - int(m.group(1)) + 1 if m else 1
+    return count
+
+
+class Function:
+    def __init__(self, name, address):
+        self.name = name
+        self.address = address
+        self.prologue = 0
+        self.in_prologue = True
+        self.dynamic = False
+        self.calls = set()
+        self.indirect = False
+
+
+def parse_disasm(text):
+    """{name: Function} and {address: name} from objdump -d output."""
+    funcs = {}
+    by_addr = {}
+    words = {}
+    current = None
+    literals = {}
+
+    for line in text.splitlines():
+        m = FUNC_RE.match(line)
+        if m:
+            current = Function(m.group(2), int(m.group(1), 16))
+            funcs.setdefault(current.name, current)
+            by_addr[current.address] = current.name
+            literals = {}
+            continue
+
+        m = INSN_RE.match(line)
+        if current is None or not m:
+            continue
+        address, mnemonic, operands = int(m.group(1), 16), m.group(2), m.group(3).strip()
+
+        if mnemonic == ".word":
+            try:
+                words[address] = int(operands.split()[0], 0)
+            except ValueError:
+                pass
+            continue
+
+        if current.in_prologue:
+            if mnemonic in ("push", "push.w", "stmdb", "stmdb.w") and (mnemonic.startswith("push") or
+                                                                     operands.startswith("sp!")):
+                current.prologue += 4 * reg_count(REGS_RE.search(operands).group(1))
+                continue
+            if mnemonic in ("vpush", "vpush.64", "vstmdb"):
+                regs = REGS_RE.search(operands).group(1)
+                current.prologue += (8 if "d" in regs else 4) * reg_count(regs)
+                continue
+            if mnemonic in ("sub", "sub.w", "subw", "subs") and operands.startswith("sp,"):
+                s = SUB_SP_RE.match(operands)
+                if s:
+                    current.prologue += int(s.group(1))
+                else:
+                    current.dynamic = True
+                continue
+            if mnemonic.startswith("b") or mnemonic.startswith("cb") or mnemonic.startswith("pop"):
+                current.in_prologue = False
+
+        lit = LITERAL_RE.match(operands) if mnemonic.startswith("ldr") else None
+        if lit:
+            literals[lit.group(1)] = int(lit.group(2), 16)
+            continue
+
+        t = TARGET_RE.match(operands)
+        if mnemonic in ("bl", "blx") and t:
+            current.calls.add(t.group(2))
+        elif mnemonic.split(".")[0] in BRANCHES and t and t.group(2) != current.name and not t.group(3):
+            current.calls.add(t.group(2))
+        elif mnemonic == "blx":
+            # Resolved after every literal pool word is known
+            current.calls.add(("literal", literals.get(operands)))
+
+    for f in funcs.values():
+        resolved = set()
+        for callee in f.calls:
+            if isinstance(callee, tuple):
+                value = words.get(callee[1]) if callee[1] is not None else None
+                name = by_addr.get(value & ~1) if value is not None else None
+                if name is None:
+                    f.indirect = True
+                else:
+                    resolved.add(name)
+            else:
+                resolved.add(callee)
+        f.calls = resolved
+
+    return funcs
+
+
+def parse_su(paths):
+    """{function: (bytes, dynamic)} from .su files; the largest of duplicate names."""
+    frames = {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                parts = line.rstrip("\n").split("\t")
+                if len(parts) != 3:
+                    continue
+                name = parts[0].rsplit(":", 1)[-1]
+                size = int(parts[1])
+                dynamic = "dynamic" in parts[2] and "bounded" not in parts[2]
+                old = frames.get(name, (0, False))
+                frames[name] = (max(old[0], size), old[1] or dynamic)
+    return frames
+
+
+def parse_vectors(path):
+    """Handler names of __isr_vector in table order, without the initial SP."""
+    names = []
+    inside = False
+    with open(path) as f:
+        for line in f:
+            if line.startswith("__isr_vector:"):
+                inside = True
+                continue
+            if not inside:
+                continue
+            m = re.match(r"\s*\.long\s+(\w+)", line)
+            if m:
+                # 0 for the reserved entries
+                if not m.group(1)[0].isdigit():
+                    names.append(m.group(1))
+            elif line.strip() and not line.strip().startswith("/*"):
+                break
+    return names[1:]
+
+
+def symbols(nm, elf):
+    out = subprocess.run([nm, elf], check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+    table = {}
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 3:
+            table[parts[2]] = int(parts[0], 16)
+    return table
+
+
+class Graph:
+    def __init__(self, funcs, frames):
+        self.funcs = funcs
+        self.frames = frames
+        self.memo = {}
+
+    def frame(self, name):
+        if name in self.frames:
+            return self.frames[name]
+        f = self.funcs.get(name)
+        return (f.prologue, f.dynamic) if f else (0, False)
+
+    def depth(self, name, stack=()):
+        """(bytes, flags, path) of the deepest call chain from name."""
+        if name in self.memo:
+            return self.memo[name]
+        if name in stack:
+            return 0, {"R"}, []
+
+        f = self.funcs.get(name)
+        size, dynamic = self.frame(name)
+        flags = set()
+        if f is None:
+            flags.add("?")
+        else:
+            if f.indirect:
+                flags.add("I")
+        if dynamic:
+            flags.add("D")
+
+        best = (0, set(), [])
+        for callee in sorted(f.calls) if f else []:
+            d = self.depth(callee, stack + (name,))
+            flags |= d[1]
+            if d[0] > best[0] or not best[2]:
+                best = d
+
+        result = (size + best[0], flags, [name] + best[2])
+        if "R" not in flags:
+            self.memo[name] = result
+        return result
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+    parser = argparse.ArgumentParser(description="Worst-case stack depth per entry point.")
+    parser.add_argument("elf")
+    parser.add_argument("su", nargs="*")
+    parser.add_argument("--startup", default=os.path.join(root, "Project_Settings", "Startup_Code",
+                                                            "startup_S32K144.S"))
+    parser.add_argument("--disasm", help="objdump -d output to use instead of running objdump")
+    parser.add_argument("--edge", action="append", default=[], metavar="CALLER:CALLEE")
+    parser.add_argument("--fpu-frame", action="store_true", help="handlers use the FPU frame")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    args = parser.parse_args()
+
+    if args.disasm:
+        with open(args.disasm) as f:
+            text = f.read()
+    else:
+        text = subprocess.run([args.objdump, "-d", "--no-show-raw-insn", args.elf], check=True,
+                              stdout=subprocess.PIPE, universal_newlines=True).stdout
+
+    funcs = parse_disasm(text)
+    for edge in args.edge:
+        caller, callee = edge.split(":", 1)
+        if caller in funcs:
+            funcs[caller].calls.add(callee)
+            funcs[caller].indirect = False
+
+    graph = Graph(funcs, parse_su(args.su))
+    syms = symbols(args.nm, args.elf)
+    default = syms.get("DefaultISR")
+    exc_frame = EXC_FRAME_FPU if args.fpu_frame else EXC_FRAME
+
+    handlers = []
+    unused = 0
+    for name in parse_vectors(args.startup):
+        if name in ("Reset_Handler", "DefaultISR") or name in (h[0] for h in handlers):
+            continue
+        if syms.get(name) == default:
+            unused += 1
+            continue
+        handlers.append((name,) + graph.depth(name))
+
+    thread = graph.depth("Reset_Handler")
+
+    def row(name, depth, flags, path, extra):
+        chain = " > ".join(path)
+        print("%-32s %6d %-4s %s" % (name, depth + extra, "".join(sorted(flags)) or "-", chain))
+
+    print("%-32s %6s %-4s %s" % ("entry", "bytes", "flag", "deepest path"))
+    row("Reset_Handler (thread)", thread[0], thread[1], thread[2], 0)
+    for name, depth, flags, path in sorted(handlers, key=lambda h: -h[1]):
+        row(name, depth, flags, path, exc_frame)
+    print("%d vectors left on DefaultISR" % unused)
+
+    depths = sorted((h[1] + exc_frame for h in handlers), reverse=True)
+    single = thread[0] + (depths[0] if depths else 0)
+    nested = thread[0] + sum(depths)
+    print()
+    print("thread + deepest handler  %6d" % single)
+    print("thread + all handlers     %6d" % nested)
+
+    status = 0
+    if "__StackTop" in syms and "__StackLimit" in syms:
+        size = syms["__StackTop"] - syms["__StackLimit"]
+        print("stack reserved            %6d  (%+d no nesting, %+d all nested)"
+              % (size, size - single, size - nested))
+        status = 1 if single > size else 0
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
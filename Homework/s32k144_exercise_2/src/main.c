@@ -2,6 +2,10 @@
  * @file s32k144_exercise_2
  * @author tatrandinhtien (tatrandinhtien@gmail.com)
  * @brief  Blink 3 LED: Blue - Red - Green
+ *         LED_USE_PWM = 1: fade through the colour wheel by mixing the three
+ *         LEDs with FTM0 PWM (PTD15 = CH0 red, PTD16 = CH1 green, PTD0 = CH2 blue)
+ *         through the assignment1 Driver_FTM, linked by the CMake build
+ *         (cmake -DLED_USE_PWM=1); the S32DS project builds the GPIO blink.
  * @version 0.1
  * @date 2025-09-20
  *
@@ -13,16 +17,101 @@
 
 #include <stdio.h>
 
+/* 1: PWM colour mixing on FTM0, 0: plain GPIO blink */
+#ifndef LED_USE_PWM
+#define LED_USE_PWM		(0U)
+#endif
+
+#if LED_USE_PWM
+#include "Driver_FTM.h"
+
+/* 1 kHz edge-aligned PWM from SYS_CLK */
+#define PWM_FREQUENCY	(1000U)
+#endif
+
 /* delay prototype */
 void delay(volatile uint32_t time);
+#if LED_USE_PWM
+void FTM0_PWM_Init(void);
+void LED_SetColor(uint8_t red, uint8_t green, uint8_t blue);
+#endif
 
 void delay(volatile uint32_t time)
 {
 	while(time--);
 }
 
+#if LED_USE_PWM
+/**
+ * @brief Route the RGB LED pins to FTM0 CH0..2 and start 1 kHz PWM.
+ *
+ * LEDs are active low, so the channels use low-true pulses. Duty writes are
+ * buffered by the driver and loaded together on a software sync.
+ */
+void FTM0_PWM_Init(void)
+{
+	static const ftm_pwm_channel_config_t channels[] =
+	{
+		{ 0U, FTM_POLARITY_LOW, 0U, false },
+		{ 1U, FTM_POLARITY_LOW, 0U, false },
+		{ 2U, FTM_POLARITY_LOW, 0U, false }
+	};
+	const ftm_pwm_config_t config = { FTM_CLK_SYSTEM, 0U, PWM_FREQUENCY, FTM_ALIGN_EDGE, 0U, channels, 3U };
+
+	IP_PCC->PCCn[PCC_PORTD_INDEX] = PCC_PCCn_CGC_MASK;
+
+	/* ALT2: FTM0 channel */
+	IP_PORTD->PCR[15] = PORT_PCR_MUX(2);
+	IP_PORTD->PCR[16] = PORT_PCR_MUX(2);
+	IP_PORTD->PCR[0] = PORT_PCR_MUX(2);
+
+	(void)FTM_PwmInit(FTM_0, &config);
+}
+
+/**
+ * @brief Set the LED colour, 0..255 per component, glitch free.
+ */
+void LED_SetColor(uint8_t red, uint8_t green, uint8_t blue)
+{
+	static const uint8_t channels[3] = { 0U, 1U, 2U };
+	uint16_t duties[3];
+
+	duties[0] = (uint16_t)((FTM_DUTY_MAX * red) / 255U);
+	duties[1] = (uint16_t)((FTM_DUTY_MAX * green) / 255U);
+	duties[2] = (uint16_t)((FTM_DUTY_MAX * blue) / 255U);
+
+	/* Three buffered writes, one sync */
+	(void)FTM_SetDutySync(FTM_0, channels, duties, 3U);
+}
+#endif
+
 int main()
 {
+#if LED_USE_PWM
+	uint8_t step = 0;
+
+	FTM0_PWM_Init();
+
+	while(1)
+	{
+		/* Red -> Green -> Blue -> Red, two components mixed at a time */
+		if (step < 85U)
+		{
+			LED_SetColor((uint8_t)(255U - (step * 3U)), (uint8_t)(step * 3U), 0);
+		}
+		else if (step < 170U)
+		{
+			LED_SetColor(0, (uint8_t)(255U - ((step - 85U) * 3U)), (uint8_t)((step - 85U) * 3U));
+		}
+		else
+		{
+			LED_SetColor((uint8_t)((step - 170U) * 3U), 0, (uint8_t)(255U - ((step - 170U) * 3U)));
+		}
+
+		step = (step < 254U) ? (uint8_t)(step + 1U) : 0U;
+		delay(100000);
+	}
+#else
 	/* Clock Port D*/
 	IP_PCC->PCCn[PCC_PORTD_INDEX] = PCC_PCCn_CGC_MASK;
 
@@ -62,6 +151,7 @@ int main()
 		delay(10000000);
 
 	}
+#endif
 
 	return 0;
 }
@@ -5,6 +5,10 @@
  *        - Initializes System Oscillator (SOSC), PORTs/GPIO and ADC.
  *        - Reads potentiometer value via ADC and controls 3 LEDs
  *          (red, green, blue) based on the voltage level.
+ *        - LED_USE_PWM = 1: the voltage instead mixes the colour continuously
+ *          (blue -> green -> red) with FTM0 PWM on the LED pins, through the
+ *          assignment1 Driver_FTM linked by the CMake build
+ *          (cmake -DLED_USE_PWM=1); the S32DS project builds the GPIO version.
  * @version 0.1
  * @date 2025-10-08
  *
@@ -14,6 +18,22 @@
 
 #include "S32K144.h"
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* 1: PWM colour mixing on FTM0, 0: threshold GPIO control */
+#ifndef LED_USE_PWM
+#define LED_USE_PWM     (0U)
+#endif
+
+#if LED_USE_PWM
+#include "Driver_FTM.h"
+
+/* 1 kHz edge-aligned PWM from SYS_CLK */
+#define PWM_FREQUENCY   (1000U)
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -22,6 +42,10 @@ void PORT_Init(void);
 void GPIO_Init(void);
 void ADC_Init(void);
 uint16_t ADC_Read(uint8_t channel);
+#if LED_USE_PWM
+void FTM0_PWM_Init(void);
+void LED_SetColor(uint8_t red, uint8_t green, uint8_t blue);
+#endif
 
 /*******************************************************************************
  * Code
@@ -69,16 +93,13 @@ void PORT_Init()
     IP_PCC->PCCn[PCC_PORTA_INDEX] = PCC_PCCn_CGC(1);
 
     /*Choose GPIO mode for PTD0 - Blue LED*/
-    IP_PORTD->PCR[0] &= ~PORT_PCR_MUX_MASK;
-    IP_PORTD->PCR[0]  = (1U << PORT_PCR_MUX_SHIFT);
+    IP_PORTD->PCR[0] = PORT_PCR_MUX(1U);
 
     /*Choose GPIO mode for PTD16 - Green LED*/
-    IP_PORTD->PCR[16] &= ~PORT_PCR_MUX_MASK;
-    IP_PORTD->PCR[16] = (1U << PORT_PCR_MUX_SHIFT);
+    IP_PORTD->PCR[16] = PORT_PCR_MUX(1U);
 
     /*Choose GPIO mode for PTD15 - Red LED*/
-    IP_PORTD->PCR[15] &= ~PORT_PCR_MUX_MASK;
-    IP_PORTD->PCR[15] = (1U << PORT_PCR_MUX_SHIFT);
+    IP_PORTD->PCR[15] = PORT_PCR_MUX(1U);
 
     /*Choose Analog mode for PTA6 - Potentiometer*/
     IP_PORTA->PCR[6] &= ~PORT_PCR_MUX_MASK;
@@ -144,6 +165,52 @@ uint16_t ADC_Read(uint8_t channel)
     return (uint16_t)IP_ADC0->R[0];
 }
 
+#if LED_USE_PWM
+/**
+ * @brief Route the LED pins to FTM0 and start 1 kHz PWM.
+ *
+ * PTD15 = FTM0_CH0 (red), PTD16 = FTM0_CH1 (green), PTD0 = FTM0_CH2 (blue),
+ * all ALT2. LEDs are active low, so the channels use low-true pulses. Duty
+ * writes are buffered by the driver and loaded together on a software sync.
+ */
+void FTM0_PWM_Init(void)
+{
+    static const ftm_pwm_channel_config_t channels[] =
+    {
+        { 0U, FTM_POLARITY_LOW, 0U, false },
+        { 1U, FTM_POLARITY_LOW, 0U, false },
+        { 2U, FTM_POLARITY_LOW, 0U, false }
+    };
+    const ftm_pwm_config_t config = { FTM_CLK_SYSTEM, 0U, PWM_FREQUENCY, FTM_ALIGN_EDGE, 0U, channels, 3U };
+
+    /*Choose FTM0 channel mode (ALT2) for the LED pins*/
+    IP_PORTD->PCR[15] = PORT_PCR_MUX(2);
+    IP_PORTD->PCR[16] = PORT_PCR_MUX(2);
+    IP_PORTD->PCR[0]  = PORT_PCR_MUX(2);
+
+    /*FTM0 clock gate, period and channels, LEDs off*/
+    (void)FTM_PwmInit(FTM_0, &config);
+}
+
+/**
+ * @brief Set the LED colour (0..255 per component) without glitches.
+ *
+ * One buffered duty write per channel, then a single software sync so the
+ * three channels change in the same PWM period.
+ */
+void LED_SetColor(uint8_t red, uint8_t green, uint8_t blue)
+{
+    static const uint8_t channels[3] = { 0U, 1U, 2U };
+    uint16_t duties[3];
+
+    duties[0] = (uint16_t)((FTM_DUTY_MAX * red) / 255U);
+    duties[1] = (uint16_t)((FTM_DUTY_MAX * green) / 255U);
+    duties[2] = (uint16_t)((FTM_DUTY_MAX * blue) / 255U);
+
+    (void)FTM_SetDutySync(FTM_0, channels, duties, 3U);
+}
+#endif
+
 int main(void)
 {
     PORT_Init();
@@ -153,6 +220,30 @@ int main(void)
 
     uint16_t adc_value, voltage;
 
+#if LED_USE_PWM
+    uint8_t level;
+
+    FTM0_PWM_Init();
+
+    while (1)
+    {
+        adc_value = ADC_Read(2);
+        voltage = (adc_value * 5000U) / 4095U;
+
+        if (voltage < 2500)
+        {
+            /*0 V blue, 2.5 V green*/
+            level = (uint8_t)((voltage * 255U) / 2500U);
+            LED_SetColor(0, level, (uint8_t)(255U - level));
+        }
+        else
+        {
+            /*2.5 V green, 5 V red*/
+            level = (uint8_t)(((voltage - 2500U) * 255U) / 2500U);
+            LED_SetColor(level, (uint8_t)(255U - level), 0);
+        }
+    }
+#else
     while (1)
     {
         adc_value = ADC_Read(2);
@@ -180,6 +271,7 @@ int main(void)
             /*Do nothing*/
         }
     }
+#endif
 
     return 0;
 }
@@ -0,0 +1,109 @@
+################################################################################
+# Build types, common flags and the image rule shared by the three projects.
+################################################################################
+
+include(CheckIPOSupported)
+
+set(S32K144_BUILD_TYPES Debug Release Speed MinSizeRel)
+if(NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Debug CACHE STRING "Build type" FORCE)
+endif()
+set_property(CACHE CMAKE_BUILD_TYPE PROPERTY STRINGS ${S32K144_BUILD_TYPES})
+if(NOT CMAKE_BUILD_TYPE IN_LIST S32K144_BUILD_TYPES)
+    message(FATAL_ERROR "CMAKE_BUILD_TYPE must be one of: ${S32K144_BUILD_TYPES}")
+endif()
+
+set(S32K144_IMAGE FLASH CACHE STRING "Images run from FLASH or RAM")
+set_property(CACHE S32K144_IMAGE PROPERTY STRINGS FLASH RAM)
+
+# -g keeps the map and reports symbolic; it does not change the code
+foreach(lang C ASM)
+    set(CMAKE_${lang}_FLAGS_DEBUG      "-O0 -g3")
+    set(CMAKE_${lang}_FLAGS_RELEASE    "-O2 -g")
+    set(CMAKE_${lang}_FLAGS_SPEED      "-O3 -g")
+    set(CMAKE_${lang}_FLAGS_MINSIZEREL "-Os -g")
+endforeach()
+set(CMAKE_EXE_LINKER_FLAGS_SPEED "")
+set(CMAKE_STATIC_LINKER_FLAGS_SPEED "")
+
+check_ipo_supported(RESULT S32K144_LTO OUTPUT S32K144_LTO_ERROR LANGUAGES C)
+if(S32K144_LTO)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION_RELEASE ON)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION_SPEED ON)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION_MINSIZEREL ON)
+else()
+    message(WARNING "No LTO with this toolchain: ${S32K144_LTO_ERROR}")
+endif()
+
+add_compile_definitions(CPU_S32K144HFT0VLLT)
+add_compile_options(
+    -Wall
+    -fmessage-length=0
+    -ffunction-sections
+    -fdata-sections
+    $<$<COMPILE_LANGUAGE:C>:-fstack-usage>
+)
+# With LTO the code is generated at link time, so -fstack-usage goes there too
+add_link_options(-Wl,--gc-sections -fstack-usage)
+
+find_package(Python3 COMPONENTS Interpreter)
+if(NOT CMAKE_SIZE)
+    find_program(CMAKE_SIZE size)
+endif()
+
+set(S32K144_REPORT_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/firmware_report.py)
+
+#
+# s32k144_firmware(<name> PROJECT_DIR <dir> SOURCES <src>... [LIBRARIES <lib>...]
+#                  [LINKER_SCRIPT <ld>])
+#
+# <name>.elf from the project sources plus its Project_Settings/Startup_Code,
+# linked with its Project_Settings/Linker_Files/S32K144_64_flash.ld (or _ram.ld
+# for S32K144_IMAGE=RAM) unless LINKER_SCRIPT is given. Cross builds only.
+#
+function(s32k144_firmware name)
+    cmake_parse_arguments(FW "" "PROJECT_DIR;LINKER_SCRIPT" "SOURCES;LIBRARIES" ${ARGN})
+
+    if(NOT CMAKE_CROSSCOMPILING)
+        message(STATUS "${name}: board image skipped, configure with cmake/arm-none-eabi.cmake")
+        return()
+    endif()
+
+    set(startup ${FW_PROJECT_DIR}/Project_Settings/Startup_Code)
+    if(NOT FW_LINKER_SCRIPT)
+        string(TOLOWER ${S32K144_IMAGE} image)
+        set(FW_LINKER_SCRIPT ${FW_PROJECT_DIR}/Project_Settings/Linker_Files/S32K144_64_${image}.ld)
+    endif()
+
+    add_executable(${name}
+        ${FW_SOURCES}
+        ${startup}/startup.c
+        ${startup}/system_S32K144.c
+        ${startup}/startup_S32K144.S
+    )
+    set_target_properties(${name} PROPERTIES SUFFIX .elf LINK_DEPENDS ${FW_LINKER_SCRIPT})
+    target_include_directories(${name} PRIVATE ${FW_PROJECT_DIR}/include)
+    if(S32K144_IMAGE STREQUAL "FLASH")
+        target_compile_definitions(${name} PRIVATE $<$<COMPILE_LANGUAGE:ASM>:START_FROM_FLASH>)
+    endif()
+    target_link_options(${name} PRIVATE
+        -T ${FW_LINKER_SCRIPT}
+        -Wl,-Map,$<TARGET_FILE_DIR:${name}>/${name}.map
+        -n
+    )
+    target_link_libraries(${name} PRIVATE ${FW_LIBRARIES})
+
+    set(report ${S32K144_REPORT_SCRIPT} $<TARGET_FILE:${name}>
+        --nm ${CMAKE_NM} --su-dir ${CMAKE_CURRENT_BINARY_DIR}
+        --out $<TARGET_FILE_DIR:${name}>/${name})
+    add_custom_command(TARGET ${name} POST_BUILD
+        COMMAND ${CMAKE_SIZE} $<TARGET_FILE:${name}>
+        COMMAND ${Python3_EXECUTABLE} ${report}
+        VERBATIM
+    )
+    add_custom_target(${name}_report
+        COMMAND ${Python3_EXECUTABLE} ${report} --print
+        DEPENDS ${name}
+        VERBATIM
+    )
+endfunction()
@@ -0,0 +1,34 @@
+################################################################################
+# Cross toolchain for the S32K144 (Cortex-M4) images: GNU Arm Embedded, as
+# bundled with S32DS. Put its bin/ on PATH or set ARM_NONE_EABI_ROOT.
+#
+# The CPU and specs flags are those of the S32DS projects (src/main.args).
+################################################################################
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(ARM_NONE_EABI_ROOT "$ENV{ARM_NONE_EABI_ROOT}" CACHE PATH "GNU Arm Embedded toolchain root (empty: PATH)")
+if(ARM_NONE_EABI_ROOT)
+    set(ARM_NONE_EABI_PREFIX "${ARM_NONE_EABI_ROOT}/bin/arm-none-eabi-")
+else()
+    set(ARM_NONE_EABI_PREFIX "arm-none-eabi-")
+endif()
+
+set(CMAKE_C_COMPILER   ${ARM_NONE_EABI_PREFIX}gcc)
+set(CMAKE_ASM_COMPILER ${ARM_NONE_EABI_PREFIX}gcc)
+set(CMAKE_AR           ${ARM_NONE_EABI_PREFIX}gcc-ar CACHE FILEPATH "")
+set(CMAKE_RANLIB       ${ARM_NONE_EABI_PREFIX}gcc-ranlib CACHE FILEPATH "")
+set(CMAKE_NM           ${ARM_NONE_EABI_PREFIX}gcc-nm CACHE FILEPATH "")
+set(CMAKE_OBJCOPY      ${ARM_NONE_EABI_PREFIX}objcopy CACHE FILEPATH "")
+set(CMAKE_SIZE         ${ARM_NONE_EABI_PREFIX}size CACHE FILEPATH "")
+
+set(CMAKE_C_FLAGS_INIT   "-mcpu=cortex-m4 -specs=rdimon.specs")
+set(CMAKE_ASM_FLAGS_INIT "-mcpu=cortex-m4 -specs=rdimon.specs")
+
+# No crt0/semihosting link for the compiler checks
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Per-symbol size and per-function stack usage reports of a linked image.
+
+Writes <out>_symbols.txt (every sized symbol of the ELF, largest first, with
+totals per kind) and <out>_stack.txt (the -fstack-usage figures of every
+function that made it into the ELF, largest first).
+
+With LTO the code is generated at link time and GCC writes the stack usage
+next to the image as <elf>.ltrans*.su; those are used when present. Otherwise
+the per-object .su files under --su-dir are used.
+
+Usage: firmware_report.py ELF --out PREFIX [--nm NM] [--su-dir DIR] [--print]
+"""
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+
+# nm symbol types, lower case for local symbols
+KINDS = {"t": "code", "w": "code", "r": "rodata", "d": "data", "b": "bss"}
+
+
+def read_symbols(nm, elf):
+    """[(size, kind, name)] of every symbol with a size."""
+    out = subprocess.run([nm, "-S", "--size-sort", elf], check=True,
+                         stdout=subprocess.PIPE, universal_newlines=True).stdout
+    symbols = []
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) != 4:
+            continue
+        _, size, sym_type, name = fields
+        symbols.append((int(size, 16), KINDS.get(sym_type.lower(), sym_type), name))
+    symbols.sort(key=lambda s: (-s[0], s[2]))
+    return symbols
+
+
+def read_stack_usage(elf, su_dir):
+    """[(bytes, qualifier, function, location)] from the .su files of the image."""
+    files = sorted(glob.glob(elf + ".ltrans*.su"))
+    if not files and su_dir:
+        files = sorted(glob.glob(os.path.join(su_dir, "**", "*.su"), recursive=True))
+
+    usage = []
+    for path in files:
+        with open(path) as f:
+            for line in f:
+                fields = line.rstrip("\n").split("\t")
+                if len(fields) != 3:
+                    continue
+                location, function = fields[0].rsplit(":", 1)
+                usage.append((int(fields[1]), fields[2], function, location))
+    return usage
+
+
+def write_symbols(path, symbols):
+    totals = {}
+    for size, kind, _ in symbols:
+        totals[kind] = totals.get(kind, 0) + size
+
+    with open(path, "w") as f:
+        f.write("# total bytes per kind\n")
+        for kind in sorted(totals, key=lambda k: -totals[k]):
+            f.write("# %-10s %8d\n" % (kind, totals[kind]))
+        f.write("#\n# %8s  %-8s %s\n" % ("bytes", "kind", "symbol"))
+        for size, kind, name in symbols:
+            f.write("%10d  %-8s %s\n" % (size, kind, name))
+
+
+def write_stack(path, usage):
+    with open(path, "w") as f:
+        f.write("# %8s  %-16s %-32s %s\n" % ("bytes", "qualifier", "function", "location"))
+        for entry in usage:
+            f.write("%10d  %-16s %-32s %s\n" % entry)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("elf")
+    parser.add_argument("--out", required=True, help="report file prefix")
+    parser.add_argument("--nm", default="nm")
+    parser.add_argument("--su-dir", help="where the objects' .su files are")
+    parser.add_argument("--print", action="store_true", help="also print both reports")
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.nm, args.elf)
+
+    # Functions removed by --gc-sections or inlined away are not in the image
+    linked = set(name for _, kind, name in symbols if kind == "code")
+    usage = [u for u in read_stack_usage(args.elf, args.su_dir) if u[2] in linked]
+    usage.sort(key=lambda u: (-u[0], u[2]))
+
+    write_symbols(args.out + "_symbols.txt", symbols)
+    write_stack(args.out + "_stack.txt", usage)
+
+    if args.print:
+        for suffix in ("_symbols.txt", "_stack.txt"):
+            with open(args.out + suffix) as f:
+                sys.stdout.write("==> %s%s\n%s\n" % (os.path.basename(args.out), suffix, f.read()))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())